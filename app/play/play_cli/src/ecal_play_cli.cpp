@@ -183,6 +183,12 @@ void printMeasurementInformation(std::shared_ptr<EcalPlay> ecal_player)
             << std::endl;
   std::cout << "  Length:          " << std::chrono::duration_cast<std::chrono::duration<double>>(ecal_player->GetMeasurementLength()).count() << " s" << std::endl;
 
+  // Measurement I/O
+  auto prefetch_statistics = ecal_player->GetPrefetchStatistics();
+  std::cout << "  Read ahead:      " << prefetch_statistics.buffered_frame_count_ << " frames (" << (prefetch_statistics.buffered_bytes_ / 1024) << " KiB)" << std::endl;
+  std::cout << "  Waited for I/O:  " << prefetch_statistics.io_wait_count_ << " of " << prefetch_statistics.published_frame_count_ << " frames ("
+            << std::chrono::duration_cast<std::chrono::milliseconds>(prefetch_statistics.io_wait_time_).count() << " ms)" << std::endl;
+
   std::cout << std::endl;
 
   // Channel Information
@@ -263,6 +269,9 @@ int main(int argc, char *argv[])
   TCLAP::SwitchArg             repeat_arg                ("r", "repeat",                 "Repeat playback from the beginning if the end has been reached",                                                                                         false);
   TCLAP::ValueArg<double>      limit_interval_start_arg  ("l", "limit-interval-start",   "Start the playback from this time (relative value in seconds, 0.0 indicates the begin of the measurement)",                                              false, -1.0, "double");
   TCLAP::ValueArg<double>      limit_interval_end_arg    ("e", "limit-interval-end",     "End the playback at this time (relative value in seconds)",                                                                                              false, -1.0, "double");
+  TCLAP::SwitchArg             frame_table_cache_arg     ("",  "frame-table-cache",      "Cache the frame table in the measurement directory, so loading the measurement again is faster",                                                         false);
+  TCLAP::ValueArg<double>      prefetch_time_arg         ("",  "prefetch-time",          "Measurement time span (in seconds) that is read ahead of the playback. 0 disables this limit. Default: 0.5",                                            false, 0.5, "double");
+  TCLAP::ValueArg<unsigned int> prefetch_size_arg        ("",  "prefetch-size",          "Payload size (in MiB) that is read ahead of the playback. 0 disables this limit. If both limits are 0, frames are read right before publishing them. Default: 64", false, 64, "MiB");
 
   TCLAP::SwitchArg             interactive_arg           ("i", "interactive",            "Just start the Player and dont exit. The user can interactively use the player or control it with the eCAL Service API.",                                false);
 
@@ -277,6 +286,9 @@ int main(int argc, char *argv[])
     &repeat_arg,
     &limit_interval_start_arg,
     &limit_interval_end_arg,
+    &frame_table_cache_arg,
+    &prefetch_time_arg,
+    &prefetch_size_arg,
     &interactive_arg,
   };
   
@@ -344,6 +356,11 @@ int main(int argc, char *argv[])
   //// Apply command line                                                   ////
   //////////////////////////////////////////////////////////////////////////////
 
+  if (frame_table_cache_arg.isSet())
+  {
+    ecal_player->SetFrameTableCacheEnabled(frame_table_cache_arg.getValue());
+  }
+
   if (measurement_path_arg.isSet())
   {
     bool success = ecal_player->LoadMeasurement(measurement_path_arg.getValue());
@@ -384,6 +401,16 @@ int main(int argc, char *argv[])
     ecal_player->SetRepeatEnabled(repeat_arg.getValue());
   }
 
+  if (prefetch_time_arg.isSet())
+  {
+    ecal_player->SetPrefetchLookAheadTime(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(std::max(0.0, prefetch_time_arg.getValue()))));
+  }
+
+  if (prefetch_size_arg.isSet())
+  {
+    ecal_player->SetPrefetchLookAheadSize(static_cast<size_t>(prefetch_size_arg.getValue()) * 1024 * 1024);
+  }
+
   if (limit_interval_start_arg.isSet() || limit_interval_end_arg.isSet())
   {
     auto limit_interval = ecal_player->GetMeasurementBoundaries();
@@ -48,6 +48,9 @@ void EcalPlayService::GetConfig(::google::protobuf::RpcController*        /*cont
   (*config_item_map)["frame_dropping_allowed"]        = (ecal_player_->IsFrameDroppingAllowed()        ? "true" : "false");
   (*config_item_map)["enforce_delay_accuracy"]        = (ecal_player_->IsEnforceDelayAccuracyEnabled() ? "true" : "false");
   (*config_item_map)["repeat"]                        = (ecal_player_->IsRepeatEnabled()               ? "true" : "false");
+  (*config_item_map)["frame_table_cache"]             = (ecal_player_->IsFrameTableCacheEnabled()      ? "true" : "false");
+  (*config_item_map)["prefetch_look_ahead_secs"]      = std::to_string(std::chrono::duration_cast<std::chrono::duration<double>>(ecal_player_->GetPrefetchLookAheadTime()).count());
+  (*config_item_map)["prefetch_look_ahead_mib"]       = std::to_string(ecal_player_->GetPrefetchLookAheadSize() / (1024 * 1024));
 
   auto measurement_boundaries = ecal_player_->GetMeasurementBoundaries();
   auto limit_interval_indices = ecal_player_->GetLimitInterval();
@@ -71,6 +74,16 @@ void EcalPlayService::SetConfig(::google::protobuf::RpcController*        /*cont
 
   char decimal_point = std::localeconv()->decimal_point[0]; // decimal point for std::stod()
 
+  //////////////////////////////////////
+  // frame_table_cache                //
+  //////////////////////////////////////
+  // Applied to the measurement that is loaded below
+  if (config_item_map.find("frame_table_cache") != config_item_map.end())
+  {
+    bool frame_table_cache = strToBool(config_item_map["frame_table_cache"]);
+    ecal_player_->SetFrameTableCacheEnabled(frame_table_cache);
+  }
+
   //////////////////////////////////////
   // measurement path                 //
   //////////////////////////////////////
@@ -210,6 +223,48 @@ void EcalPlayService::SetConfig(::google::protobuf::RpcController*        /*cont
     ecal_player_->SetRepeatEnabled(repeat);
   }
 
+  //////////////////////////////////////
+  // prefetch_look_ahead_secs         //
+  //////////////////////////////////////
+  if (config_item_map.find("prefetch_look_ahead_secs") != config_item_map.end())
+  {
+    std::string look_ahead_string = config_item_map["prefetch_look_ahead_secs"];
+    std::replace(look_ahead_string.begin(), look_ahead_string.end(), '.', decimal_point);
+    double look_ahead_secs = 0.0;
+    try
+    {
+      look_ahead_secs = std::stod(look_ahead_string);
+    }
+    catch (const std::exception& e)
+    {
+      response->set_result(eCAL::pb::play::eServiceResult::failed);
+      response->set_error("Error parsing value \"" + look_ahead_string + "\": " + e.what());
+      return;
+    }
+    look_ahead_secs = std::max(0.0, look_ahead_secs);
+    ecal_player_->SetPrefetchLookAheadTime(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(look_ahead_secs)));
+  }
+
+  //////////////////////////////////////
+  // prefetch_look_ahead_mib          //
+  //////////////////////////////////////
+  if (config_item_map.find("prefetch_look_ahead_mib") != config_item_map.end())
+  {
+    std::string look_ahead_string = config_item_map["prefetch_look_ahead_mib"];
+    unsigned long long look_ahead_mib = 0;
+    try
+    {
+      look_ahead_mib = std::stoull(look_ahead_string);
+    }
+    catch (const std::exception& e)
+    {
+      response->set_result(eCAL::pb::play::eServiceResult::failed);
+      response->set_error("Error parsing value \"" + look_ahead_string + "\": " + e.what());
+      return;
+    }
+    ecal_player_->SetPrefetchLookAheadSize(static_cast<size_t>(look_ahead_mib * 1024 * 1024));
+  }
+
   // Return success
   response->set_result(eCAL::pb::play::eServiceResult::success);
 }
@@ -512,6 +512,49 @@ public:
    */
   void SetEnforceDelayAccuracyEnabled(bool enabled) const;
 
+  /**
+   * @brief Cache the frame table of measurements in their directory
+   *
+   * If enabled, the frame table (i.e. the list of all frames sorted by their
+   * timestamps) is written to a file in the measurement directory when a
+   * measurement is loaded. When the measurement is loaded again, the table is
+   * mapped from that file instead of being rebuilt, as long as the
+   * measurement has not changed. This speeds up loading huge measurements.
+   *
+   * The setting is applied to the next measurement that is loaded.
+   *
+   * The default value is @code{false}.
+   *
+   * @param enabled    Whether the frame table should be cached
+   */
+  void SetFrameTableCacheEnabled(bool enabled) const;
+
+  /**
+   * @brief Sets the measurement time span that is read ahead of the playback
+   *
+   * The upcoming frames are read from the measurement on an I/O thread, so
+   * the player does not have to wait for the measurement when publishing
+   * them. The read-ahead stops, when either the time span or the size set by
+   * @see{SetPrefetchLookAheadSize} is reached. A value of 0 disables this
+   * limit. If both are 0, the frames are read right before publishing them.
+   *
+   * The default value is 500ms.
+   *
+   * @param look_ahead_time    The measurement time span to read ahead
+   */
+  void SetPrefetchLookAheadTime(std::chrono::nanoseconds look_ahead_time) const;
+
+  /**
+   * @brief Sets the payload size that is read ahead of the playback
+   *
+   * See @see{SetPrefetchLookAheadTime}.
+   *
+   * The default value is 64 MiB.
+   *
+   * @param look_ahead_size    The payload size to read ahead in bytes
+   */
+  void SetPrefetchLookAheadSize(size_t look_ahead_size) const;
+
   /**
    * @brief Checks whether the player starts from the beginning, if the measurement end has been reached
    * The default value is @code{false}.
@@ -591,6 +634,24 @@ public:
    */
   bool IsEnforceDelayAccuracyEnabled() const;
 
+  /**
+   * @brief Checks whether the frame table of measurements is cached in their directory
+   * @return Whether the frame table is cached
+   */
+  bool IsFrameTableCacheEnabled() const;
+
+  /**
+   * @brief Gets the measurement time span that is read ahead of the playback
+   * @return The measurement time span that is read ahead
+   */
+  std::chrono::nanoseconds GetPrefetchLookAheadTime() const;
+
+  /**
+   * @brief Gets the payload size that is read ahead of the playback
+   * @return The payload size in bytes that is read ahead
+   */
+  size_t GetPrefetchLookAheadSize() const;
+
   //////////////////////////////////////////////////////////////////////////////
   //// Playback                                                             ////
   //////////////////////////////////////////////////////////////////////////////
@@ -798,6 +859,16 @@ public:
    */
   EcalPlayState GetCurrentPlayState() const;
 
+  /**
+   * @brief Returns the statistics of reading frames ahead of the playback
+   *
+   * The statistics tell how often the playback had to wait for the
+   * measurement I/O. They are reset when a new measurement is loaded.
+   *
+   * @return The read-ahead statistics of the current measurement
+   */
+  EcalPlayPrefetchStatistics GetPrefetchStatistics() const;
+
   /**
    * @brief Checks whether the playback is running
    * @return True if the playback is running
@@ -61,3 +61,19 @@ struct EcalPlayState
     return !operator==(other);
   }
 };
+
+/**
+ * @brief Statistics of the read-ahead of frames from the measurement
+ *
+ * Frames are read from the measurement on an I/O thread ahead of the playback.
+ * Whenever the next frame has not been read in time, the player has to wait
+ * for the measurement I/O.
+ */
+struct EcalPlayPrefetchStatistics
+{
+  long long                published_frame_count_  = 0;                         /**< Number of frames that have been read for publishing */
+  long long                io_wait_count_          = 0;                         /**< Number of frames the player had to wait for, because they had not been read from the measurement in time */
+  std::chrono::nanoseconds io_wait_time_           = std::chrono::nanoseconds(0); /**< Accumulated time the player has waited for the measurement I/O */
+  long long                buffered_frame_count_   = 0;                         /**< Number of frames that are currently read ahead */
+  size_t                   buffered_bytes_         = 0;                         /**< Payload size of the frames that are currently read ahead */
+};
@@ -478,6 +478,21 @@ void EcalPlay::SetEnforceDelayAccuracyEnabled(bool enabled) const
   play_thread_->SetEnforceDelayAccuracyEnabled(enabled);
 }
 
+void EcalPlay::SetFrameTableCacheEnabled(bool enabled) const
+{
+  play_thread_->SetFrameTableCacheEnabled(enabled);
+}
+
+void EcalPlay::SetPrefetchLookAheadTime(std::chrono::nanoseconds look_ahead_time) const
+{
+  play_thread_->SetPrefetchLookAheadTime(look_ahead_time);
+}
+
+void EcalPlay::SetPrefetchLookAheadSize(size_t look_ahead_size) const
+{
+  play_thread_->SetPrefetchLookAheadSize(look_ahead_size);
+}
+
 bool EcalPlay::SetLimitInterval(const std::pair<long long, long long>& limit_interval) const
 {
   return play_thread_->SetLimitInterval(limit_interval);
@@ -513,6 +528,21 @@ bool EcalPlay::IsEnforceDelayAccuracyEnabled() const
   return play_thread_->IsEnforceDelayAccuracyEnabled();
 }
 
+bool EcalPlay::IsFrameTableCacheEnabled() const
+{
+  return play_thread_->IsFrameTableCacheEnabled();
+}
+
+std::chrono::nanoseconds EcalPlay::GetPrefetchLookAheadTime() const
+{
+  return play_thread_->GetPrefetchLookAheadTime();
+}
+
+size_t EcalPlay::GetPrefetchLookAheadSize() const
+{
+  return play_thread_->GetPrefetchLookAheadSize();
+}
+
 std::pair<long long, long long> EcalPlay::GetLimitInterval() const
 {
   return play_thread_->GetLimitInterval();
@@ -594,6 +624,11 @@ EcalPlayState EcalPlay::GetCurrentPlayState() const
 
 }
 
+EcalPlayPrefetchStatistics EcalPlay::GetPrefetchStatistics() const
+{
+  return play_thread_->GetPrefetchStatistics();
+}
+
 bool EcalPlay::IsPlaying() const
 {
   return play_thread_->IsPlaying();
@@ -0,0 +1,284 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_prefetcher.h"
+
+#include <algorithm>
+
+#include "measurement_container.h"
+
+const std::chrono::nanoseconds FramePrefetcher::DEFAULT_LOOK_AHEAD_TIME = std::chrono::milliseconds(500);
+
+FramePrefetcher::FramePrefetcher(const MeasurementContainer& measurement)
+  : InterruptibleThread()
+  , measurement_          (measurement)
+  , look_ahead_time_      (DEFAULT_LOOK_AHEAD_TIME)
+  , look_ahead_size_      (DEFAULT_LOOK_AHEAD_SIZE)
+  , active_               (false)
+  , generation_           (0)
+  , repeat_from_beginning_(false)
+  , limit_interval_       (-1LL, -1LL)
+  , next_read_index_      (-1)
+  , reading_index_        (-1)
+  , last_read_index_      (-1)
+  , buffered_bytes_       (0)
+  , buffered_time_        (0)
+  , published_frame_count_(0)
+  , io_wait_count_        (0)
+  , io_wait_time_         (0)
+{}
+
+FramePrefetcher::~FramePrefetcher()
+{
+  Interrupt();
+  Join();
+}
+
+void FramePrefetcher::Interrupt()
+{
+  {
+    // Lock the mutex, so the interrupt cannot get lost between checking the predicate and waiting
+    std::lock_guard<std::mutex> lock(mutex_);
+    InterruptibleThread::Interrupt();
+  }
+  frame_read_cv_.notify_all();
+  frame_taken_cv_.notify_all();
+}
+
+void FramePrefetcher::SetLookAhead(std::chrono::nanoseconds look_ahead_time, size_t look_ahead_size)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    look_ahead_time_ = std::max(look_ahead_time, std::chrono::nanoseconds(0));
+    look_ahead_size_ = look_ahead_size;
+  }
+  frame_taken_cv_.notify_all();
+}
+
+std::chrono::nanoseconds FramePrefetcher::GetLookAheadTime()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return look_ahead_time_;
+}
+
+size_t FramePrefetcher::GetLookAheadSize()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return look_ahead_size_;
+}
+
+bool FramePrefetcher::GetFrame(long long index, bool repeat_from_beginning, std::pair<long long, long long> limit_interval, std::vector<char>& data)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  published_frame_count_++;
+
+  if ((look_ahead_time_ == std::chrono::nanoseconds(0)) && (look_ahead_size_ == 0))
+  {
+    // Reading ahead is disabled, so we always have to wait for the measurement
+    active_ = false;
+    generation_++;
+    while (!frames_.empty())
+      PopFrame_Private(nullptr);
+
+    io_wait_count_++;
+    lock.unlock();
+
+    auto wait_start = std::chrono::steady_clock::now();
+    bool success = measurement_.ReadFrameData(index, data);
+    auto wait_time = std::chrono::steady_clock::now() - wait_start;
+
+    lock.lock();
+    io_wait_time_ += std::chrono::duration_cast<std::chrono::nanoseconds>(wait_time);
+    return success;
+  }
+
+  if (!active_
+    || (repeat_from_beginning != repeat_from_beginning_)
+    || (limit_interval != limit_interval_))
+  {
+    Restart_Private(index, repeat_from_beginning, limit_interval);
+  }
+  else
+  {
+    auto frame_it = std::find_if(frames_.begin(), frames_.end(), [index](const PrefetchedFrame& frame) { return frame.index_ == index; });
+
+    if ((frame_it != frames_.end())
+      || (reading_index_ == index)
+      || ((reading_index_ < 0) && (next_read_index_ == index)))
+    {
+      // Discard the frames that have been skipped (e.g. by dropping frames)
+      while (!frames_.empty() && (frames_.front().index_ != index))
+        PopFrame_Private(nullptr);
+    }
+    else
+    {
+      // The player has jumped
+      Restart_Private(index, repeat_from_beginning, limit_interval);
+    }
+  }
+
+  if (frames_.empty())
+  {
+    io_wait_count_++;
+    auto wait_start = std::chrono::steady_clock::now();
+    frame_read_cv_.wait(lock, [this]() { return IsInterrupted() || !frames_.empty(); });
+    io_wait_time_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wait_start);
+  }
+
+  if (frames_.empty() || (frames_.front().index_ != index))
+    return false;
+
+  bool success = frames_.front().success_;
+  PopFrame_Private(&data);
+  return success;
+}
+
+void FramePrefetcher::Reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  active_ = false;
+  generation_++;
+  while (!frames_.empty())
+    PopFrame_Private(nullptr);
+}
+
+EcalPlayPrefetchStatistics FramePrefetcher::GetStatistics()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  EcalPlayPrefetchStatistics statistics;
+  statistics.published_frame_count_ = published_frame_count_;
+  statistics.io_wait_count_         = io_wait_count_;
+  statistics.io_wait_time_          = io_wait_time_;
+  statistics.buffered_frame_count_  = static_cast<long long>(frames_.size());
+  statistics.buffered_bytes_        = buffered_bytes_;
+  return statistics;
+}
+
+void FramePrefetcher::Run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (!IsInterrupted())
+  {
+    frame_taken_cv_.wait(lock, [this]() { return IsInterrupted() || (active_ && (next_read_index_ >= 0) && !IsLookAheadReached_Private()); });
+    if (IsInterrupted()) return;
+
+    PrefetchedFrame frame;
+    frame.index_   = next_read_index_;
+    frame.success_ = false;
+    if (!free_buffers_.empty())
+    {
+      frame.data_ = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+
+    // The frame table must only be accessed while active, as the enabled
+    // frames may change otherwise.
+    const unsigned long long generation = generation_;
+    reading_index_   = frame.index_;
+    next_read_index_ = measurement_.GetNextEnabledFrameIndex(frame.index_, repeat_from_beginning_, limit_interval_);
+
+    lock.unlock();
+    frame.success_ = measurement_.ReadFrameData(frame.index_, frame.data_);
+    lock.lock();
+
+    reading_index_ = -1;
+
+    if (generation != generation_)
+    {
+      // The read-ahead has been restarted while reading the frame
+      if (free_buffers_.size() < MAX_FREE_BUFFERS)
+        free_buffers_.push_back(std::move(frame.data_));
+      continue;
+    }
+
+    if (!frames_.empty())
+      buffered_time_ += GetPlaybackTimeBetweenFrames(last_read_index_, frame.index_);
+    buffered_bytes_ += frame.data_.size();
+    last_read_index_ = frame.index_;
+    frames_.push_back(std::move(frame));
+
+    frame_read_cv_.notify_all();
+  }
+}
+
+void FramePrefetcher::Restart_Private(long long index, bool repeat_from_beginning, std::pair<long long, long long> limit_interval)
+{
+  while (!frames_.empty())
+    PopFrame_Private(nullptr);
+
+  active_                = true;
+  generation_++;
+  repeat_from_beginning_ = repeat_from_beginning;
+  limit_interval_        = limit_interval;
+  next_read_index_       = index;
+
+  frame_taken_cv_.notify_all();
+}
+
+bool FramePrefetcher::IsLookAheadReached_Private() const
+{
+  if (frames_.empty())
+    return false;
+
+  return (frames_.size() >= MAX_BUFFERED_FRAMES)
+    || ((look_ahead_size_ > 0)                          && (buffered_bytes_ >= look_ahead_size_))
+    || ((look_ahead_time_ > std::chrono::nanoseconds(0)) && (buffered_time_  >= look_ahead_time_));
+}
+
+void FramePrefetcher::PopFrame_Private(std::vector<char>* data)
+{
+  PrefetchedFrame& frame = frames_.front();
+
+  buffered_bytes_ -= frame.data_.size();
+  if (data)
+    data->swap(frame.data_);
+
+  if (free_buffers_.size() < MAX_FREE_BUFFERS)
+    free_buffers_.push_back(std::move(frame.data_));
+
+  const long long index = frame.index_;
+  frames_.pop_front();
+
+  if (frames_.empty())
+    buffered_time_ = std::chrono::nanoseconds(0);
+  else
+    buffered_time_ -= GetPlaybackTimeBetweenFrames(index, frames_.front().index_);
+
+  frame_taken_cv_.notify_all();
+}
+
+std::chrono::nanoseconds FramePrefetcher::GetPlaybackTimeBetweenFrames(long long first, long long second) const
+{
+  std::chrono::nanoseconds time_between_frames(0);
+
+  if (second >= first)
+  {
+    time_between_frames = measurement_.GetTimestamp(second) - measurement_.GetTimestamp(first);
+  }
+  else
+  {
+    // The playback wraps around at the end of the limit interval
+    time_between_frames = (measurement_.GetTimestamp(limit_interval_.second) - measurement_.GetTimestamp(first))
+                        + (measurement_.GetTimestamp(second) - measurement_.GetTimestamp(limit_interval_.first));
+  }
+
+  return std::max(time_between_frames, std::chrono::nanoseconds(0));
+}
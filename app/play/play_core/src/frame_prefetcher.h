@@ -0,0 +1,174 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include "ThreadingUtils/InterruptibleThread.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ecal_play_state.h"
+
+class MeasurementContainer;
+
+/**
+ * @brief A Thread that reads the upcoming frames of a measurement ahead of the playback
+ *
+ * The frames are read in the order in which the player will publish them
+ * (@see{MeasurementContainer::GetNextEnabledFrameIndex()}), until the buffered
+ * frames span the configured look-ahead time or size. The measurement is
+ * read by this single thread only, as the measurement reader is not thread
+ * safe.
+ *
+ * When the player requests a frame that is not the next one of the read-ahead
+ * order (e.g. because it jumped to a different position or dropped frames),
+ * all frames before the requested one are discarded or the read-ahead is
+ * restarted at the requested frame.
+ */
+class FramePrefetcher : public InterruptibleThread
+{
+public:
+  static const std::chrono::nanoseconds DEFAULT_LOOK_AHEAD_TIME;
+  static const size_t                   DEFAULT_LOOK_AHEAD_SIZE = 64 * 1024 * 1024;
+  static const size_t                   MAX_BUFFERED_FRAMES     = 100000;       /**< Limits the read-ahead of frames that neither take time nor memory (e.g. a single empty frame played in a loop) */
+  static const size_t                   MAX_FREE_BUFFERS        = 64;
+
+  /**
+   * @brief Creates a new prefetcher that will read frames once Start() has been called
+   * @param measurement    The measurement to read the frames from. Must outlive the prefetcher.
+   */
+  FramePrefetcher(const MeasurementContainer& measurement);
+
+  ~FramePrefetcher();
+
+  void Interrupt() override;
+
+  /**
+   * @brief Sets how far the frames are read ahead of the playback
+   *
+   * Frames are read until either limit is reached. A limit of 0 disables
+   * that limit. If both limits are 0, nothing is read ahead and GetFrame()
+   * reads the frames synchronously.
+   *
+   * @param look_ahead_time    The measurement time span to read ahead
+   * @param look_ahead_size    The payload size to read ahead in bytes
+   */
+  void SetLookAhead(std::chrono::nanoseconds look_ahead_time, size_t look_ahead_size);
+
+  std::chrono::nanoseconds GetLookAheadTime();
+  size_t GetLookAheadSize();
+
+  /**
+   * @brief Gets the payload of the given frame and continues reading ahead from it
+   *
+   * Blocks until the frame has been read. The previous content of data is
+   * re-used for reading the following frames.
+   *
+   * @param index                    The frame to get
+   * @param repeat_from_beginning    Whether the playback will wrap around at the end of the limit interval
+   * @param limit_interval           The limit interval of the playback
+   * @param data                     The payload of the frame
+   *
+   * @return True if the frame could be read from the measurement
+   */
+  bool GetFrame(long long index, bool repeat_from_beginning, std::pair<long long, long long> limit_interval, std::vector<char>& data);
+
+  /**
+   * @brief Discards all frames and stops reading ahead until the next call of GetFrame()
+   *
+   * Must be called before the enabled frames of the measurement are changed
+   * (i.e. the publishers are created or de-initialized).
+   */
+  void Reset();
+
+  EcalPlayPrefetchStatistics GetStatistics();
+
+protected:
+  void Run() override;
+
+private:
+  struct PrefetchedFrame
+  {
+    long long         index_;
+    bool              success_;
+    std::vector<char> data_;
+  };
+
+  /**
+   * @brief Discards all frames and restarts reading ahead at the given index
+   *
+   * This function does not lock any mutex. The mutex_ has to be locked when
+   * calling this function.
+   */
+  void Restart_Private(long long index, bool repeat_from_beginning, std::pair<long long, long long> limit_interval);
+
+  /**
+   * @brief Checks whether the buffered frames span the configured look-ahead
+   *
+   * This function does not lock any mutex. The mutex_ has to be locked when
+   * calling this function.
+   */
+  bool IsLookAheadReached_Private() const;
+
+  /**
+   * @brief Removes the first frame of the frames_ and keeps its buffer for re-use
+   *
+   * This function does not lock any mutex. The mutex_ has to be locked when
+   * calling this function.
+   *
+   * @param data    If not nullptr, the payload is swapped into data and the previous content of data is kept for re-use
+   */
+  void PopFrame_Private(std::vector<char>* data);
+
+  /**
+   * @brief Returns the measurement time between two frames in playback order
+   */
+  std::chrono::nanoseconds GetPlaybackTimeBetweenFrames(long long first, long long second) const;
+
+  const MeasurementContainer&     measurement_;                                 /**< The measurement to read the frames from */
+
+  std::mutex                      mutex_;                                       /**< A mutex protecting all following variables */
+  std::condition_variable         frame_read_cv_;                               /**< Notified by the I/O thread when a frame has been read */
+  std::condition_variable         frame_taken_cv_;                              /**< Notified when the read-ahead has to be continued (e.g. a frame has been taken or the read-ahead has been restarted) */
+
+  std::chrono::nanoseconds        look_ahead_time_;                             /**< The measurement time span to read ahead */
+  size_t                          look_ahead_size_;                             /**< The payload size to read ahead */
+
+  bool                            active_;                                      /**< Whether the I/O thread is reading ahead. Only while active, the I/O thread accesses the frame table of the measurement. */
+  unsigned long long              generation_;                                  /**< Incremented with every restart, so the I/O thread can discard a frame that it has read for an old position */
+  bool                            repeat_from_beginning_;                       /**< The repeat setting the read-ahead order has been computed with */
+  std::pair<long long, long long> limit_interval_;                              /**< The limit interval the read-ahead order has been computed with */
+  long long                       next_read_index_;                             /**< The next frame the I/O thread will read, or -1 if there are no more frames */
+  long long                       reading_index_;                               /**< The frame the I/O thread is currently reading, or -1 */
+  long long                       last_read_index_;                             /**< The last frame of the frames_ */
+
+  std::deque<PrefetchedFrame>     frames_;                                      /**< The frames that have been read ahead, in publishing order */
+  size_t                          buffered_bytes_;                              /**< The payload size of the frames_ */
+  std::chrono::nanoseconds        buffered_time_;                               /**< The measurement time span of the frames_ */
+  std::vector<std::vector<char>>  free_buffers_;                                /**< Buffers of published frames that are re-used for reading the next frames */
+
+  long long                       published_frame_count_;                       /**< Number of frames taken with GetFrame() */
+  long long                       io_wait_count_;                               /**< Number of times GetFrame() had to wait for the I/O thread */
+  std::chrono::nanoseconds        io_wait_time_;                                /**< Accumulated time GetFrame() waited for the I/O thread */
+};
@@ -0,0 +1,432 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_table.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <utility>
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <ecal_utils/str_convert.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // WIN32
+
+namespace
+{
+  // Layout of the cache file:
+  //   FileHeader
+  //   Channel names (uint32_t length + characters each), padded to 8 bytes
+  //   Timestamps      (int64_t  * frame_count)
+  //   Entry IDs       (int64_t  * frame_count)
+  //   Send IDs        (int64_t  * frame_count)
+  //   Channel indices (uint32_t * frame_count)
+  struct FileHeader
+  {
+    char     magic[8];
+    uint32_t byte_order_mark;                                                   // The file is only valid on machines with the same byte order
+    uint32_t header_size;
+    uint64_t fingerprint;
+    uint64_t frame_count;
+    uint64_t channel_count;
+    uint64_t channel_names_size;
+  };
+
+  const char     FILE_MAGIC[8]   = { 'E', 'C', 'P', 'L', 'A', 'Y', 'F', '1' };
+  const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  const uint64_t BYTES_PER_FRAME = 3 * sizeof(int64_t) + sizeof(uint32_t);
+
+  uint64_t PaddedSize(uint64_t size)
+  {
+    return (size + 7) & ~static_cast<uint64_t>(7);
+  }
+}
+
+FrameTable::FrameTable()
+  : mapped_data_    (nullptr)
+  , mapped_size_    (0)
+#ifdef WIN32
+  , file_handle_    (INVALID_HANDLE_VALUE)
+  , mapping_handle_ (nullptr)
+#endif // WIN32
+  , frame_count_    (0)
+  , timestamps_     (nullptr)
+  , entry_ids_      (nullptr)
+  , send_ids_       (nullptr)
+  , channel_indices_(nullptr)
+{}
+
+FrameTable::~FrameTable()
+{
+  Clear();
+}
+
+void FrameTable::Build(const eCAL::experimental::measurement::base::Reader& measurement, bool use_receive_timestamp)
+{
+  Clear();
+
+  auto channel_names = measurement.GetChannelNames();
+  channel_names_.assign(channel_names.begin(), channel_names.end());
+
+  struct Entry
+  {
+    int64_t timestamp;
+    int64_t entry_id;
+    int64_t send_id;
+  };
+
+  // Collect the entries of each channel. The measurement reader is not thread safe, so this is done sequentially.
+  std::vector<std::vector<Entry>> channel_entries(channel_names_.size());
+  for (size_t channel = 0; channel < channel_names_.size(); channel++)
+  {
+    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
+    if (!measurement.GetEntriesInfo(channel_names_[channel], entry_info_set))
+      continue;
+
+    auto& entries = channel_entries[channel];
+    entries.reserve(entry_info_set.size());
+    for (const auto& entry_info : entry_info_set)
+    {
+      entries.push_back({ (use_receive_timestamp ? entry_info.RcvTimestamp : entry_info.SndTimestamp), entry_info.ID, entry_info.SndID });
+    }
+  }
+
+  // The entry info set is sorted by the receive timestamp, sort the channels by their send timestamps in parallel
+  if (!use_receive_timestamp)
+  {
+    std::atomic<size_t> next_channel(0);
+    auto sort_entries = [&]()
+                        {
+                          for (size_t channel = next_channel++; channel < channel_entries.size(); channel = next_channel++)
+                          {
+                            auto& entries = channel_entries[channel];
+                            std::stable_sort(entries.begin(), entries.end(), [](const Entry& e1, const Entry& e2) { return e1.timestamp < e2.timestamp; });
+                          }
+                        };
+
+    const size_t thread_count = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), channel_entries.size()));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_count; i++)
+    {
+      threads.emplace_back(sort_entries);
+    }
+    sort_entries();
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  // Merge the channels by their timestamps
+  size_t frame_count = 0;
+  for (const auto& entries : channel_entries)
+  {
+    frame_count += entries.size();
+  }
+
+  timestamp_column_    .reserve(frame_count);
+  entry_id_column_     .reserve(frame_count);
+  send_id_column_      .reserve(frame_count);
+  channel_index_column_.reserve(frame_count);
+
+  using MergeItem = std::pair<int64_t, uint32_t>; // timestamp and channel index of the next entry of a channel
+  std::priority_queue<MergeItem, std::vector<MergeItem>, std::greater<MergeItem>> merge_queue;
+  std::vector<size_t> next_entry(channel_entries.size(), 0);
+
+  for (uint32_t channel = 0; channel < static_cast<uint32_t>(channel_entries.size()); channel++)
+  {
+    if (!channel_entries[channel].empty())
+      merge_queue.emplace(channel_entries[channel].front().timestamp, channel);
+  }
+
+  while (!merge_queue.empty())
+  {
+    const uint32_t channel = merge_queue.top().second;
+    merge_queue.pop();
+
+    auto& entries = channel_entries[channel];
+    const Entry& entry = entries[next_entry[channel]++];
+
+    timestamp_column_    .push_back(entry.timestamp);
+    entry_id_column_     .push_back(entry.entry_id);
+    send_id_column_      .push_back(entry.send_id);
+    channel_index_column_.push_back(channel);
+
+    if (next_entry[channel] < entries.size())
+    {
+      merge_queue.emplace(entries[next_entry[channel]].timestamp, channel);
+    }
+    else
+    {
+      // Free the memory of merged channels early
+      std::vector<Entry>().swap(entries);
+    }
+  }
+
+  frame_count_     = static_cast<long long>(timestamp_column_.size());
+  timestamps_      = timestamp_column_.data();
+  entry_ids_       = entry_id_column_.data();
+  send_ids_        = send_id_column_.data();
+  channel_indices_ = channel_index_column_.data();
+}
+
+bool FrameTable::LoadCache(const std::string& path, uint64_t fingerprint)
+{
+  Clear();
+
+#ifdef WIN32
+  HANDLE file_handle = ::CreateFileW(EcalUtils::StrConvert::Utf8ToWide(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle == INVALID_HANDLE_VALUE)
+    return false;
+  file_handle_ = file_handle;
+
+  LARGE_INTEGER file_size;
+  if (!::GetFileSizeEx(file_handle, &file_size) || (file_size.QuadPart < static_cast<LONGLONG>(sizeof(FileHeader))))
+  {
+    Clear();
+    return false;
+  }
+
+  mapping_handle_ = ::CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping_handle_ == nullptr)
+  {
+    Clear();
+    return false;
+  }
+
+  mapped_data_ = static_cast<const char*>(::MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+  if (mapped_data_ == nullptr)
+  {
+    Clear();
+    return false;
+  }
+  mapped_size_ = static_cast<uint64_t>(file_size.QuadPart);
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat file_stat;
+  if ((::fstat(fd, &file_stat) != 0) || (file_stat.st_size < static_cast<off_t>(sizeof(FileHeader))))
+  {
+    ::close(fd);
+    return false;
+  }
+
+  void* data = ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED)
+    return false;
+
+  mapped_data_ = static_cast<const char*>(data);
+  mapped_size_ = static_cast<uint64_t>(file_stat.st_size);
+#endif // WIN32
+
+  // Check the header
+  FileHeader header;
+  std::memcpy(&header, mapped_data_, sizeof(header));
+
+  if ((std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    || (header.byte_order_mark != BYTE_ORDER_MARK)
+    || (header.header_size     != sizeof(FileHeader))
+    || (header.fingerprint     != fingerprint)
+    || (header.channel_names_size != PaddedSize(header.channel_names_size))
+    || (header.channel_names_size > mapped_size_)
+    || (header.frame_count > (mapped_size_ / BYTES_PER_FRAME))
+    || (mapped_size_ != sizeof(FileHeader) + header.channel_names_size + header.frame_count * BYTES_PER_FRAME))
+  {
+    Clear();
+    return false;
+  }
+
+  // Read the channel names
+  const char* names_begin = mapped_data_ + sizeof(FileHeader);
+  const char* names_end   = names_begin + header.channel_names_size;
+  const char* name_it     = names_begin;
+
+  channel_names_.reserve(static_cast<size_t>(std::min<uint64_t>(header.channel_count, header.channel_names_size / sizeof(uint32_t))));
+  for (uint64_t i = 0; i < header.channel_count; i++)
+  {
+    uint32_t name_size = 0;
+    if (static_cast<uint64_t>(names_end - name_it) < sizeof(name_size))
+    {
+      Clear();
+      return false;
+    }
+    std::memcpy(&name_size, name_it, sizeof(name_size));
+    name_it += sizeof(name_size);
+
+    if (static_cast<uint64_t>(names_end - name_it) < name_size)
+    {
+      Clear();
+      return false;
+    }
+    channel_names_.emplace_back(name_it, name_size);
+    name_it += name_size;
+  }
+
+  // Map the columns
+  const uint64_t frame_count = header.frame_count;
+  timestamps_      = reinterpret_cast<const int64_t*>(names_end);
+  entry_ids_       = timestamps_ + frame_count;
+  send_ids_        = entry_ids_  + frame_count;
+  channel_indices_ = reinterpret_cast<const uint32_t*>(send_ids_ + frame_count);
+  frame_count_     = static_cast<long long>(frame_count);
+
+  // The channel indices are not checked here, that would read the whole column. They are checked where they are used.
+  return true;
+}
+
+bool FrameTable::SaveCache(const std::string& path, uint64_t fingerprint) const
+{
+  const std::string temp_path = path + ".tmp";
+
+  {
+#ifdef WIN32
+    std::ofstream cache_file(EcalUtils::StrConvert::Utf8ToWide(temp_path), std::ios::binary | std::ios::trunc);
+#else
+    std::ofstream cache_file(temp_path, std::ios::binary | std::ios::trunc);
+#endif // WIN32
+    if (!cache_file)
+      return false;
+
+    std::string channel_names_block;
+    for (const auto& channel_name : channel_names_)
+    {
+      const uint32_t name_size = static_cast<uint32_t>(channel_name.size());
+      channel_names_block.append(reinterpret_cast<const char*>(&name_size), sizeof(name_size));
+      channel_names_block.append(channel_name);
+    }
+    channel_names_block.resize(static_cast<size_t>(PaddedSize(channel_names_block.size())), '\0');
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.byte_order_mark    = BYTE_ORDER_MARK;
+    header.header_size        = sizeof(FileHeader);
+    header.fingerprint        = fingerprint;
+    header.frame_count        = static_cast<uint64_t>(frame_count_);
+    header.channel_count      = channel_names_.size();
+    header.channel_names_size = channel_names_block.size();
+
+    const std::streamsize frame_count = static_cast<std::streamsize>(frame_count_);
+
+    cache_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    cache_file.write(channel_names_block.data(), static_cast<std::streamsize>(channel_names_block.size()));
+    cache_file.write(reinterpret_cast<const char*>(timestamps_),      frame_count * static_cast<std::streamsize>(sizeof(int64_t)));
+    cache_file.write(reinterpret_cast<const char*>(entry_ids_),       frame_count * static_cast<std::streamsize>(sizeof(int64_t)));
+    cache_file.write(reinterpret_cast<const char*>(send_ids_),        frame_count * static_cast<std::streamsize>(sizeof(int64_t)));
+    cache_file.write(reinterpret_cast<const char*>(channel_indices_), frame_count * static_cast<std::streamsize>(sizeof(uint32_t)));
+    cache_file.close();
+
+    if (!cache_file)
+    {
+      std::remove(temp_path.c_str());
+      return false;
+    }
+  }
+
+#ifdef WIN32
+  if (!::MoveFileExW(EcalUtils::StrConvert::Utf8ToWide(temp_path).c_str(), EcalUtils::StrConvert::Utf8ToWide(path).c_str(), MOVEFILE_REPLACE_EXISTING))
+#else
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+#endif // WIN32
+  {
+    std::remove(temp_path.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+long long FrameTable::GetFrameCount() const
+{
+  return frame_count_;
+}
+
+const std::vector<std::string>& FrameTable::GetChannelNames() const
+{
+  return channel_names_;
+}
+
+const int64_t* FrameTable::GetTimestamps() const
+{
+  return timestamps_;
+}
+
+const int64_t* FrameTable::GetEntryIds() const
+{
+  return entry_ids_;
+}
+
+const int64_t* FrameTable::GetSendIds() const
+{
+  return send_ids_;
+}
+
+const uint32_t* FrameTable::GetChannelIndices() const
+{
+  return channel_indices_;
+}
+
+void FrameTable::Clear()
+{
+  channel_names_.clear();
+
+  timestamp_column_    .clear();
+  entry_id_column_     .clear();
+  send_id_column_      .clear();
+  channel_index_column_.clear();
+
+#ifdef WIN32
+  if (mapped_data_ != nullptr)
+    ::UnmapViewOfFile(mapped_data_);
+  if (mapping_handle_ != nullptr)
+    ::CloseHandle(mapping_handle_);
+  if (file_handle_ != INVALID_HANDLE_VALUE)
+    ::CloseHandle(file_handle_);
+  mapping_handle_ = nullptr;
+  file_handle_    = INVALID_HANDLE_VALUE;
+#else
+  if (mapped_data_ != nullptr)
+    ::munmap(const_cast<char*>(mapped_data_), static_cast<size_t>(mapped_size_));
+#endif // WIN32
+  mapped_data_ = nullptr;
+  mapped_size_ = 0;
+
+  frame_count_     = 0;
+  timestamps_      = nullptr;
+  entry_ids_       = nullptr;
+  send_ids_        = nullptr;
+  channel_indices_ = nullptr;
+}
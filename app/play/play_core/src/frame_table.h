@@ -0,0 +1,125 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ecal/measurement/base/reader.h>
+
+/**
+ * @brief The frames of a measurement sorted by their timestamps, stored column by column
+ *
+ * Instead of one struct per frame, the frame table consists of one array per
+ * property (timestamp, entry id, send id and channel index). The channel names
+ * are only stored once. This keeps the table small for measurements with
+ * hundreds of millions of frames.
+ *
+ * The table is either built from the measurement or loaded from a cache file
+ * that is mapped into memory, so loading it does not depend on the frame
+ * count.
+ *
+ * The table is not modified after it has been built or loaded, so it can be
+ * read from multiple threads.
+ */
+class FrameTable
+{
+public:
+  FrameTable();
+  ~FrameTable();
+
+  FrameTable(const FrameTable&)            = delete;
+  FrameTable& operator=(const FrameTable&) = delete;
+
+  /**
+   * @brief Builds the table from the given measurement
+   *
+   * The entries of the channels are collected in parallel and merged by their
+   * timestamps afterwards.
+   *
+   * @param measurement              The measurement to read the entries from
+   * @param use_receive_timestamp    Whether to sort the frames by their receive timestamp (true) or their send timestamp (false)
+   */
+  void Build(const eCAL::experimental::measurement::base::Reader& measurement, bool use_receive_timestamp);
+
+  /**
+   * @brief Maps the table from a cache file written by @see{SaveCache()}
+   *
+   * Fails and leaves the table empty, if the file does not exist, is corrupt
+   * (including channel indices out of range) or has been written with a
+   * different fingerprint.
+   *
+   * @param path           The cache file
+   * @param fingerprint    The fingerprint of the measurement the table must have been built from
+   *
+   * @return True if the table has been loaded
+   */
+  bool LoadCache(const std::string& path, uint64_t fingerprint);
+
+  /**
+   * @brief Writes the table to a cache file
+   *
+   * The file is written to a temporary file first and renamed afterwards, so
+   * a reader never sees a partially written file.
+   *
+   * @param path           The cache file
+   * @param fingerprint    The fingerprint of the measurement the table has been built from
+   *
+   * @return True if successfull
+   */
+  bool SaveCache(const std::string& path, uint64_t fingerprint) const;
+
+  long long GetFrameCount() const;
+
+  const std::vector<std::string>& GetChannelNames() const;
+
+  // Columns, each has GetFrameCount() elements
+  const int64_t*  GetTimestamps()     const;                                    /**< The timestamps (in microseconds) the frames are sorted by */
+  const int64_t*  GetEntryIds()       const;                                    /**< The entry IDs in the measurement */
+  const int64_t*  GetSendIds()        const;                                    /**< The send IDs of the publishers that have sent the frames */
+  const uint32_t* GetChannelIndices() const;                                    /**< The indices of the channel names, must be checked against GetChannelNames() (a corrupt cache file may contain invalid ones) */
+
+private:
+  void Clear();
+
+  std::vector<std::string> channel_names_;
+
+  // Storage of a built table
+  std::vector<int64_t>     timestamp_column_;
+  std::vector<int64_t>     entry_id_column_;
+  std::vector<int64_t>     send_id_column_;
+  std::vector<uint32_t>    channel_index_column_;
+
+  // Storage of a loaded table
+  const char*              mapped_data_;
+  uint64_t                 mapped_size_;
+#ifdef WIN32
+  void*                    file_handle_;
+  void*                    mapping_handle_;
+#endif // WIN32
+
+  // The columns point to either storage
+  long long                frame_count_;
+  const int64_t*           timestamps_;
+  const int64_t*           entry_ids_;
+  const int64_t*           send_ids_;
+  const uint32_t*          channel_indices_;
+};
@@ -22,60 +22,123 @@
 
 #include <algorithm>
 #include <math.h>
-#include <stdlib.h>
 
-MeasurementContainer::MeasurementContainer(std::shared_ptr<eCAL::experimental::measurement::base::Reader> hdf5_meas, const std::string& meas_dir, bool use_receive_timestamp)
+#include <ecal_utils/filesystem.h>
+
+#include "ecal_play_logger.h"
+
+namespace
+{
+  const std::string FRAME_TABLE_CACHE_FILE_NAME = ".ecal_play_frame_table";
+
+  // FNV-1a
+  void HashCombine(uint64_t& hash, const void* data, size_t size)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+      hash ^= bytes[i];
+      hash *= 0x100000001b3ULL;
+    }
+  }
+
+  void HashCombine(uint64_t& hash, const std::string& value)
+  {
+    const uint64_t size = value.size();
+    HashCombine(hash, &size, sizeof(size));
+    HashCombine(hash, value.data(), value.size());
+  }
+
+  void HashCombine(uint64_t& hash, long long value)
+  {
+    HashCombine(hash, &value, sizeof(value));
+  }
+}
+
+MeasurementContainer::MeasurementContainer(std::shared_ptr<eCAL::experimental::measurement::base::Reader> hdf5_meas, const std::string& meas_dir, bool use_receive_timestamp, bool use_frame_table_cache)
   : hdf5_meas_             (hdf5_meas)
   , meas_dir_              (meas_dir)
   , use_receive_timestamp_ (use_receive_timestamp)
   , publishers_initialized_(false)
-  , send_buffer_           (nullptr)
 {
-  send_buffer_           = malloc(MIN_SEND_BUFFER_SIZE);
-  allocated_buffer_size_ = MIN_SEND_BUFFER_SIZE;
+  send_buffer_.reserve(MIN_SEND_BUFFER_SIZE);
 
   // Create a table of all frames, sorted by their timestamps
-  CreateFrameTable();
+  CreateFrameTable(use_frame_table_cache);
+
+  // Start reading frames ahead once they are requested
+  prefetcher_ = std::make_unique<FramePrefetcher>(*this);
+  prefetcher_->Start();
 }
 
 MeasurementContainer::~MeasurementContainer()
 {
+  // Stop the I/O thread before anything it reads is destroyed
+  prefetcher_.reset();
+
   DeInitializePublishers();
-  free(send_buffer_);
 }
 
-void MeasurementContainer::CreateFrameTable()
+void MeasurementContainer::CreateFrameTable(bool use_frame_table_cache)
 {
-  auto channel_names = hdf5_meas_->GetChannelNames();
-  for (auto& channel_name : channel_names)
+  const bool        use_cache       = use_frame_table_cache && !meas_dir_.empty();
+  const std::string cache_file_path = meas_dir_ + "/" + FRAME_TABLE_CACHE_FILE_NAME;
+  uint64_t          fingerprint     = 0;
+
+  bool loaded_from_cache = false;
+  if (use_cache)
   {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
-    {
-      for (auto& entry_info : entry_info_set)
-      {
-        MeasurementFrame frame_entry;
+    fingerprint       = CalculateFrameTableFingerprint();
+    loaded_from_cache = frame_table_.LoadCache(cache_file_path, fingerprint);
+  }
 
-        frame_entry.id_                = entry_info.ID;
-        frame_entry.channel_name_      = channel_name;
-        frame_entry.receive_timestamp_ = eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(entry_info.RcvTimestamp));
-        frame_entry.send_timestamp_    = eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(entry_info.SndTimestamp));
-        frame_entry.send_id_           = entry_info.SndID;
-        frame_entry.publisher_info_    = nullptr;
+  if (loaded_from_cache)
+  {
+    EcalPlayLogger::Instance()->info("Loaded frame table from " + cache_file_path);
+  }
+  else
+  {
+    frame_table_.Build(*hdf5_meas_, use_receive_timestamp_);
 
-        frame_table_.push_back(frame_entry);
-      }
+    if (use_cache && !frame_table_.SaveCache(cache_file_path, fingerprint))
+    {
+      EcalPlayLogger::Instance()->warn("Unable to save frame table to " + cache_file_path);
     }
   }
 
-  if (use_receive_timestamp_)
+  channel_publishers_.assign(frame_table_.GetChannelNames().size(), nullptr);
+}
+
+uint64_t MeasurementContainer::CalculateFrameTableFingerprint() const
+{
+  uint64_t fingerprint = 0xcbf29ce484222325ULL;
+
+  HashCombine(fingerprint, static_cast<long long>(use_receive_timestamp_));
+
+  for (const auto& file : EcalUtils::Filesystem::DirContent(meas_dir_, EcalUtils::Filesystem::OsStyle::Current))
   {
-    std::sort(frame_table_.begin(), frame_table_.end(), [](const MeasurementFrame& e1, const MeasurementFrame& e2) {return e1.receive_timestamp_ < e2.receive_timestamp_; });
+    const std::string& file_name = file.first;
+    if ((file_name.size() > 5) && (file_name.compare(file_name.size() - 5, 5, ".hdf5") == 0))
+    {
+      HashCombine(fingerprint, file_name);
+      HashCombine(fingerprint, static_cast<long long>(file.second.FileSize()));
+    }
   }
-  else
+
+  for (const auto& channel_name : hdf5_meas_->GetChannelNames())
   {
-    std::sort(frame_table_.begin(), frame_table_.end(), [](const MeasurementFrame& e1, const MeasurementFrame& e2) {return e1.send_timestamp_ < e2.send_timestamp_; });
+    HashCombine(fingerprint, channel_name);
+    HashCombine(fingerprint, hdf5_meas_->GetMinTimestamp(channel_name));
+    HashCombine(fingerprint, hdf5_meas_->GetMaxTimestamp(channel_name));
   }
+
+  return fingerprint;
+}
+
+MeasurementContainer::PublisherInfo* MeasurementContainer::GetPublisherInfo(long long index) const
+{
+  const uint32_t channel_index = frame_table_.GetChannelIndices()[index];
+  return (channel_index < channel_publishers_.size() ? channel_publishers_[channel_index] : nullptr);
 }
 
 void MeasurementContainer::CalculateEstimatedSizeForChannels()
@@ -97,7 +160,10 @@ void MeasurementContainer::CalculateEstimatedSizeForChannels()
       {
         size_t entry_size = 0;
         auto id = (*std::next(entry_info_set.begin(), i)).ID;
-        hdf5_meas_->GetEntryDataSize(id, entry_size);
+        {
+          std::lock_guard<std::mutex> read_lock(hdf5_meas_read_mutex_);
+          hdf5_meas_->GetEntryDataSize(id, entry_size);
+        }
         ++additions;
         sum += entry_size;
       }
@@ -123,7 +189,7 @@ void MeasurementContainer::CreatePublishers()
 
 void MeasurementContainer::CreatePublishers(const std::map<std::string, std::string>& publisher_map)
 {
-  // De-Initialize old publishers
+  // De-Initialize old publishers. This also stops the read-ahead of frames.
   DeInitializePublishers();
 
   // Create new publishers
@@ -135,13 +201,14 @@ void MeasurementContainer::CreatePublishers(const std::map<std::string, std::str
     publisher_map_.emplace(channel_mapping.first, PublisherInfo(channel_mapping.second, topic_type, topic_description));
   }
 
-  // Assign publishers to entries
-  for (auto& entry : frame_table_)
+  // Assign publishers to channels
+  const auto& channel_names = frame_table_.GetChannelNames();
+  for (size_t i = 0; i < channel_names.size(); i++)
   {
-    auto publisher_it = publisher_map_.find(entry.channel_name_);
+    auto publisher_it = publisher_map_.find(channel_names[i]);
     if (publisher_it != publisher_map_.end())
     {
-      entry.publisher_info_ = &(publisher_it->second);
+      channel_publishers_[i] = &(publisher_it->second);
     }
   }
 
@@ -150,6 +217,10 @@ void MeasurementContainer::CreatePublishers(const std::map<std::string, std::str
 
 void MeasurementContainer::DeInitializePublishers()
 {
+  // The prefetcher must not read the frame table while we remove the publishers
+  if (prefetcher_)
+    prefetcher_->Reset();
+
   // Clear the publisher map
   for (auto& publisher_info : publisher_map_)
   {
@@ -157,11 +228,8 @@ void MeasurementContainer::DeInitializePublishers()
   }
   publisher_map_.clear();
 
-  // Remove pointers to publishers from all frames
-  for (auto& entry : frame_table_)
-  {
-    entry.publisher_info_ = nullptr;
-  }
+  // Remove pointers to publishers from all channels
+  std::fill(channel_publishers_.begin(), channel_publishers_.end(), nullptr);
 
   publishers_initialized_ = false;
 }
@@ -180,52 +248,60 @@ bool MeasurementContainer::PublishersCreated() const
   return publishers_initialized_;
 }
 
-bool MeasurementContainer::PublishFrame(long long index)
+bool MeasurementContainer::PublishFrame(long long index, bool repeat_from_beginning, std::pair<long long, long long> limit_interval)
 {
   // Check that the user created the publishers before publishing a frame
   if (!publishers_initialized_ || (index < 0) || index >= GetFrameCount())
     return false;
 
-  if (frame_table_[index].publisher_info_)
+  PublisherInfo* publisher_info = GetPublisherInfo(index);
+  if (publisher_info)
   {
-    size_t data_size;
-    if (hdf5_meas_->GetEntryDataSize(frame_table_[index].id_, data_size))
+    if (prefetcher_->GetFrame(index, repeat_from_beginning, limit_interval, send_buffer_))
     {
-      if (data_size > allocated_buffer_size_)
-      {
-        void* temp = realloc(send_buffer_, data_size);
-        if (temp == nullptr)
-        {
-          return false;
-        }
-        else
-        {
-          send_buffer_ = temp;
-        }
-        allocated_buffer_size_ = data_size;
-      }
-      if (hdf5_meas_->GetEntryData(frame_table_[index].id_, send_buffer_))
-      {
-        long long timestamp_usecs = -1;
-        if (use_receive_timestamp_)
-        {
-          timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].receive_timestamp_.time_since_epoch()).count();
-        }
-        else
-        {
-          timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].send_timestamp_.time_since_epoch()).count();
-        }
-        frame_table_[index].publisher_info_->publisher_.SetID(frame_table_[index].send_id_);
-        frame_table_[index].publisher_info_->publisher_.Send(send_buffer_, data_size, timestamp_usecs);
-        frame_table_[index].publisher_info_->message_counter_++;
-        return true;
-      }
+      // The frame table contains the receive or send timestamp, depending on use_receive_timestamp_
+      long long timestamp_usecs = frame_table_.GetTimestamps()[index];
+
+      publisher_info->publisher_.SetID(frame_table_.GetSendIds()[index]);
+      publisher_info->publisher_.Send(send_buffer_.data(), send_buffer_.size(), timestamp_usecs);
+      publisher_info->message_counter_++;
+      return true;
     }
   }
 
   return false;
 }
 
+bool MeasurementContainer::ReadFrameData(long long index, std::vector<char>& data) const
+{
+  if ((index < 0) || index >= GetFrameCount())
+    return false;
+
+  std::lock_guard<std::mutex> read_lock(hdf5_meas_read_mutex_);
+
+  const long long entry_id = frame_table_.GetEntryIds()[index];
+
+  size_t data_size;
+  if (!hdf5_meas_->GetEntryDataSize(entry_id, data_size))
+    return false;
+
+  data.resize(data_size);
+  if (data_size == 0)
+    return true;
+
+  return hdf5_meas_->GetEntryData(entry_id, data.data());
+}
+
+void MeasurementContainer::SetPrefetchLookAhead(std::chrono::nanoseconds look_ahead_time, size_t look_ahead_size)
+{
+  prefetcher_->SetLookAhead(look_ahead_time, look_ahead_size);
+}
+
+EcalPlayPrefetchStatistics MeasurementContainer::GetPrefetchStatistics() const
+{
+  return prefetcher_->GetStatistics();
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //// Getters                                                                ////
@@ -233,7 +309,7 @@ bool MeasurementContainer::PublishFrame(long long index)
 
 long long MeasurementContainer::GetFrameCount() const
 {
-  return (long long)frame_table_.size();
+  return frame_table_.GetFrameCount();
 }
 
 bool MeasurementContainer::IsUsingReceiveTimestamp() const
@@ -250,14 +326,7 @@ eCAL::Time::ecal_clock::time_point MeasurementContainer::GetTimestamp(long long
 {
   if ((index >= 0) && (index < GetFrameCount()))
   {
-    if (use_receive_timestamp_)
-    {
-      return frame_table_[index].receive_timestamp_;
-    }
-    else
-    {
-      return frame_table_[index].send_timestamp_;
-    }
+    return eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(frame_table_.GetTimestamps()[index]));
   }
   else
   {
@@ -269,12 +338,13 @@ std::string MeasurementContainer::GetChannelName(long long index) const
 {
   if ((index >= 0) && (index < GetFrameCount()))
   {
-    return frame_table_[index].channel_name_;
-  }
-  else
-  {
-    return "";
+    const uint32_t channel_index = frame_table_.GetChannelIndices()[index];
+    if (channel_index < frame_table_.GetChannelNames().size())
+    {
+      return frame_table_.GetChannelNames()[channel_index];
+    }
   }
+  return "";
 }
 
 std::chrono::nanoseconds MeasurementContainer::GetMeasurementLength() const
@@ -350,7 +420,7 @@ long long MeasurementContainer::GetNextEnabledFrameIndex(long long current_index
   // Search from current_index to the end
   for (long long i = std::max(current_index, limit_interval.first) + 1; i <= std::min(limit_interval.second, GetFrameCount() - 1); i++)
   {
-    if (frame_table_[i].publisher_info_)
+    if (GetPublisherInfo(i))
     {
       return i;
     }
@@ -361,7 +431,7 @@ long long MeasurementContainer::GetNextEnabledFrameIndex(long long current_index
   {
     for (long long i = std::max(0LL, limit_interval.first); i <= std::min(std::min(current_index, limit_interval.second), GetFrameCount() - 1); i++)
     {
-      if (frame_table_[i].publisher_info_)
+      if (GetPublisherInfo(i))
       {
         return i;
       }
@@ -374,10 +444,18 @@ long long MeasurementContainer::GetNextEnabledFrameIndex(long long current_index
 
 long long MeasurementContainer::GetNextOccurenceOfChannel(long long current_index, const std::string& source_channel_name, bool repeat_from_beginning, std::pair<long long, long long> limit_interval) const
 {
+  const auto& channel_names = frame_table_.GetChannelNames();
+  auto channel_it = std::find(channel_names.begin(), channel_names.end(), source_channel_name);
+  if (channel_it == channel_names.end())
+    return -1;
+
+  const uint32_t  source_channel_index = static_cast<uint32_t>(channel_it - channel_names.begin());
+  const uint32_t* channel_indices      = frame_table_.GetChannelIndices();
+
   // Search from current_index to the end
   for (long long i = std::max(current_index, limit_interval.first) + 1; i <= std::min(limit_interval.second, GetFrameCount() - 1); i++)
   {
-    if (frame_table_[i].channel_name_ == source_channel_name)
+    if (channel_indices[i] == source_channel_index)
     {
       return i;
     }
@@ -388,7 +466,7 @@ long long MeasurementContainer::GetNextOccurenceOfChannel(long long current_inde
   {
     for (long long i = std::max(0LL, limit_interval.first); i <= std::min(std::min(current_index, limit_interval.second), GetFrameCount() - 1); i++)
     {
-      if (frame_table_[i].channel_name_ == source_channel_name)
+      if (channel_indices[i] == source_channel_index)
       {
         return i;
       }
@@ -414,7 +492,7 @@ std::chrono::nanoseconds MeasurementContainer::GetTimeBetweenFrames(long long fi
 
 long long MeasurementContainer::GetNearestIndex(eCAL::Time::ecal_clock::time_point timestamp) const
 {
-  if (frame_table_.size() < 1)
+  if (GetFrameCount() < 1)
   {
     return -1;
   }
@@ -424,21 +502,29 @@ long long MeasurementContainer::GetNearestIndex(eCAL::Time::ecal_clock::time_poi
     return 0;
   }
 
-  for (int i = 0; i < GetFrameCount() - 1; i++)
+  // Binary search for the first frame that is not before the timestamp
+  const int64_t* timestamps     = frame_table_.GetTimestamps();
+  const int64_t* timestamps_end = timestamps + GetFrameCount();
+  auto upper_it = std::lower_bound(timestamps, timestamps_end, timestamp,
+                                  [](int64_t frame_timestamp, eCAL::Time::ecal_clock::time_point t)
+                                  {
+                                    return eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(frame_timestamp)) < t;
+                                  });
+
+  if (upper_it == timestamps_end)
   {
-    if ((GetTimestamp(i) <= timestamp) && (timestamp <= GetTimestamp(i + 1)))
-    {
-      if ((timestamp - GetTimestamp(i)) <= (GetTimestamp(i + 1) - timestamp))
-      {
-        return i;
-      }
-      else
-      {
-        return i + 1;
-      }
-    }
+    return GetFrameCount() - 1;
+  }
+
+  long long i = (upper_it - timestamps) - 1;
+  if ((timestamp - GetTimestamp(i)) <= (GetTimestamp(i + 1) - timestamp))
+  {
+    return i;
+  }
+  else
+  {
+    return i + 1;
   }
-  return GetFrameCount() - 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -22,16 +22,29 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <ecal/ecal.h>
 #include <ecal/measurement/base/reader.h>
 
 #include "continuity_report.h"
+#include "ecal_play_state.h"
+#include "frame_prefetcher.h"
+#include "frame_table.h"
 
 class MeasurementContainer
 {
 public:
-  MeasurementContainer(std::shared_ptr<eCAL::experimental::measurement::base::Reader> hdf5_meas, const std::string& meas_dir = "", bool use_receive_timestamp = true);
+  /**
+   * @brief Creates the frame table of the given measurement
+   *
+   * @param hdf5_meas                The measurement
+   * @param meas_dir                 The directory of the measurement
+   * @param use_receive_timestamp    Whether to play the frames by their receive timestamp (true) or their send timestamp (false)
+   * @param use_frame_table_cache    Whether to load the frame table from / save it to a cache file in the measurement directory
+   */
+  MeasurementContainer(std::shared_ptr<eCAL::experimental::measurement::base::Reader> hdf5_meas, const std::string& meas_dir = "", bool use_receive_timestamp = true, bool use_frame_table_cache = false);
   ~MeasurementContainer();
 
   void CreatePublishers();
@@ -40,7 +53,33 @@ public:
   void ClearMessageCounters();
   bool PublishersCreated() const;
 
-  bool PublishFrame(long long index);
+  /**
+   * @brief Publishes the given frame and reads the following frames ahead
+   *
+   * The frames following the given one in playback order (i.e. as returned
+   * by @see{GetNextEnabledFrameIndex()} with the given parameters) are read
+   * ahead on the I/O thread of the prefetcher.
+   *
+   * @param index                    The frame to publish
+   * @param repeat_from_beginning    Whether the playback will wrap around at the end of the limit interval
+   * @param limit_interval           The limit interval of the playback
+   *
+   * @return True if the frame has been published
+   */
+  bool PublishFrame(long long index, bool repeat_from_beginning, std::pair<long long, long long> limit_interval);
+
+  /**
+   * @brief Reads the payload of the given frame from the measurement (thread safe)
+   *
+   * @param index    The frame to read
+   * @param data     The payload, resized to the size of the frame
+   *
+   * @return True if successfull
+   */
+  bool ReadFrameData(long long index, std::vector<char>& data) const;
+
+  void SetPrefetchLookAhead(std::chrono::nanoseconds look_ahead_time, size_t look_ahead_size);
+  EcalPlayPrefetchStatistics GetPrefetchStatistics() const;
 
   void CalculateEstimatedSizeForChannels();
 
@@ -80,7 +119,20 @@ public:
   std::map<std::string, ContinuityReport> CreateContinuityReport() const;
 
 private:
-  void CreateFrameTable();
+  struct PublisherInfo;
+
+  void CreateFrameTable(bool use_frame_table_cache);
+
+  /**
+   * @brief Computes a fingerprint of the measurement that changes, whenever the frame table cache has to be rebuilt
+   *
+   * The fingerprint covers the names and sizes of the HDF5 files in the
+   * measurement directory, the channel names and their timestamp ranges and
+   * the selected timestamp.
+   */
+  uint64_t CalculateFrameTableFingerprint() const;
+
+  PublisherInfo* GetPublisherInfo(long long index) const;
 
 ////////////////////////////////////////////////////////////////////////////////
 //// Member Variables                                                       ////
@@ -98,27 +150,20 @@ private:
     {}
   };
 
-  struct MeasurementFrame
-  {
-    long long                          id_;
-    eCAL::Time::ecal_clock::time_point receive_timestamp_;
-    eCAL::Time::ecal_clock::time_point send_timestamp_;
-    std::string                        channel_name_;
-    long long                          send_id_;
-    PublisherInfo*                     publisher_info_;
-  };
-
   std::shared_ptr<eCAL::experimental::measurement::base::Reader>      hdf5_meas_;
+  mutable std::mutex                                    hdf5_meas_read_mutex_;  // The entry data is read by the prefetcher and the player
   std::string                                           meas_dir_;
   bool                                                  use_receive_timestamp_;
 
-  std::vector<MeasurementFrame>           frame_table_;
+  FrameTable                              frame_table_;
+  std::vector<PublisherInfo*>             channel_publishers_;              // The publisher of each channel of the frame_table_ (nullptr if the channel is not published)
   std::map<std::string, size_t>           total_estimated_channel_size_map_;
   std::map<std::string, PublisherInfo>    publisher_map_;
   bool                                    publishers_initialized_;
 
   static const size_t                     MIN_SEND_BUFFER_SIZE = 10 * 1024 * 1024;
-  size_t                                  allocated_buffer_size_;
-  void*                                   send_buffer_;
+  std::vector<char>                       send_buffer_;
+
+  std::unique_ptr<FramePrefetcher>        prefetcher_;
 };
 
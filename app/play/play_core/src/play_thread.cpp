@@ -30,7 +30,10 @@
 #include "ecal_play_logger.h"
 
 PlayThread::PlayThread()
-  : time_log_complete_time_span_(0)
+  : frame_table_cache_enabled_  (false)
+  , prefetch_look_ahead_time_   (FramePrefetcher::DEFAULT_LOOK_AHEAD_TIME)
+  , prefetch_look_ahead_size_   (FramePrefetcher::DEFAULT_LOOK_AHEAD_SIZE)
+  , time_log_complete_time_span_(0)
 {
   state_publisher_thread_ = std::make_unique<StatePublisherThread>(*this);
   state_publisher_thread_->Start();
@@ -147,7 +150,7 @@ void PlayThread::Run()
       // Publish the desired frame
       if (measurement_container_)
       {
-        measurement_container_->PublishFrame(command.next_frame_index_);
+        measurement_container_->PublishFrame(command.next_frame_index_, command.repeat_enabled_, command.limit_interval_);
 
         auto elapsed_time = frame_stopwatch_.GetElapsedTimeAndRestart();
         
@@ -582,7 +585,18 @@ void PlayThread::SetMeasurement(const std::shared_ptr<eCAL::experimental::measur
 
   if (measurement)
   {
-    new_measurment_container = std::make_unique<MeasurementContainer>(measurement, path);
+    bool                     frame_table_cache_enabled;
+    std::chrono::nanoseconds prefetch_look_ahead_time;
+    size_t                   prefetch_look_ahead_size;
+    {
+      std::shared_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+      frame_table_cache_enabled = frame_table_cache_enabled_;
+      prefetch_look_ahead_time  = prefetch_look_ahead_time_;
+      prefetch_look_ahead_size  = prefetch_look_ahead_size_;
+    }
+
+    new_measurment_container = std::make_unique<MeasurementContainer>(measurement, path, true, frame_table_cache_enabled);
+    new_measurment_container->SetPrefetchLookAhead(prefetch_look_ahead_time, prefetch_look_ahead_size);
   }
 
   {
@@ -640,6 +654,19 @@ void PlayThread::SetMeasurement(const std::shared_ptr<eCAL::experimental::measur
   state_publisher_thread_->PublishNow();
 }
 
+void PlayThread::SetFrameTableCacheEnabled(bool enabled)
+{
+  EcalPlayLogger::Instance()->info("Setting frame table cache to:      " + std::string(enabled ? "True" : "False"));
+  std::unique_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  frame_table_cache_enabled_ = enabled;
+}
+
+bool PlayThread::IsFrameTableCacheEnabled()
+{
+  std::shared_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  return frame_table_cache_enabled_;
+}
+
 bool PlayThread::IsMeasurementLoaded()
 {
   std::shared_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
@@ -874,6 +901,28 @@ void PlayThread::SetEnforceDelayAccuracyEnabled(bool enabled)
   command_.enforce_delay_accuracy_ = enabled;
 }
 
+void PlayThread::SetPrefetchLookAheadTime(std::chrono::nanoseconds look_ahead_time)
+{
+  EcalPlayLogger::Instance()->info("Setting prefetch look-ahead time:  " + std::to_string(std::chrono::duration_cast<std::chrono::duration<double>>(look_ahead_time).count()) + " s");
+  std::unique_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  prefetch_look_ahead_time_ = look_ahead_time;
+  if (measurement_container_)
+  {
+    measurement_container_->SetPrefetchLookAhead(prefetch_look_ahead_time_, prefetch_look_ahead_size_);
+  }
+}
+
+void PlayThread::SetPrefetchLookAheadSize(size_t look_ahead_size)
+{
+  EcalPlayLogger::Instance()->info("Setting prefetch look-ahead size:  " + std::to_string(look_ahead_size) + " bytes");
+  std::unique_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  prefetch_look_ahead_size_ = look_ahead_size;
+  if (measurement_container_)
+  {
+    measurement_container_->SetPrefetchLookAhead(prefetch_look_ahead_time_, prefetch_look_ahead_size_);
+  }
+}
+
 bool PlayThread::IsRepeatEnabled()
 {
   std::lock_guard<std::mutex> command_lock(command_mutex_);
@@ -904,6 +953,18 @@ bool PlayThread::IsEnforceDelayAccuracyEnabled()
   return command_.enforce_delay_accuracy_;
 }
 
+std::chrono::nanoseconds PlayThread::GetPrefetchLookAheadTime()
+{
+  std::shared_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  return prefetch_look_ahead_time_;
+}
+
+size_t PlayThread::GetPrefetchLookAheadSize()
+{
+  std::shared_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  return prefetch_look_ahead_size_;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //// Playback                                                               ////
@@ -1013,8 +1074,8 @@ bool PlayThread::StepForward()
       measurement_container_->CreatePublishers();
     }
 
-    // publish the frame
-    measurement_container_->PublishFrame(command.next_frame_index_);
+    // publish the frame (the frames are read ahead the same way as when playing)
+    measurement_container_->PublishFrame(command.next_frame_index_, command.repeat_enabled_, command.limit_interval_);
 
     // Calculate the next frame (We always loop when stepping forward, as it would otherwise not be defined what to do when we reached the end)
     long long next_frame_index = measurement_container_->GetNextEnabledFrameIndex(command.next_frame_index_, true, command.limit_interval_);
@@ -1193,6 +1254,19 @@ EcalPlayState PlayThread::GetCurrentPlayState()
   return state;
 }
 
+EcalPlayPrefetchStatistics PlayThread::GetPrefetchStatistics()
+{
+  std::shared_lock<std::shared_timed_mutex> measurement_lock(measurement_mutex_);
+  if (measurement_container_)
+  {
+    return measurement_container_->GetPrefetchStatistics();
+  }
+  else
+  {
+    return EcalPlayPrefetchStatistics();
+  }
+}
+
 bool PlayThread::IsPlaying()
 {
   std::lock_guard<std::mutex> command_lock_(command_mutex_);
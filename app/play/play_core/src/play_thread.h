@@ -81,6 +81,29 @@ public:
    */
   void SetMeasurement(const std::shared_ptr<eCAL::experimental::measurement::base::Reader>& measurement, const std::string& path = "");
 
+  /**
+   * @brief Cache the frame table of measurements in their directory
+   *
+   * If enabled, the frame table (i.e. the list of all frames sorted by their
+   * timestamps) is written to a file in the measurement directory when a
+   * measurement is loaded. When the measurement is loaded again, the table is
+   * mapped from that file instead of being rebuilt, as long as the
+   * measurement has not changed.
+   *
+   * The setting is applied to the next measurement that is loaded.
+   *
+   * The default value is @code{false}.
+   *
+   * @param enabled    Whether the frame table should be cached
+   */
+  void SetFrameTableCacheEnabled(bool enabled);
+
+  /**
+   * @brief Checks whether the frame table of measurements is cached in their directory
+   * @return Whether the frame table is cached
+   */
+  bool IsFrameTableCacheEnabled();
+
   /**
    * @brief Returns whether a measurement has successfully been loaded
    * @return True if a measurement is loaded
@@ -351,6 +374,32 @@ public:
    */
   void SetEnforceDelayAccuracyEnabled(bool enabled);
 
+  /**
+   * @brief Sets the measurement time span that is read ahead of the playback
+   *
+   * The upcoming frames are read from the measurement on an I/O thread, so
+   * the player does not have to wait for the measurement when publishing
+   * them. The read-ahead stops, when either the time span or the size set by
+   * @see{SetPrefetchLookAheadSize()} is reached. A value of 0 disables this
+   * limit. If both are 0, the frames are read synchronously.
+   *
+   * The default value is 500ms.
+   *
+   * @param look_ahead_time    The measurement time span to read ahead
+   */
+  void SetPrefetchLookAheadTime(std::chrono::nanoseconds look_ahead_time);
+
+  /**
+   * @brief Sets the payload size that is read ahead of the playback
+   *
+   * @see{SetPrefetchLookAheadTime()}
+   *
+   * The default value is 64 MiB.
+   *
+   * @param look_ahead_size    The payload size to read ahead in bytes
+   */
+  void SetPrefetchLookAheadSize(size_t look_ahead_size);
+
   /**
    * @brief Checks whether the player starts from the beginning, if the measurement end has been reached
    * The default value is @code{false}.
@@ -430,6 +479,18 @@ public:
    */
   bool IsEnforceDelayAccuracyEnabled();
 
+  /**
+   * @brief Gets the measurement time span that is read ahead of the playback
+   * @return The measurement time span that is read ahead
+   */
+  std::chrono::nanoseconds GetPrefetchLookAheadTime();
+
+  /**
+   * @brief Gets the payload size that is read ahead of the playback
+   * @return The payload size in bytes that is read ahead
+   */
+  size_t GetPrefetchLookAheadSize();
+
   //////////////////////////////////////////////////////////////////////////////
   //// Playback                                                             ////
   //////////////////////////////////////////////////////////////////////////////
@@ -582,6 +643,16 @@ public:
    */
   EcalPlayState GetCurrentPlayState();
 
+  /**
+   * @brief Returns the statistics of reading frames ahead of the playback
+   *
+   * The statistics tell how often the playback had to wait for the
+   * measurement I/O. They are reset when a new measurement is loaded.
+   *
+   * @return The read-ahead statistics of the current measurement
+   */
+  EcalPlayPrefetchStatistics GetPrefetchStatistics();
+
   /**
    * @brief Checks whether the playback is running
    * @return True if the playback is running
@@ -830,6 +901,9 @@ private:
   // Measurement
   std::shared_timed_mutex               measurement_mutex_;                     /**< A mutex that protects the measurement_container_. When the measurement_container_ is modified internally or replaced with another one, this mutex must be locked unique. */
   std::unique_ptr<MeasurementContainer> measurement_container_;                 /**< The wrapped measurement */
+  bool                                  frame_table_cache_enabled_;             /**< Whether the frame table of the next measurement_container_ is cached in the measurement directory. Protected by the measurement_mutex_. */
+  std::chrono::nanoseconds              prefetch_look_ahead_time_;              /**< The measurement time span that is read ahead. Protected by the measurement_mutex_, as it is applied to every new measurement_container_. */
+  size_t                                prefetch_look_ahead_size_;              /**< The payload size that is read ahead. Protected by the measurement_mutex_, as it is applied to every new measurement_container_. */
 
   // State
   std::mutex               command_mutex_;                                      /**< A mutex protecting the command_, time_log_ and time_log_complete_time_span_ variables. It is also the mutex for the pause_cv_ condition variable used for pausing the playback and waiting between frames. */
@@ -83,6 +83,14 @@ void StatePublisherThread::PublishState()
     auto meas_boundaries = play_thread_.GetMeasurementBoundaries();
     meas_info->set_first_timestamp_nsecs(std::chrono::duration_cast<std::chrono::nanoseconds>(meas_boundaries.first.time_since_epoch()).count());
     meas_info->set_last_timestamp_nsecs (std::chrono::duration_cast<std::chrono::nanoseconds>(meas_boundaries.second.time_since_epoch()).count());
+
+    auto prefetch_statistics    = play_thread_.GetPrefetchStatistics();
+    auto prefetch_statistics_pb = state_pb.mutable_prefetch_statistics();
+    prefetch_statistics_pb->set_published_frame_count(prefetch_statistics.published_frame_count_);
+    prefetch_statistics_pb->set_io_wait_count        (prefetch_statistics.io_wait_count_);
+    prefetch_statistics_pb->set_io_wait_time_nsecs   (prefetch_statistics.io_wait_time_.count());
+    prefetch_statistics_pb->set_buffered_frame_count (prefetch_statistics.buffered_frame_count_);
+    prefetch_statistics_pb->set_buffered_bytes       (prefetch_statistics.buffered_bytes_);
   }
 
   auto settings = state_pb.mutable_settings();
@@ -94,6 +102,8 @@ void StatePublisherThread::PublishState()
   auto limit_interval = play_thread_.GetLimitInterval();
   settings->set_limit_interval_lower_index    (limit_interval.first);
   settings->set_limit_interval_upper_index    (limit_interval.second);
+  settings->set_prefetch_look_ahead_time_nsecs(play_thread_.GetPrefetchLookAheadTime().count());
+  settings->set_prefetch_look_ahead_size      (play_thread_.GetPrefetchLookAheadSize());
 
   state_publisher_.Send(state_pb);
 }
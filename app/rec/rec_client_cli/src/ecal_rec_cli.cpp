@@ -88,6 +88,9 @@ int main(int argc, char** argv)
 
   // Settings args
   TCLAP::ValueArg<double>       pre_buffer_arg     ("b", "pre-buffer",      "Pre-buffer data for some seconds",                                                                                                                                       false, -1.0, "seconds");
+  TCLAP::ValueArg<unsigned int> pre_buffer_memory_arg("", "pre-buffer-memory", "Limit the memory of the pre-buffer. Older frames are moved to the --pre-buffer-spill-file or dropped.",                                                            false, 0, "megabytes");
+  TCLAP::ValueArg<std::string>  spill_file_arg     ("",  "pre-buffer-spill-file", "Memory mapped scratch file for pre-buffered frames exceeding the --pre-buffer-memory limit. The file is deleted on exit.",                                     false, "", "path");
+  TCLAP::ValueArg<unsigned int> spill_file_size_arg("",  "pre-buffer-spill-size", "Size of the --pre-buffer-spill-file",                                                                                                                                 false, 0, "megabytes");
   TCLAP::ValueArg<std::string>  blacklist_arg      ("",  "blacklist",       "Record all topics except the listed ones (Comma separated list, e.g.: \"Topic1,Topic2\")",                                                                               false, "", "list");
   TCLAP::ValueArg<std::string>  whitelist_arg      ("",  "whitelist",       "Only record these topics (Comma separated list, e.g.: \"Topic1,Topic2\")",                                                                                               false, "", "list");
   TCLAP::ValueArg<std::string>  host_filter_arg    ("f", "hosts",           "Only record a topic when it is published by any of these hosts (Comma-separated list, e.g.: \"Computer1,Computer2\")",                                                   false, "", "list");
@@ -102,6 +105,7 @@ int main(int argc, char** argv)
   TCLAP::ValueArg<std::string>  meas_name_arg      ("n", "meas-name",       "Name of the measurement, when --" + record_arg.getName() + " is set. This will create a folder in the directory provided by --" + meas_root_dir_arg.getName() + ".",     false, "", "directory");
   TCLAP::ValueArg<unsigned int> max_file_size_arg  ("",  "max-file-size",   "Maximum file size of the recording files, when --" + record_arg.getName() + " is set.",                                                                                  false, 100, "megabytes");
   TCLAP::ValueArg<std::string>  description_arg    ("",  "description",     "Description stored in the measurement folder, when --" + record_arg.getName() + " is set.",                                                                              false, "", "string");
+  TCLAP::ValueArg<std::string>  compress_arg       ("",  "compress",        "Record these topics deflate compressed, when --" + record_arg.getName() + " is set (Comma separated list, e.g.: \"Topic1,Topic2\")",                                   false, "", "list");
 
   // Various args
   TCLAP::SwitchArg              list_addons_arg    ("",  "list-addons",     "Lists addons and exit.",                                                                                                                                                  false);
@@ -109,6 +113,9 @@ int main(int argc, char** argv)
   std::vector<TCLAP::Arg*> arg_vector =
   {
     &pre_buffer_arg,
+    &pre_buffer_memory_arg,
+    &spill_file_arg,
+    &spill_file_size_arg,
     &blacklist_arg,
     &whitelist_arg,
     &host_filter_arg,
@@ -119,6 +126,7 @@ int main(int argc, char** argv)
     &meas_name_arg,
     &max_file_size_arg,
     &description_arg,
+    &compress_arg,
     &list_addons_arg,
   };
   
@@ -170,6 +178,19 @@ int main(int argc, char** argv)
     ecal_rec->SetMaxPreBufferLength(buffer_length);
   }
 
+  if (pre_buffer_memory_arg.isSet())
+  {
+    ecal_rec->SetMaxPreBufferMemory(static_cast<uint64_t>(pre_buffer_memory_arg.getValue()) * 1024 * 1024);
+  }
+
+  if (spill_file_arg.isSet())
+  {
+    if (!ecal_rec->SetPreBufferSpillFile(spill_file_arg.getValue(), static_cast<uint64_t>(spill_file_size_arg.getValue()) * 1024 * 1024))
+    {
+      std::cerr << "Error creating pre-buffer spill file \"" << spill_file_arg.getValue() << "\"" << std::endl;
+    }
+  }
+
   //////////////////////////////////
   // Blacklist / whitelist
   //////////////////////////////////
@@ -285,6 +306,21 @@ int main(int argc, char** argv)
     {
       job_config.SetDescription(description_arg.getValue());
     }
+    //////////////////////////////////
+    // compress
+    //////////////////////////////////
+    if (compress_arg.isSet())
+    {
+      std::list<std::string> compress_list;
+      EcalUtils::String::Split(compress_arg.getValue(), ",", compress_list);
+
+      std::set<std::string> compressed_topics;
+      for (const auto& topic : compress_list)
+      {
+        compressed_topics.emplace(EcalUtils::String::Trim(topic));
+      }
+      job_config.SetCompressedTopics(compressed_topics);
+    }
 
     ecal_rec->ConnectToEcal();
     ecal_rec->StartRecording(job_config);
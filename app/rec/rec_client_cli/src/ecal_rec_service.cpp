@@ -54,6 +54,9 @@ void EcalRecService::GetConfig(::google::protobuf::RpcController*        /*contr
   std::replace(max_pre_buffer_length_secs_string.begin(), max_pre_buffer_length_secs_string.end(), decimal_point, '.');
   (*config_item_map)["max_pre_buffer_length_secs"] = max_pre_buffer_length_secs_string;
   (*config_item_map)["pre_buffering_enabled"]      = (ecal_rec_->IsPreBufferingEnabled() ? "true" : "false");
+  (*config_item_map)["max_pre_buffer_memory_mib"]  = std::to_string(ecal_rec_->GetMaxPreBufferMemory() / (1024 * 1024));
+  (*config_item_map)["pre_buffer_spill_file"]      = ecal_rec_->GetPreBufferSpillFilePath();
+  (*config_item_map)["pre_buffer_spill_file_size_mib"] = std::to_string(ecal_rec_->GetPreBufferSpillFileSize() / (1024 * 1024));
   (*config_item_map)["host_filter"]                = EcalUtils::String::Join("\n", ecal_rec_->GetHostsFilter());
   std::string record_mode_string;
   switch (ecal_rec_->GetRecordMode())
@@ -119,6 +122,64 @@ void EcalRecService::SetConfig(::google::protobuf::RpcController*        /*contr
     ecal_rec_->SetPreBufferingEnabled(pre_buffering_enabled);
   }
 
+  //////////////////////////////////////
+  // max_pre_buffer_memory_mib        //
+  //////////////////////////////////////
+  if (config_item_map.find("max_pre_buffer_memory_mib") != config_item_map.end())
+  {
+    std::string max_pre_buffer_memory_mib_string = config_item_map["max_pre_buffer_memory_mib"];
+    unsigned long long max_pre_buffer_memory_mib = 0;
+    try
+    {
+      max_pre_buffer_memory_mib = std::stoull(max_pre_buffer_memory_mib_string);
+    }
+    catch (const std::exception& e)
+    {
+      response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+      response->set_error("Error parsing value \"" + max_pre_buffer_memory_mib_string + "\": " + e.what());
+      return;
+    }
+
+    ecal_rec_->SetMaxPreBufferMemory(static_cast<uint64_t>(max_pre_buffer_memory_mib) * 1024 * 1024);
+  }
+
+  //////////////////////////////////////
+  // pre_buffer_spill_file            //
+  //////////////////////////////////////
+  if ((config_item_map.find("pre_buffer_spill_file") != config_item_map.end())
+    || (config_item_map.find("pre_buffer_spill_file_size_mib") != config_item_map.end()))
+  {
+    std::string        spill_file_path     = ecal_rec_->GetPreBufferSpillFilePath();
+    unsigned long long spill_file_size_mib = ecal_rec_->GetPreBufferSpillFileSize() / (1024 * 1024);
+
+    if (config_item_map.find("pre_buffer_spill_file") != config_item_map.end())
+    {
+      spill_file_path = config_item_map["pre_buffer_spill_file"];
+    }
+
+    if (config_item_map.find("pre_buffer_spill_file_size_mib") != config_item_map.end())
+    {
+      std::string spill_file_size_mib_string = config_item_map["pre_buffer_spill_file_size_mib"];
+      try
+      {
+        spill_file_size_mib = std::stoull(spill_file_size_mib_string);
+      }
+      catch (const std::exception& e)
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error parsing value \"" + spill_file_size_mib_string + "\": " + e.what());
+        return;
+      }
+    }
+
+    if (!ecal_rec_->SetPreBufferSpillFile(spill_file_path, static_cast<uint64_t>(spill_file_size_mib) * 1024 * 1024))
+    {
+      response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+      response->set_error("Error creating pre-buffer spill file \"" + spill_file_path + "\"");
+      return;
+    }
+  }
+
   //////////////////////////////////////
   // host_filter                      //
   //////////////////////////////////////
@@ -636,6 +697,22 @@ bool EcalRecService::strToBool(const std::string& str)
     }
   }
 
+  //////////////////////////////////////
+  // compressed_topics                //
+  //////////////////////////////////////
+  {
+    std::set<std::string> compressed_topics;
+
+    auto it = config.items().find("compressed_topics");
+    if (it != config.items().end())
+    {
+      EcalUtils::String::Split(it->second, "\n", compressed_topics);
+      compressed_topics.erase("");
+    }
+
+    job_config.SetCompressedTopics(compressed_topics);
+  }
+
   //////////////////////////////////////
   // description                      //
   //////////////////////////////////////
@@ -59,6 +59,30 @@ namespace eCAL
 
       std::chrono::steady_clock::duration GetMaxPreBufferLength() const;
 
+      /**
+       * @brief Limits the payload memory of the pre-buffer (0 = unlimited)
+       *
+       * When exceeding the limit, the oldest frames are moved to the spill
+       * file (if set) or dropped from the pre-buffer.
+       */
+      void SetMaxPreBufferMemory(uint64_t max_pre_buffer_memory);
+
+      uint64_t GetMaxPreBufferMemory() const;
+
+      /**
+       * @brief Sets a memory mapped scratch file for pre-buffered frames exceeding the memory limit
+       *
+       * The file is created with the given size and deleted when it is not
+       * needed anymore. An empty path or a size of 0 removes the spill file.
+       *
+       * @return False if the file could not be created (the pre-buffer will not spill frames then)
+       */
+      bool SetPreBufferSpillFile(const std::string& spill_file_path, uint64_t spill_file_size);
+
+      std::string GetPreBufferSpillFilePath() const;
+
+      uint64_t GetPreBufferSpillFileSize() const;
+
       bool IsPreBufferingEnabled() const;
 
       std::pair<size_t, std::chrono::steady_clock::duration> GetCurrentPreBufferLength() const;
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <chrono>
+#include <set>
 
 namespace eCAL
 {
@@ -55,6 +56,9 @@ namespace eCAL
       void SetOneFilePerTopicEnabled(bool enabled);
       bool GetOneFilePerTopicEnabled() const;
 
+      void SetCompressedTopics(const std::set<std::string>& compressed_topics);
+      std::set<std::string> GetCompressedTopics() const;
+
       void SetDescription(const std::string& description);
       std::string GetDescription() const;
 
@@ -76,6 +80,7 @@ namespace eCAL
       std::string  meas_name_;
       int64_t      max_file_size_mb_;
       bool         one_file_per_topic_;
+      std::set<std::string> compressed_topics_;                                 /**< Topics that are recorded deflate compressed */
       std::string  description_;
     };
   }
@@ -25,6 +25,7 @@
 #include <set>
 #include <vector>
 #include <chrono>
+#include <cstdint>
 
 #include <ecal/ecal_time.h>
 
@@ -34,14 +35,26 @@ namespace eCAL
   {
     struct RecHdf5JobStatus
     {
-      RecHdf5JobStatus() : total_length_(0), total_frame_count_(0), unflushed_frame_count_(0), info_{ true, "" } {}
+      RecHdf5JobStatus() : total_length_(0), total_frame_count_(0), unflushed_frame_count_(0), average_batch_size_(0.0), written_frames_per_second_(0.0), written_bytes_per_second_(0.0), info_{ true, "" } {}
 
       std::chrono::steady_clock::duration total_length_;
       int64_t                             total_frame_count_;
       int64_t                             unflushed_frame_count_;
+      double                              average_batch_size_;                  /**< Average number of frames written to the HDF5 file at once */
+      double                              written_frames_per_second_;
+      double                              written_bytes_per_second_;
       std::pair<bool, std::string>        info_;
 
-      bool operator==(const RecHdf5JobStatus& other) const { return (total_length_ == other.total_length_) && (total_frame_count_ == other.total_frame_count_) && (unflushed_frame_count_ == other.unflushed_frame_count_) && (info_ == other.info_); }
+      bool operator==(const RecHdf5JobStatus& other) const
+      {
+        return (total_length_            == other.total_length_)
+          && (total_frame_count_         == other.total_frame_count_)
+          && (unflushed_frame_count_     == other.unflushed_frame_count_)
+          && (average_batch_size_        == other.average_batch_size_)
+          && (written_frames_per_second_ == other.written_frames_per_second_)
+          && (written_bytes_per_second_  == other.written_bytes_per_second_)
+          && (info_                      == other.info_);
+      }
       bool operator!=(const RecHdf5JobStatus& other) const { return !operator==(other); }
     };
 
@@ -145,11 +158,14 @@ namespace eCAL
 
     struct RecorderStatus
     {
-      RecorderStatus() : pid_(-1), timestamp_(eCAL::Time::ecal_clock::duration(0)), initialized_(false), pre_buffer_length_{ 0, std::chrono::steady_clock::duration(0) }, info_{ true, "" } {}
+      RecorderStatus() : pid_(-1), timestamp_(eCAL::Time::ecal_clock::duration(0)), initialized_(false), pre_buffer_length_{ 0, std::chrono::steady_clock::duration(0) }, frame_pool_hit_rate_(0.0), frame_memory_in_use_(0), frame_memory_high_water_mark_(0), info_{ true, "" } {}
       int                                                     pid_;
       eCAL::Time::ecal_clock::time_point                      timestamp_;
       bool                                                    initialized_;
       std::pair<int64_t, std::chrono::steady_clock::duration> pre_buffer_length_;
+      double                                                  frame_pool_hit_rate_;           /**< Share of frame payloads that re-used a pooled buffer (0..1) */
+      uint64_t                                                frame_memory_in_use_;           /**< Bytes held by the frames of the pre-buffer and the recording queues */
+      uint64_t                                                frame_memory_high_water_mark_;
       std::set<std::string>                                   subscribed_topics_;
       std::vector<RecorderAddonStatus>                        addon_statuses_;
       std::vector<JobStatus>                                  job_statuses_;
@@ -158,13 +174,16 @@ namespace eCAL
 
       bool operator==(const RecorderStatus& other) const
       {
-        return (timestamp_       == other.timestamp_)
-          && (initialized_       == other.initialized_)
-          && (pre_buffer_length_ == other.pre_buffer_length_)
-          && (subscribed_topics_ == other.subscribed_topics_)
-          && (addon_statuses_    == other.addon_statuses_)
-          && (job_statuses_      == other.job_statuses_)
-          && (info_              == other.info_);
+        return (timestamp_                  == other.timestamp_)
+          && (initialized_                  == other.initialized_)
+          && (pre_buffer_length_            == other.pre_buffer_length_)
+          && (frame_pool_hit_rate_          == other.frame_pool_hit_rate_)
+          && (frame_memory_in_use_          == other.frame_memory_in_use_)
+          && (frame_memory_high_water_mark_ == other.frame_memory_high_water_mark_)
+          && (subscribed_topics_            == other.subscribed_topics_)
+          && (addon_statuses_               == other.addon_statuses_)
+          && (job_statuses_                 == other.job_statuses_)
+          && (info_                         == other.info_);
       }
       bool operator!=(const RecorderStatus& other) const { return !operator==(other); }
     };
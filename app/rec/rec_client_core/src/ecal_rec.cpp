@@ -66,6 +66,31 @@ namespace eCAL
       return recorder_->GetMaxPreBufferLength();
     }
 
+    void EcalRec::SetMaxPreBufferMemory(uint64_t max_pre_buffer_memory)
+    {
+      recorder_->SetMaxPreBufferMemory(max_pre_buffer_memory);
+    }
+
+    uint64_t EcalRec::GetMaxPreBufferMemory() const
+    {
+      return recorder_->GetMaxPreBufferMemory();
+    }
+
+    bool EcalRec::SetPreBufferSpillFile(const std::string& spill_file_path, uint64_t spill_file_size)
+    {
+      return recorder_->SetPreBufferSpillFile(spill_file_path, spill_file_size);
+    }
+
+    std::string EcalRec::GetPreBufferSpillFilePath() const
+    {
+      return recorder_->GetPreBufferSpillFilePath();
+    }
+
+    uint64_t EcalRec::GetPreBufferSpillFileSize() const
+    {
+      return recorder_->GetPreBufferSpillFileSize();
+    }
+
     bool EcalRec::IsPreBufferingEnabled() const
     {
       return recorder_->IsPreBufferingEnabled();
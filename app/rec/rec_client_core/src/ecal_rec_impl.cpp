@@ -58,6 +58,7 @@ namespace eCAL
                                                       }))
       , recording_recorder_job_(nullptr)
       , info_                  {true, ""}
+      , frame_pool_            (std::make_shared<FramePool>())
       , pre_buffer_            (false, std::chrono::steady_clock::duration(0))
       , connected_to_ecal_     (false)
       , record_mode_           (RecordMode::All)
@@ -126,6 +127,51 @@ namespace eCAL
       return pre_buffer_.get_max_buffer_length();
     }
 
+    void EcalRecImpl::SetMaxPreBufferMemory(uint64_t max_pre_buffer_memory)
+    {
+      pre_buffer_.set_max_buffer_memory(max_pre_buffer_memory);
+
+      EcalRecLogger::Instance()->info(std::string("Max pre-buffer memory: ") + (max_pre_buffer_memory > 0 ? std::to_string(max_pre_buffer_memory / (1024 * 1024)) + " MiB" : "unlimited"));
+    }
+
+    uint64_t EcalRecImpl::GetMaxPreBufferMemory() const
+    {
+      return pre_buffer_.get_max_buffer_memory();
+    }
+
+    bool EcalRecImpl::SetPreBufferSpillFile(const std::string& spill_file_path, uint64_t spill_file_size)
+    {
+      if (spill_file_path.empty() || (spill_file_size == 0))
+      {
+        pre_buffer_.set_spill_file(nullptr);
+        EcalRecLogger::Instance()->info("Pre-buffer spill file: none");
+        return true;
+      }
+
+      auto spill_file = std::make_shared<FrameSpillFile>();
+      if (!spill_file->Open(spill_file_path, spill_file_size))
+      {
+        pre_buffer_.set_spill_file(nullptr);
+        return false;
+      }
+
+      pre_buffer_.set_spill_file(spill_file);
+      EcalRecLogger::Instance()->info("Pre-buffer spill file: \"" + spill_file_path + "\" (" + std::to_string(spill_file_size / (1024 * 1024)) + " MiB)");
+      return true;
+    }
+
+    std::string EcalRecImpl::GetPreBufferSpillFilePath() const
+    {
+      auto spill_file = pre_buffer_.get_spill_file();
+      return (spill_file ? spill_file->GetPath() : "");
+    }
+
+    uint64_t EcalRecImpl::GetPreBufferSpillFileSize() const
+    {
+      auto spill_file = pre_buffer_.get_spill_file();
+      return (spill_file ? spill_file->GetSize() : 0);
+    }
+
     bool EcalRecImpl::IsPreBufferingEnabled() const
     {
       return pre_buffer_.is_enabled();
@@ -366,6 +412,12 @@ namespace eCAL
 
       // pre_buffer_length_
       recorder_status.pre_buffer_length_ = pre_buffer_.length();
+
+      // frame pool
+      const FramePool::Statistics frame_pool_statistics = frame_pool_->GetStatistics();
+      recorder_status.frame_pool_hit_rate_          = (frame_pool_statistics.allocation_count > 0 ? static_cast<double>(frame_pool_statistics.pool_hit_count) / frame_pool_statistics.allocation_count : 0.0);
+      recorder_status.frame_memory_in_use_          = frame_pool_statistics.memory_in_use;
+      recorder_status.frame_memory_high_water_mark_ = frame_pool_statistics.memory_high_water_mark;
       
       {
         std::shared_lock<decltype(recorder_mutex_)> recorder_lock(recorder_mutex_);
@@ -695,12 +747,12 @@ namespace eCAL
       return subscribed_topics;
     }
 
-    void EcalRecImpl::EcalMessageReceived(const char* topic_name, const eCAL::SReceiveCallbackData* callback_data)
+    void EcalRecImpl::EcalMessageReceived(const std::string* topic_name, const eCAL::SReceiveCallbackData* callback_data)
     {
       auto ecal_receive_time   = eCAL::Time::ecal_clock::now();
       auto system_receive_time = std::chrono::steady_clock::now();
 
-      std::shared_ptr<Frame> frame = std::make_shared<Frame>(callback_data, topic_name, ecal_receive_time, system_receive_time);
+      std::shared_ptr<Frame> frame = std::make_shared<Frame>(*frame_pool_, callback_data, topic_name, ecal_receive_time, system_receive_time);
 
       pre_buffer_.push_back(frame);
 
@@ -828,7 +880,9 @@ namespace eCAL
             info_ = { false, "Error creating eCAL subsribers" };
             continue;
           }
-          if (!subscriber->AddReceiveCallback(std::bind(&EcalRecImpl::EcalMessageReceived, this, std::placeholders::_1, std::placeholders::_2)))
+          // The frames reference the interned topic name instead of copying the name
+          const std::string* interned_topic_name = frame_pool_->InternTopicName(topic);
+          if (!subscriber->AddReceiveCallback([this, interned_topic_name](const char* /*topic_name*/, const eCAL::SReceiveCallbackData* callback_data) { EcalMessageReceived(interned_topic_name, callback_data); }))
           {
             EcalRecLogger::Instance()->error("Error adding callback for subscriber on topic " + topic);
             info_ = { false, "Error creating eCAL subsribers" };
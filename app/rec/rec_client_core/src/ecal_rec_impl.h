@@ -39,6 +39,7 @@
 #include "job/record_job.h"
 
 #include "frame_buffer.h"
+#include "frame_pool.h"
 
 #include <ecal/ecal_callback.h>
 #include <ecal/ecal_subscriber.h>
@@ -66,6 +67,13 @@ namespace eCAL
       void SetMaxPreBufferLength(std::chrono::steady_clock::duration max_pre_buffer_length);
       std::chrono::steady_clock::duration GetMaxPreBufferLength() const;
 
+      void SetMaxPreBufferMemory(uint64_t max_pre_buffer_memory);
+      uint64_t GetMaxPreBufferMemory() const;
+
+      bool SetPreBufferSpillFile(const std::string& spill_file_path, uint64_t spill_file_size);
+      std::string GetPreBufferSpillFilePath() const;
+      uint64_t GetPreBufferSpillFileSize() const;
+
       bool IsPreBufferingEnabled() const;
       std::pair<int64_t, std::chrono::steady_clock::duration> GetCurrentPreBufferLength() const;
 
@@ -115,7 +123,7 @@ namespace eCAL
 
       std::set<std::string> GetSubscribedTopics() const;
 
-      void EcalMessageReceived(const char* topic_name, const eCAL::SReceiveCallbackData* callback_data);
+      void EcalMessageReceived(const std::string* topic_name, const eCAL::SReceiveCallbackData* callback_data);
 
       //////////////////////////////////////
       //// API for external threads     ////
@@ -155,6 +163,9 @@ namespace eCAL
       std::unique_ptr<GarbageCollectorTriggerThread> garbage_collector_trigger_thread_; /** frame_buffer_, buffer_writer_threads_, max_pre_buffer_length_ */
       std::unique_ptr<MonitoringThread>              monitoring_thread_;                /** connected_to_ecal_, FilterAvailableTopics_NoLock(hosts_filter_, topic_whitelist_, topic_blacklist_), CreateNewSubscribers_NoLock(subscriber_map_), main_writer_thread_, buffer_writer_threads_ */
 
+      // Frame payload buffers and topic names
+      std::shared_ptr<FramePool>                     frame_pool_;             /** < Thread-safe, kept alive by the frames */
+
       // Pre-buffer
       FrameBuffer                                    pre_buffer_;             /** < Thread-safe framebuffer */
 
@@ -19,12 +19,14 @@
 
 #pragma once
 
-#include <vector>
+#include <cstring>
 #include <string>
 #include <chrono>
 #include <ecal/ecal_time.h>
 #include <ecal/ecal_callback.h>
 
+#include "frame_pool.h"
+
 namespace eCAL
 {
   namespace rec
@@ -32,16 +34,21 @@ namespace eCAL
     class Frame
     {
     public:
-      Frame(const eCAL::SReceiveCallbackData* const callback_data, const std::string& topic_name, const eCAL::Time::ecal_clock::time_point receive_time, std::chrono::steady_clock::time_point system_receive_time)
-        : ecal_publish_time_(std::chrono::duration_cast<eCAL::Time::ecal_clock::duration>(std::chrono::microseconds(callback_data->time)))
+      /**
+       * @param frame_pool  Pool to allocate the payload buffer from
+       * @param topic_name  Topic name interned by the frame pool (FramePool::InternTopicName())
+       */
+      Frame(FramePool& frame_pool, const eCAL::SReceiveCallbackData* const callback_data, const std::string* topic_name, const eCAL::Time::ecal_clock::time_point receive_time, std::chrono::steady_clock::time_point system_receive_time)
+        : data_(frame_pool.Allocate(static_cast<size_t>(callback_data->size)))
+        , ecal_publish_time_(std::chrono::duration_cast<eCAL::Time::ecal_clock::duration>(std::chrono::microseconds(callback_data->time)))
         , ecal_receive_time_(receive_time)
         , system_receive_time_(system_receive_time)
         , topic_name_(topic_name)
         , clock_(callback_data->clock)
         , id_(callback_data->id)
       {
-        data_.reserve(callback_data->size);
-        data_.assign((char*)callback_data->buf, (char*)callback_data->buf + callback_data->size);
+        if (callback_data->size > 0)
+          std::memcpy(data_.data(), callback_data->buf, static_cast<size_t>(callback_data->size));
       }
 
       Frame()
@@ -49,17 +56,27 @@ namespace eCAL
         , ecal_publish_time_(eCAL::Time::ecal_clock::time_point(eCAL::Time::ecal_clock::duration(0)))
         , ecal_receive_time_(eCAL::Time::ecal_clock::time_point(eCAL::Time::ecal_clock::duration(0)))
         , system_receive_time_(std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(0)))
+        , topic_name_(&NoTopicName())
         , clock_(0)
         , id_(0)
       {}
 
-      std::vector<char>                     data_;
+      const std::string& topic_name() const { return *topic_name_; }
+
+      FramePool::Buffer                     data_;
       eCAL::Time::ecal_clock::time_point    ecal_publish_time_;
       eCAL::Time::ecal_clock::time_point    ecal_receive_time_;
       std::chrono::steady_clock::time_point system_receive_time_;
-      std::string                           topic_name_;
+      const std::string*                    topic_name_;
       long long                             clock_;
       long long                             id_;
+
+    private:
+      static const std::string& NoTopicName()
+      {
+        static const std::string no_topic_name;
+        return no_topic_name;
+      }
     };
   }
-}
\ No newline at end of file
+}
@@ -19,6 +19,7 @@
 
 #include "frame_buffer.h"
 
+#include <cstring>
 #include <thread>
 
 namespace eCAL
@@ -29,6 +30,9 @@ namespace eCAL
     FrameBuffer::FrameBuffer(bool enabled, std::chrono::steady_clock::duration max_length)
       : is_enabled_(enabled)
       , max_buffer_length_(max_length)
+      , max_buffer_memory_(0)
+      , spilled_frame_count_(0)
+      , buffer_memory_(0)
     {}
 
     // Destructor
@@ -47,12 +51,12 @@ namespace eCAL
 
       // Clear just in case something has happend while the frame-buffer was disabled
       if (!is_enabled_)
-        frame_buffer_deque_.clear();
+        clear_no_lock();
 
       is_enabled_ = enabled;
 
       if (!is_enabled_)
-        frame_buffer_deque_.clear();
+        clear_no_lock();
     }
 
     std::chrono::steady_clock::duration FrameBuffer::get_max_buffer_length() const
@@ -68,12 +72,43 @@ namespace eCAL
       remove_old_frames_no_lock();
     }
 
+    uint64_t FrameBuffer::get_max_buffer_memory() const
+    {
+      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      return max_buffer_memory_;
+    }
+
+    void FrameBuffer::set_max_buffer_memory(uint64_t max_memory)
+    {
+      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      max_buffer_memory_ = max_memory;
+      limit_memory_no_lock();
+    }
+
+    std::shared_ptr<FrameSpillFile> FrameBuffer::get_spill_file() const
+    {
+      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      return spill_file_;
+    }
+
+    void FrameBuffer::set_spill_file(const std::shared_ptr<FrameSpillFile>& spill_file)
+    {
+      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+
+      // Frames that are already spilled keep the old file alive until they are dropped
+      spill_file_ = spill_file;
+      limit_memory_no_lock();
+    }
+
     void FrameBuffer::push_back(const std::shared_ptr<Frame>& frame)
     {
       std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
       if (is_enabled_)
       {
         frame_buffer_deque_.push_back(frame);
+        buffer_memory_ += frame->data_.size();
+
+        limit_memory_no_lock();
       }
     }
 
@@ -112,26 +147,82 @@ namespace eCAL
 
       if (!is_enabled_)
       {
-        frame_buffer_deque_.clear();
+        clear_no_lock();
       }
       else
       {
         auto oldest_timestamp_to_leave = now - max_buffer_length_;
-        auto it = frame_buffer_deque_.begin();
-        for (; it != frame_buffer_deque_.end(); it++)
+        while (!frame_buffer_deque_.empty()
+          && (frame_buffer_deque_.front()->system_receive_time_ < oldest_timestamp_to_leave))
         {
-          if ((*it)->system_receive_time_ >= oldest_timestamp_to_leave)
+          pop_front_no_lock();
+        }
+      }
+    }
+
+    void FrameBuffer::limit_memory_no_lock()
+    {
+      if (max_buffer_memory_ == 0)
+        return;
+
+      while ((buffer_memory_ > max_buffer_memory_) && !frame_buffer_deque_.empty())
+      {
+        // The spilled frames are always the oldest ones, so the buffer stays a contiguous time span
+        if (spill_file_ && (spilled_frame_count_ < frame_buffer_deque_.size()))
+        {
+          const std::shared_ptr<Frame>& oldest_frame = frame_buffer_deque_[spilled_frame_count_];
+          const size_t size = oldest_frame->data_.size();
+
+          // Frames that are also queued for a recording may be read right now. They stay
+          // in memory until the recording has written them, the next frame retries.
+          if (oldest_frame.use_count() > 1)
             break;
+
+          // Empty frames do not need any space
+          if (size == 0)
+          {
+            spilled_frame_count_++;
+            continue;
+          }
+
+          FrameMemory::Buffer spilled_data;
+          if (spill_file_->Allocate(size, spilled_data))
+          {
+            std::memcpy(spilled_data.data(), oldest_frame->data_.data(), size);
+            oldest_frame->data_ = std::move(spilled_data);
+
+            buffer_memory_ -= size;
+            spilled_frame_count_++;
+            continue;
+          }
         }
 
-        frame_buffer_deque_.erase(frame_buffer_deque_.begin(), it);
+        // The spill file is full (or there is none): drop the oldest frame, which frees its space in the spill file
+        pop_front_no_lock();
       }
     }
 
+    void FrameBuffer::pop_front_no_lock()
+    {
+      if (spilled_frame_count_ > 0)
+        spilled_frame_count_--;
+      else
+        buffer_memory_ -= frame_buffer_deque_.front()->data_.size();
+
+      frame_buffer_deque_.pop_front();
+    }
+
+    void FrameBuffer::clear_no_lock()
+    {
+      frame_buffer_deque_.clear();
+      spilled_frame_count_ = 0;
+      buffer_memory_       = 0;
+    }
+
     void FrameBuffer::clear()
     {
       std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
-      frame_buffer_deque_.clear();
+      clear_no_lock();
     }
 
     std::deque<std::shared_ptr<Frame>> FrameBuffer::get_as_deque() const
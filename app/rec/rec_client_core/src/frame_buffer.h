@@ -17,12 +17,14 @@
  * ========================= eCAL LICENSE =================================
 */
 
+#include <cstdint>
 #include <deque>
 #include <shared_mutex>
 #include <memory>
 #include <condition_variable>
 
 #include "frame.h"
+#include "frame_spill_file.h"
 
 namespace eCAL
 {
@@ -51,6 +53,17 @@ namespace eCAL
       std::chrono::steady_clock::duration get_max_buffer_length() const;
       void set_max_buffer_length(std::chrono::steady_clock::duration new_length);
 
+      // Maximum payload memory of the buffered frames in bytes (0 = unlimited). When
+      // exceeding it, the oldest frames are moved to the spill file, frames are only
+      // dropped if the spill file is full. Frames that are still held by a recording
+      // are not moved, they may exceed the budget until the recording released them.
+      uint64_t get_max_buffer_memory() const;
+      void set_max_buffer_memory(uint64_t max_memory);
+
+      // Memory mapped scratch file for frames exceeding the memory budget (nullptr = drop them)
+      std::shared_ptr<FrameSpillFile> get_spill_file() const;
+      void set_spill_file(const std::shared_ptr<FrameSpillFile>& spill_file);
+
       void push_back(const std::shared_ptr<Frame>& frame);
       //std::shared_ptr<Frame> pop_front();
 
@@ -63,6 +76,9 @@ namespace eCAL
 
     private:
       void remove_old_frames_no_lock();
+      void limit_memory_no_lock();
+      void pop_front_no_lock();
+      void clear_no_lock();
 
     private:
 
@@ -72,9 +88,13 @@ namespace eCAL
       // Settings
       bool                                is_enabled_;
       std::chrono::steady_clock::duration max_buffer_length_;
+      uint64_t                            max_buffer_memory_;
+      std::shared_ptr<FrameSpillFile>     spill_file_;
 
-      // Actual frame buffer
+      // Actual frame buffer. The first spilled_frame_count_ frames are moved to the spill file.
       std::deque<std::shared_ptr<Frame>>  frame_buffer_deque_;
+      size_t                              spilled_frame_count_;
+      uint64_t                            buffer_memory_;         // Payload memory of the frames that are not spilled
 
     };
   }
@@ -0,0 +1,87 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_memory.h"
+
+namespace eCAL
+{
+  namespace rec
+  {
+    ///////////////////////////////
+    // Buffer
+    ///////////////////////////////
+
+    FrameMemory::Buffer::~Buffer()
+    {
+      Release();
+    }
+
+    FrameMemory::Buffer::Buffer(Buffer&& other) noexcept
+      : memory_(std::move(other.memory_))
+      , data_  (other.data_)
+      , size_  (other.size_)
+      , tag_   (other.tag_)
+    {
+      other.data_ = nullptr;
+      other.size_ = 0;
+    }
+
+    FrameMemory::Buffer& FrameMemory::Buffer::operator=(Buffer&& other) noexcept
+    {
+      if (this != &other)
+      {
+        Release();
+
+        memory_ = std::move(other.memory_);
+        data_   = other.data_;
+        size_   = other.size_;
+        tag_    = other.tag_;
+
+        other.data_ = nullptr;
+        other.size_ = 0;
+      }
+      return *this;
+    }
+
+    void FrameMemory::Buffer::Release()
+    {
+      if (memory_)
+      {
+        memory_->Release(data_, size_, tag_);
+        memory_.reset();
+      }
+      data_ = nullptr;
+      size_ = 0;
+    }
+
+    ///////////////////////////////
+    // FrameMemory
+    ///////////////////////////////
+
+    FrameMemory::Buffer FrameMemory::MakeBuffer(char* data, size_t size, size_t tag)
+    {
+      Buffer buffer;
+      buffer.memory_ = shared_from_this();
+      buffer.data_   = data;
+      buffer.size_   = size;
+      buffer.tag_    = tag;
+      return buffer;
+    }
+  }
+}
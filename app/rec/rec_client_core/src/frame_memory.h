@@ -0,0 +1,83 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Memory that frame payload buffers are allocated from (frame pool, pre-buffer spill file)
+     *
+     * Must be created with std::make_shared, the buffers keep their memory alive.
+     */
+    class FrameMemory : public std::enable_shared_from_this<FrameMemory>
+    {
+    public:
+      /**
+       * @brief Payload buffer of a frame, returned to its memory on destruction
+       */
+      class Buffer
+      {
+      public:
+        Buffer() = default;
+        ~Buffer();
+
+        Buffer(const Buffer&)            = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+
+        const char* data() const { return data_; }
+        char*       data()       { return data_; }
+        size_t      size() const { return size_; }
+
+      private:
+        friend class FrameMemory;
+        void Release();
+
+        std::shared_ptr<FrameMemory> memory_;
+        char*                        data_ = nullptr;
+        size_t                       size_ = 0;
+        size_t                       tag_  = 0;
+      };
+
+      FrameMemory() = default;
+      virtual ~FrameMemory() = default;
+
+      FrameMemory(const FrameMemory&)            = delete;
+      FrameMemory& operator=(const FrameMemory&) = delete;
+      FrameMemory(FrameMemory&&)                 = delete;
+      FrameMemory& operator=(FrameMemory&&)      = delete;
+
+    protected:
+      /**
+       * @brief Hands out the given memory as buffer, Release() is called with the same arguments when it is dropped
+       */
+      Buffer MakeBuffer(char* data, size_t size, size_t tag);
+
+      virtual void Release(char* data, size_t size, size_t tag) = 0;
+    };
+  }
+}
@@ -0,0 +1,161 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_pool.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    namespace
+    {
+      constexpr size_t kMinSizeClassShift = 8;    // 256 byte
+      constexpr size_t kMaxSizeClassShift = 26;   // 64 MiB
+      constexpr size_t kNoSizeClass       = std::numeric_limits<size_t>::max();
+    }
+
+    FramePool::FramePool(uint64_t max_cached_memory)
+      : max_cached_memory_     (max_cached_memory)
+      , allocation_count_      (0)
+      , pool_hit_count_        (0)
+      , memory_in_use_         (0)
+      , memory_high_water_mark_(0)
+      , memory_cached_         (0)
+    {
+      // 4 size classes per power of two: 256, 320, 384, 448, 512, 640, ...
+      for (size_t shift = kMinSizeClassShift; shift < kMaxSizeClassShift; shift++)
+      {
+        for (size_t quarter = 4; quarter < 8; quarter++)
+        {
+          size_classes_.push_back(std::make_unique<SizeClass>());
+          size_classes_.back()->size = quarter << (shift - 2);
+        }
+      }
+      size_classes_.push_back(std::make_unique<SizeClass>());
+      size_classes_.back()->size = static_cast<size_t>(1) << kMaxSizeClassShift;
+    }
+
+    FramePool::~FramePool()
+    {
+      for (const auto& size_class : size_classes_)
+      {
+        for (char* buffer : size_class->free_buffers)
+        {
+          delete[] buffer;
+        }
+      }
+    }
+
+    FramePool::Buffer FramePool::Allocate(size_t size)
+    {
+      allocation_count_++;
+
+      auto size_class_it = std::lower_bound(size_classes_.begin(), size_classes_.end(), size
+                                          , [](const std::unique_ptr<SizeClass>& size_class, size_t size_) { return size_class->size < size_; });
+
+      char*  data       = nullptr;
+      size_t size_class = kNoSizeClass;
+      size_t allocated_size;
+      if (size_class_it == size_classes_.end())
+      {
+        // Too large for the pool
+        data           = new char[size];
+        allocated_size = size;
+      }
+      else
+      {
+        SizeClass& pool_size_class = **size_class_it;
+        size_class                 = static_cast<size_t>(size_class_it - size_classes_.begin());
+        allocated_size             = pool_size_class.size;
+
+        {
+          std::lock_guard<std::mutex> size_class_lock(pool_size_class.mutex);
+          if (!pool_size_class.free_buffers.empty())
+          {
+            data = pool_size_class.free_buffers.back();
+            pool_size_class.free_buffers.pop_back();
+          }
+        }
+
+        if (data != nullptr)
+        {
+          pool_hit_count_++;
+          memory_cached_ -= allocated_size;
+        }
+        else
+        {
+          data = new char[allocated_size];
+        }
+      }
+
+      const uint64_t memory_in_use   = (memory_in_use_ += allocated_size);
+      uint64_t       high_water_mark = memory_high_water_mark_.load(std::memory_order_relaxed);
+      while ((memory_in_use > high_water_mark)
+        && !memory_high_water_mark_.compare_exchange_weak(high_water_mark, memory_in_use, std::memory_order_relaxed))
+      {}
+
+      return MakeBuffer(data, size, size_class);
+    }
+
+    void FramePool::Release(char* data, size_t size, size_t size_class)
+    {
+      if (size_class == kNoSizeClass)
+      {
+        memory_in_use_ -= size;
+        delete[] data;
+        return;
+      }
+
+      SizeClass& pool_size_class = *size_classes_[size_class];
+      memory_in_use_ -= pool_size_class.size;
+
+      // Keep the buffer for the next frame, unless the pool already holds enough memory
+      if ((memory_cached_ += pool_size_class.size) <= max_cached_memory_)
+      {
+        std::lock_guard<std::mutex> size_class_lock(pool_size_class.mutex);
+        pool_size_class.free_buffers.push_back(data);
+      }
+      else
+      {
+        memory_cached_ -= pool_size_class.size;
+        delete[] data;
+      }
+    }
+
+    const std::string* FramePool::InternTopicName(const std::string& topic_name)
+    {
+      std::lock_guard<std::mutex> topic_names_lock(topic_names_mutex_);
+      return &(*topic_names_.insert(topic_name).first);
+    }
+
+    FramePool::Statistics FramePool::GetStatistics() const
+    {
+      Statistics statistics;
+      statistics.allocation_count       = allocation_count_;
+      statistics.pool_hit_count         = pool_hit_count_;
+      statistics.memory_in_use          = memory_in_use_;
+      statistics.memory_high_water_mark = memory_high_water_mark_;
+      statistics.memory_cached          = memory_cached_;
+      return statistics;
+    }
+  }
+}
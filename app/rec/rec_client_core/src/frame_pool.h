@@ -0,0 +1,101 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "frame_memory.h"
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Pool of frame payload buffers and interned topic names
+     *
+     * The payloads are allocated from size classes (4 classes per power of two,
+     * so at most 25% of a buffer is unused). Released buffers are kept for the
+     * next frame of the same size class, until max_cached_memory is reached.
+     * Payloads larger than the largest size class are allocated directly.
+     *
+     * Must be created with std::make_shared, the buffers keep the pool alive.
+     */
+    class FramePool : public FrameMemory
+    {
+    public:
+      static constexpr uint64_t kDefaultMaxCachedMemory = 256 * 1024 * 1024;
+
+      struct Statistics
+      {
+        uint64_t allocation_count       = 0;  /**< Number of allocated payload buffers */
+        uint64_t pool_hit_count         = 0;  /**< Number of allocations served from a released buffer */
+        uint64_t memory_in_use          = 0;  /**< Bytes held by frames */
+        uint64_t memory_high_water_mark = 0;  /**< Maximum of memory_in_use */
+        uint64_t memory_cached          = 0;  /**< Bytes held by the pool for re-use */
+      };
+
+      explicit FramePool(uint64_t max_cached_memory = kDefaultMaxCachedMemory);
+      ~FramePool() override;
+
+      /**
+       * @brief Allocates a buffer for a payload of the given size (thread safe)
+       */
+      Buffer Allocate(size_t size);
+
+      /**
+       * @brief Returns the interned copy of the topic name (thread safe)
+       *
+       * The returned name is valid for the lifetime of the pool and can be
+       * compared by its address.
+       */
+      const std::string* InternTopicName(const std::string& topic_name);
+
+      Statistics GetStatistics() const;
+
+    private:
+      struct SizeClass
+      {
+        size_t             size;
+        std::mutex         mutex;
+        std::vector<char*> free_buffers;
+      };
+
+      void Release(char* data, size_t size, size_t size_class) override;
+
+      const uint64_t                             max_cached_memory_;
+      std::vector<std::unique_ptr<SizeClass>>    size_classes_;
+
+      std::mutex                                 topic_names_mutex_;
+      std::unordered_set<std::string>            topic_names_;
+
+      std::atomic<uint64_t>                      allocation_count_;
+      std::atomic<uint64_t>                      pool_hit_count_;
+      std::atomic<uint64_t>                      memory_in_use_;
+      std::atomic<uint64_t>                      memory_high_water_mark_;
+      std::atomic<uint64_t>                      memory_cached_;
+    };
+  }
+}
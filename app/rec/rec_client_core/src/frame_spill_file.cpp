@@ -0,0 +1,234 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_spill_file.h"
+
+#include "rec_client_core/ecal_rec_logger.h"
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <ecal_utils/str_convert.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // WIN32
+
+namespace eCAL
+{
+  namespace rec
+  {
+    namespace
+    {
+      constexpr uint64_t kAllocationAlignment = 64;
+    }
+
+    FrameSpillFile::FrameSpillFile()
+      : size_          (0)
+      , data_          (nullptr)
+#ifdef WIN32
+      , file_handle_   (INVALID_HANDLE_VALUE)
+      , mapping_handle_(nullptr)
+#endif // WIN32
+      , memory_in_use_ (0)
+    {}
+
+    FrameSpillFile::~FrameSpillFile()
+    {
+      Close();
+    }
+
+    bool FrameSpillFile::Open(const std::string& path, uint64_t size)
+    {
+      Close();
+
+      if (size == 0)
+        return false;
+
+#ifdef WIN32
+      // The file is only needed as long as it is mapped
+      file_handle_ = ::CreateFileW(EcalUtils::StrConvert::Utf8ToWide(path).c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+      if (file_handle_ == INVALID_HANDLE_VALUE)
+      {
+        EcalRecLogger::Instance()->error("Unable to create pre-buffer spill file \"" + path + "\": error " + std::to_string(::GetLastError()));
+        return false;
+      }
+
+      mapping_handle_ = ::CreateFileMappingW(file_handle_, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+      if (mapping_handle_ != nullptr)
+      {
+        data_ = static_cast<char*>(::MapViewOfFile(mapping_handle_, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+      }
+
+      if (data_ == nullptr)
+      {
+        EcalRecLogger::Instance()->error("Unable to map pre-buffer spill file \"" + path + "\": error " + std::to_string(::GetLastError()));
+        Close();
+        return false;
+      }
+#else
+      int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+      if (fd < 0)
+      {
+        EcalRecLogger::Instance()->error("Unable to create pre-buffer spill file \"" + path + "\": " + std::strerror(errno));
+        return false;
+      }
+
+      // The file is only needed as long as it is mapped
+      ::unlink(path.c_str());
+
+#ifdef __linux__
+      // Reserve the disk space, running out of space when writing to a sparse file would crash the recorder (SIGBUS)
+      const int resize_error = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+#else
+      const int resize_error = (::ftruncate(fd, static_cast<off_t>(size)) == 0 ? 0 : errno);
+#endif // __linux__
+      if (resize_error != 0)
+      {
+        EcalRecLogger::Instance()->error("Unable to resize pre-buffer spill file \"" + path + "\" to " + std::to_string(size) + " bytes: " + std::strerror(resize_error));
+        ::close(fd);
+        return false;
+      }
+
+      void* data = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (data == MAP_FAILED)
+      {
+        EcalRecLogger::Instance()->error("Unable to map pre-buffer spill file \"" + path + "\": " + std::strerror(errno));
+        return false;
+      }
+      data_ = static_cast<char*>(data);
+#endif // WIN32
+
+      path_ = path;
+      size_ = size;
+      return true;
+    }
+
+    void FrameSpillFile::Close()
+    {
+#ifdef WIN32
+      if (data_ != nullptr)
+        ::UnmapViewOfFile(data_);
+      if (mapping_handle_ != nullptr)
+        ::CloseHandle(mapping_handle_);
+      if (file_handle_ != INVALID_HANDLE_VALUE)
+        ::CloseHandle(file_handle_);
+
+      mapping_handle_ = nullptr;
+      file_handle_    = INVALID_HANDLE_VALUE;
+#else
+      if (data_ != nullptr)
+        ::munmap(data_, static_cast<size_t>(size_));
+#endif // WIN32
+
+      data_ = nullptr;
+      size_ = 0;
+      path_.clear();
+    }
+
+    bool FrameSpillFile::Allocate(size_t size, Buffer& buffer)
+    {
+      if ((data_ == nullptr) || (size == 0))
+        return false;
+
+      const uint64_t allocation_size = (static_cast<uint64_t>(size) + kAllocationAlignment - 1) & ~(kAllocationAlignment - 1);
+
+      std::lock_guard<std::mutex> allocations_lock(allocations_mutex_);
+
+      uint64_t offset = 0;
+      if (!allocations_.empty())
+      {
+        const uint64_t oldest_offset = allocations_.front().offset;
+        const uint64_t newest_end    = allocations_.back().offset + allocations_.back().size;
+
+        if (newest_end > oldest_offset)
+        {
+          // Not wrapped: free space behind the newest allocation and in front of the oldest one
+          if (size_ - newest_end >= allocation_size)
+            offset = newest_end;
+          else if (oldest_offset >= allocation_size)
+            offset = 0;
+          else
+            return false;
+        }
+        else
+        {
+          // Wrapped: free space between the newest and the oldest allocation
+          if (oldest_offset - newest_end >= allocation_size)
+            offset = newest_end;
+          else
+            return false;
+        }
+      }
+      else if (allocation_size > size_)
+      {
+        return false;
+      }
+
+      allocations_.push_back({ offset, allocation_size, false });
+      memory_in_use_ += allocation_size;
+
+      buffer = MakeBuffer(data_ + offset, size, static_cast<size_t>(offset));
+      return true;
+    }
+
+    void FrameSpillFile::Release(char* /*data*/, size_t /*size*/, size_t offset)
+    {
+      std::lock_guard<std::mutex> allocations_lock(allocations_mutex_);
+
+      // The payloads are usually released in allocation order
+      for (auto& allocation : allocations_)
+      {
+        if (!allocation.released && (allocation.offset == offset))
+        {
+          allocation.released = true;
+          memory_in_use_     -= allocation.size;
+          break;
+        }
+      }
+
+      while (!allocations_.empty() && allocations_.front().released)
+      {
+        allocations_.pop_front();
+      }
+    }
+
+    const std::string& FrameSpillFile::GetPath() const
+    {
+      return path_;
+    }
+
+    uint64_t FrameSpillFile::GetSize() const
+    {
+      return size_;
+    }
+
+    uint64_t FrameSpillFile::GetMemoryInUse() const
+    {
+      std::lock_guard<std::mutex> allocations_lock(allocations_mutex_);
+      return memory_in_use_;
+    }
+  }
+}
@@ -0,0 +1,94 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include "frame_memory.h"
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Memory mapped scratch file that pre-buffered frame payloads are moved to when the pre-buffer exceeds its memory budget
+     *
+     * The file is used as ring: the payloads are allocated behind the newest
+     * payload and the space is re-used once the oldest payloads are released.
+     * The file is deleted when it is closed.
+     *
+     * Must be created with std::make_shared, the buffers keep the file mapped.
+     */
+    class FrameSpillFile : public FrameMemory
+    {
+    public:
+      FrameSpillFile();
+      ~FrameSpillFile() override;
+
+      /**
+       * @brief Creates and maps the scratch file
+       *
+       * @param path  Path of the scratch file. An existing file is overwritten.
+       * @param size  Size of the scratch file in bytes
+       *
+       * @return True on success
+       */
+      bool Open(const std::string& path, uint64_t size);
+
+      /**
+       * @brief Allocates a buffer in the scratch file (thread safe)
+       *
+       * @return False if the file has no contiguous space of the given size left
+       */
+      bool Allocate(size_t size, Buffer& buffer);
+
+      const std::string& GetPath() const;
+      uint64_t           GetSize() const;
+      uint64_t           GetMemoryInUse() const;
+
+    private:
+      struct Allocation
+      {
+        uint64_t offset;
+        uint64_t size;
+        bool     released;
+      };
+
+      void Release(char* data, size_t size, size_t offset) override;
+      void Close();
+
+      std::string              path_;
+      uint64_t                 size_;
+      char*                    data_;
+
+#ifdef WIN32
+      void*                    file_handle_;
+      void*                    mapping_handle_;
+#endif // WIN32
+
+      mutable std::mutex       allocations_mutex_;
+      std::deque<Allocation>   allocations_;                                   /**< Allocations in allocation order, the oldest one is at the front */
+      uint64_t                 memory_in_use_;
+    };
+  }
+}
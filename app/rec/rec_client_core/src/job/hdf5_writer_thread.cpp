@@ -24,6 +24,8 @@
 
 #include <ecal_utils/filesystem.h>
 
+#include <algorithm>
+
 namespace eCAL
 {
   namespace rec
@@ -38,8 +40,14 @@ namespace eCAL
       , job_config_                  (job_config)
       , frame_buffer_                (initial_frame_buffer)
       , written_frames_              (0)
+      , written_bytes_               (0)
+      , written_batches_             (0)
       , new_topic_info_map_          (initial_topic_info_map)
       , new_topic_info_map_available_(true)
+      , last_rate_timestamp_         (std::chrono::steady_clock::now())
+      , last_rate_written_frames_    (0)
+      , last_rate_written_bytes_     (0)
+      , last_rate_written_batches_   (0)
       , flushing_                    (false)
     {
       hdf5_writer_ = std::make_unique<eCAL::experimental::measurement::hdf5::Writer>();
@@ -121,12 +129,13 @@ namespace eCAL
       // Initialization
       if (!OpenHdf5Writer()) return;
 
+      // Frames taken from the frame buffer and the entries handed to the HDF5 writer. Both are reused, so the entry channel names keep their capacity.
+      std::vector<std::shared_ptr<Frame>>                               frame_batch;
+      std::vector<eCAL::experimental::measurement::base::WriterEntry>   entry_batch;
+
       // Loop
       while (!IsInterrupted())
       {
-        // Frame to write to the HDF5 file
-        std::shared_ptr<Frame> frame;
-
         // Topic info to write to the HDF5 file
         bool set_topic_info_map = false;
         std::map<std::string, TopicInfo> topic_info_map_to_set; 
@@ -136,7 +145,7 @@ namespace eCAL
           std::unique_lock<decltype(input_mutex_)> input_lock(input_mutex_);
 
           // Wait until something is set to an input variable (frame_buffer_, topic info)
-          input_cv_.wait(input_lock, [this]() { return IsInterrupted() || IsFlushing() || !frame_buffer_.empty() || !new_topic_info_map_available_; });
+          input_cv_.wait(input_lock, [this]() { return IsInterrupted() || IsFlushing() || !frame_buffer_.empty() || new_topic_info_map_available_; });
 
           if (IsInterrupted())
             break;
@@ -149,17 +158,27 @@ namespace eCAL
 
             new_topic_info_map_available_ = false;
           }
-          else if (!frame_buffer_.empty())
+
+          if (!frame_buffer_.empty())
           {
-            // take one frame from the framebuffer
-            frame = frame_buffer_.front();
-            frame_buffer_.pop_front();
+            // take all buffered frames (up to the maximum batch size) from the framebuffer
+            const size_t batch_size = std::min<size_t>(frame_buffer_.size(), size_t{kMaxBatchSize});
+
             if (written_frames_ == 0)
             {
-              first_written_frame_timestamp_ = frame->system_receive_time_;
+              first_written_frame_timestamp_ = frame_buffer_.front()->system_receive_time_;
+            }
+
+            for (size_t i = 0; i < batch_size; i++)
+            {
+              written_bytes_ += frame_buffer_.front()->data_.size();
+              frame_batch.push_back(std::move(frame_buffer_.front()));
+              frame_buffer_.pop_front();
             }
-            last_written_frame_timestamp_ = frame->system_receive_time_;
-            written_frames_++;
+
+            last_written_frame_timestamp_ = frame_batch.back()->system_receive_time_;
+            written_frames_ += batch_size;
+            written_batches_++;
           }
         }
 
@@ -173,29 +192,42 @@ namespace eCAL
             hdf5_writer_->SetChannelDescription(topic.first, topic.second.description_);
           }
         }
-        else if (frame)
-        {
-          std::unique_lock<decltype(hdf5_writer_mutex_)> hdf5_writer_lock(hdf5_writer_mutex_);
 
-          if (IsInterrupted())
-            break;
+        if (!frame_batch.empty())
+        {
+          entry_batch.resize(frame_batch.size());
+          for (size_t i = 0; i < frame_batch.size(); i++)
+          {
+            const Frame& frame = *frame_batch[i];
+            auto&        entry = entry_batch[i];
+
+            entry.Data         = frame.data_.data();
+            entry.Size         = frame.data_.size();
+            entry.SndTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(frame.ecal_publish_time_.time_since_epoch()).count();
+            entry.RcvTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(frame.ecal_receive_time_.time_since_epoch()).count();
+            entry.ChannelName.assign(frame.topic_name());
+            entry.ID           = frame.id_;
+            entry.Clock        = frame.clock_;
+          }
 
-          // Write Frame element to HDF5
-          if (!hdf5_writer_->AddEntryToFile(
-            frame->data_.data(),
-            frame->data_.size(),
-            std::chrono::duration_cast<std::chrono::microseconds>(frame->ecal_publish_time_.time_since_epoch()).count(),
-            std::chrono::duration_cast<std::chrono::microseconds>(frame->ecal_receive_time_.time_since_epoch()).count(),
-            frame->topic_name_,
-            frame->id_,
-            frame->clock_
-          ))
           {
-            last_status_.info_ = { false, "Error adding frame to measurement" };
-            EcalRecLogger::Instance()->error("Hdf5WriterThread::Run(): Unable to add Frame to measurement");
+            std::unique_lock<decltype(hdf5_writer_mutex_)> hdf5_writer_lock(hdf5_writer_mutex_);
+
+            if (IsInterrupted())
+              break;
+
+            // Write Frame elements to HDF5
+            if (!hdf5_writer_->AddEntriesToFile(entry_batch))
+            {
+              last_status_.info_ = { false, "Error adding frame to measurement" };
+              EcalRecLogger::Instance()->error("Hdf5WriterThread::Run(): Unable to add Frame to measurement");
+            }
           }
+
+          // Release the frames outside of the locks
+          frame_batch.clear();
         }
-        else
+        else if (!set_topic_info_map)
         {
           if (flushing_)
           {
@@ -247,6 +279,23 @@ namespace eCAL
 
         last_status_.unflushed_frame_count_ = frame_buffer_.size();
         last_status_.total_frame_count_     = written_frames_ + frame_buffer_.size();
+
+        // Update the write rates about once per second, so they don't jump with every status request
+        const auto now     = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(now - last_rate_timestamp_).count();
+        if (elapsed >= 1.0)
+        {
+          const size_t batches = written_batches_ - last_rate_written_batches_;
+
+          last_status_.average_batch_size_        = (batches > 0 ? static_cast<double>(written_frames_ - last_rate_written_frames_) / batches : 0.0);
+          last_status_.written_frames_per_second_ = static_cast<double>(written_frames_ - last_rate_written_frames_) / elapsed;
+          last_status_.written_bytes_per_second_  = static_cast<double>(written_bytes_ - last_rate_written_bytes_) / elapsed;
+
+          last_rate_timestamp_       = now;
+          last_rate_written_frames_  = written_frames_;
+          last_rate_written_bytes_   = written_bytes_;
+          last_rate_written_batches_ = written_batches_;
+        }
       }
 
       return last_status_;
@@ -274,6 +323,15 @@ namespace eCAL
         hdf5_writer_->SetFileBaseName(host_name);
         hdf5_writer_->SetMaxSizePerFile(job_config_.GetMaxFileSize());
         hdf5_writer_->SetOneFilePerChannelEnabled(job_config_.GetOneFilePerTopicEnabled());
+
+        // The compression has to be set before the first frame of the topic is written
+        for (const auto& topic : job_config_.GetCompressedTopics())
+        {
+          if (!hdf5_writer_->SetChannelCompression(topic, eCAL::experimental::measurement::base::Compression::DEFLATE))
+          {
+            EcalRecLogger::Instance()->warn("Hdf5WriterThread::Open(): Compression is not supported, recording topic \"" + topic + "\" uncompressed");
+          }
+        }
       }
       else
       {
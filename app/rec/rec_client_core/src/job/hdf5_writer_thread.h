@@ -22,6 +22,8 @@
 
 #include <ecal/measurement/base/writer.h>
 
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <deque>
 #include <map>
@@ -81,18 +83,28 @@ namespace eCAL
     // Member Variables
     ///////////////////////////////
     private:
+      static constexpr size_t kMaxBatchSize = 1024;                             /**< Maximum number of frames written to the HDF5 file at once */
+
       JobConfig job_config_;
 
       mutable std::mutex                    input_mutex_;                       /**< Mutex protecting every input variables (notably the variables below). */
       mutable std::condition_variable       input_cv_;                          /**< condition variable for notifying the internal worker thread that new input data is available */
       std::deque<std::shared_ptr<Frame>>    frame_buffer_;
       size_t                                written_frames_;
+      uint64_t                              written_bytes_;
+      size_t                                written_batches_;
       std::chrono::steady_clock::time_point first_written_frame_timestamp_;
       std::chrono::steady_clock::time_point last_written_frame_timestamp_;
       std::map<std::string, TopicInfo>      new_topic_info_map_;                /**< The new topic info map that shall be set to the HDF5 writer */
       bool                                  new_topic_info_map_available_;      /**< Telling that a new topic info map has been set from the outside. */
       mutable RecHdf5JobStatus              last_status_;
 
+      // Counters at the last computation of the write rates (see GetStatus())
+      mutable std::chrono::steady_clock::time_point last_rate_timestamp_;
+      mutable size_t                                last_rate_written_frames_;
+      mutable uint64_t                              last_rate_written_bytes_;
+      mutable size_t                                last_rate_written_batches_;
+
       mutable std::mutex                                    hdf5_writer_mutex_;
       std::unique_ptr<eCAL::experimental::measurement::base::Writer>      hdf5_writer_;
 
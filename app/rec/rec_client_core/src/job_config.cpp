@@ -75,6 +75,9 @@ namespace eCAL
     void            JobConfig::SetOneFilePerTopicEnabled(bool enabled)                     { one_file_per_topic_ = enabled; }
     bool            JobConfig::GetOneFilePerTopicEnabled() const                           { return one_file_per_topic_; }
 
+    void                  JobConfig::SetCompressedTopics(const std::set<std::string>& compressed_topics) { compressed_topics_ = compressed_topics; }
+    std::set<std::string> JobConfig::GetCompressedTopics() const                                         { return compressed_topics_; }
+
     void            JobConfig::SetDescription           (const std::string& description)   { description_ = description; }
     std::string     JobConfig::GetDescription           () const                           { return description_; }
 
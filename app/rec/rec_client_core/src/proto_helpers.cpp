@@ -40,6 +40,15 @@ namespace eCAL
         // unflushed_frame_count
         hdf5_status_pb.set_unflushed_frame_count(hdf5_job_status.unflushed_frame_count_);
         
+        // average_batch_size
+        hdf5_status_pb.set_average_batch_size   (hdf5_job_status.average_batch_size_);
+        
+        // written_frames_per_second
+        hdf5_status_pb.set_written_frames_per_second(hdf5_job_status.written_frames_per_second_);
+        
+        // written_bytes_per_second
+        hdf5_status_pb.set_written_bytes_per_second(hdf5_job_status.written_bytes_per_second_);
+        
         // info_ok
         hdf5_status_pb.set_info_ok              (hdf5_job_status.info_.first);
         
@@ -155,6 +164,15 @@ namespace eCAL
         // pre_buffer_length_secs
         rec_status_pb.set_pre_buffer_length_secs              (std::chrono::duration_cast<std::chrono::duration<double>>(rec_status.pre_buffer_length_.second).count());
 
+        // frame_pool_hit_rate
+        rec_status_pb.set_frame_pool_hit_rate                 (rec_status.frame_pool_hit_rate_);
+
+        // frame_memory_in_use
+        rec_status_pb.set_frame_memory_in_use                 (rec_status.frame_memory_in_use_);
+
+        // frame_memory_high_water_mark
+        rec_status_pb.set_frame_memory_high_water_mark        (rec_status.frame_memory_high_water_mark_);
+
         // subscribed_topics
         for (const std::string& subscribed_topic : rec_status.subscribed_topics_)
         {
@@ -278,8 +296,11 @@ namespace eCAL
       {
         hdf5_job_status.total_frame_count_     = hdf5_status_pb.total_frame_count();
         hdf5_job_status.total_length_          = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(hdf5_status_pb.total_length_secs()));
-        hdf5_job_status.unflushed_frame_count_ = hdf5_status_pb.unflushed_frame_count();
-        hdf5_job_status.info_                  = std::make_pair(hdf5_status_pb.info_ok(), hdf5_status_pb.info_message());
+        hdf5_job_status.unflushed_frame_count_     = hdf5_status_pb.unflushed_frame_count();
+        hdf5_job_status.average_batch_size_        = hdf5_status_pb.average_batch_size();
+        hdf5_job_status.written_frames_per_second_ = hdf5_status_pb.written_frames_per_second();
+        hdf5_job_status.written_bytes_per_second_  = hdf5_status_pb.written_bytes_per_second();
+        hdf5_job_status.info_                      = std::make_pair(hdf5_status_pb.info_ok(), hdf5_status_pb.info_message());
       }
 
       void FromProtobuf(const eCAL::pb::rec_client::State::RecAddonJobStatus& rec_addon_job_status_pb, eCAL::rec::RecAddonJobStatus& rec_addon_job_status)
@@ -361,6 +382,11 @@ namespace eCAL
         std::chrono::steady_clock::duration pre_buffer_length = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(rec_status_pb.pre_buffer_length_secs()));
         rec_status.pre_buffer_length_ = std::make_pair(pre_buffer_length_frames, pre_buffer_length);
 
+        // frame pool
+        rec_status.frame_pool_hit_rate_          = rec_status_pb.frame_pool_hit_rate();
+        rec_status.frame_memory_in_use_          = rec_status_pb.frame_memory_in_use();
+        rec_status.frame_memory_high_water_mark_ = rec_status_pb.frame_memory_high_water_mark();
+
         // subscribed_topics_
         for (const auto& subscribed_topic : rec_status_pb.subscribed_topics())
         {
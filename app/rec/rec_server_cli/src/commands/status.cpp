@@ -685,8 +685,11 @@ namespace eCAL
                 rec_state_entry.content = "Not Started";
                 break;
               case eCAL::rec::JobState::Recording:
-                rec_state_entry.content    = "Recording";
+              {
+                const auto& hdf5_status = client_status.second.job_status_.rec_hdf5_status_;
+                rec_state_entry.content    = "Recording (" + bytesToPrettyString(static_cast<uint64_t>(hdf5_status.written_bytes_per_second_)) + "/s, " + std::to_string(hdf5_status.unflushed_frame_count_) + " frames queued)";
                 rec_state_entry.text_color = table_printer::Color::RED;
+              }
                 break;
               case eCAL::rec::JobState::Flushing:
                 rec_state_entry.content = "Flushing (" + std::to_string(client_status.second.job_status_.rec_hdf5_status_.unflushed_frame_count_) + " frames)";
@@ -815,6 +818,11 @@ namespace eCAL
           ostream << "Time-error:      " << time_error_ss.str() << " s" << std::endl;
           ostream << "Buffer:          " << buffer_ss.str() << std::endl;
 
+          std::stringstream frame_memory_ss;
+          frame_memory_ss << bytesToPrettyString(client_status.frame_memory_in_use_) << " (max " << bytesToPrettyString(client_status.frame_memory_high_water_mark_) << "), "
+            << std::fixed << std::setprecision(1) << (client_status.frame_pool_hit_rate_ * 100.0) << " % pooled";
+          ostream << "Frame memory:    " << frame_memory_ss.str() << std::endl;
+
           auto rec_client_state_eval = recClientStateToString(client_status);
           ostream << "State:           ";
           if (rec_client_state_eval.second == eCAL::rec::JobState::Recording)
@@ -124,12 +124,14 @@ namespace eCAL
       void SetMaxFileSizeMib        (unsigned int max_file_size_mib);
       void SetOneFilePerTopicEnabled(bool enabled);
       void SetDescription           (std::string  description);
+      void SetCompressedTopics      (const std::set<std::string>& compressed_topics);
 
       std::string  GetMeasRootDir   () const;
       std::string  GetMeasName      () const;
       int64_t      GetMaxFileSizeMib() const;
       bool         GetOneFilePerTopicEnabled() const;
       std::string  GetDescription   () const;
+      std::set<std::string> GetCompressedTopics() const;
 
     ////////////////////////////////////
     // Server Settings
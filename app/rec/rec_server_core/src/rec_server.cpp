@@ -95,12 +95,14 @@ namespace eCAL
     void RecServer::SetMaxFileSizeMib        (unsigned int max_file_size_mib)  { rec_server_impl_->SetMaxFileSizeMib(max_file_size_mib); }
     void RecServer::SetOneFilePerTopicEnabled(bool enabled)                    { rec_server_impl_->SetOneFilePerTopicEnabled(enabled); }
     void RecServer::SetDescription           (std::string description)         { rec_server_impl_->SetDescription(description); }
+    void RecServer::SetCompressedTopics      (const std::set<std::string>& compressed_topics) { rec_server_impl_->SetCompressedTopics(compressed_topics); }
 
     std::string  RecServer::GetMeasRootDir   () const                   { return rec_server_impl_->GetMeasRootDir(); } 
     std::string  RecServer::GetMeasName      () const                   { return rec_server_impl_->GetMeasName(); }
     int64_t      RecServer::GetMaxFileSizeMib() const                   { return rec_server_impl_->GetMaxFileSizeMib(); }
     bool         RecServer::GetOneFilePerTopicEnabled() const           { return rec_server_impl_->GetOneFilePerTopicEnabled(); }
     std::string  RecServer::GetDescription   () const                   { return rec_server_impl_->GetDescription(); }
+    std::set<std::string> RecServer::GetCompressedTopics() const        { return rec_server_impl_->GetCompressedTopics(); }
 
     ////////////////////////////////////
     // Server Settings
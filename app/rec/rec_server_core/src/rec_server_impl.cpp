@@ -960,6 +960,11 @@ namespace eCAL
       job_config_.SetDescription(description);
     }
 
+    void RecServerImpl::SetCompressedTopics(const std::set<std::string>& compressed_topics)
+    {
+      job_config_.SetCompressedTopics(compressed_topics);
+    }
+
 
     std::string RecServerImpl::GetMeasRootDir() const
     {
@@ -986,6 +991,11 @@ namespace eCAL
       return job_config_.GetDescription();
     }
 
+    std::set<std::string> RecServerImpl::GetCompressedTopics() const
+    {
+      return job_config_.GetCompressedTopics();
+    }
+
     ////////////////////////////////////
     // Server Settings
     ////////////////////////////////////
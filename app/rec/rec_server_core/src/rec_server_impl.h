@@ -150,12 +150,14 @@ namespace eCAL
       void SetMaxFileSizeMib        (int64_t max_file_size_mib);
       void SetOneFilePerTopicEnabled(bool enabled);
       void SetDescription           (const std::string& description);
+      void SetCompressedTopics      (const std::set<std::string>& compressed_topics);
 
       std::string  GetMeasRootDir           () const;
       std::string  GetMeasName              () const;
       int64_t      GetMaxFileSizeMib        () const;
       bool         GetOneFilePerTopicEnabled() const;
       std::string  GetDescription           () const;
+      std::set<std::string> GetCompressedTopics() const;
 
     ////////////////////////////////////
     // Server Settings                //
@@ -619,6 +619,7 @@ namespace eCAL
       (*job_config_pb)["description"]          = job_config.GetDescription();
       (*job_config_pb)["max_file_size_mib"]    = std::to_string(job_config.GetMaxFileSize());
       (*job_config_pb)["one_file_per_topic"]   = job_config.GetOneFilePerTopicEnabled() ? "true" : "false";
+      (*job_config_pb)["compressed_topics"]    = EcalUtils::String::Join("\n", job_config.GetCompressedTopics());
     }
 
     void RemoteRecorder::SetUploadConfig(google::protobuf::Map<std::string, std::string>* upload_config_pb, const eCAL::rec::UploadConfig& upload_config)
@@ -0,0 +1,246 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_buffer.h"
+#include "frame_pool.h"
+#include "frame_spill_file.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  const std::string spill_file_path("rec_client_core_tests.spill");
+
+  // Frame with size bytes of the given value
+  std::shared_ptr<eCAL::rec::Frame> MakeFrame(eCAL::rec::FramePool& frame_pool, size_t size, char value)
+  {
+    std::vector<char> payload(size, value);
+
+    eCAL::SReceiveCallbackData callback_data;
+    callback_data.buf  = payload.data();
+    callback_data.size = static_cast<long>(size);
+
+    return std::make_shared<eCAL::rec::Frame>(frame_pool, &callback_data, frame_pool.InternTopicName("topic"), eCAL::Time::ecal_clock::now(), std::chrono::steady_clock::now());
+  }
+
+  // Pre-buffer of one hour limited to max_memory, with a spill file of spill_size bytes (0 = none)
+  std::unique_ptr<eCAL::rec::FrameBuffer> MakeFrameBuffer(uint64_t max_memory, uint64_t spill_size)
+  {
+    std::unique_ptr<eCAL::rec::FrameBuffer> frame_buffer(new eCAL::rec::FrameBuffer(true, std::chrono::hours(1)));
+    frame_buffer->set_max_buffer_memory(max_memory);
+    if (spill_size > 0)
+    {
+      auto spill_file = std::make_shared<eCAL::rec::FrameSpillFile>();
+      EXPECT_TRUE(spill_file->Open(spill_file_path, spill_size));
+      frame_buffer->set_spill_file(spill_file);
+    }
+    return frame_buffer;
+  }
+
+  bool HasPayload(const eCAL::rec::Frame& frame, size_t size, char value)
+  {
+    if (frame.data_.size() != size) return false;
+    for (size_t i = 0; i < size; ++i)
+    {
+      if (frame.data_.data()[i] != value) return false;
+    }
+    return true;
+  }
+}
+
+TEST(FrameSpillFile, RingAllocation)
+{
+  auto spill_file = std::make_shared<eCAL::rec::FrameSpillFile>();
+  ASSERT_TRUE(spill_file->Open(spill_file_path, 1024));
+
+  // empty buffers and buffers larger than the file are never allocated
+  {
+    eCAL::rec::FrameMemory::Buffer buffer;
+    EXPECT_FALSE(spill_file->Allocate(0, buffer));
+    EXPECT_FALSE(spill_file->Allocate(1025, buffer));
+  }
+
+  // fill the file (allocations are aligned to 64 bytes)
+  std::vector<eCAL::rec::FrameMemory::Buffer> buffers(4);
+  for (auto& buffer : buffers)
+  {
+    ASSERT_TRUE(spill_file->Allocate(200, buffer));
+    EXPECT_EQ(200u, buffer.size());
+  }
+  EXPECT_EQ(1024u, spill_file->GetMemoryInUse());
+  EXPECT_EQ(buffers[0].data() + 256, buffers[1].data());
+
+  eCAL::rec::FrameMemory::Buffer buffer;
+  EXPECT_FALSE(spill_file->Allocate(1, buffer));
+
+  // releasing a buffer that is not the oldest one does not free contiguous space
+  buffers[1] = eCAL::rec::FrameMemory::Buffer();
+  EXPECT_EQ(768u, spill_file->GetMemoryInUse());
+  EXPECT_FALSE(spill_file->Allocate(1, buffer));
+
+  // releasing the oldest one frees the space of both
+  buffers[0] = eCAL::rec::FrameMemory::Buffer();
+  EXPECT_EQ(512u, spill_file->GetMemoryInUse());
+  EXPECT_TRUE(spill_file->Allocate(512, buffer));
+  EXPECT_EQ(1024u, spill_file->GetMemoryInUse());
+}
+
+TEST(FrameSpillFile, Wraparound)
+{
+  auto spill_file = std::make_shared<eCAL::rec::FrameSpillFile>();
+  ASSERT_TRUE(spill_file->Open(spill_file_path, 1024));
+
+  std::vector<eCAL::rec::FrameMemory::Buffer> buffers(3);
+  for (auto& buffer : buffers)
+  {
+    ASSERT_TRUE(spill_file->Allocate(256, buffer));
+  }
+  char* const file_begin = buffers[0].data();
+
+  // 256 bytes left at the end, but not 384
+  eCAL::rec::FrameMemory::Buffer wrapped;
+  EXPECT_FALSE(spill_file->Allocate(384, wrapped));
+
+  // after releasing the oldest buffers, the allocation wraps around to the beginning
+  buffers[0] = eCAL::rec::FrameMemory::Buffer();
+  buffers[1] = eCAL::rec::FrameMemory::Buffer();
+  ASSERT_TRUE(spill_file->Allocate(384, wrapped));
+  EXPECT_EQ(file_begin, wrapped.data());
+
+  // the space between the wrapped allocation and the oldest one is used next, the end of the file is skipped
+  eCAL::rec::FrameMemory::Buffer between;
+  EXPECT_FALSE(spill_file->Allocate(192, between));
+  ASSERT_TRUE(spill_file->Allocate(128, between));
+  EXPECT_EQ(file_begin + 384, between.data());
+
+  // the space left at the end is used again once the buffers in front of it are released
+  buffers[2] = eCAL::rec::FrameMemory::Buffer();
+  eCAL::rec::FrameMemory::Buffer at_end;
+  ASSERT_TRUE(spill_file->Allocate(512, at_end));
+  EXPECT_EQ(file_begin + 512, at_end.data());
+}
+
+TEST(FrameBuffer, SpillAndDrop)
+{
+  auto frame_pool   = std::make_shared<eCAL::rec::FramePool>();
+  auto frame_buffer = MakeFrameBuffer(128, 512);
+
+  // 2 frames stay in memory, 8 frames fit into the spill file
+  for (int i = 0; i < 10; ++i)
+  {
+    frame_buffer->push_back(MakeFrame(*frame_pool, 64, static_cast<char>(i)));
+  }
+  EXPECT_EQ(10, frame_buffer->length().first);
+
+  auto frames = frame_buffer->get_as_deque();
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_TRUE(HasPayload(*frames[i], 64, static_cast<char>(i)));
+  }
+  frames.clear();
+
+  // the spill file is full, the oldest frames are dropped
+  for (int i = 10; i < 13; ++i)
+  {
+    frame_buffer->push_back(MakeFrame(*frame_pool, 64, static_cast<char>(i)));
+  }
+  frames = frame_buffer->get_as_deque();
+  ASSERT_EQ(10u, frames.size());
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_TRUE(HasPayload(*frames[i], 64, static_cast<char>(i + 3)));
+  }
+}
+
+TEST(FrameBuffer, DropWithoutSpillFile)
+{
+  auto frame_pool   = std::make_shared<eCAL::rec::FramePool>();
+  auto frame_buffer = MakeFrameBuffer(128, 0);
+
+  for (int i = 0; i < 5; ++i)
+  {
+    frame_buffer->push_back(MakeFrame(*frame_pool, 64, static_cast<char>(i)));
+  }
+
+  const auto frames = frame_buffer->get_as_deque();
+  ASSERT_EQ(2u, frames.size());
+  EXPECT_TRUE(HasPayload(*frames[0], 64, 3));
+  EXPECT_TRUE(HasPayload(*frames[1], 64, 4));
+}
+
+TEST(FrameBuffer, EmptyFrameKeepsSpilledFrames)
+{
+  auto frame_pool   = std::make_shared<eCAL::rec::FramePool>();
+  auto frame_buffer = MakeFrameBuffer(64, 1024);
+
+  for (int i = 0; i < 4; ++i)
+  {
+    frame_buffer->push_back(MakeFrame(*frame_pool, 64, static_cast<char>(i)));
+  }
+
+  // an empty frame is spilled without space in the spill file
+  frame_buffer->push_back(MakeFrame(*frame_pool, 0, 0));
+  frame_buffer->push_back(MakeFrame(*frame_pool, 64, 4));
+  frame_buffer->push_back(MakeFrame(*frame_pool, 64, 5));
+
+  const auto frames = frame_buffer->get_as_deque();
+  ASSERT_EQ(7u, frames.size());
+  EXPECT_TRUE(HasPayload(*frames[0], 64, 0));
+  EXPECT_TRUE(HasPayload(*frames[4], 0,  0));
+  EXPECT_TRUE(HasPayload(*frames[6], 64, 5));
+}
+
+TEST(FrameBuffer, SharedFrameKeepsSpilledFrames)
+{
+  auto frame_pool   = std::make_shared<eCAL::rec::FramePool>();
+  auto frame_buffer = MakeFrameBuffer(64, 1024);
+
+  for (int i = 0; i < 4; ++i)
+  {
+    frame_buffer->push_back(MakeFrame(*frame_pool, 64, static_cast<char>(i)));
+  }
+
+  // a frame held by a recording is not spilled, the budget is exceeded instead of dropping frames
+  std::shared_ptr<eCAL::rec::Frame> recorded_frame = MakeFrame(*frame_pool, 64, 4);
+  frame_buffer->push_back(recorded_frame);
+  frame_buffer->push_back(MakeFrame(*frame_pool, 64, 5));
+  {
+    const auto frames = frame_buffer->get_as_deque();
+    ASSERT_EQ(6u, frames.size());
+    EXPECT_EQ(recorded_frame->data_.data(), frames[4]->data_.data());
+  }
+
+  // once the recording has released it, the frame is spilled with the next one
+  char* const memory_data = recorded_frame->data_.data();
+  recorded_frame.reset();
+  frame_buffer->push_back(MakeFrame(*frame_pool, 64, 6));
+
+  const auto frames = frame_buffer->get_as_deque();
+  ASSERT_EQ(7u, frames.size());
+  EXPECT_NE(memory_data, frames[4]->data_.data());
+  for (int i = 0; i < 7; ++i)
+  {
+    EXPECT_TRUE(HasPayload(*frames[i], 64, static_cast<char>(i)));
+  }
+}
@@ -214,6 +214,20 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type);
 
+      /**
+       * @brief Set compression of the given channel (measurement writers only)
+       *
+       *        The entries of a compressed channel are compressed by a pool of worker threads,
+       *        reading them back is transparent. The compression should be set before the
+       *        first entry of the channel is added.
+       *
+       * @param channel_name  channel name
+       * @param compression   compression of the channel entries
+       *
+       * @return              true if the compression is supported, false if the channel is stored uncompressed
+      **/
+      bool SetChannelCompression(const std::string& channel_name, eCompression compression);
+
       /**
        * @brief Gets minimum timestamp for specified channel
        *
@@ -298,6 +312,15 @@ namespace eCAL
       **/
       bool AddEntryToFile(const void* data, const unsigned long long& size, const long long& snd_timestamp, const long long& rcv_timestamp, const std::string& channel_name, long long id, long long clock);
 
+      /**
+       * @brief Add a batch of entries to file
+       *
+       * @param entries        entries to be added (in this order)
+       *
+       * @return              true if all entries were added, false if adding any entry failed
+      **/
+      bool AddEntriesToFile(const std::vector<WriterEntry>& entries);
+
       /**
        * @brief Callback function type for pre file split notification
       **/
@@ -49,6 +49,8 @@ namespace eCAL
     using eAccessType = eCAL::experimental::measurement::base::AccessType;
     using eCAL::experimental::measurement::base::RDONLY;
     using eCAL::experimental::measurement::base::CREATE;
+    using eCompression = eCAL::experimental::measurement::base::Compression;
+    using WriterEntry = eCAL::experimental::measurement::base::WriterEntry;
     //!< @endcond
   }  // namespace eh5
 }  // namespace eCAL
@@ -0,0 +1,139 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCALHDF5 chunk compressor (worker thread pool)
+**/
+
+#include "eh5_chunk_compressor.h"
+
+#include <algorithm>
+
+#include "hdf5.h"
+
+#ifdef EH5_ZLIB_COMPRESSION
+#include <zlib.h>
+#endif // EH5_ZLIB_COMPRESSION
+
+constexpr size_t kMaxCompressorThreads = 4;
+
+bool eCAL::eh5::HDF5ChunkCompressor::IsDeflateAvailable()
+{
+#ifdef EH5_ZLIB_COMPRESSION
+  // the chunks written by us must be readable with this HDF5 library
+  return (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0);
+#else
+  return false;
+#endif // EH5_ZLIB_COMPRESSION
+}
+
+std::shared_ptr<eCAL::eh5::HDF5ChunkCompressor> eCAL::eh5::HDF5ChunkCompressor::Instance()
+{
+  static std::mutex                          instance_mutex;
+  static std::weak_ptr<HDF5ChunkCompressor>  instance;
+
+  const std::lock_guard<std::mutex> lock(instance_mutex);
+  auto compressor = instance.lock();
+  if (!compressor)
+  {
+    const size_t thread_count = std::min<size_t>(std::max<unsigned int>(std::thread::hardware_concurrency() / 2, 1), kMaxCompressorThreads);
+    compressor = std::make_shared<HDF5ChunkCompressor>(thread_count);
+    instance   = compressor;
+  }
+  return compressor;
+}
+
+eCAL::eh5::HDF5ChunkCompressor::HDF5ChunkCompressor(size_t thread_count)
+  : stop_(false)
+{
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    threads_.emplace_back([this]() { Worker(); });
+  }
+}
+
+eCAL::eh5::HDF5ChunkCompressor::~HDF5ChunkCompressor()
+{
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+
+  for (auto& thread : threads_)
+  {
+    thread.join();
+  }
+}
+
+std::future<eCAL::eh5::HDF5ChunkCompressor::CompressedChunk> eCAL::eh5::HDF5ChunkCompressor::Deflate(std::vector<char> chunk)
+{
+  std::packaged_task<CompressedChunk()> task([chunk = std::move(chunk)]() { return DeflateChunk(chunk); });
+  auto future = task.get_future();
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  cv_.notify_one();
+
+  return future;
+}
+
+eCAL::eh5::HDF5ChunkCompressor::CompressedChunk eCAL::eh5::HDF5ChunkCompressor::DeflateChunk(const std::vector<char>& chunk)
+{
+  CompressedChunk compressed_chunk;
+
+#ifdef EH5_ZLIB_COMPRESSION
+  // zlib stream, as written by the HDF5 deflate filter
+  uLongf compressed_size = compressBound(static_cast<uLong>(chunk.size()));
+  compressed_chunk.Data.resize(compressed_size);
+
+  if ((compress2(reinterpret_cast<Bytef*>(compressed_chunk.Data.data()), &compressed_size, reinterpret_cast<const Bytef*>(chunk.data()), static_cast<uLong>(chunk.size()), static_cast<int>(kDeflateLevel)) == Z_OK)
+    && (compressed_size < chunk.size()))
+  {
+    compressed_chunk.Data.resize(compressed_size);
+    compressed_chunk.Compressed = true;
+    return compressed_chunk;
+  }
+#endif // EH5_ZLIB_COMPRESSION
+
+  // store the chunk uncompressed (the filter is skipped for this chunk)
+  compressed_chunk.Data       = chunk;
+  compressed_chunk.Compressed = false;
+  return compressed_chunk;
+}
+
+void eCAL::eh5::HDF5ChunkCompressor::Worker()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;)
+  {
+    cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+    // queued chunks are still compressed, the writers wait for them
+    if (tasks_.empty()) return;
+
+    auto task = std::move(tasks_.front());
+    tasks_.pop_front();
+
+    lock.unlock();
+    task();
+    lock.lock();
+  }
+}
@@ -0,0 +1,95 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * eCALHDF5 chunk compressor (worker thread pool)
+**/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    /**
+    * @brief Compresses dataset chunks on a pool of worker threads
+    *
+    * The chunks are compressed in the format of the HDF5 deflate filter, so they can be
+    * written with H5Dwrite_chunk and are decompressed by HDF5 when the dataset is read.
+    * All writers of a process share one pool (see Instance()).
+    **/
+    class HDF5ChunkCompressor
+    {
+    public:
+      // fast deflate level, the recorder has to keep up with the incoming data
+      static constexpr unsigned int kDeflateLevel = 1;
+
+      struct CompressedChunk
+      {
+        std::vector<char> Data;
+        bool              Compressed = false;  // false if the chunk did not compress, Data holds the raw chunk then
+      };
+
+      /**
+      * @brief Deflate compression is available (zlib support compiled in and HDF5 deflate filter available)
+      **/
+      static bool IsDeflateAvailable();
+
+      /**
+      * @brief Get the pool shared by all writers, it is created with the first call and destroyed with the last reference
+      **/
+      static std::shared_ptr<HDF5ChunkCompressor> Instance();
+
+      explicit HDF5ChunkCompressor(size_t thread_count);
+      ~HDF5ChunkCompressor();
+
+      HDF5ChunkCompressor(const HDF5ChunkCompressor&)            = delete;
+      HDF5ChunkCompressor& operator=(const HDF5ChunkCompressor&) = delete;
+      HDF5ChunkCompressor(HDF5ChunkCompressor&&)                 = delete;
+      HDF5ChunkCompressor& operator=(HDF5ChunkCompressor&&)      = delete;
+
+      /**
+      * @brief Queue a chunk for deflate compression
+      *
+      * @param chunk  raw chunk (full chunk size)
+      *
+      * @return       the compressed chunk
+      **/
+      std::future<CompressedChunk> Deflate(std::vector<char> chunk);
+
+    private:
+      static CompressedChunk DeflateChunk(const std::vector<char>& chunk);
+      void Worker();
+
+      std::mutex                                         mutex_;
+      std::condition_variable                            cv_;
+      std::deque<std::packaged_task<CompressedChunk()>>  tasks_;
+      std::vector<std::thread>                           threads_;
+      bool                                               stop_;
+    };
+  }  //  namespace eh5
+}  //  namespace eCAL
@@ -33,12 +33,13 @@
 #include "eh5_meas_file_v3.h"
 #include "eh5_meas_file_v4.h"
 #include "eh5_meas_file_v5.h"
+#include "eh5_meas_file_v6.h"
 
 #include "escape.h"
 
 namespace
 {
-  const double file_version_max(5.0);
+  const double file_version_max(6.0);
 }
 
 eCAL::eh5::HDF5Meas::HDF5Meas()
@@ -120,6 +121,10 @@ bool eCAL::eh5::HDF5Meas::Open(const std::string& path, eAccessType access /*= e
     {
       hdf_meas_impl_ = std::make_unique<HDF5MeasFileV4>(path, access);
     }
+    else if (file_version_numeric >= 6.0)
+    {
+      hdf_meas_impl_ = std::make_unique<HDF5MeasFileV6>(path, access);
+    }
   }
   break;
   case EcalUtils::Filesystem::Unknown:
@@ -271,6 +276,17 @@ void eCAL::eh5::HDF5Meas::SetChannelType(const std::string& channel_name, const
   }
 }
 
+bool eCAL::eh5::HDF5Meas::SetChannelCompression(const std::string& channel_name, eCompression compression)
+{
+  bool ret_val = false;
+  if (hdf_meas_impl_)
+  {
+    ret_val = hdf_meas_impl_->SetChannelCompression(GetEscapedTopicname(channel_name), compression);
+  }
+
+  return ret_val;
+}
+
 long long eCAL::eh5::HDF5Meas::GetMinTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
@@ -356,6 +372,30 @@ bool eCAL::eh5::HDF5Meas::AddEntryToFile(const void* data, const unsigned long l
   return ret_val;
 }
 
+bool eCAL::eh5::HDF5Meas::AddEntriesToFile(const std::vector<WriterEntry>& entries)
+{
+  if (!hdf_meas_impl_) return false;
+
+  bool ret_val = true;
+
+  // Batches usually contain runs of entries of the same channel, the escaped name is reused for them
+  const std::string* channel_name = nullptr;
+  std::string        escaped_channel_name;
+
+  for (const auto& entry : entries)
+  {
+    if ((channel_name == nullptr) || (*channel_name != entry.ChannelName))
+    {
+      channel_name         = &entry.ChannelName;
+      escaped_channel_name = GetEscapedTopicname(entry.ChannelName);
+    }
+
+    ret_val = hdf_meas_impl_->AddEntryToFile(entry.Data, entry.Size, entry.SndTimestamp, entry.RcvTimestamp, escaped_channel_name, entry.ID, entry.Clock) && ret_val;
+  }
+
+  return ret_val;
+}
+
 void eCAL::eh5::HDF5Meas::ConnectPreSplitCallback(CallbackFunction cb)
 {
   if (hdf_meas_impl_)
@@ -30,6 +30,7 @@
 #include <dirent.h>
 #endif //WIN32
 
+#include <algorithm>
 #include <string>
 #include <list>
 #include <iostream>
@@ -37,7 +38,7 @@
 #include <ecal_utils/filesystem.h>
 #include <ecal_utils/str_convert.h>
 
-#include "eh5_meas_file_writer_v5.h"
+#include "eh5_meas_file_writer_v6.h"
 
 // TODO: Test the one-file-per-channel setting with gtest
 constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
@@ -116,16 +117,16 @@ bool eCAL::eh5::HDF5MeasDir::Close()
     {
       if (file != nullptr)
       {
-        successfully_closed &= file->Close();
+        if (file->IsOk())
+          successfully_closed &= file->Close();
         delete file;
         file = nullptr;
       }
     }
 
     file_readers_.clear();
-    channels_info_.clear();
-    entries_by_id_.clear();
-    entries_by_chn_.clear();
+    index_.Clear();
+    input_dir_.clear();
 
     return successfully_closed;
   }
@@ -137,7 +138,7 @@ bool eCAL::eh5::HDF5MeasDir::IsOk() const
   {
   case eCAL::eh5::RDONLY:
   //case eCAL::eh5::RDWR:
-    return !file_readers_.empty() && !entries_by_id_.empty();
+    return index_.GetEntryCount() > 0;
   case eCAL::eh5::CREATE:
     return true;
   default:
@@ -148,9 +149,13 @@ bool eCAL::eh5::HDF5MeasDir::IsOk() const
 std::string eCAL::eh5::HDF5MeasDir::GetFileVersion() const
 {
   std::string version;
-  if (!file_readers_.empty())
+  for (const auto& file : index_.GetFiles())
   {
-    version = file_readers_.front()->GetFileVersion();
+    if (!file.version.empty())
+    {
+      version = file.version;
+      break;
+    }
   }
   return version;
 }
@@ -185,26 +190,26 @@ void eCAL::eh5::HDF5MeasDir::SetOneFilePerChannelEnabled(bool enabled)
 std::set<std::string> eCAL::eh5::HDF5MeasDir::GetChannelNames() const
 {
   std::set<std::string> channels;
-  for (const auto& chn : channels_info_)
-    channels.insert(chn.first);
+  for (const auto& chn : index_.GetChannels())
+    channels.insert(chn.name);
 
   return channels;
 }
 
 bool eCAL::eh5::HDF5MeasDir::HasChannel(const std::string& channel_name) const
 {
-  return channels_info_.count(channel_name) != 0;
+  return index_.FindChannel(channel_name) != nullptr;
 }
 
 std::string eCAL::eh5::HDF5MeasDir::GetChannelDescription(const std::string& channel_name) const
 {
   std::string ret_val;
 
-  const auto& found = channels_info_.find(channel_name);
+  const auto* found = index_.FindChannel(channel_name);
 
-  if (found != channels_info_.end())
+  if (found != nullptr)
   {
-    ret_val = found->second.description;
+    ret_val = found->description;
   }
   return ret_val;
 }
@@ -220,11 +225,11 @@ std::string eCAL::eh5::HDF5MeasDir::GetChannelType(const std::string& channel_na
 {
   std::string ret_val;
 
-  const auto& found = channels_info_.find(channel_name);
+  const auto* found = index_.FindChannel(channel_name);
 
-  if (found != channels_info_.end())
+  if (found != nullptr)
   {
-    ret_val = found->second.type;
+    ret_val = found->type;
   }
   return ret_val;
 }
@@ -236,18 +241,23 @@ void eCAL::eh5::HDF5MeasDir::SetChannelType(const std::string& channel_name, con
   file_writer_it->second->SetChannelType(channel_name, type);
 }
 
+bool eCAL::eh5::HDF5MeasDir::SetChannelCompression(const std::string& channel_name, eCompression compression)
+{
+  // Get an existing writer or create a new one
+  auto file_writer_it = GetWriter(channel_name);
+  return file_writer_it->second->SetChannelCompression(channel_name, compression);
+}
+
 long long eCAL::eh5::HDF5MeasDir::GetMinTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
+  long long max_timestamp = 0;
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto* found = index_.FindChannel(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (found != nullptr)
   {
-    if (!found->second.empty())
-    {
-      ret_val = found->second.begin()->RcvTimestamp;
-    }
+    index_.GetTimestampRange(*found, ret_val, max_timestamp);
   }
 
   return ret_val;
@@ -256,15 +266,13 @@ long long eCAL::eh5::HDF5MeasDir::GetMinTimestamp(const std::string& channel_nam
 long long eCAL::eh5::HDF5MeasDir::GetMaxTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
+  long long min_timestamp = 0;
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto* found = index_.FindChannel(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (found != nullptr)
   {
-    if (!found->second.empty())
-    {
-      ret_val = found->second.rbegin()->RcvTimestamp;
-    }
+    index_.GetTimestampRange(*found, min_timestamp, ret_val);
   }
 
   return ret_val;
@@ -274,11 +282,11 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfo(const std::string& channel_name, Ent
 {
   entries.clear();
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto* found = index_.FindChannel(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (found != nullptr)
   {
-    entries = found->second;
+    index_.GetEntriesInfoRange(*found, 0, 0, entries);
   }
 
   return !entries.empty();
@@ -290,17 +298,12 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const std::string& channel_name
 
   entries.clear();
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto* found = index_.FindChannel(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (found != nullptr)
   {
-    if (begin == 0) begin = entries.begin()->RcvTimestamp;
-    if (end == 0) end = entries.rbegin()->RcvTimestamp;
-
-    const auto& lower = found->second.lower_bound(SEntryInfo(begin, 0, 0));
-    const auto& upper = found->second.upper_bound(SEntryInfo(end, 0, 0));
-
-    entries.insert(lower, upper);
+    // a begin / end of 0 means the first / last entry of the channel
+    index_.GetEntriesInfoRange(*found, begin, end, entries);
     ret_val = true;
   }
 
@@ -310,10 +313,12 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const std::string& channel_name
 bool eCAL::eh5::HDF5MeasDir::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   auto ret_val = false;
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  size_t    file_index    = 0;
+  long long file_entry_id = 0;
+  if (index_.GetEntryLocation(entry_id, file_index, file_entry_id))
   {
-    ret_val = found->second.reader->GetEntryDataSize(found->second.file_id, size);
+    auto reader = GetFileReader(file_index);
+    ret_val = (reader != nullptr) && reader->GetEntryDataSize(file_entry_id, size);
   }
   return ret_val;
 }
@@ -321,10 +326,12 @@ bool eCAL::eh5::HDF5MeasDir::GetEntryDataSize(long long entry_id, size_t& size)
 bool eCAL::eh5::HDF5MeasDir::GetEntryData(long long entry_id, void* data) const
 {
   auto ret_val = false;
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  size_t    file_index    = 0;
+  long long file_entry_id = 0;
+  if (index_.GetEntryLocation(entry_id, file_index, file_entry_id))
   {
-    ret_val = found->second.reader->GetEntryData(found->second.file_id, data);
+    auto reader = GetFileReader(file_index);
+    ret_val = (reader != nullptr) && reader->GetEntryData(file_entry_id, data);
   }
   return ret_val;
 }
@@ -443,13 +450,49 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, eAccessType access
 {
   if (access != eAccessType::RDONLY /*&& access != eAccessType::RDWR*/) return false;
 
-  auto files = GetHdfFiles(path);
+  // The index file is only used if it has been written for exactly these files
+  std::vector<HDF5MeasDirIndex::FileInfo> files;
+  for (const auto& file_path : GetHdfFiles(path))
+  {
+    HDF5MeasDirIndex::FileInfo file;
+    file.path = file_path.substr(path.size() + 1);
+    HDF5MeasDirIndex::ReadFileStatus(file_path, file);
+    files.push_back(file);
+  }
 
-  long long id = 0;
+  input_dir_ = path;
+  const std::string index_path = path + "/" + kIndexFileName;
 
-  for (const auto& file_path : files)
+  if (index_.Load(index_path, files))
+  {
+    // The files are opened when their entries are read
+    file_readers_.resize(index_.GetFiles().size(), nullptr);
+  }
+  else
   {
-    auto reader = new eCAL::eh5::HDF5Meas(file_path);
+    BuildIndex(files);
+
+    // Writing the index fails for read-only measurements, it is built again on every open then
+    if (index_.GetEntryCount() > 0)
+      index_.Save(index_path);
+  }
+
+  const auto& index_files = index_.GetFiles();
+  return std::any_of(index_files.begin(), index_files.end(), [](const HDF5MeasDirIndex::FileInfo& file) { return !file.version.empty(); });
+}
+
+void eCAL::eh5::HDF5MeasDir::BuildIndex(const std::vector<HDF5MeasDirIndex::FileInfo>& files)
+{
+  for (const auto& file : files)
+  {
+    auto reader = new eCAL::eh5::HDF5Meas(input_dir_ + "/" + file.path);
+
+    HDF5MeasDirIndex::FileInfo file_info(file);
+    if (reader->IsOk())
+    {
+      file_info.version = reader->GetFileVersion();
+    }
+    const uint32_t file_index = index_.AddFile(file_info);
 
     if (reader->IsOk())
     {
@@ -457,44 +500,31 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, eAccessType access
       for (const auto& channel : channels)
       {
         auto escaped_name = GetEscapedTopicname(channel);
-        auto description = reader->GetChannelDescription(channel);
-
-        if (channels_info_.find(escaped_name) == channels_info_.end())
-        {
-          channels_info_[escaped_name] = ChannelInfo(reader->GetChannelType(channel), description);
-        }
-        else
-        {
-          if (!description.empty())
-          {
-            channels_info_[escaped_name].description = description;
-          }
-        }
-
-        channels_info_[escaped_name].files.push_back(reader);
+        const size_t channel_index = index_.AddChannel(escaped_name, reader->GetChannelType(channel), reader->GetChannelDescription(channel));
 
         EntryInfoSet entries;
         if (reader->GetEntriesInfo(channel, entries))
         {
-          for (auto entry : entries)
-          {
-            entries_by_id_[id] = EntryInfo(entry.ID, reader);
-            entry.ID = id;
-            entries_by_chn_[escaped_name].insert(entry);
-            id++;
-          }
+          index_.AddEntries(channel_index, file_index, entries);
         }
       }
-      file_readers_.push_back(reader);
-    }
-    else
-    {
-      reader->Close();
-      delete reader;
-      reader = nullptr;
     }
+
+    // The reader of a file that cannot be read is kept as well, so it is not opened again
+    file_readers_.push_back(reader);
+  }
+
+  index_.FinishBuild();
+}
+
+eCAL::eh5::HDF5Meas* eCAL::eh5::HDF5MeasDir::GetFileReader(size_t file_index) const
+{
+  auto& reader = file_readers_[file_index];
+  if (reader == nullptr)
+  {
+    reader = new eCAL::eh5::HDF5Meas(input_dir_ + "/" + index_.GetFiles()[file_index].path);
   }
-  return !file_readers_.empty();
+  return reader->IsOk() ? reader : nullptr;
 }
 
 ::eCAL::eh5::HDF5MeasDir::FileWriterMap::iterator eCAL::eh5::HDF5MeasDir::GetWriter(const std::string& channel_name)
@@ -506,7 +536,7 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, eAccessType access
   if (file_writer_it == file_writers_.end())
   {
     // No appropriate file writer was found. Let's create a new one!
-    file_writer_it = file_writers_.emplace(one_file_per_channel_ ? channel_name : "", std::make_unique<::eCAL::eh5::HDF5MeasFileWriterV5>()).first;
+    file_writer_it = file_writers_.emplace(one_file_per_channel_ ? channel_name : "", std::make_unique<::eCAL::eh5::HDF5MeasFileWriterV6>()).first;
 
     // Set the current parameters to the new file writer
     file_writer_it->second->SetMaxSizePerFile(GetMaxSizePerFile());
@@ -28,7 +28,9 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
+#include "eh5_meas_dir_index.h"
 #include "eh5_meas_impl.h"
 
 #include "hdf5.h"
@@ -176,6 +178,16 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+      /**
+      * @brief Set compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression of the channel entries
+      *
+      * @return              true if the compression is supported, false if the channel is stored uncompressed
+      **/
+      bool SetChannelCompression(const std::string& channel_name, eCompression compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -278,41 +290,11 @@ namespace eCAL
     // ==== Reading Files
     // =====================================================================
     protected:
-      struct ChannelInfo
-      {
-        std::string type;
-        std::string description;
-        std::list<const eCAL::eh5::HDF5Meas*> files;
-
-        ChannelInfo() = default;
-        ChannelInfo(const std::string& type_, const std::string& description_)
-          : type(type_)
-          , description(description_)
-        {}
-      };
-
-      struct EntryInfo
-      {
-        long long                   file_id;
-        const eCAL::eh5::HDF5Meas* reader;
+      typedef std::vector<eCAL::eh5::HDF5Meas*> HDF5Files;
 
-        EntryInfo() : file_id(0), reader(nullptr) {}
-
-        EntryInfo(long long file_id_, const eCAL::eh5::HDF5Meas* reader_)
-          : file_id(file_id_)
-          , reader(reader_)
-        {}
-      };
-
-      typedef std::list<eCAL::eh5::HDF5Meas*>               HDF5Files;
-      typedef std::unordered_map<std::string, ChannelInfo>  ChannelInfoUMap;
-      typedef std::unordered_map<long long, EntryInfo>      EntriesByIdUMap;
-      typedef std::unordered_map<std::string, EntryInfoSet> EntriesByChannelUMap;
-
-      HDF5Files              file_readers_;
-      ChannelInfoUMap        channels_info_;
-      EntriesByIdUMap        entries_by_id_;
-      EntriesByChannelUMap   entries_by_chn_;
+      std::string            input_dir_;                                        //!< The measurement directory when in RDONLY mode
+      HDF5MeasDirIndex       index_;                                            //!< The files, channels and entries of the measurement directory
+      mutable HDF5Files      file_readers_;                                     //!< One reader for each file of the index_. When the index_ has been loaded from the index file, the readers are created on first access (nullptr until then).
 
       struct Channel
       {
@@ -337,6 +319,24 @@ namespace eCAL
 
       bool OpenRX(const std::string& path, eAccessType access /*= eAccessType::RDONLY*/);
 
+      /**
+       * @brief Builds the index_ by opening all given files
+       *
+       * @param files   the HDF5 files of the input_dir_
+       */
+      void BuildIndex(const std::vector<HDF5MeasDirIndex::FileInfo>& files);
+
+      /**
+       * @brief Returns the reader of the given file and opens it, if it has not been opened yet
+       *
+       * Not thread safe, as the reader may be created by this call.
+       *
+       * @param file_index  index of the file in the index_
+       *
+       * @return the reader, nullptr if the file cannot be read
+       */
+      eCAL::eh5::HDF5Meas* GetFileReader(size_t file_index) const;
+
 
       // =====================================================================
       // ==== Writing files
@@ -0,0 +1,594 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCALHDF5 entries index of a measurement directory
+**/
+
+#include "eh5_meas_dir_index.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <utility>
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <ecal_utils/str_convert.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // WIN32
+
+namespace
+{
+  // Layout of the index file:
+  //   FileHeader
+  //   Metadata block, padded to 8 bytes:
+  //     files    (path, version, size, modification time)
+  //     channels (name, type, description, first, count)
+  //     strings are stored as uint32_t length + characters
+  //   File entry ids   (int64_t  * entry_count)
+  //   Rcv timestamps   (int64_t  * channel_entry_count)
+  //   Entry ids        (int64_t  * channel_entry_count)
+  //   Send clocks      (int64_t  * channel_entry_count)
+  //   Send timestamps  (int64_t  * channel_entry_count)
+  //   Send ids         (int64_t  * channel_entry_count)
+  //   File indices     (uint32_t * entry_count)
+  struct FileHeader
+  {
+    char     magic[8];
+    uint32_t byte_order_mark;                                                   // The file is only valid on machines with the same byte order
+    uint32_t header_size;
+    uint64_t file_count;
+    uint64_t channel_count;
+    uint64_t entry_count;
+    uint64_t channel_entry_count;
+    uint64_t metadata_size;
+  };
+
+  const char     kFileMagic[8]    = { 'E', 'C', 'A', 'L', 'H', '5', 'I', '1' };
+  const uint32_t kByteOrderMark   = 0x01020304;
+
+  const size_t   kChannelColumns        = 5;
+  const uint64_t kBytesPerEntry         = sizeof(int64_t) + sizeof(uint32_t);
+  const uint64_t kBytesPerChannelEntry  = kChannelColumns * sizeof(int64_t);
+
+  uint64_t PaddedSize(uint64_t size)
+  {
+    return (size + 7) & ~static_cast<uint64_t>(7);
+  }
+
+  template <typename T>
+  void WriteValue(std::string& block, const T& value)
+  {
+    block.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void WriteString(std::string& block, const std::string& value)
+  {
+    WriteValue(block, static_cast<uint32_t>(value.size()));
+    block.append(value);
+  }
+
+  // Reads values from the metadata block and fails instead of reading past its end
+  class MetadataReader
+  {
+  public:
+    MetadataReader(const char* begin, const char* end)
+      : it_(begin)
+      , end_(end)
+    {}
+
+    template <typename T>
+    bool ReadValue(T& value)
+    {
+      if (static_cast<size_t>(end_ - it_) < sizeof(value)) return false;
+      std::memcpy(&value, it_, sizeof(value));
+      it_ += sizeof(value);
+      return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+      uint32_t size = 0;
+      if (!ReadValue(size) || (static_cast<size_t>(end_ - it_) < size)) return false;
+      value.assign(it_, size);
+      it_ += size;
+      return true;
+    }
+
+  private:
+    const char* it_;
+    const char* end_;
+  };
+}
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    HDF5MeasDirIndex::HDF5MeasDirIndex()
+      : mapped_data_        (nullptr)
+      , mapped_size_        (0)
+#ifdef WIN32
+      , file_handle_        (INVALID_HANDLE_VALUE)
+      , mapping_handle_     (nullptr)
+#endif // WIN32
+      , entry_count_        (0)
+      , file_entry_ids_     (nullptr)
+      , file_indices_       (nullptr)
+      , channel_entry_count_(0)
+      , rcv_timestamps_     (nullptr)
+      , entry_ids_          (nullptr)
+      , snd_clocks_         (nullptr)
+      , snd_timestamps_     (nullptr)
+      , snd_ids_            (nullptr)
+    {}
+
+    HDF5MeasDirIndex::~HDF5MeasDirIndex()
+    {
+      Clear();
+    }
+
+    void HDF5MeasDirIndex::Clear()
+    {
+      files_.clear();
+      channels_.clear();
+      channel_indices_.clear();
+      build_entries_.clear();
+
+      std::vector<int64_t>() .swap(file_entry_id_column_);
+      std::vector<uint32_t>().swap(file_index_column_);
+      std::vector<int64_t>() .swap(channel_columns_);
+
+#ifdef WIN32
+      if (mapped_data_ != nullptr)                 ::UnmapViewOfFile(mapped_data_);
+      if (mapping_handle_ != nullptr)              ::CloseHandle(mapping_handle_);
+      if (file_handle_ != INVALID_HANDLE_VALUE)    ::CloseHandle(file_handle_);
+      mapping_handle_ = nullptr;
+      file_handle_    = INVALID_HANDLE_VALUE;
+#else
+      if (mapped_data_ != nullptr)                 ::munmap(const_cast<char*>(mapped_data_), static_cast<size_t>(mapped_size_));
+#endif // WIN32
+      mapped_data_ = nullptr;
+      mapped_size_ = 0;
+
+      entry_count_         = 0;
+      file_entry_ids_      = nullptr;
+      file_indices_        = nullptr;
+      channel_entry_count_ = 0;
+      rcv_timestamps_      = nullptr;
+      entry_ids_           = nullptr;
+      snd_clocks_          = nullptr;
+      snd_timestamps_      = nullptr;
+      snd_ids_             = nullptr;
+    }
+
+    bool HDF5MeasDirIndex::ReadFileStatus(const std::string& path, FileInfo& file)
+    {
+#ifdef WIN32
+      WIN32_FILE_ATTRIBUTE_DATA attributes;
+      if (!::GetFileAttributesExW(EcalUtils::StrConvert::Utf8ToWide(path).c_str(), GetFileExInfoStandard, &attributes)) return false;
+
+      file.size              = static_cast<long long>((static_cast<unsigned long long>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow);
+      file.modification_time = static_cast<long long>((static_cast<unsigned long long>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime);
+#else
+      struct stat file_stat;
+      if (::stat(path.c_str(), &file_stat) != 0) return false;
+
+      file.size = static_cast<long long>(file_stat.st_size);
+#if defined(__APPLE__)
+      file.modification_time = static_cast<long long>(file_stat.st_mtimespec.tv_sec) * 1000000000LL + file_stat.st_mtimespec.tv_nsec;
+#else
+      file.modification_time = static_cast<long long>(file_stat.st_mtim.tv_sec) * 1000000000LL + file_stat.st_mtim.tv_nsec;
+#endif // __APPLE__
+#endif // WIN32
+      return true;
+    }
+
+    uint32_t HDF5MeasDirIndex::AddFile(const FileInfo& file)
+    {
+      files_.push_back(file);
+      return static_cast<uint32_t>(files_.size() - 1);
+    }
+
+    size_t HDF5MeasDirIndex::AddChannel(const std::string& name, const std::string& type, const std::string& description)
+    {
+      const auto& found = channel_indices_.find(name);
+      if (found != channel_indices_.end())
+      {
+        if (!description.empty())
+          channels_[found->second].description = description;
+        return found->second;
+      }
+
+      ChannelInfo channel;
+      channel.name        = name;
+      channel.type        = type;
+      channel.description = description;
+      channels_.push_back(channel);
+      build_entries_.emplace_back();
+
+      channel_indices_[name] = channels_.size() - 1;
+      return channels_.size() - 1;
+    }
+
+    void HDF5MeasDirIndex::AddEntries(size_t channel_index, uint32_t file_index, const EntryInfoSet& entries)
+    {
+      EntryInfoVect& channel_entries = build_entries_[channel_index];
+      channel_entries.reserve(channel_entries.size() + entries.size());
+
+      for (auto entry : entries)
+      {
+        file_entry_id_column_.push_back(entry.ID);
+        file_index_column_   .push_back(file_index);
+
+        entry.ID = static_cast<long long>(file_entry_id_column_.size() - 1);
+        channel_entries.push_back(entry);
+      }
+    }
+
+    void HDF5MeasDirIndex::FinishBuild()
+    {
+      // The entries of one file are sorted already, the stable sort keeps the
+      // order of the files for equal timestamps
+      size_t channel_entry_count = 0;
+      for (auto& entries : build_entries_)
+      {
+        std::stable_sort(entries.begin(), entries.end(), [](const SEntryInfo& lhs, const SEntryInfo& rhs) { return lhs.RcvTimestamp < rhs.RcvTimestamp; });
+        entries.erase(std::unique(entries.begin(), entries.end(), [](const SEntryInfo& lhs, const SEntryInfo& rhs) { return lhs.RcvTimestamp == rhs.RcvTimestamp; }), entries.end());
+        channel_entry_count += entries.size();
+      }
+
+      channel_columns_.resize(kChannelColumns * channel_entry_count);
+      int64_t* rcv_timestamps = channel_columns_.data();
+      int64_t* entry_ids      = rcv_timestamps + channel_entry_count;
+      int64_t* snd_clocks     = entry_ids      + channel_entry_count;
+      int64_t* snd_timestamps = snd_clocks     + channel_entry_count;
+      int64_t* snd_ids        = snd_timestamps + channel_entry_count;
+
+      size_t position = 0;
+      for (size_t channel_index = 0; channel_index < channels_.size(); channel_index++)
+      {
+        EntryInfoVect& entries = build_entries_[channel_index];
+
+        channels_[channel_index].first = position;
+        channels_[channel_index].count = entries.size();
+
+        for (const auto& entry : entries)
+        {
+          rcv_timestamps[position] = entry.RcvTimestamp;
+          entry_ids     [position] = entry.ID;
+          snd_clocks    [position] = entry.SndClock;
+          snd_timestamps[position] = entry.SndTimestamp;
+          snd_ids       [position] = entry.SndID;
+          position++;
+        }
+
+        // Free the memory of copied channels early
+        EntryInfoVect().swap(entries);
+      }
+      build_entries_.clear();
+
+      entry_count_         = static_cast<long long>(file_entry_id_column_.size());
+      file_entry_ids_      = file_entry_id_column_.data();
+      file_indices_        = file_index_column_.data();
+      channel_entry_count_ = channel_entry_count;
+      rcv_timestamps_      = rcv_timestamps;
+      entry_ids_           = entry_ids;
+      snd_clocks_          = snd_clocks;
+      snd_timestamps_      = snd_timestamps;
+      snd_ids_             = snd_ids;
+    }
+
+    bool HDF5MeasDirIndex::Load(const std::string& path, const std::vector<FileInfo>& files)
+    {
+      Clear();
+
+#ifdef WIN32
+      HANDLE file_handle = ::CreateFileW(EcalUtils::StrConvert::Utf8ToWide(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file_handle == INVALID_HANDLE_VALUE) return false;
+      file_handle_ = file_handle;
+
+      LARGE_INTEGER file_size;
+      if (!::GetFileSizeEx(file_handle, &file_size) || (file_size.QuadPart < static_cast<LONGLONG>(sizeof(FileHeader))))
+      {
+        Clear();
+        return false;
+      }
+
+      mapping_handle_ = ::CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping_handle_ == nullptr)
+      {
+        Clear();
+        return false;
+      }
+
+      mapped_data_ = static_cast<const char*>(::MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+      if (mapped_data_ == nullptr)
+      {
+        Clear();
+        return false;
+      }
+      mapped_size_ = static_cast<uint64_t>(file_size.QuadPart);
+#else
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0) return false;
+
+      struct stat file_stat;
+      if ((::fstat(fd, &file_stat) != 0) || (file_stat.st_size < static_cast<off_t>(sizeof(FileHeader))))
+      {
+        ::close(fd);
+        return false;
+      }
+
+      void* data = ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (data == MAP_FAILED) return false;
+
+      mapped_data_ = static_cast<const char*>(data);
+      mapped_size_ = static_cast<uint64_t>(file_stat.st_size);
+#endif // WIN32
+
+      //  Check the header
+      FileHeader header;
+      std::memcpy(&header, mapped_data_, sizeof(header));
+
+      if ((std::memcmp(header.magic, kFileMagic, sizeof(kFileMagic)) != 0)
+        || (header.byte_order_mark != kByteOrderMark)
+        || (header.header_size     != sizeof(FileHeader))
+        || (header.metadata_size   != PaddedSize(header.metadata_size))
+        || (header.metadata_size       > mapped_size_)
+        || (header.entry_count         > mapped_size_ / kBytesPerEntry)
+        || (header.channel_entry_count > mapped_size_ / kBytesPerChannelEntry)
+        || (mapped_size_ != sizeof(FileHeader) + header.metadata_size + header.entry_count * kBytesPerEntry + header.channel_entry_count * kBytesPerChannelEntry))
+      {
+        Clear();
+        return false;
+      }
+
+      //  Read the files and channels
+      const char* metadata_begin = mapped_data_ + sizeof(FileHeader);
+      const char* metadata_end   = metadata_begin + header.metadata_size;
+      MetadataReader metadata(metadata_begin, metadata_end);
+
+      bool metadata_ok = (header.file_count <= header.metadata_size) && (header.channel_count <= header.metadata_size);
+      for (uint64_t i = 0; metadata_ok && (i < header.file_count); i++)
+      {
+        FileInfo file;
+        int64_t  size              = 0;
+        int64_t  modification_time = 0;
+        metadata_ok = metadata.ReadString(file.path)
+                   && metadata.ReadString(file.version)
+                   && metadata.ReadValue(size)
+                   && metadata.ReadValue(modification_time);
+        file.size              = static_cast<long long>(size);
+        file.modification_time = static_cast<long long>(modification_time);
+        files_.push_back(file);
+      }
+
+      for (uint64_t i = 0; metadata_ok && (i < header.channel_count); i++)
+      {
+        ChannelInfo channel;
+        uint64_t    first = 0;
+        uint64_t    count = 0;
+        metadata_ok = metadata.ReadString(channel.name)
+                   && metadata.ReadString(channel.type)
+                   && metadata.ReadString(channel.description)
+                   && metadata.ReadValue(first)
+                   && metadata.ReadValue(count)
+                   && (count <= header.channel_entry_count)
+                   && (first <= header.channel_entry_count - count);
+        channel.first = static_cast<size_t>(first);
+        channel.count = static_cast<size_t>(count);
+        channel_indices_[channel.name] = channels_.size();
+        channels_.push_back(channel);
+      }
+
+      if (!metadata_ok)
+      {
+        Clear();
+        return false;
+      }
+
+      //  Check that the index has been written for exactly the given files
+      std::map<std::string, std::pair<long long, long long>> file_status;
+      for (const auto& file : files)
+        file_status[file.path] = std::make_pair(file.size, file.modification_time);
+
+      bool files_match = (file_status.size() == files_.size());
+      for (const auto& file : files_)
+      {
+        const auto& found = file_status.find(file.path);
+        files_match = files_match
+                   && (found != file_status.end())
+                   && (found->second == std::make_pair(file.size, file.modification_time));
+      }
+
+      if (!files_match)
+      {
+        Clear();
+        return false;
+      }
+
+      //  Map the columns
+      const size_t entry_count         = static_cast<size_t>(header.entry_count);
+      const size_t channel_entry_count = static_cast<size_t>(header.channel_entry_count);
+
+      entry_count_         = static_cast<long long>(entry_count);
+      file_entry_ids_      = reinterpret_cast<const int64_t*>(metadata_end);
+      channel_entry_count_ = channel_entry_count;
+      rcv_timestamps_      = file_entry_ids_ + entry_count;
+      entry_ids_           = rcv_timestamps_ + channel_entry_count;
+      snd_clocks_          = entry_ids_      + channel_entry_count;
+      snd_timestamps_      = snd_clocks_     + channel_entry_count;
+      snd_ids_             = snd_timestamps_ + channel_entry_count;
+      file_indices_        = reinterpret_cast<const uint32_t*>(snd_ids_ + channel_entry_count);
+
+      return true;
+    }
+
+    bool HDF5MeasDirIndex::Save(const std::string& path) const
+    {
+      // The process id keeps processes opening the same directory from writing the same temporary file
+#ifdef WIN32
+      const std::string temp_path = path + "." + std::to_string(::GetCurrentProcessId()) + ".tmp";
+#else
+      const std::string temp_path = path + "." + std::to_string(::getpid()) + ".tmp";
+#endif // WIN32
+
+      {
+#ifdef WIN32
+        std::ofstream index_file(EcalUtils::StrConvert::Utf8ToWide(temp_path), std::ios::binary | std::ios::trunc);
+#else
+        std::ofstream index_file(temp_path, std::ios::binary | std::ios::trunc);
+#endif // WIN32
+        if (!index_file) return false;
+
+        std::string metadata;
+        for (const auto& file : files_)
+        {
+          WriteString(metadata, file.path);
+          WriteString(metadata, file.version);
+          WriteValue (metadata, static_cast<int64_t>(file.size));
+          WriteValue (metadata, static_cast<int64_t>(file.modification_time));
+        }
+        for (const auto& channel : channels_)
+        {
+          WriteString(metadata, channel.name);
+          WriteString(metadata, channel.type);
+          WriteString(metadata, channel.description);
+          WriteValue (metadata, static_cast<uint64_t>(channel.first));
+          WriteValue (metadata, static_cast<uint64_t>(channel.count));
+        }
+        metadata.resize(static_cast<size_t>(PaddedSize(metadata.size())), '\0');
+
+        FileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+        header.byte_order_mark     = kByteOrderMark;
+        header.header_size         = sizeof(FileHeader);
+        header.file_count          = files_.size();
+        header.channel_count       = channels_.size();
+        header.entry_count         = static_cast<uint64_t>(entry_count_);
+        header.channel_entry_count = channel_entry_count_;
+        header.metadata_size       = metadata.size();
+
+        const std::streamsize entry_count         = static_cast<std::streamsize>(entry_count_);
+        const std::streamsize channel_entry_count = static_cast<std::streamsize>(channel_entry_count_);
+        const std::streamsize int64_size          = static_cast<std::streamsize>(sizeof(int64_t));
+
+        index_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        index_file.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+        index_file.write(reinterpret_cast<const char*>(file_entry_ids_), entry_count         * int64_size);
+        index_file.write(reinterpret_cast<const char*>(rcv_timestamps_), channel_entry_count * int64_size);
+        index_file.write(reinterpret_cast<const char*>(entry_ids_),      channel_entry_count * int64_size);
+        index_file.write(reinterpret_cast<const char*>(snd_clocks_),     channel_entry_count * int64_size);
+        index_file.write(reinterpret_cast<const char*>(snd_timestamps_), channel_entry_count * int64_size);
+        index_file.write(reinterpret_cast<const char*>(snd_ids_),        channel_entry_count * int64_size);
+        index_file.write(reinterpret_cast<const char*>(file_indices_),   entry_count         * static_cast<std::streamsize>(sizeof(uint32_t)));
+        index_file.close();
+
+        if (!index_file)
+        {
+          std::remove(temp_path.c_str());
+          return false;
+        }
+      }
+
+#ifdef WIN32
+      if (!::MoveFileExW(EcalUtils::StrConvert::Utf8ToWide(temp_path).c_str(), EcalUtils::StrConvert::Utf8ToWide(path).c_str(), MOVEFILE_REPLACE_EXISTING))
+#else
+      if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+#endif // WIN32
+      {
+        std::remove(temp_path.c_str());
+        return false;
+      }
+
+      return true;
+    }
+
+    const std::vector<HDF5MeasDirIndex::FileInfo>& HDF5MeasDirIndex::GetFiles() const
+    {
+      return files_;
+    }
+
+    const std::vector<HDF5MeasDirIndex::ChannelInfo>& HDF5MeasDirIndex::GetChannels() const
+    {
+      return channels_;
+    }
+
+    const HDF5MeasDirIndex::ChannelInfo* HDF5MeasDirIndex::FindChannel(const std::string& name) const
+    {
+      const auto& found = channel_indices_.find(name);
+      return (found != channel_indices_.end()) ? &channels_[found->second] : nullptr;
+    }
+
+    long long HDF5MeasDirIndex::GetEntryCount() const
+    {
+      return entry_count_;
+    }
+
+    bool HDF5MeasDirIndex::GetEntryLocation(long long entry_id, size_t& file_index, long long& file_entry_id) const
+    {
+      if ((entry_id < 0) || (entry_id >= entry_count_)) return false;
+
+      file_index    = file_indices_[entry_id];
+      file_entry_id = file_entry_ids_[entry_id];
+      return file_index < files_.size();
+    }
+
+    bool HDF5MeasDirIndex::GetTimestampRange(const ChannelInfo& channel, long long& min_timestamp, long long& max_timestamp) const
+    {
+      if (channel.count == 0) return false;
+
+      min_timestamp = rcv_timestamps_[channel.first];
+      max_timestamp = rcv_timestamps_[channel.first + channel.count - 1];
+      return true;
+    }
+
+    void HDF5MeasDirIndex::GetEntriesInfoRange(const ChannelInfo& channel, long long begin, long long end, EntryInfoSet& entries) const
+    {
+      entries.clear();
+      if (channel.count == 0) return;
+
+      //  A timestamp of 0 does not limit the range
+      const int64_t* channel_begin = rcv_timestamps_ + channel.first;
+      const int64_t* channel_end   = channel_begin + channel.count;
+      const int64_t* lower         = (begin == 0) ? channel_begin : std::lower_bound(channel_begin, channel_end, static_cast<int64_t>(begin));
+      const int64_t* upper         = (end   == 0) ? channel_end   : std::upper_bound(lower,         channel_end, static_cast<int64_t>(end));
+
+      for (const int64_t* it = lower; it < upper; it++)
+      {
+        const size_t position = static_cast<size_t>(it - rcv_timestamps_);
+
+        //                                        rec timestamp,             entry id,             send clock,            send time stamp,           send ID
+        entries.emplace_hint(entries.end(), SEntryInfo(rcv_timestamps_[position], entry_ids_[position], snd_clocks_[position], snd_timestamps_[position], snd_ids_[position]));
+      }
+    }
+  }  //  namespace eh5
+}  //  namespace eCAL
@@ -0,0 +1,245 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * eCALHDF5 entries index of a measurement directory
+ *
+ * The index maps the entry ids of the directory to the HDF5 file and the
+ * entry id within that file, and it holds the sorted entries of every
+ * channel column by column (rcv timestamp, entry id, send clock, send
+ * timestamp, send id).
+ *
+ * It is either built from the HDF5 files or memory-mapped from an index file
+ * written next to them, so loading it does not depend on the number of
+ * entries.
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ecalhdf5/eh5_types.h"
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    // the index file in the measurement directory
+    const std::string kIndexFileName(".ecalhdf5_index");
+
+    class HDF5MeasDirIndex
+    {
+    public:
+      struct FileInfo
+      {
+        std::string path;                                                       //!< Path relative to the measurement directory
+        long long   size              = -1;                                     //!< File size in bytes
+        long long   modification_time = -1;                                     //!< Platform specific, only compared for equality
+        std::string version;                                                    //!< File version, empty if the file cannot be read
+      };
+
+      struct ChannelInfo
+      {
+        std::string name;
+        std::string type;
+        std::string description;
+        size_t      first = 0;                                                  //!< Position of the first entry of the channel in the channel columns
+        size_t      count = 0;                                                  //!< Number of entries of the channel
+      };
+
+      HDF5MeasDirIndex();
+      ~HDF5MeasDirIndex();
+
+      HDF5MeasDirIndex(const HDF5MeasDirIndex&)            = delete;
+      HDF5MeasDirIndex& operator=(const HDF5MeasDirIndex&) = delete;
+
+      /**
+      * @brief Removes all files, channels and entries and unmaps the index file
+      **/
+      void Clear();
+
+      /**
+      * @brief Reads size and modification time of a file
+      *
+      * @param [in]  path   file path
+      * @param [out] file   file info to set the size and modification time of
+      *
+      * @return             true if succeeds, false if it fails
+      **/
+      static bool ReadFileStatus(const std::string& path, FileInfo& file);
+
+      // =====================================================================
+      // ==== Building the index
+      // =====================================================================
+
+      /**
+      * @brief Adds a file
+      *
+      * @return   the file index used by AddEntries()
+      **/
+      uint32_t AddFile(const FileInfo& file);
+
+      /**
+      * @brief Adds a channel or updates its description
+      *
+      * The type is kept from the first file containing the channel, the
+      * description is replaced by every non-empty one.
+      *
+      * @return   the channel index used by AddEntries()
+      **/
+      size_t AddChannel(const std::string& name, const std::string& type, const std::string& description);
+
+      /**
+      * @brief Adds entries of a file to a channel
+      *
+      * The entries get consecutive entry ids of the directory.
+      *
+      * @param channel_index   channel index returned by AddChannel()
+      * @param file_index      file index returned by AddFile()
+      * @param entries         entries with the entry ids of the file
+      **/
+      void AddEntries(size_t channel_index, uint32_t file_index, const EntryInfoSet& entries);
+
+      /**
+      * @brief Sorts the entries of all channels, must be called after adding all entries
+      *
+      * Entries of a channel with the same rcv timestamp are kept only once
+      * (the first one that has been added), like in an EntryInfoSet.
+      **/
+      void FinishBuild();
+
+      // =====================================================================
+      // ==== Index file
+      // =====================================================================
+
+      /**
+      * @brief Memory-maps an index file written by Save()
+      *
+      * Fails and leaves the index empty, if the file does not exist, is
+      * corrupt or has been written for other files (compared by path, size
+      * and modification time).
+      *
+      * @param path    index file path
+      * @param files   the HDF5 files of the measurement directory
+      *
+      * @return        true if succeeds, false if it fails
+      **/
+      bool Load(const std::string& path, const std::vector<FileInfo>& files);
+
+      /**
+      * @brief Writes the index to a file
+      *
+      * The index is written to a temporary file first and renamed afterwards,
+      * so a reader never maps a partially written file.
+      *
+      * @param path    index file path
+      *
+      * @return        true if succeeds, false if it fails
+      **/
+      bool Save(const std::string& path) const;
+
+      // =====================================================================
+      // ==== Reading the index
+      // =====================================================================
+
+      const std::vector<FileInfo>&    GetFiles() const;
+      const std::vector<ChannelInfo>& GetChannels() const;
+
+      /**
+      * @brief Finds a channel by name
+      *
+      * @return   the channel, nullptr if it does not exist
+      **/
+      const ChannelInfo* FindChannel(const std::string& name) const;
+
+      /**
+      * @brief Gets the number of entry ids of the directory
+      **/
+      long long GetEntryCount() const;
+
+      /**
+      * @brief Gets the file and the entry id within that file of an entry of the directory
+      *
+      * @param [in]  entry_id        entry id of the directory
+      * @param [out] file_index      index into GetFiles()
+      * @param [out] file_entry_id   entry id within the file
+      *
+      * @return                      true if succeeds, false if the entry does not exist
+      **/
+      bool GetEntryLocation(long long entry_id, size_t& file_index, long long& file_entry_id) const;
+
+      /**
+      * @brief Gets the minimum and maximum rcv timestamp of a channel
+      *
+      * @return   false if the channel has no entries
+      **/
+      bool GetTimestampRange(const ChannelInfo& channel, long long& min_timestamp, long long& max_timestamp) const;
+
+      /**
+      * @brief Gets the entries of a channel in the given rcv timestamp range (begin->end)
+      *
+      * The range is found by binary search, only the entries in it are
+      * copied.
+      *
+      * @param [in]  channel    channel
+      * @param [in]  begin      time range begin timestamp
+      * @param [in]  end        time range end timestamp
+      * @param [out] entries    entries with the entry ids of the directory
+      **/
+      void GetEntriesInfoRange(const ChannelInfo& channel, long long begin, long long end, EntryInfoSet& entries) const;
+
+    private:
+      std::vector<FileInfo>                   files_;
+      std::vector<ChannelInfo>                channels_;
+      std::unordered_map<std::string, size_t> channel_indices_;                 //!< Channel name -> index into channels_
+
+      // Entries of the channels while building
+      std::vector<EntryInfoVect>              build_entries_;
+
+      // Storage of a built index
+      std::vector<int64_t>                    file_entry_id_column_;
+      std::vector<uint32_t>                   file_index_column_;
+      std::vector<int64_t>                    channel_columns_;                 //!< All channel columns, one after another
+
+      // Storage of a loaded index
+      const char*                             mapped_data_;
+      uint64_t                                mapped_size_;
+#ifdef WIN32
+      void*                                   file_handle_;
+      void*                                   mapping_handle_;
+#endif // WIN32
+
+      // Entry columns (entry id of the directory -> file), point to either storage
+      long long                               entry_count_;
+      const int64_t*                          file_entry_ids_;
+      const uint32_t*                         file_indices_;                    //!< Not checked when loading an index file, must be bounds-checked when used
+
+      // Channel columns (sorted entries of all channels), point to either storage
+      size_t                                  channel_entry_count_;
+      const int64_t*                          rcv_timestamps_;
+      const int64_t*                          entry_ids_;
+      const int64_t*                          snd_clocks_;
+      const int64_t*                          snd_timestamps_;
+      const int64_t*                          snd_ids_;
+    };
+  }  //  namespace eh5
+}  //  namespace eCAL
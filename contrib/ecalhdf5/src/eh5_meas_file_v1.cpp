@@ -194,6 +194,12 @@ void eCAL::eh5::HDF5MeasFileV1::SetChannelType(const std::string& /*channel_name
   ReportUnsupportedAction();
 }
 
+bool eCAL::eh5::HDF5MeasFileV1::SetChannelCompression(const std::string& /*channel_name*/, eCompression /*compression*/)
+{
+  ReportUnsupportedAction();
+  return false;
+}
+
 long long eCAL::eh5::HDF5MeasFileV1::GetMinTimestamp(const std::string& /*channel_name*/) const
 {
   long long ret_val = 0;
@@ -199,6 +199,11 @@ long long eCAL::eh5::HDF5MeasFileV2::GetMinTimestamp(const std::string& channel_
   return ret_val;
 }
 
+bool eCAL::eh5::HDF5MeasFileV2::SetChannelCompression(const std::string& /*channel_name*/, eCompression /*compression*/)
+{
+  return false;
+}
+
 long long eCAL::eh5::HDF5MeasFileV2::GetMaxTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
@@ -0,0 +1,173 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCALHDF5 reader multiple channels (chunked channel datasets) implement
+**/
+
+#include "eh5_meas_file_v6.h"
+
+#include "hdf5.h"
+
+namespace eCAL
+{
+  namespace eh5
+  {
+
+    HDF5MeasFileV6::HDF5MeasFileV6(const std::string& path, eAccessType access /*= eAccessType::RDONLY*/)
+      : HDF5MeasFileV2(path, access)
+    {
+      // call the function via its class becase it's a virtual function that is called in constructor/destructor,-
+      // where the vtable is not created yet or it's destructed.
+      if (HDF5MeasFileV2::IsOk() && !HDF5MeasFileV6::ReadIndex())
+        HDF5MeasFileV6::Close();
+    }
+
+    HDF5MeasFileV6::HDF5MeasFileV6()
+    = default;
+
+    HDF5MeasFileV6::~HDF5MeasFileV6()
+    {
+      // the payload datasets have to be closed before the file
+      HDF5MeasFileV6::Close();
+    }
+
+    bool HDF5MeasFileV6::Open(const std::string& path, eAccessType access /*= eAccessType::RDONLY*/)
+    {
+      HDF5MeasFileV6::Close();
+
+      if (!HDF5MeasFileV2::Open(path, access)) return false;
+
+      if (!ReadIndex())
+      {
+        HDF5MeasFileV6::Close();
+        return false;
+      }
+
+      return true;
+    }
+
+    bool HDF5MeasFileV6::Close()
+    {
+      for (auto payload_dataset : payload_datasets_)
+        H5Dclose(payload_dataset);
+
+      payload_datasets_.clear();
+      entry_locations_.clear();
+      channel_entries_.clear();
+
+      return HDF5MeasFileV2::Close();
+    }
+
+    bool HDF5MeasFileV6::GetEntriesInfo(const std::string& channel_name, EntryInfoSet& entries) const
+    {
+      entries.clear();
+
+      if (!this->IsOk()) return false;
+
+      const auto& found = channel_entries_.find(channel_name);
+      if (found == channel_entries_.end()) return false;
+
+      entries = found->second;
+      return true;
+    }
+
+    bool HDF5MeasFileV6::GetEntryDataSize(long long entry_id, size_t& size) const
+    {
+      const auto& found = entry_locations_.find(entry_id);
+      if (found == entry_locations_.end()) return false;
+
+      size = static_cast<size_t>(found->second.size);
+      return true;
+    }
+
+    bool HDF5MeasFileV6::GetEntryData(long long entry_id, void* data) const
+    {
+      if (data == nullptr) return false;
+
+      const auto& found = entry_locations_.find(entry_id);
+      if (found == entry_locations_.end()) return false;
+
+      const EntryLocation& location = found->second;
+      if (location.size == 0) return true;
+
+      const hid_t payload_dataset = payload_datasets_[location.payload_index];
+
+      //  Select the entry slice in the channel payload
+      auto fileSpace = H5Dget_space(payload_dataset);
+      H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, &location.offset, nullptr, &location.size, nullptr);
+      auto memSpace = H5Screate_simple(1, &location.size, nullptr);
+
+      herr_t read_status = H5Dread(payload_dataset, H5T_NATIVE_UCHAR, memSpace, fileSpace, H5P_DEFAULT, data);
+
+      H5Sclose(memSpace);
+      H5Sclose(fileSpace);
+
+      return (read_status >= 0);
+    }
+
+    bool HDF5MeasFileV6::ReadIndex()
+    {
+      for (const auto& channel_name : GetChannelNames())
+      {
+        auto index_dataset = H5Dopen(file_id_, channel_name.c_str(), H5P_DEFAULT);
+        if (index_dataset < 0) return false;
+
+        //  Read the complete entries index of the channel
+        auto dataSpace = H5Dget_space(index_dataset);
+        hsize_t dims[2] = { 0, 0 };
+        const int rank = H5Sget_simple_extent_dims(dataSpace, dims, nullptr);
+        H5Sclose(dataSpace);
+
+        std::vector<long long> index;
+        herr_t read_status = -1;
+        if ((rank == 2) && (dims[1] == kIndexColumns))
+        {
+          index.resize(static_cast<size_t>(dims[0]) * kIndexColumns);
+          read_status = index.empty() ? 0 : H5Dread(index_dataset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, index.data());
+        }
+        H5Dclose(index_dataset);
+
+        if (read_status < 0) return false;
+
+        //  Keep the payload dataset open for reading the entries
+        auto payload_dataset = H5Dopen(file_id_, (kPayloadGroupTitle + "/" + channel_name).c_str(), H5P_DEFAULT);
+        if (payload_dataset < 0) return false;
+        payload_datasets_.push_back(payload_dataset);
+
+        EntryInfoSet& entries = channel_entries_[channel_name];
+        for (size_t row = 0; row < index.size(); row += kIndexColumns)
+        {
+          const long long* entry = &index[row];
+
+          //                        rec timestamp,  entry id,  send clock,  send time stamp,  send ID
+          entries.emplace(SEntryInfo(entry[0],       entry[1],  entry[2],    entry[3],         entry[4]));
+
+          EntryLocation location;
+          location.payload_index = payload_datasets_.size() - 1;
+          location.offset        = static_cast<hsize_t>(entry[5]);
+          location.size          = static_cast<hsize_t>(entry[6]);
+          entry_locations_[entry[1]] = location;
+        }
+      }
+
+      return true;
+    }
+  }  //  namespace eh5
+}  //  namespace eCAL
@@ -0,0 +1,139 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * eCALHDF5 file reader multiple channels (chunked channel datasets)
+ *
+ * File layout version 6.0:
+ *
+ *   /<channel>           entries index, long long [n, 7], chunked and extendible
+ *                        (rcv timestamp, entry id, send clock, send timestamp, send id, data offset, data size)
+ *                        attributes: channel type, channel description
+ *   /%payload/<channel>  payload bytes of all entries of the channel, chunked and extendible
+ *
+ * Every entry is a slice of the channel payload dataset instead of a dataset of its own.
+**/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "eh5_meas_file_v5.h"
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    // '%' is always escaped in channel names ("%25"), so the group can not collide with a channel dataset
+    const std::string kPayloadGroupTitle("%payload");
+
+    // columns of the entries index
+    constexpr size_t kIndexColumns = 7;
+
+    class HDF5MeasFileV6 : virtual public HDF5MeasFileV5
+    {
+    public:
+      /**
+      * @brief Constructor
+      **/
+      HDF5MeasFileV6();
+
+      /**
+      * @brief Constructor
+      *
+      * @param path    Input file path
+      **/
+      explicit HDF5MeasFileV6(const std::string& path, eAccessType access = eAccessType::RDONLY);
+
+      /**
+      * @brief Destructor
+      **/
+      ~HDF5MeasFileV6() override;
+
+      /**
+      * @brief Open file
+      *
+      * @param path     Input file path
+      * @param access   Access type
+      *
+      * @return         true if succeeds, false if it fails
+      **/
+      bool Open(const std::string& path, eAccessType access = eAccessType::RDONLY) override;
+
+      /**
+      * @brief Close file
+      *
+      * @return         true if succeeds, false if it fails
+      **/
+      bool Close() override;
+
+      /**
+      * @brief Gets the header info for all data entries for the given channel
+      *        Header = timestamp + entry id
+      *
+      * @param [in]  channel_name  channel name
+      * @param [out] entries       header info for all data entries
+      *
+      * @return                    true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfo(const std::string& channel_name, EntryInfoSet& entries) const override;
+
+      /**
+      * @brief Gets data size of a specific entry
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] size       Entry data size
+      *
+      * @return                 true if succeeds, false if it fails
+      **/
+      bool GetEntryDataSize(long long entry_id, size_t& size) const override;
+
+      /**
+      * @brief Gets data from a specific entry
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] data       Entry data
+      *
+      * @return                 true if succeeds, false if it fails
+      **/
+      bool GetEntryData(long long entry_id, void* data) const override;
+
+    protected:
+      struct EntryLocation
+      {
+        size_t     payload_index = 0;   // index into payload_datasets_
+        hsize_t    offset        = 0;   // offset in the channel payload dataset
+        hsize_t    size          = 0;   // entry data size
+      };
+
+      /**
+      * @brief Reads the entries index of all channels and opens their payload datasets
+      *
+      * @return       true if succeeds, false if it fails
+      **/
+      bool ReadIndex();
+
+      std::vector<hid_t>                              payload_datasets_;
+      std::unordered_map<long long, EntryLocation>    entry_locations_;
+      std::unordered_map<std::string, EntryInfoSet>   channel_entries_;
+    };
+  }  //  namespace eh5
+}  //  namespace eCAL
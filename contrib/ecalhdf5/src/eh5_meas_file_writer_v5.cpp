@@ -160,6 +160,12 @@ void eCAL::eh5::HDF5MeasFileWriterV5::SetChannelType(const std::string& channel_
   channels_[channel_name].Type = type;
 }
 
+bool eCAL::eh5::HDF5MeasFileWriterV5::SetChannelCompression(const std::string& /*channel_name*/, eCompression compression)
+{
+  // The contiguous entry datasets of file version 5.0 are not compressed
+  return (compression == eCompression::NONE);
+}
+
 long long eCAL::eh5::HDF5MeasFileWriterV5::GetMinTimestamp(const std::string& /*channel_name*/) const
 {
   // UNSUPPORTED FUNCTION
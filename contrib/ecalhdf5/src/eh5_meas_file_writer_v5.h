@@ -174,6 +174,16 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+      /**
+      * @brief Set compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression of the channel entries
+      *
+      * @return              true if the compression is supported, false if the channel is stored uncompressed
+      **/
+      bool SetChannelCompression(const std::string& channel_name, eCompression compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -0,0 +1,646 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCALHDF5 file writer (chunked channel datasets, file layout version 6.0)
+**/
+
+#include "eh5_meas_file_writer_v6.h"
+#include "eh5_meas_file_v6.h"
+#include "escape.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif //WIN32
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <list>
+#include <iostream>
+
+#include <ecal_utils/filesystem.h>
+#include <ecal_utils/str_convert.h>
+
+constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
+
+// dataset chunking
+constexpr hsize_t kPayloadChunkSize    = 64 * 1024;          // bytes
+constexpr hsize_t kIndexChunkRows      = 512;                // entries
+
+// pending entries are written in batches per channel
+constexpr size_t  kChannelFlushSize    = 256 * 1024;         // pending payload bytes of a channel
+constexpr size_t  kChannelFlushEntries = 512;                // pending entries of a channel
+constexpr size_t  kMaxPendingSize      = 32 * 1024 * 1024;   // pending bytes of all channels
+
+// compressed channels
+constexpr size_t  kMaxCompressingChunks = 64;               // chunks of a channel queued for compression
+
+eCAL::eh5::HDF5MeasFileWriterV6::HDF5MeasFileWriterV6()
+  : cb_pre_split_               (nullptr)
+  , file_id_                    (-1)
+  , file_split_counter_         (-1)
+  , entries_counter_            (0)
+  , max_size_per_file_          (kDefaultMaxFileSizeMB * 1024 * 1024)
+  , pending_size_               (0)
+  , written_size_               (0)
+  , compressed_pending_size_    (0)
+  , compressed_pending_estimate_(0.0)
+{}
+
+eCAL::eh5::HDF5MeasFileWriterV6::~HDF5MeasFileWriterV6()
+{
+  // call the function via its class becase it's a virtual function that is called in constructor/destructor,-
+  // where the vtable is not created yet or it's destructed.
+  HDF5MeasFileWriterV6::Close();
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::Open(const std::string& output_dir, eAccessType /*access = eAccessType::RDONLY*/)
+{
+  Close();
+
+  // Check if the given path points to a directory
+  if (!EcalUtils::Filesystem::IsDir(output_dir, EcalUtils::Filesystem::Current))
+    return false;
+
+  output_dir_ = output_dir;
+
+  return true;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::Close()
+{
+  if (!this->IsOk())  return false;
+
+  bool flush_status = FlushChannels(true);
+
+  std::string channels_with_entries;
+
+  for (auto& channel : channels_)
+  {
+    if (channel.second.IndexDataSet >= 0)
+    {
+      SetAttribute(channel.second.IndexDataSet, kChnTypeAttrTitle, channel.second.Type);
+      SetAttribute(channel.second.IndexDataSet, kChnDescAttrTitle, channel.second.Description);
+
+      if (channel.second.IndexRows > 0)
+        channels_with_entries += channel.first + ",";
+
+      H5Dclose(channel.second.IndexDataSet);
+    }
+    if (channel.second.PayloadDataSet >= 0)
+      H5Dclose(channel.second.PayloadDataSet);
+
+    channel.second.IndexDataSet   = -1;
+    channel.second.PayloadDataSet = -1;
+    channel.second.Compressed     = false;
+    channel.second.IndexRows      = 0;
+    channel.second.PayloadSize    = 0;
+    channel.second.SubmittedSize  = 0;
+  }
+
+  if ((!channels_with_entries.empty())  && (channels_with_entries.back() == ','))
+    channels_with_entries.pop_back();
+
+  SetAttribute(file_id_, kChnAttrTitle, channels_with_entries);
+
+  written_size_               = 0;
+  compressed_pending_estimate_ = 0.0;
+
+  if (H5Fclose(file_id_) >= 0)
+  {
+    file_id_ = -1;
+    return flush_status;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::IsOk() const
+{
+  return (file_id_ >= 0);
+}
+
+std::string eCAL::eh5::HDF5MeasFileWriterV6::GetFileVersion() const
+{
+  // UNSUPPORTED FUNCTION
+  return "";
+}
+
+size_t eCAL::eh5::HDF5MeasFileWriterV6::GetMaxSizePerFile() const
+{
+  return max_size_per_file_ / 1024 / 1024;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetMaxSizePerFile(size_t max_file_size_mib)
+{
+  max_size_per_file_ = max_file_size_mib * 1024 * 1024;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::IsOneFilePerChannelEnabled() const
+{
+  return false;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetOneFilePerChannelEnabled(bool /*enabled*/)
+{
+}
+
+std::set<std::string> eCAL::eh5::HDF5MeasFileWriterV6::GetChannelNames() const
+{
+  // UNSUPPORTED FUNCTION
+  return {};
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::HasChannel(const std::string& /*channel_name*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
+std::string eCAL::eh5::HDF5MeasFileWriterV6::GetChannelDescription(const std::string& /*channel_name*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return "";
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetChannelDescription(const std::string& channel_name, const std::string& description)
+{
+  channels_[channel_name].Description = description;
+}
+
+std::string eCAL::eh5::HDF5MeasFileWriterV6::GetChannelType(const std::string& /*channel_name*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return "";
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetChannelType(const std::string& channel_name, const std::string& type)
+{
+  channels_[channel_name].Type = type;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::SetChannelCompression(const std::string& channel_name, eCompression compression)
+{
+  Channel& channel = channels_[channel_name];
+
+  if ((compression == eCompression::DEFLATE) && !HDF5ChunkCompressor::IsDeflateAvailable())
+  {
+    channel.Compression = eCompression::NONE;
+    return false;
+  }
+
+  //  Datasets that already exist in the current file keep their compression
+  channel.Compression = compression;
+
+  if ((compression != eCompression::NONE) && !compressor_)
+    compressor_ = HDF5ChunkCompressor::Instance();
+
+  return true;
+}
+
+long long eCAL::eh5::HDF5MeasFileWriterV6::GetMinTimestamp(const std::string& /*channel_name*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return -1;
+}
+
+long long eCAL::eh5::HDF5MeasFileWriterV6::GetMaxTimestamp(const std::string& /*channel_name*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return -1;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntriesInfo(const std::string& /*channel_name*/, EntryInfoSet& /*entries*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntriesInfoRange(const std::string& /*channel_name*/, long long /*begin*/, long long /*end*/, EntryInfoSet& /*entries*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntryDataSize(long long /*entry_id*/, size_t& /*size*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntryData(long long /*entry_id*/, void* /*data*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetFileBaseName(const std::string& base_name)
+{
+  base_name_ = base_name;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::AddEntryToFile(const void* data, const unsigned long long& size, const long long& snd_timestamp, const long long& rcv_timestamp, const std::string& channel_name, long long id, long long clock)
+{
+  if (!IsOk()) file_id_ = Create();
+  if (!IsOk())
+    return false;
+
+  hsize_t hsSize = static_cast<hsize_t>(size);
+
+  Channel& channel = channels_[channel_name];
+
+  //  Entries of compressed channels are estimated with the compression ratio of the channel
+  const double ratio = ((channel.Compression != eCompression::NONE) && compressor_) ? CompressionRatio(channel) : 1.0;
+
+  if (!EntryFitsTheFile(static_cast<hsize_t>(static_cast<double>(hsSize) * ratio)))
+  {
+    if (cb_pre_split_ != nullptr)
+    {
+      cb_pre_split_();
+    }
+
+    if (Create() < 0)
+      return false;
+  }
+
+  if ((channel.IndexDataSet < 0) && !CreateChannelDataSets(channel_name, channel))
+    return false;
+
+  //  The entry data starts behind the written (or queued) and the pending payload of the channel
+  const hsize_t offset = channel.SubmittedSize + channel.PendingPayload.size();
+
+  if ((hsSize >= kChannelFlushSize) && !channel.Compressed)
+  {
+    //  Large entries are appended directly instead of being copied into the pending payload
+    if (!FlushChannel(channel_name, channel, false))
+      return false;
+    if (!AppendToDataSet(channel.PayloadDataSet, 1, channel.PayloadSize, hsSize, 1, H5T_NATIVE_UCHAR, data))
+      return false;
+    channel.SubmittedSize = channel.PayloadSize;
+    written_size_ += static_cast<size_t>(size);
+  }
+  else
+  {
+    const char* entry_data = static_cast<const char*>(data);
+    channel.PendingPayload.insert(channel.PendingPayload.end(), entry_data, entry_data + size);
+    pending_size_ += static_cast<size_t>(size);
+    if (channel.Compressed)
+    {
+      compressed_pending_size_ += static_cast<size_t>(size);
+      UpdatePendingEstimate(channel);
+    }
+  }
+
+  //  Entry index row: rec timestamp, entry id, send clock, send time stamp, send ID, data offset, data size
+  channel.PendingIndex.insert(channel.PendingIndex.end(),
+    { rcv_timestamp, static_cast<long long>(entries_counter_), clock, snd_timestamp, id, static_cast<long long>(offset), static_cast<long long>(size) });
+  pending_size_ += kIndexColumns * sizeof(long long);
+
+  entries_counter_++;
+
+  //  Write the pending entries in batches (the index rows of a compressed channel wait for their payload chunk anyway)
+  if ((channel.PendingPayload.size() >= kChannelFlushSize) || (!channel.Compressed && (channel.PendingIndex.size() >= kChannelFlushEntries * kIndexColumns)))
+    return FlushChannel(channel_name, channel, false);
+
+  if (pending_size_ >= kMaxPendingSize)
+    return FlushChannels(false);
+
+  return true;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::ConnectPreSplitCallback(CallbackFunction cb)
+{
+  cb_pre_split_ = cb;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::DisconnectPreSplitCallback()
+{
+  cb_pre_split_ = nullptr;
+}
+
+hid_t eCAL::eh5::HDF5MeasFileWriterV6::Create()
+{
+  if (output_dir_.empty()) return -1;
+
+  if (!EcalUtils::Filesystem::IsDir(output_dir_, EcalUtils::Filesystem::OsStyle::Current)
+      && !EcalUtils::Filesystem::MkPath(output_dir_, EcalUtils::Filesystem::OsStyle::Current))
+    return -1;
+
+  if (base_name_.empty()) return -1;
+
+  if (IsOk() && !Close()) return -1;
+
+  file_split_counter_++;
+
+  std::string filePath = output_dir_ + "/" + base_name_;
+
+  if (file_split_counter_ > 0)
+    filePath += "_" + std::to_string(file_split_counter_);
+
+  filePath += ".hdf5";
+
+  //  create file access property
+  hid_t fileAccessPropery = H5Pcreate(H5P_FILE_ACCESS);
+  //  create file create property
+  hid_t fileCreateProperty = H5Pcreate(H5P_FILE_CREATE);
+
+  //  Create hdf file and get file id
+  file_id_ = H5Fcreate(filePath.c_str(), H5F_ACC_TRUNC, fileCreateProperty, fileAccessPropery);
+
+  if (file_id_ >= 0)
+  {
+    SetAttribute(file_id_, kFileVerAttrTitle, "6.0");
+
+    //  Create the group of the channel payload datasets
+    auto payloadGroup = H5Gcreate(file_id_, kPayloadGroupTitle.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Gclose(payloadGroup);
+  }
+  else
+    file_split_counter_--;
+
+  return file_id_;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::SetAttribute(const hid_t& id, const std::string& name, const std::string& value)
+{
+  if (id < 0) return false;
+
+  if (H5Aexists(id, name.c_str()) > 0)
+    H5Adelete(id, name.c_str());
+  //  create scalar dataset
+  hid_t scalarDataset = H5Screate(H5S_SCALAR);
+
+  //  create new string data type
+  hid_t stringDataType = H5Tcopy(H5T_C_S1);
+
+  //  if attribute's value length exists, allocate space for it
+  if (value.length() > 0)
+    H5Tset_size(stringDataType, value.length());
+
+  //  create attribute
+  hid_t attribute = H5Acreate(id, name.c_str(), stringDataType, scalarDataset, H5P_DEFAULT, H5P_DEFAULT);
+
+  if (attribute < 0) return false;
+
+  //  write attribute value to attribute
+  herr_t writeStatus = H5Awrite(attribute, stringDataType, value.c_str());
+  if (writeStatus < 0) return false;
+
+  //  close attribute
+  H5Aclose(attribute);
+  //  close scalar dataset
+  H5Sclose(scalarDataset);
+  //  close string data type
+  H5Tclose(stringDataType);
+
+  return true;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::EntryFitsTheFile(const hsize_t& size) const
+{
+  hsize_t fileSize = 0;
+  bool status = GetFileSize(fileSize);
+
+  //  The pending payload of compressed channels is counted with its estimated compressed size
+  const hsize_t pendingSize = (pending_size_ - compressed_pending_size_) + static_cast<hsize_t>(compressed_pending_estimate_);
+
+  //  check if buffer fits the current file
+  return (status && ((std::max<hsize_t>(fileSize, written_size_) + pendingSize + size) <= max_size_per_file_));
+}
+
+double eCAL::eh5::HDF5MeasFileWriterV6::CompressionRatio(const Channel& channel)
+{
+  return (channel.WrittenRawSize > 0) ? static_cast<double>(channel.WrittenCompressedSize) / static_cast<double>(channel.WrittenRawSize) : 1.0;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::UpdatePendingEstimate(Channel& channel)
+{
+  const double estimate = static_cast<double>(channel.PendingPayload.size() + channel.CompressingSize) * CompressionRatio(channel);
+
+  compressed_pending_estimate_ += estimate - channel.PendingEstimate;
+  channel.PendingEstimate       = estimate;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::GetFileSize(hsize_t& size) const
+{
+  if (!IsOk())
+  {
+    size = 0;
+    return false;
+  }
+  else
+  {
+    return H5Fget_filesize(file_id_, &size) >= 0;
+  }
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::CreateChannelDataSets(const std::string& channel_name, Channel& channel) const
+{
+  if (!IsOk()) return false;
+
+  //  Entries index: extendible number of rows, chunked
+  {
+    hsize_t dims[2]     = { 0, kIndexColumns };
+    hsize_t max_dims[2] = { H5S_UNLIMITED, kIndexColumns };
+    hsize_t chunk[2]    = { kIndexChunkRows, kIndexColumns };
+
+    auto dataSpace  = H5Screate_simple(2, dims, max_dims);
+    auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_obj_track_times(dsProperty, false);
+    H5Pset_chunk(dsProperty, 2, chunk);
+
+    channel.IndexDataSet = H5Dcreate(file_id_, channel_name.c_str(), H5T_NATIVE_LLONG, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
+
+    H5Pclose(dsProperty);
+    H5Sclose(dataSpace);
+  }
+
+  //  Payload: extendible number of bytes, chunked, optionally deflate compressed
+  {
+    hsize_t dims     = 0;
+    hsize_t max_dims = H5S_UNLIMITED;
+    hsize_t chunk    = kPayloadChunkSize;
+
+    auto dataSpace  = H5Screate_simple(1, &dims, &max_dims);
+    auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_obj_track_times(dsProperty, false);
+    H5Pset_chunk(dsProperty, 1, &chunk);
+
+    //  The chunks are compressed by the chunk compressor, the filter decompresses them when reading
+    channel.Compressed = (channel.Compression == eCompression::DEFLATE) && compressor_ && (H5Pset_deflate(dsProperty, HDF5ChunkCompressor::kDeflateLevel) >= 0);
+
+    channel.PayloadDataSet = H5Dcreate(file_id_, (kPayloadGroupTitle + "/" + channel_name).c_str(), H5T_NATIVE_UCHAR, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
+
+    H5Pclose(dsProperty);
+    H5Sclose(dataSpace);
+  }
+
+  return (channel.IndexDataSet >= 0) && (channel.PayloadDataSet >= 0);
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::FlushChannel(const std::string& channel_name, Channel& channel, bool complete)
+{
+  if ((channel.IndexDataSet < 0) && !CreateChannelDataSets(channel_name, channel))
+    return false;
+
+  bool status = true;
+
+  if (!channel.Compressed)
+  {
+    //  Payload first, so the written index never points behind the written payload
+    const size_t payload_size = channel.PendingPayload.size();
+    status = AppendToDataSet(channel.PayloadDataSet, 1, channel.PayloadSize, payload_size, 1, H5T_NATIVE_UCHAR, channel.PendingPayload.data());
+    channel.SubmittedSize = channel.PayloadSize;
+
+    pending_size_ -= payload_size;
+    written_size_ += payload_size;
+    channel.PendingPayload.clear();
+  }
+  else
+  {
+    //  Queue the complete chunks for compression, the last partial chunk only if all entries have to be written
+    const size_t chunk_size = static_cast<size_t>(kPayloadChunkSize);
+    size_t       queued     = 0;
+
+    while ((channel.PendingPayload.size() - queued >= chunk_size) || (complete && (channel.PendingPayload.size() > queued)))
+    {
+      const size_t raw_size = std::min(chunk_size, channel.PendingPayload.size() - queued);
+
+      //  Chunks are always complete, the part behind the dataset extent is ignored
+      std::vector<char> chunk(chunk_size, 0);
+      std::memcpy(chunk.data(), channel.PendingPayload.data() + queued, raw_size);
+
+      channel.CompressingChunks.emplace_back(raw_size, compressor_->Deflate(std::move(chunk)));
+      channel.SubmittedSize   += raw_size;
+      channel.CompressingSize += raw_size;
+      queued                  += raw_size;
+    }
+    channel.PendingPayload.erase(channel.PendingPayload.begin(), channel.PendingPayload.begin() + queued);
+
+    status = WriteCompressedChunks(channel, complete ? 0 : kMaxCompressingChunks);
+  }
+
+  //  Index rows of the written payload (rows are sorted by their payload offset)
+  size_t rows = complete ? channel.PendingIndex.size() / kIndexColumns : 0;
+  while ((rows * kIndexColumns < channel.PendingIndex.size())
+    && (static_cast<hsize_t>(channel.PendingIndex[rows * kIndexColumns + 5] + channel.PendingIndex[rows * kIndexColumns + 6]) <= channel.PayloadSize))
+  {
+    rows++;
+  }
+
+  status = AppendToDataSet(channel.IndexDataSet, 2, channel.IndexRows, rows, kIndexColumns, H5T_NATIVE_LLONG, channel.PendingIndex.data()) && status;
+
+  const size_t index_size = rows * kIndexColumns;
+  pending_size_ -= index_size * sizeof(long long);
+  written_size_ += index_size * sizeof(long long);
+  channel.PendingIndex.erase(channel.PendingIndex.begin(), channel.PendingIndex.begin() + index_size);
+
+  return status;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::FlushChannels(bool complete)
+{
+  bool status = true;
+
+  for (auto& channel : channels_)
+  {
+    if (!channel.second.PendingIndex.empty())
+      status &= FlushChannel(channel.first, channel.second, complete);
+  }
+
+  return status;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::WriteCompressedChunks(Channel& channel, size_t max_queued)
+{
+  bool status = true;
+
+  while (!channel.CompressingChunks.empty())
+  {
+    auto& front = channel.CompressingChunks.front();
+    if ((channel.CompressingChunks.size() <= max_queued) && (front.second.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+      break;
+
+    const hsize_t raw_size = front.first;
+    const auto    chunk    = front.second.get();
+    channel.CompressingChunks.pop_front();
+
+    //  Extend the dataset and write the chunk as it is, the deflate filter is skipped for chunks that did not compress
+    hsize_t dims   = channel.PayloadSize + raw_size;
+    hsize_t offset = channel.PayloadSize;
+
+    if (status
+      && (H5Dset_extent(channel.PayloadDataSet, &dims) >= 0)
+      && (H5Dwrite_chunk(channel.PayloadDataSet, H5P_DEFAULT, chunk.Compressed ? 0 : 1, &offset, chunk.Data.size(), chunk.Data.data()) >= 0))
+    {
+      channel.PayloadSize = dims;
+      written_size_      += chunk.Data.size();
+
+      channel.WrittenRawSize        += raw_size;
+      channel.WrittenCompressedSize += chunk.Data.size();
+    }
+    else
+    {
+      status = false;
+    }
+
+    channel.CompressingSize  -= static_cast<size_t>(raw_size);
+    pending_size_            -= static_cast<size_t>(raw_size);
+    compressed_pending_size_ -= static_cast<size_t>(raw_size);
+  }
+
+  UpdatePendingEstimate(channel);
+
+  return status;
+}
+
+bool eCAL::eh5::HDF5MeasFileWriterV6::AppendToDataSet(hid_t dataset, int rank, hsize_t& rows, hsize_t count, hsize_t columns, hid_t type, const void* data)
+{
+  if (dataset < 0) return false;
+  if (count == 0)  return true;
+
+  //  Extend the dataset
+  hsize_t dims[2] = { rows + count, columns };
+  if (H5Dset_extent(dataset, dims) < 0) return false;
+
+  //  Select the appended rows
+  hsize_t start[2] = { rows, 0 };
+  hsize_t block[2] = { count, columns };
+
+  auto fileSpace = H5Dget_space(dataset);
+  H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, block, nullptr);
+  auto memSpace = H5Screate_simple(rank, block, nullptr);
+
+  //  Write buffer to dataset
+  herr_t writeStatus = H5Dwrite(dataset, type, memSpace, fileSpace, H5P_DEFAULT, data);
+
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+
+  if (writeStatus < 0) return false;
+
+  rows += count;
+  return true;
+}
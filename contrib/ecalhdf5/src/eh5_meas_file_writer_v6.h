@@ -0,0 +1,443 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * eCALHDF5 file writer (chunked channel datasets, file layout version 6.0)
+**/
+
+#pragma once
+
+#include <deque>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "eh5_chunk_compressor.h"
+#include "eh5_meas_impl.h"
+
+#include "hdf5.h"
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    class HDF5MeasFileWriterV6 : virtual public HDF5MeasImpl
+    {
+    public:
+      /**
+      * @brief Constructor
+      **/
+      HDF5MeasFileWriterV6();
+
+      // Copy
+      HDF5MeasFileWriterV6(const HDF5MeasFileWriterV6&)            = delete;
+      HDF5MeasFileWriterV6& operator=(const HDF5MeasFileWriterV6&) = delete;
+
+      // Move
+      HDF5MeasFileWriterV6& operator=(HDF5MeasFileWriterV6&&)      = default;
+      HDF5MeasFileWriterV6(HDF5MeasFileWriterV6&&)                 = default;
+
+      /**
+      * @brief Destructor
+      **/
+      ~HDF5MeasFileWriterV6() override;
+
+      /**
+      * @brief Open file
+      *
+      * @param output_dir  Input file path / measurement directory path
+      * @param access      Access type (IGNORED, WILL ALWAYS OPEN READ-WRITE!)
+      *
+      * @return            true if succeeds, false if it fails
+      **/
+      bool Open(const std::string& output_dir, eAccessType access) override;
+
+      /**
+      * @brief Close file
+      *
+      * @return         true if succeeds, false if it fails
+      **/
+      bool Close() override;
+
+      /**
+      * @brief Checks if file/measurement is ok
+      *
+      * @return  true if meas can be opened(read) or location is accessible(write), false otherwise
+      **/
+      bool IsOk() const override;
+
+      /**
+      * @brief Get the File Type Version of the current opened file
+      *
+      * @return       file version
+      **/
+      std::string GetFileVersion() const override;
+
+      /**
+      * @brief Gets maximum allowed size for an individual file
+      *
+      * @return       maximum size in MB
+      **/
+      size_t GetMaxSizePerFile() const override;
+
+      /**
+      * @brief Sets maximum allowed size for an individual file
+      *
+      * @param max_file_size_mib   maximum size in MB
+      **/
+      void SetMaxSizePerFile(size_t max_file_size_mib) override;
+
+      /**
+      * @brief Whether each Channel shall be writte in its own file
+      * 
+      * When enabled, data is clustered by channel and each channel is written
+      * to its own file. The filenames will consist of the basename and the 
+      * channel name.
+      * 
+      * @return true, if one file per channel is enabled
+      */
+      bool IsOneFilePerChannelEnabled() const override;
+
+      /**
+      * @brief Enable / disable the creation of one individual file per channel
+      * 
+      * When enabled, data is clustered by channel and each channel is written
+      * to its own file. The filenames will consist of the basename and the 
+      * channel name.
+      * 
+      * @param enabled   Whether one file shall be created per channel
+      */
+      void SetOneFilePerChannelEnabled(bool enabled) override;
+
+      /**
+      * @brief Get the available channel names of the current opened file / measurement
+      *
+      * @return       channel names
+      **/
+      std::set<std::string> GetChannelNames() const override;
+
+      /**
+      * @brief Check if channel exists in measurement
+      *
+      * @param channel_name   name of the channel
+      *
+      * @return       true if exists, false otherwise
+      **/
+      bool HasChannel(const std::string& channel_name) const override;
+
+      /**
+      * @brief Get the channel description for the given channel
+      *
+      * @param channel_name  channel name
+      *
+      * @return              channel description
+      **/
+      std::string GetChannelDescription(const std::string& channel_name) const override;
+
+      /**
+      * @brief Set description of the given channel
+      *
+      * @param channel_name    channel name
+      * @param description     description of the channel
+      **/
+      void SetChannelDescription(const std::string& channel_name, const std::string& description) override;
+
+      /**
+      * @brief Gets the channel type of the given channel
+      *
+      * @param channel_name  channel name
+      *
+      * @return              channel type
+      **/
+      std::string GetChannelType(const std::string& channel_name) const override;
+
+      /**
+      * @brief Set type of the given channel
+      *
+      * @param channel_name  channel name
+      * @param type          type of the channel
+      **/
+      void SetChannelType(const std::string& channel_name, const std::string& type) override;
+
+      /**
+      * @brief Set compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression of the channel entries
+      *
+      * @return              true if the compression is supported, false if the channel is stored uncompressed
+      **/
+      bool SetChannelCompression(const std::string& channel_name, eCompression compression) override;
+
+      /**
+      * @brief Gets minimum timestamp for specified channel
+      *
+      * @param channel_name    channel name
+      *
+      * @return                minimum timestamp value
+      **/
+      long long GetMinTimestamp(const std::string& channel_name) const override;
+
+      /**
+      * @brief Gets maximum timestamp for specified channel
+      *
+      * @param channel_name    channel name
+      *
+      * @return                maximum timestamp value
+      **/
+      long long GetMaxTimestamp(const std::string& channel_name) const override;
+
+      /**
+      * @brief Gets the header info for all data entries for the given channel
+      *        Header = timestamp + entry id
+      *
+      * @param [in]  channel_name  channel name
+      * @param [out] entries       header info for all data entries
+      *
+      * @return                    true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfo(const std::string& channel_name, EntryInfoSet& entries) const override;
+
+      /**
+      * @brief Gets the header info for data entries for the given channel included in given time range (begin->end)
+      *        Header = timestamp + entry id
+      *
+      * @param [in]  channel_name channel name
+      * @param [in]  begin        time range begin timestamp
+      * @param [in]  end          time range end timestamp
+      * @param [out] entries      header info for data entries in given range
+      *
+      * @return                   true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfoRange(const std::string& channel_name, long long begin, long long end, EntryInfoSet& entries) const override;
+
+      /**
+      * @brief Gets data size of a specific entry
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] size       Entry data size
+      *
+      * @return                 true if succeeds, false if it fails
+      **/
+      bool GetEntryDataSize(long long entry_id, size_t& size) const override;
+
+      /**
+      * @brief Gets data from a specific entry
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] data       Entry data
+      *
+      * @return                 true if succeeds, false if it fails
+      **/
+      bool GetEntryData(long long entry_id, void* data) const override;
+
+      /**
+      * @brief Set measurement file base name
+      *
+      * @param base_name        File base name.
+      **/
+      void SetFileBaseName(const std::string& base_name) override;
+
+      /**
+      * @brief Add entry to file
+      *
+      * @param data           data to be added
+      * @param size           size of the data
+      * @param snd_timestamp  send timestamp
+      * @param rcv_timestamp  receive timestamp
+      * @param channel_name   channel name
+      * @param id             message id
+      * @param clock          message clock
+      *
+      * @return               true if succeeds, false if it fails
+      **/
+      bool AddEntryToFile(const void* data, const unsigned long long& size, const long long& snd_timestamp, const long long& rcv_timestamp, const std::string& channel_name, long long id, long long clock) override;
+
+      using CallbackFunction = std::function<void ()>;
+      /**
+      * @brief Connect callback for pre file split notification
+      *
+      * @param cb   callback function
+      **/
+      void ConnectPreSplitCallback(CallbackFunction cb) override;
+
+      /**
+      * @brief Disconnect pre file split callback
+      **/
+      void DisconnectPreSplitCallback() override;
+
+    protected:
+      using CompressingChunk = std::pair<hsize_t, std::future<HDF5ChunkCompressor::CompressedChunk>>;  // raw chunk size, compressed chunk
+
+      struct Channel
+      {
+        std::string             Description;
+        std::string             Type;
+        eCompression            Compression = eCompression::NONE;  // applied when the datasets are created
+
+        // entries not yet written to the file
+        std::vector<long long>  PendingIndex;
+        std::vector<char>       PendingPayload;
+
+        // chunks of a compressed payload dataset queued for compression (in payload order)
+        std::deque<CompressingChunk> CompressingChunks;
+        size_t                  CompressingSize       = 0;    // raw bytes of the queued chunks
+        double                  PendingEstimate       = 0.0;  // estimated compressed size of the pending and queued payload
+        unsigned long long      WrittenRawSize        = 0;    // raw bytes of all written chunks (compression ratio)
+        unsigned long long      WrittenCompressedSize = 0;    // compressed bytes of all written chunks (compression ratio)
+
+        // datasets of the current file
+        hid_t                   IndexDataSet   = -1;
+        hid_t                   PayloadDataSet = -1;
+        bool                    Compressed     = false;  // payload dataset is deflate compressed, it is written in whole chunks
+        hsize_t                 IndexRows      = 0;
+        hsize_t                 PayloadSize    = 0;      // payload bytes written to the dataset
+        hsize_t                 SubmittedSize  = 0;      // payload bytes written or queued for compression, the pending payload starts behind them
+      };
+
+      using Channels = std::map<std::string, Channel>;
+
+      std::string                          output_dir_;
+      std::string                          base_name_;
+      Channels                             channels_;
+      CallbackFunction                     cb_pre_split_;
+      hid_t                                file_id_;
+      int                                  file_split_counter_;
+      unsigned long long                   entries_counter_;
+      size_t                               max_size_per_file_;
+      size_t                               pending_size_;             // bytes of the pending entries of all channels
+      size_t                               written_size_;             // bytes written to the current file (may still be in the chunk cache)
+
+      std::shared_ptr<HDF5ChunkCompressor> compressor_;               // shared compression thread pool, set if a channel is compressed
+      size_t                               compressed_pending_size_;      // bytes of the pending payload of compressed channels (part of pending_size_)
+      double                               compressed_pending_estimate_;  // estimated compressed size of the pending payload of compressed channels
+
+      /**
+      * @brief Creates the actual file
+      *
+      * @return       file ID, file was not created if id is negative
+      **/
+      hid_t Create();
+
+      /**
+      * @brief Set attribute to object(file, entry...)
+      *
+      * @param id       ID of the attributes parent
+      * @param name     Name of the attribute
+      * @param value    Value of the attribute
+      *
+      * @return         true if succeeds, false if it fails
+      **/
+      static bool SetAttribute(const hid_t& id, const std::string& name, const std::string& value);
+
+      /**
+      * @brief Checks if current file size + pending entries + entry size does not exceed the maximum allowed size of the file
+      *        (the file size is at least the written size, chunks in the chunk cache are not yet part of the file)
+      *
+      * @param size  Size of the entry in bytes (estimated compressed size for compressed channels)
+      *
+      * @return  true if entry can be saved in current file, false if it can not be added to the current file
+      **/
+      bool EntryFitsTheFile(const hsize_t& size) const;
+
+      /**
+      * @brief Compression ratio (compressed / raw size) of the chunks written for a channel, 1.0 until the first chunk is written
+      **/
+      static double CompressionRatio(const Channel& channel);
+
+      /**
+      * @brief Updates the estimated compressed size of the pending payload of a compressed channel
+      **/
+      void UpdatePendingEstimate(Channel& channel);
+
+      /**
+      * @brief Gets the size of the file
+      *
+      * @param size  Size of the file in bytes
+      *
+      * @return  true if succeeds, false if it fails
+      **/
+      bool GetFileSize(hsize_t& size) const;
+
+      /**
+      * @brief Creates the chunked index and payload datasets of a channel in the current file
+      *
+      * @param channel_name  name of the channel
+      * @param channel       channel
+      *
+      * @return              true if succeeds, false if it fails
+      **/
+      bool CreateChannelDataSets(const std::string& channel_name, Channel& channel) const;
+
+      /**
+      * @brief Appends the pending entries of a channel to its datasets
+      *
+      *        The payload of a compressed channel is queued for compression in whole chunks,
+      *        index rows are written as soon as their payload has been written.
+      *
+      * @param channel_name  name of the channel
+      * @param channel       channel
+      * @param complete      write all entries (wait for the compression, write the last partial chunk)
+      *
+      * @return              true if succeeds, false if it fails
+      **/
+      bool FlushChannel(const std::string& channel_name, Channel& channel, bool complete);
+
+      /**
+      * @brief Appends the pending entries of all channels to their datasets
+      *
+      * @param complete      write all entries (see FlushChannel)
+      *
+      * @return              true if succeeds, false if it fails
+      **/
+      bool FlushChannels(bool complete);
+
+      /**
+      * @brief Writes the compressed chunks of a channel to its payload dataset
+      *
+      * @param channel       channel
+      * @param max_queued    wait for the compression until at most max_queued chunks are left in the queue
+      *
+      * @return              true if succeeds, false if it fails
+      **/
+      bool WriteCompressedChunks(Channel& channel, size_t max_queued);
+
+      /**
+      * @brief Appends rows to an extendible dataset
+      *
+      * @param dataset   dataset id
+      * @param rank      dataset rank (1 or 2)
+      * @param rows      current number of rows, increased by count
+      * @param count     number of rows to append
+      * @param columns   number of columns (rank 2)
+      * @param type      memory data type
+      * @param data      rows to append
+      *
+      * @return          true if succeeds, false if it fails
+      **/
+      static bool AppendToDataSet(hid_t dataset, int rank, hsize_t& rows, hsize_t count, hsize_t columns, hid_t type, const void* data);
+
+    };
+  }  //  namespace eh5
+}  //  namespace eCAL
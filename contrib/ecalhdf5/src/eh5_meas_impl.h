@@ -159,6 +159,16 @@ namespace eCAL
       **/
       virtual void SetChannelType(const std::string& channel_name, const std::string& type) = 0;
 
+      /**
+      * @brief Set compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression of the channel entries
+      *
+      * @return              true if the compression is supported, false if the channel is stored uncompressed
+      **/
+      virtual bool SetChannelCompression(const std::string& channel_name, eCompression compression) = 0;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
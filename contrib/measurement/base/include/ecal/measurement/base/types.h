@@ -25,6 +25,7 @@
 #pragma once 
 
 #include <set>
+#include <string>
 #include <vector>
 
 namespace eCAL
@@ -80,6 +81,20 @@ namespace eCAL
         **/
         using EntryInfoVect = std::vector<EntryInfo>;
 
+        /**
+         * @brief Entry to be added to a measurement (batch writing)
+        **/
+        struct WriterEntry
+        {
+          const void*        Data         = nullptr;  //!< Entry data
+          unsigned long long Size         = 0;        //!< Entry data size
+          long long          SndTimestamp = 0;        //!< Send time stamp
+          long long          RcvTimestamp = 0;        //!< Receive time stamp
+          std::string        ChannelName;             //!< Channel name
+          long long          ID           = 0;        //!< Message id
+          long long          Clock        = 0;        //!< Message clock
+        };
+
         /**
          * @brief eCAL Measurement Access types
         **/
@@ -89,6 +104,15 @@ namespace eCAL
           CREATE   //!< Create   - a new measurement will be created
         };
 
+        /**
+         * @brief eCAL Measurement channel compression
+        **/
+        enum class Compression
+        {
+          NONE,    //!< None    - the entries of the channel are stored uncompressed
+          DEFLATE  //!< Deflate - the entries of the channel are stored deflate (zlib) compressed
+        };
+
       }
     }
   }
@@ -28,6 +28,7 @@
 #include <set>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <ecal/measurement/base/types.h>
 
@@ -154,6 +155,19 @@ namespace eCAL
           **/
           virtual void SetChannelType(const std::string& channel_name, const std::string& type) = 0;
 
+          /**
+           * @brief Set compression of the given channel
+           *
+           *        The compression should be set before the first entry of the channel is added,
+           *        reading the entries of a compressed channel is transparent.
+           *
+           * @param channel_name  channel name
+           * @param compression   compression of the channel entries
+           *
+           * @return              true if the compression is supported, false if the channel is stored uncompressed
+          **/
+          virtual bool SetChannelCompression(const std::string& channel_name, Compression compression) = 0;
+
           /**
            * @brief Set measurement file base name (desired name for the actual hdf5 files that will be created)
            *
@@ -176,6 +190,26 @@ namespace eCAL
           **/
           virtual bool AddEntryToFile(const void* data, const unsigned long long& size, const long long& snd_timestamp, const long long& rcv_timestamp, const std::string& channel_name, long long id, long long clock) = 0;
 
+          /**
+           * @brief Add a batch of entries to file
+           *
+           *        The default implementation adds the entries one by one, writers may
+           *        implement a more efficient way.
+           *
+           * @param entries        entries to be added (in this order)
+           *
+           * @return              true if all entries were added, false if adding any entry failed
+          **/
+          virtual bool AddEntriesToFile(const std::vector<WriterEntry>& entries)
+          {
+            bool success = true;
+            for (const auto& entry : entries)
+            {
+              success = AddEntryToFile(entry.Data, entry.Size, entry.SndTimestamp, entry.RcvTimestamp, entry.ChannelName, entry.ID, entry.Clock) && success;
+            }
+            return success;
+          }
+
         };
       }
     }
@@ -164,6 +164,19 @@ namespace eCAL
           **/
           void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+          /**
+           * @brief Set compression of the given channel
+           *
+           *        The compression should be set before the first entry of the channel is added,
+           *        reading the entries of a compressed channel is transparent.
+           *
+           * @param channel_name  channel name
+           * @param compression   compression of the channel entries
+           *
+           * @return              true if the compression is supported, false if the channel is stored uncompressed
+          **/
+          bool SetChannelCompression(const std::string& channel_name, measurement::base::Compression compression) override;
+
           /**
            * @brief Set measurement file base name (desired name for the actual hdf5 files that will be created)
            *
@@ -186,6 +199,15 @@ namespace eCAL
           **/
           bool AddEntryToFile(const void* data, const unsigned long long& size, const long long& snd_timestamp, const long long& rcv_timestamp, const std::string& channel_name, long long id, long long clock) override;
 
+          /**
+           * @brief Add a batch of entries to file
+           *
+           * @param entries        entries to be added (in this order)
+           *
+           * @return              true if all entries were added, false if adding any entry failed
+          **/
+          bool AddEntriesToFile(const std::vector<measurement::base::WriterEntry>& entries) override;
+
         private:
           std::unique_ptr<eh5::HDF5Meas> measurement;
         };
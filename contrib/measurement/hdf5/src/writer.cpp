@@ -63,6 +63,11 @@ void Writer::SetChannelType(const std::string& channel_name, const std::string&
   return measurement->SetChannelType(channel_name, type);
 }
 
+bool Writer::SetChannelCompression(const std::string& channel_name, base::Compression compression)
+{
+  return measurement->SetChannelCompression(channel_name, compression);
+}
+
 void Writer::SetFileBaseName(const std::string& base_name)
 {
   return measurement->SetFileBaseName(base_name);
@@ -72,3 +77,8 @@ bool Writer::AddEntryToFile(const void* data, const unsigned long long& size, co
 {
   return measurement->AddEntryToFile(data, size, snd_timestamp, rcv_timestamp, channel_name, id, clock);
 }
+
+bool Writer::AddEntriesToFile(const std::vector<base::WriterEntry>& entries)
+{
+  return measurement->AddEntriesToFile(entries);
+}
@@ -106,6 +106,7 @@ namespace eCAL
     unsigned int   version     = 0;  //!< service protocol version
     unsigned short tcp_port_v0 = 0;  //!< service tcp port protocol version 0
     unsigned short tcp_port_v1 = 0;  //!< service tcp port protocol version 1
+    std::string    shm_name;         //!< service shared memory listener (calls on the same host)
   };
 
   /**
@@ -44,6 +44,8 @@ namespace eCAL
     ECAL_API std::string       GetLoadedEcalIniPath                 ();
     ECAL_API int               GetRegistrationTimeoutMs             ();
     ECAL_API int               GetRegistrationRefreshMs             ();
+    ECAL_API bool              IsRegistrationDeltaEnabled           ();
+    ECAL_API int               GetRegistrationFullStateRefreshMs    ();
 
     /////////////////////////////////////
     // network
@@ -98,6 +100,9 @@ namespace eCAL
     ECAL_API eCAL_Logging_Filter GetConsoleLogFilter                  ();
     ECAL_API eCAL_Logging_Filter GetFileLogFilter                     ();
     ECAL_API eCAL_Logging_Filter GetUdpLogFilter                      ();
+    ECAL_API bool                IsLogAsyncEnabled                    ();
+    ECAL_API size_t              GetLogQueueSize                      ();
+    ECAL_API int                 GetLogOverflowMode                   ();
 
     /////////////////////////////////////
     // sys
@@ -116,17 +121,35 @@ namespace eCAL
     ECAL_API size_t            GetMemfileMinsizeBytes               ();
     ECAL_API size_t            GetMemfileOverprovisioningPercentage ();
     ECAL_API int               GetMemfileAckTimeoutMs               ();
+    ECAL_API bool              IsMemfileAckPipeliningEnabled        ();
+    ECAL_API bool              IsMemfileAckCounterEnabled           ();
     ECAL_API bool              IsMemfileZerocopyEnabled             ();
     ECAL_API size_t            GetMemfileBufferCount                ();
+    ECAL_API size_t            GetMemfileRingSlotCount              ();
 
     ECAL_API bool              IsTopicTypeSharingEnabled            ();
     ECAL_API bool              IsTopicDescriptionSharingEnabled     ();
 
+    /////////////////////////////////////
+    // subscriber
+    /////////////////////////////////////
+    ECAL_API size_t            GetMemfileSpinTimeUs                 ();
+    ECAL_API size_t            GetMemfileObserverThreadCount        ();
+    ECAL_API int               GetCallbackExecutorMode              ();
+    ECAL_API size_t            GetCallbackExecutorThreadCount       ();
+    ECAL_API size_t            GetCallbackQueueSize                 ();
+    ECAL_API size_t            GetDuplicateWindowSize               ();
+
     /////////////////////////////////////
     // service
     /////////////////////////////////////
     ECAL_API bool              IsServiceProtocolV0Enabled           ();
     ECAL_API bool              IsServiceProtocolV1Enabled           ();
+    ECAL_API bool              IsServiceShmTransportEnabled         ();
+    ECAL_API size_t            GetServiceShmBufferSize              ();
+    ECAL_API int               GetServiceServerExecutorMode         ();
+    ECAL_API size_t            GetServiceServerThreadCount          ();
+    ECAL_API size_t            GetServiceServerQueueSize            ();
 
     /////////////////////////////////////
     // experimental
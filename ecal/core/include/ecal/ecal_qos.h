@@ -50,6 +50,21 @@ namespace eCAL
       reliable_reliability_qos,       //!< Reliable reliability (default for Publishers).
     };
 
+    /**
+     * @brief eCAL QOS overflow mode of the subscriber receive queue.
+     *
+     * Only applies to keep_last_history_qos, a keep_all_history_qos queue grows instead.
+     * block_overflow_qos blocks a transport thread that may be shared with other
+     * subscribers (e.g. the udp receive thread), so it should only be used if the
+     * samples are polled continuously.
+    **/
+    enum eQOSPolicy_Overflow
+    {
+      drop_oldest_overflow_qos,       //!< Overwrite the oldest queued sample, default value.
+      drop_newest_overflow_qos,       //!< Discard the incoming sample.
+      block_overflow_qos,             //!< Block the receiving transport thread until a sample was taken.
+    };
+
     /**
      * @brief eCAL data writer QOS settings.
      * @deprecated Will be removed in future eCAL versions.
@@ -76,12 +91,14 @@ namespace eCAL
       SReaderQOS()
       {
         history_kind       = keep_last_history_qos;
-        history_kind_depth = 8;
+        history_kind_depth = 1;
         reliability        = best_effort_reliability_qos;
+        overflow           = drop_oldest_overflow_qos;
       }
-      eQOSPolicy_HistoryKind  history_kind;              //!< qos history kind mode
-      int                     history_kind_depth;        //!< qos history kind mode depth
+      eQOSPolicy_HistoryKind  history_kind;              //!< qos history kind mode (keep_all_history_qos queues samples for Receive without limit)
+      int                     history_kind_depth;        //!< qos history kind mode depth (number of samples queued for Receive, 1 = only the latest sample)
       eQOSPolicy_Reliability  reliability;               //!< qos reliability mode
+      eQOSPolicy_Overflow     overflow;                  //!< qos receive queue overflow mode
     };
   }
 }
@@ -153,6 +153,25 @@ namespace eCAL
     **/
     ECAL_API bool IsConnected();
 
+    /**
+     * @brief Set the execution policy of the method callbacks.
+     *
+     * The default policy is set by the eCAL configuration (service/server_executor).
+     * Calls that are queued when the policy is changed fail.
+     *
+     * @param policy_  The execution policy.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API bool SetExecutionPolicy(const SServerExecutionPolicy& policy_);
+
+    /**
+     * @brief Get the execution policy of the method callbacks.
+     *
+     * @return  The execution policy.
+    **/
+    ECAL_API SServerExecutionPolicy GetExecutionPolicy();
+
   private:
     std::shared_ptr<CServiceServerImpl> m_service_server_impl;
     bool                                m_created;
@@ -26,6 +26,7 @@
 
 #include <ecal/cimpl/ecal_service_info_cimpl.h>
 
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <vector>
@@ -70,4 +71,34 @@ namespace eCAL
    * @param service_response_  Service response struct containing the (responding) server informations and the response itself.
   **/
   typedef std::function<void(const struct SServiceResponse& service_response_)> ResponseCallbackT;
+
+  /**
+   * @brief Execution mode of the service server method callbacks.
+  **/
+  enum eServerExecutionMode
+  {
+    server_execution_inline = 0,        //!< execute on the transport thread of the client session (tcp io context, shared memory channel)
+    server_execution_method_thread,     //!< execute on a dedicated thread per method
+    server_execution_worker_pool,       //!< execute on a bounded worker pool shared by all client sessions of the server
+  };
+
+  /**
+   * @brief Execution policy of a service server.
+   *
+   * The calls of one client session are always executed one after the other,
+   * in the order of the requests. Calls exceeding the queue size are not
+   * executed, the client receives a failed call state.
+  **/
+  struct SServerExecutionPolicy
+  {
+    SServerExecutionPolicy()
+    {
+      mode           = server_execution_inline;
+      worker_threads = 4;
+      queue_size     = 64;
+    };
+    eServerExecutionMode  mode;             //!< execution mode (see eServerExecutionMode)
+    size_t                worker_threads;   //!< number of worker pool threads (server_execution_worker_pool)
+    size_t                queue_size;       //!< maximum number of queued calls per server (worker pool) or per method (method thread)
+  };
 }
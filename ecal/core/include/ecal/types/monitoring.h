@@ -57,20 +57,23 @@ namespace eCAL
     {
       STopicMon()
       {
-        rclock             = 0;
-        hid                = 0;
-        pid                = 0;
-        tsize              = 0;
-        tlayer_ecal_udp_mc = false;
-        tlayer_ecal_shm    = false;
-        tlayer_ecal_tcp    = false;
-        tlayer_inproc      = false;
-        connections_loc    = 0;
-        connections_ext    = 0;
-        message_drops      = 0;
-        did                = 0;
-        dclock             = 0;
-        dfreq              = 0;
+        rclock               = 0;
+        hid                  = 0;
+        pid                  = 0;
+        tsize                = 0;
+        tlayer_ecal_udp_mc   = false;
+        tlayer_ecal_shm      = false;
+        tlayer_ecal_tcp      = false;
+        tlayer_inproc        = false;
+        connections_loc      = 0;
+        connections_ext      = 0;
+        message_drops        = 0;
+        queue_drops          = 0;
+        callback_queue_depth = 0;
+        callback_time_us     = 0;
+        did                  = 0;
+        dclock               = 0;
+        dfreq                = 0;
       };
 
       int                                 rclock;               //!< registration clock (heart beat)
@@ -94,6 +97,9 @@ namespace eCAL
       int                                 connections_loc;      //!< number of local connected entities
       int                                 connections_ext;      //!< number of external connected entities
       long long                           message_drops;        //!< dropped messages
+      long long                           queue_drops;          //!< messages dropped by the subscriber receive queue
+      int                                 callback_queue_depth; //!< maximum number of queued receive callbacks (callback executor)
+      int                                 callback_time_us;     //!< average receive callback execution time [us]
 
       long long                           did;                  //!< data send id (publisher setid)
       long long                           dclock;               //!< data clock (send / receive action)
@@ -117,6 +123,9 @@ namespace eCAL
         state_severity_level = 0;
         tsync_state          = 0;
         component_init_state = 0;
+        udp_socket_drops     = 0;
+        udp_incomplete_msgs  = 0;
+        udp_defrag_timeouts  = 0;
       };
 
       int            rclock;                                    //!< registration clock
@@ -157,6 +166,10 @@ namespace eCAL
       std::string    component_init_info;                       //!< like comp_init_state as human readable string (pub|sub|srv|mon|log|time|proc)
 
       std::string    ecal_runtime_version;                      //!< loaded / runtime eCAL version of a component
+
+      long long      udp_socket_drops;                          //!< udp datagrams dropped by the receive sockets
+      long long      udp_incomplete_msgs;                       //!< udp messages with missing or out of order fragments
+      long long      udp_defrag_timeouts;                       //!< udp messages discarded by the reassembly timeout
     };
 
     struct SMethodMon                                           //<! eCAL Server Method struct
@@ -181,6 +194,11 @@ namespace eCAL
         pid      = 0;
         tcp_port_v0 = 0;
         tcp_port_v1 = 0;
+        exec_mode   = 0;
+        queued      = 0;
+        queued_max  = 0;
+        in_flight   = 0;
+        rejected    = 0;
       };
 
       int                      rclock;                          //<! registration clock    
@@ -195,6 +213,12 @@ namespace eCAL
       int                      tcp_port_v0;                 //<! the tcp port protocol version 0 used for that service
       int                      tcp_port_v1;                 //<! the tcp port protocol version 1 used for that service
 
+      int                      exec_mode;                       //<! method call execution mode (0 = inline, 1 = thread per method, 2 = worker pool)
+      int                      queued;                          //<! currently queued method calls
+      int                      queued_max;                      //<! maximum number of queued method calls since the last registration
+      int                      in_flight;                       //<! currently executed method calls
+      long long                rejected;                        //<! method calls rejected because of a full queue
+
       std::vector<SMethodMon>  methods;                         //<! list of methods
     };
 
@@ -95,6 +95,8 @@ namespace eCAL
     ECAL_API std::string       GetLoadedEcalIniPath                 () { return g_default_ini_file; }
     ECAL_API int               GetRegistrationTimeoutMs             () { return eCALPAR(CMN, REGISTRATION_TO); }
     ECAL_API int               GetRegistrationRefreshMs             () { return eCALPAR(CMN, REGISTRATION_REFRESH); }
+    ECAL_API bool              IsRegistrationDeltaEnabled           () { return eCALPAR(CMN, REGISTRATION_DELTA); }
+    ECAL_API int               GetRegistrationFullStateRefreshMs    () { return eCALPAR(CMN, REGISTRATION_FULL_STATE_REFRESH); }
 
     /////////////////////////////////////
     // network
@@ -160,6 +162,9 @@ namespace eCAL
     ECAL_API eCAL_Logging_Filter GetConsoleLogFilter                  () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_CON)); }
     ECAL_API eCAL_Logging_Filter GetFileLogFilter                     () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_FILE)); }
     ECAL_API eCAL_Logging_Filter GetUdpLogFilter                      () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_UDP)); }
+    ECAL_API bool                IsLogAsyncEnabled                    () { return (eCALPAR(MON, LOG_ASYNC) != 0); }
+    ECAL_API size_t              GetLogQueueSize                      () { return static_cast<size_t>(eCALPAR(MON, LOG_QUEUE_SIZE)); }
+    ECAL_API int                 GetLogOverflowMode                   () { return eCALPAR(MON, LOG_OVERFLOW); }
 
     /////////////////////////////////////
     // sys
@@ -179,17 +184,36 @@ namespace eCAL
     ECAL_API size_t            GetMemfileMinsizeBytes               () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE)); }
     ECAL_API size_t            GetMemfileOverprovisioningPercentage () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_RESERVE)); }
     ECAL_API int               GetMemfileAckTimeoutMs               () { return eCALPAR(PUB, MEMFILE_ACK_TO); }
+    ECAL_API bool              IsMemfileAckPipeliningEnabled        () { return (eCALPAR(PUB, MEMFILE_ACK_PIPELINING) != 0); }
+    ECAL_API bool              IsMemfileAckCounterEnabled           () { return (eCALPAR(PUB, MEMFILE_ACK_COUNTER) != 0); }
     ECAL_API bool              IsMemfileZerocopyEnabled             () { return (eCALPAR(PUB, MEMFILE_ZERO_COPY) != 0); }
     ECAL_API size_t            GetMemfileBufferCount                () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_BUF_COUNT)); }
+    ECAL_API size_t            GetMemfileRingSlotCount              () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_RING_SLOTS)); }
 
     ECAL_API bool              IsTopicTypeSharingEnabled            () { return (eCALPAR(PUB, SHARE_TTYPE) != 0); }
     ECAL_API bool              IsTopicDescriptionSharingEnabled     () { return (eCALPAR(PUB, SHARE_TDESC) != 0); }
 
+    /////////////////////////////////////
+    // subscriber
+    /////////////////////////////////////
+
+    ECAL_API size_t            GetMemfileSpinTimeUs                 () { return static_cast<size_t>(eCALPAR(SUB, MEMFILE_SPIN_TIME)); }
+    ECAL_API size_t            GetMemfileObserverThreadCount        () { return static_cast<size_t>(eCALPAR(SUB, MEMFILE_OBSERVER_THREADS)); }
+    ECAL_API int               GetCallbackExecutorMode              () { return eCALPAR(SUB, CALLBACK_EXECUTOR); }
+    ECAL_API size_t            GetCallbackExecutorThreadCount       () { return static_cast<size_t>(eCALPAR(SUB, CALLBACK_THREADS)); }
+    ECAL_API size_t            GetCallbackQueueSize                 () { return static_cast<size_t>(eCALPAR(SUB, CALLBACK_QUEUE_SIZE)); }
+    ECAL_API size_t            GetDuplicateWindowSize               () { return static_cast<size_t>(eCALPAR(SUB, DUPLICATE_WINDOW)); }
+
     /////////////////////////////////////
     // service
     /////////////////////////////////////
     ECAL_API bool              IsServiceProtocolV0Enabled           () { return (eCALPAR(SERVICE, PROTOCOL_V0) != 0); }
     ECAL_API bool              IsServiceProtocolV1Enabled           () { return (eCALPAR(SERVICE, PROTOCOL_V1) != 0); }
+    ECAL_API bool              IsServiceShmTransportEnabled         () { return (eCALPAR(SERVICE, SHM_TRANSPORT) != 0); }
+    ECAL_API size_t            GetServiceShmBufferSize              () { return static_cast<size_t>(eCALPAR(SERVICE, SHM_BUFFER_SIZE)); }
+    ECAL_API int               GetServiceServerExecutorMode         () { return eCALPAR(SERVICE, SERVER_EXECUTOR); }
+    ECAL_API size_t            GetServiceServerThreadCount          () { return static_cast<size_t>(eCALPAR(SERVICE, SERVER_THREADS)); }
+    ECAL_API size_t            GetServiceServerQueueSize            () { return static_cast<size_t>(eCALPAR(SERVICE, SERVER_QUEUE_SIZE)); }
 
     /////////////////////////////////////
     // experimemtal
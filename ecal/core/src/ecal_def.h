@@ -52,6 +52,20 @@
 #define MON_LOG_FILTER_FILE                        ""
 #define MON_LOG_FILTER_UDP                         "info,warning,error,fatal"
 
+/* asynchronous logging (0 = off, 1 = on), log messages are buffered per thread and
+   written to console, file and udp by a background thread
+*/
+#define MON_LOG_ASYNC                              0
+
+/* number of buffered log messages per thread (asynchronous logging) */
+#define MON_LOG_QUEUE_SIZE                         1024
+
+/* full log buffer (asynchronous logging)
+   0 = drop the message (the number of dropped messages is logged)
+   1 = block the logging thread until the buffer was written
+*/
+#define MON_LOG_OVERFLOW                           0
+
 
 /**********************************************************************************************/
 /*                                     sys settings                                       */
@@ -80,6 +94,8 @@
 
 #define NET_UDP_RECBUFFER_TIMEOUT                  1000  /* ms */
 #define NET_UDP_RECBUFFER_CLEANUP                  10    /* ms */
+#define NET_UDP_RECBUFFER_POOL_SIZE                8     /* reusable defragmentation buffers per receiver */
+#define NET_UDP_RECEIVE_BATCH                      16    /* datagrams per receive call (recvmmsg) */
 
 /* overall udp multicast bandwidth limitation in bytes/s, -1 == no limitation*/
 #define NET_BANDWIDTH_MAX_UDP                      (-1)
@@ -128,6 +144,17 @@
 /* timeout for memory read acknowledge signal from data reader in ms */
 #define PUB_MEMFILE_ACK_TO                          0  /* ms */
 
+/* wait for the memory read acknowledge signals right before the memory file is written again (pipelining, 0 = off, 1 = on)
+   instead of directly after writing, in combination with memfile_buffer_count > 1 the publisher can write
+   the next memory files while the data readers still process the previous ones
+*/
+#define PUB_MEMFILE_ACK_PIPELINING                  0
+
+/* acknowledge via one shared counter instead of one event per data reader (0 = off, 1 = on, linux only)
+   data readers of eCAL 5.12 and older will not acknowledge anymore
+*/
+#define PUB_MEMFILE_ACK_COUNTER                     0
+
 /* defines number of memory files handle by the publisher for a 1:n connection
    a higher number will increase data throughput, but will also increase the size of used memory, number of semaphores
    and number of memory file observer threads on subscription side, default = 1, double buffering = 2
@@ -142,6 +169,53 @@
 */
 #define PUB_MEMFILE_ZERO_COPY                      0
 
+/* number of sample slots in a lock-free memory file ring (0 = off, classic mutex protected single sample memory file)
+   the publisher never waits for a subscriber, slow subscribers may lose samples that are overwritten in the meantime
+   values > 0 will break local IPC compatibility to eCAL 5.12 and older
+*/
+#define PUB_MEMFILE_RING_SLOTS                     0
+
+/**********************************************************************************************/
+/*                                     subscriber settings                                    */
+/**********************************************************************************************/
+/* maximum busy spin time before a memory file ring observer goes to sleep in us (0 = no spinning)
+   the spin time adapts between 0 and this value depending on the publisher frequency
+   only applied for lock-free memory file rings on linux (futex notification)
+*/
+#define SUB_MEMFILE_SPIN_TIME                      0
+
+/* number of threads observing all memory files of a process (0 = one observer thread per memory file)
+   the threads multiplex the memory files and execute the subscriber callbacks, a slow callback
+   will delay other topics handled by the same thread
+*/
+#define SUB_MEMFILE_OBSERVER_THREADS               0
+
+/* memory file observer threads poll memory files without futex notification (older publishers, windows) in this interval in ms */
+#define SUB_MEMFILE_OBSERVER_POLL_MS               1
+
+/* execution of subscriber receive callbacks
+   0 = inline, on the transport layer thread (udp receive, memory file observer, tcp executor)
+   1 = shared thread pool of all subscribers of a process
+   2 = dedicated thread per subscriber
+*/
+#define SUB_CALLBACK_EXECUTOR                      0
+
+/* number of threads of the shared callback thread pool */
+#define SUB_CALLBACK_THREADS                       2
+
+/* maximum number of queued callbacks per subscriber (executor mode 1 and 2),
+   a full queue is handled like the receive queue (subscriber qos overflow policy)
+*/
+#define SUB_CALLBACK_QUEUE_SIZE                    64
+
+/* number of recent sample hashes to detect samples received on more than one transport layer */
+#define SUB_DUPLICATE_WINDOW                       64
+
+/* number of memory file receive buffers that can be handed over to callback executors
+   (buffered memory file mode only, more pending callbacks copy the payload)
+*/
+#define SUB_MEMFILE_HANDOFF_BUFFERS                8
+
 /**********************************************************************************************/
 /*                                     service settings                                       */
 /**********************************************************************************************/
@@ -151,6 +225,27 @@
 /* support service protocol v1, eCAL 5.12 and newer (0 = off, 1 = on) */
 #define SERVICE_PROTOCOL_V1                        1
 
+/* call services on the same host via shared memory instead of tcp (0 = off, 1 = on) */
+#define SERVICE_SHM_TRANSPORT                      1
+
+/* shared memory service channel buffer size in bytes (larger requests / responses are transferred in chunks) */
+#define SERVICE_SHM_BUFFER_SIZE                    65536
+
+/* execution of service method callbacks (default, can be changed per server)
+   0 = inline, on the transport thread (tcp io context, shared memory channel thread)
+   1 = dedicated thread per method
+   2 = bounded worker pool shared by all client sessions of a server
+*/
+#define SERVICE_SERVER_EXECUTOR                    0
+
+/* number of threads of the server worker pool */
+#define SERVICE_SERVER_THREADS                     4
+
+/* maximum number of queued calls per server (worker pool) or per method (thread per method),
+   further calls are rejected with a failed call state
+*/
+#define SERVICE_SERVER_QUEUE_SIZE                  64
+
 /**********************************************************************************************/
 /*                                     time settings                                          */
 /**********************************************************************************************/
@@ -171,6 +266,12 @@
 /* time for resend registration info from publisher/subscriber in ms */
 #define CMN_REGISTRATION_REFRESH                       1000
 
+/* delta registration, send entity registrations only on change plus a heartbeat every registration refresh */
+#define CMN_REGISTRATION_DELTA                         false
+
+/* delta registration, time to resend the full registration state (with current statistics) in ms (0 = only on request) */
+#define CMN_REGISTRATION_FULL_STATE_REFRESH            10000
+
 /* delta time to check timeout for data readers in ms */
 #define CMN_DATAREADER_TIMEOUT_RESOLUTION_MS           100
 
@@ -29,6 +29,8 @@
 #define  CMN_SECTION_S                             "common"
 #define  CMN_REGISTRATION_TO_S                     "registration_timeout"
 #define  CMN_REGISTRATION_REFRESH_S                "registration_refresh"
+#define  CMN_REGISTRATION_DELTA_S                  "registration_delta"
+#define  CMN_REGISTRATION_FULL_STATE_REFRESH_S     "registration_full_state_refresh"
 
 /////////////////////////////////////
 // network
@@ -88,6 +90,9 @@
 #define  MON_LOG_FILTER_CON_S                      "filter_log_con"
 #define  MON_LOG_FILTER_FILE_S                     "filter_log_file"
 #define  MON_LOG_FILTER_UDP_S                      "filter_log_udp"
+#define  MON_LOG_ASYNC_S                           "log_async"
+#define  MON_LOG_QUEUE_SIZE_S                      "log_queue_size"
+#define  MON_LOG_OVERFLOW_S                        "log_overflow"
 
 /////////////////////////////////////
 // sys
@@ -108,12 +113,27 @@
 #define  PUB_MEMFILE_MINSIZE_S                     "memfile_minsize"
 #define  PUB_MEMFILE_RESERVE_S                     "memfile_reserve"
 #define  PUB_MEMFILE_ACK_TO_S                      "memfile_ack_timeout"
+#define  PUB_MEMFILE_ACK_PIPELINING_S              "memfile_ack_pipelining"
+#define  PUB_MEMFILE_ACK_COUNTER_S                 "memfile_ack_counter"
 #define  PUB_MEMFILE_ZERO_COPY_S                   "memfile_zero_copy"
 #define  PUB_MEMFILE_BUF_COUNT_S                   "memfile_buffer_count"
+#define  PUB_MEMFILE_RING_SLOTS_S                  "memfile_ring_slots"
 
 #define  PUB_SHARE_TTYPE_S                         "share_ttype"
 #define  PUB_SHARE_TDESC_S                         "share_tdesc"
 
+/////////////////////////////////////
+// subscriber
+/////////////////////////////////////
+#define  SUB_SECTION_S                             "subscriber"
+
+#define  SUB_MEMFILE_SPIN_TIME_S                   "memfile_spin_time"
+#define  SUB_MEMFILE_OBSERVER_THREADS_S            "memfile_observer_threads"
+#define  SUB_CALLBACK_EXECUTOR_S                   "callback_executor"
+#define  SUB_CALLBACK_THREADS_S                    "callback_threads"
+#define  SUB_CALLBACK_QUEUE_SIZE_S                 "callback_queue_size"
+#define  SUB_DUPLICATE_WINDOW_S                    "duplicate_window"
+
 /////////////////////////////////////
 // service
 /////////////////////////////////////
@@ -121,6 +141,11 @@
 
 #define  SERVICE_PROTOCOL_V0_S                     "protocol_v0"
 #define  SERVICE_PROTOCOL_V1_S                     "protocol_v1"
+#define  SERVICE_SHM_TRANSPORT_S                   "shm_transport"
+#define  SERVICE_SHM_BUFFER_SIZE_S                 "shm_buffer_size"
+#define  SERVICE_SERVER_EXECUTOR_S                 "server_executor"
+#define  SERVICE_SERVER_THREADS_S                  "server_threads"
+#define  SERVICE_SERVER_QUEUE_SIZE_S               "server_queue_size"
 
 /////////////////////////////////////
 // experimental
@@ -25,9 +25,11 @@
 #include "ecal_memfile.h"
 #include "ecal_memfile_info.h"
 #include "ecal_memfile_db.h"
+#include "ecal_memfile_futex.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -55,6 +57,16 @@ namespace eCAL
   }
 
   bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_)
+  {
+    return(Create(name_, create_, false, len_, auto_sanitizing_));
+  }
+
+  bool CMemoryFile::OpenWritable(const char* name_)
+  {
+    return(Create(name_, false, true, 0, false));
+  }
+
+  bool CMemoryFile::Create(const char* name_, const bool create_, const bool writable_, const size_t len_, const bool auto_sanitizing_)
   {
     assert((create_ && len_ > 0) || (!create_ && len_ == 0));
     assert((auto_sanitizing_ && create_) || !auto_sanitizing_);
@@ -85,7 +97,7 @@ namespace eCAL
       m_memfile_info = SMemFileInfo();
 
       // create memory file
-      if (!memfile::db::AddFile(name_, create_, create_ ? len_ + m_header.int_hdr_size : SIZEOF_PARTIAL_STRUCT(SInternalHeader, int_hdr_size), m_memfile_info))
+      if (!memfile::db::AddFile(name_, create_, writable_, create_ ? len_ + m_header.int_hdr_size : SIZEOF_PARTIAL_STRUCT(SInternalHeader, int_hdr_size), m_memfile_info))
       {
 #ifndef NDEBUG
         printf("Could not create memory file: %s.\n", name_);
@@ -354,6 +366,39 @@ namespace eCAL
     }
   }
 
+  std::uint32_t CMemoryFile::NotifySequence() const
+  {
+    const std::atomic<std::uint32_t>* notify_seq = NotifyAddress();
+    if (notify_seq == nullptr) return(0);
+    return(notify_seq->load(std::memory_order_seq_cst));
+  }
+
+  void CMemoryFile::Notify()
+  {
+    if (!m_memfile_info.writable) return;
+
+    auto* notify_seq = const_cast<std::atomic<std::uint32_t>*>(NotifyAddress());
+    if (notify_seq == nullptr) return;
+
+    notify_seq->fetch_add(1, std::memory_order_seq_cst);
+#ifdef __linux__
+    memfile::futex::WakeAll(notify_seq);
+#endif
+  }
+
+  const std::atomic<std::uint32_t>* CMemoryFile::NotifyAddress() const
+  {
+    if (!memfile::futex::Supported())          return(nullptr);
+    if (!m_created)                            return(nullptr);
+    if (m_memfile_info.mem_address == nullptr) return(nullptr);
+
+    // the internal header size is set once by the writer, headers of older writers end before the counter
+    const auto* header = static_cast<const SInternalHeader*>(m_memfile_info.mem_address);
+    if (header->int_hdr_size < SIZEOF_PARTIAL_STRUCT(SInternalHeader, notify_seq)) return(nullptr);
+
+    return(reinterpret_cast<const std::atomic<std::uint32_t>*>(static_cast<const char*>(m_memfile_info.mem_address) + offsetof(SInternalHeader, notify_seq)));
+  }
+
   bool CMemoryFile::GetAccess(int timeout_)
   {
     if (!m_created)                            return(false);
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -62,6 +63,18 @@ namespace eCAL
     **/
     bool Create(const char* name_, const bool create_, const size_t len_ = 0, const bool auto_sanitizing_ = false);
 
+    /**
+     * @brief Open an existing memory file with write access.
+     *
+     * Other than Create(name_, true, len_), this never adds the file to the system,
+     * so a file that has just been removed by its owner is not created again.
+     *
+     * @param name_    Unique file name.
+     *
+     * @return  true if it succeeds, false if it fails (e.g. the file does not exist).
+    **/
+    bool OpenWritable(const char* name_);
+
     /**
      * @brief Delete the associated memory file from system. 
      *
@@ -179,6 +192,25 @@ namespace eCAL
     bool HasReadAccess()     const {return(m_access_state == access_state::read_access);};
     bool HasWriteAccess()    const {return(m_access_state == access_state::write_access);};
 
+    /**
+     * @brief Current value of the notification counter (0 if the memory file has none).
+     *        Has to be taken before checking for new content and waited for afterwards.
+    **/
+    std::uint32_t NotifySequence() const;
+
+    /**
+     * @brief Wake up all readers waiting on the notification counter (writer side only, after writing).
+    **/
+    void Notify();
+
+    /**
+     * @brief Address of the notification counter (futex word), to wait for multiple memory files at once.
+     *
+     * @return  nullptr if the memory file has been created without a notification counter (older eCAL versions)
+     *          or futex notification is not supported on this platform.
+    **/
+    const std::atomic<std::uint32_t>* NotifyAddress() const;
+
     
     // @deprecate_eCAL6
     // Use of platform specific aligment to remain compatible with previous struct layout
@@ -199,13 +231,17 @@ namespace eCAL
       std::uint64_t               cur_data_size = 0;
       std::uint64_t               max_data_size = 0;
 #endif
+      // Futex word incremented by the writer after every write (see Notify), not available in files of older writers
+      std::uint32_t               notify_seq    = 0;
+      std::array<std::uint8_t, 4> _reserved_1   = {};
       // New fields should only declare well defined data types and be aligned to 8 bytes
       // std::uint8_t                 _new_field  = 0;
-      // std::array<std::uint8_t, 7>  _reserved_1 = {};
+      // std::array<std::uint8_t, 7>  _reserved_2 = {};
     };
 #pragma pack(pop)
 
   protected:
+    bool Create(const char* name_, const bool create_, const bool writable_, const size_t len_, const bool auto_sanitizing_);
     bool GetAccess(int timeout_);
 
     enum class access_state
@@ -0,0 +1,155 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  shared acknowledge counter for memory files
+**/
+
+#include "ecal_def.h"
+#include "ecal_memfile_ack.h"
+#include "ecal_memfile_futex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+  // size of the companion memory file content, keep the counter on its own cache line
+  const size_t ack_file_size = 64;
+}
+
+namespace eCAL
+{
+  CMemFileAck::CMemFileAck() :
+    m_word(nullptr),
+    m_owner(false)
+  {
+  }
+
+  CMemFileAck::~CMemFileAck()
+  {
+    Destroy();
+  }
+
+  bool CMemFileAck::Supported()
+  {
+    return(memfile::futex::Supported());
+  }
+
+  bool CMemFileAck::Create(const std::string& memfile_name_, bool owner_)
+  {
+    if (m_word != nullptr) return(false);
+
+    const std::string ack_name = memfile_name_ + "_ack";
+
+    // subscribers need write access to the counter, but must never create the file on their own
+    // (the publisher may have removed it already)
+    const bool opened = owner_ ? m_memfile.Create(ack_name.c_str(), true, ack_file_size) : m_memfile.OpenWritable(ack_name.c_str());
+    if (!opened) return(false);
+
+    if (m_memfile.GetWriteAccess(PUB_MEMFILE_CREATE_TO))
+    {
+      void* wbuf(nullptr);
+      if (m_memfile.GetWriteAddress(wbuf, ack_file_size) != 0u)
+      {
+        m_word = static_cast<std::atomic<std::uint32_t>*>(wbuf);
+        if (owner_) m_word->store(0, std::memory_order_relaxed);
+      }
+
+      // the counter is accessed without the memory file mutex from now on
+      m_memfile.ReleaseWriteAccess();
+    }
+
+    if (m_word == nullptr)
+    {
+      m_memfile.Destroy(owner_);
+      return(false);
+    }
+
+    m_owner = owner_;
+    return(true);
+  }
+
+  bool CMemFileAck::Destroy()
+  {
+    if (m_word == nullptr) return(false);
+
+    m_word = nullptr;
+    return(m_memfile.Destroy(m_owner));
+  }
+
+  void CMemFileAck::Reset(std::uint64_t clock_)
+  {
+    if (m_word == nullptr) return;
+
+    m_word->store(Tag(clock_) << 16, std::memory_order_seq_cst);
+  }
+
+  std::size_t CMemFileAck::Wait(std::uint64_t clock_, std::size_t expected_, int timeout_)
+  {
+    if (m_word == nullptr) return(0);
+
+    const std::uint32_t tag      = Tag(clock_);
+    const auto          deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_);
+
+    for (;;)
+    {
+      const std::uint32_t word = m_word->load(std::memory_order_seq_cst);
+
+      // someone else started a new round
+      if ((word >> 16) != tag) return(0);
+
+      const std::size_t received = word & 0xFFFF;
+      if (received >= expected_) return(received);
+
+      const auto time_to_wait    = deadline - std::chrono::steady_clock::now();
+      const long time_to_wait_ms = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
+      if (time_to_wait <= std::chrono::steady_clock::duration::zero()) return(received);
+
+#ifdef __linux__
+      // returns immediately if the word was already changed
+      memfile::futex::Wait(m_word, word, static_cast<int>(std::max(1L, time_to_wait_ms)));
+#else
+      (void)time_to_wait_ms;
+      std::this_thread::yield();
+#endif
+    }
+  }
+
+  void CMemFileAck::Acknowledge(std::uint64_t clock_)
+  {
+    if (m_word == nullptr) return;
+
+    const std::uint32_t tag  = Tag(clock_);
+    std::uint32_t       word = m_word->load(std::memory_order_seq_cst);
+
+    // increment only if the publisher still waits for this sample
+    while (((word >> 16) == tag) && ((word & 0xFFFF) != 0xFFFF))
+    {
+      if (m_word->compare_exchange_weak(word, word + 1, std::memory_order_seq_cst))
+      {
+#ifdef __linux__
+        memfile::futex::WakeAll(m_word);
+#endif
+        return;
+      }
+    }
+  }
+}
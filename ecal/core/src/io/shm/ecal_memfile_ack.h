@@ -0,0 +1,106 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  shared acknowledge counter for memory files
+**/
+
+#pragma once
+
+#include "ecal_memfile.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace eCAL
+{
+  /**
+   * @brief Acknowledge counter shared by a memory file publisher and all of its subscribers.
+   *
+   * The counter lives in a small companion memory file (memory file name + "_ack"),
+   * because subscribers map the memory file itself read only.
+   * One 32 bit word holds a 16 bit sample tag (derived from the sample clock) and
+   * a 16 bit counter. Subscribers increment the counter only if the tag matches,
+   * so late acknowledges of older samples are ignored. The publisher waits on the word
+   * (futex) until all subscribers have acknowledged instead of waiting on one event per subscriber.
+  **/
+  class CMemFileAck
+  {
+  public:
+    CMemFileAck();
+    ~CMemFileAck();
+
+    CMemFileAck(const CMemFileAck&) = delete;
+    CMemFileAck& operator=(const CMemFileAck&) = delete;
+    CMemFileAck(CMemFileAck&& rhs) = delete;
+    CMemFileAck& operator=(CMemFileAck&& rhs) = delete;
+
+    /**
+     * @brief Shared acknowledge counter can be used on this platform.
+    **/
+    static bool Supported();
+
+    /**
+     * @brief Create (publisher) or open (subscriber) the acknowledge counter of a memory file.
+     *
+     * @param memfile_name_  Name of the observed memory file.
+     * @param owner_         Publisher side, create the companion file and remove it on destruction.
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool Create(const std::string& memfile_name_, bool owner_);
+    bool Destroy();
+
+    bool IsCreated() const { return(m_word != nullptr); };
+
+    /**
+     * @brief Start a new acknowledge round (publisher side, before signaling the subscribers).
+     *
+     * @param clock_  Clock of the sample that has to be acknowledged.
+    **/
+    void Reset(std::uint64_t clock_);
+
+    /**
+     * @brief Wait for the acknowledges of a sample (publisher side).
+     *
+     * @param clock_     Clock of the sample (as passed to Reset).
+     * @param expected_  Number of expected acknowledges.
+     * @param timeout_   Timeout in ms.
+     *
+     * @return  Number of received acknowledges.
+    **/
+    std::size_t Wait(std::uint64_t clock_, std::size_t expected_, int timeout_);
+
+    /**
+     * @brief Acknowledge a processed sample (subscriber side).
+     *
+     * @param clock_  Clock of the processed sample.
+    **/
+    void Acknowledge(std::uint64_t clock_);
+
+  protected:
+    static std::uint32_t Tag(std::uint64_t clock_) { return(static_cast<std::uint32_t>(clock_ & 0xFFFF)); };
+
+    CMemoryFile                  m_memfile;
+    std::atomic<std::uint32_t>*  m_word;
+    bool                         m_owner;
+  };
+}
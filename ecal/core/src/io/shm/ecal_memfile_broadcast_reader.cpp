@@ -100,7 +100,8 @@ namespace eCAL
 
             memfile_broadcast_message_list.push_back({memfile_broadcast_payload.payload_memfile_buffer.data(),
                                                               memfile_broadcast_payload.payload_memfile_buffer.size(),
-                                                              memfile_broadcast_payload.timestamp});
+                                                              memfile_broadcast_payload.timestamp,
+                                                              event_id});
           }
           else
           {
@@ -38,6 +38,7 @@ namespace eCAL
     const void *data;
     std::size_t size;
     std::int64_t timestamp;
+    std::uint64_t event_id;
   };
 
   using MemfileBroadcastMessageListT = std::vector<SMemfileBroadcastMessage>;
@@ -61,7 +61,7 @@ namespace eCAL
     m_memfile_map.clear();
   }
 
-  bool CMemFileMap::AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_)
+  bool CMemFileMap::AddFile(const std::string& name_, const bool create_, const bool writable_, const size_t len_, SMemFileInfo& mem_file_info_)
   {
     // we need a length != 0
     assert(len_ > 0);
@@ -74,7 +74,7 @@ namespace eCAL
     if (iter == m_memfile_map.end())
     {
       // create memory file
-      if (!memfile::os::AllocFile(name_, create_, mem_file_info_))
+      if (!memfile::os::AllocFile(name_, create_, writable_, mem_file_info_))
       {
 #ifndef NDEBUG
         printf("Could create memory file: %s.\n\n", name_.c_str());
@@ -91,6 +91,9 @@ namespace eCAL
     }
     else
     {
+      // the existing mapping of this process is read only
+      if (writable_ && !iter->second.writable) return(false);
+
       // tag memory file as existing
       iter->second.exists = true;
 
@@ -165,10 +168,10 @@ namespace eCAL
   {
     namespace db
     {
-      bool AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_)
+      bool AddFile(const std::string& name_, const bool create_, const bool writable_, const size_t len_, SMemFileInfo& mem_file_info_)
       {
         if (g_memfile_map() == nullptr) return false;
-        return g_memfile_map()->AddFile(name_, create_, len_, mem_file_info_);
+        return g_memfile_map()->AddFile(name_, create_, writable_, len_, mem_file_info_);
       }
 
       bool RemoveFile(const std::string& name_, const bool remove_)
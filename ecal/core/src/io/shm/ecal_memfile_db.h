@@ -40,7 +40,7 @@ namespace eCAL
 
     void Destroy();
 
-    bool AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_);
+    bool AddFile(const std::string& name_, const bool create_, const bool writable_, const size_t len_, SMemFileInfo& mem_file_info_);
     bool RemoveFile(const std::string& name_, const bool remove_);
     bool CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
 
@@ -54,7 +54,7 @@ namespace eCAL
   {
     namespace db
     {
-      bool AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_);
+      bool AddFile(const std::string& name_, const bool create_, const bool writable_, const size_t len_, SMemFileInfo& mem_file_info_);
       bool RemoveFile(const std::string& name_, const bool remove_);
 
       bool CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
@@ -0,0 +1,131 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  futex helper for words placed into memory files
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __linux__
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace eCAL
+{
+  namespace memfile
+  {
+    namespace futex
+    {
+      inline bool Supported()
+      {
+#ifdef __linux__
+        return(true);
+#else
+        return(false);
+#endif
+      }
+
+      // waiting for multiple words (futex_waitv) is available since linux 5.16
+      inline bool WaitAnySupported()
+      {
+#if defined(__linux__) && defined(SYS_futex_waitv)
+        // an empty wait list is rejected with EINVAL by kernels knowing the system call
+        static const bool supported = (syscall(SYS_futex_waitv, nullptr, 0, 0, nullptr, 0) == -1) && (errno != ENOSYS);
+        return(supported);
+#else
+        return(false);
+#endif
+      }
+
+#ifdef __linux__
+      // memory files are shared between processes, so we must not use FUTEX_PRIVATE_FLAG here
+      inline long Wait(const std::atomic<std::uint32_t>* addr_, std::uint32_t expected_, int timeout_)
+      {
+        struct timespec ts;
+        ts.tv_sec  = timeout_ / 1000;
+        ts.tv_nsec = (timeout_ % 1000) * 1000000L;
+        return syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(addr_), FUTEX_WAIT, expected_, &ts, nullptr, 0);
+      }
+
+      // waking up works on read only mappings as well
+      inline long WakeAll(const std::atomic<std::uint32_t>* addr_)
+      {
+        return syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(addr_), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+      }
+
+      // maximum number of words for WaitAny (FUTEX_WAITV_MAX)
+      const std::size_t wait_any_max = 128;
+
+      // wait until one of the words differs from its expected value, timeout in ms
+      inline long WaitAny(const std::atomic<std::uint32_t>* const* addrs_, const std::uint32_t* expected_, std::size_t count_, int timeout_)
+      {
+#ifdef SYS_futex_waitv
+        // layout of struct futex_waitv, not available in older kernel headers
+        struct SWaitV
+        {
+          std::uint64_t val;
+          std::uint64_t uaddr;
+          std::uint32_t flags;
+          std::uint32_t reserved;
+        };
+        // FUTEX2_SIZE_U32, shared (no FUTEX2_PRIVATE)
+        const std::uint32_t futex2_size_u32 = 0x02;
+
+        if (count_ > wait_any_max) return(-1);
+
+        SWaitV waiters[wait_any_max];
+        for (std::size_t i = 0; i < count_; ++i)
+        {
+          waiters[i].val      = expected_[i];
+          waiters[i].uaddr    = reinterpret_cast<std::uintptr_t>(addrs_[i]);
+          waiters[i].flags    = futex2_size_u32;
+          waiters[i].reserved = 0;
+        }
+
+        // futex_waitv expects an absolute timeout
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        ts.tv_sec  += timeout_ / 1000;
+        ts.tv_nsec += (timeout_ % 1000) * 1000000L;
+        if (ts.tv_nsec >= 1000000000L)
+        {
+          ts.tv_sec  += 1;
+          ts.tv_nsec -= 1000000000L;
+        }
+        return syscall(SYS_futex_waitv, waiters, static_cast<unsigned int>(count_), 0, &ts, CLOCK_MONOTONIC);
+#else
+        (void)addrs_; (void)expected_; (void)count_; (void)timeout_;
+        errno = ENOSYS;
+        return(-1);
+#endif
+      }
+#endif
+    }
+  }
+}
@@ -38,10 +38,12 @@ namespace eCAL
     // ----- > 5.8 -----
     struct optflags
     {
-      unsigned char zero_copy : 1;    // allow reader to access memory without copying
-      unsigned char unused    : 7;
+      unsigned char zero_copy   : 1;  // allow reader to access memory without copying
+      unsigned char ring_buffer : 1;  // memory file content is organized as lock-free slot ring (see CMemFileRing)
+      unsigned char ack_counter : 1;  // acknowledge via shared counter instead of ack event (see CMemFileAck)
+      unsigned char unused      : 5;
     };
-    optflags   options = { 0, 0 };
+    optflags   options = { 0, 0, 0, 0 };
     // ----- > 5.11 ----
     int64_t    ack_timout_ms = 0;
   };
@@ -57,5 +57,6 @@ namespace eCAL
     std::string  name;
     size_t       size        = 0;
     bool         exists      = false;
+    bool         writable    = false;
   };
 }
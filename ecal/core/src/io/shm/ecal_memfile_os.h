@@ -34,7 +34,7 @@ namespace eCAL
   {
     namespace os
     {
-      bool AllocFile(const std::string& name_, const bool create_, SMemFileInfo& mem_file_info_);
+      bool AllocFile(const std::string& name_, const bool create_, const bool writable_, SMemFileInfo& mem_file_info_);
       bool DeAllocFile(SMemFileInfo& mem_file_info_);
       bool RemoveFile(const SMemFileInfo& mem_file_info_);
 
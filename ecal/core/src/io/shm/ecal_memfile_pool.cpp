@@ -22,14 +22,20 @@
  * @brief  memory file pool handler
 **/
 
+#include <ecal/ecal_config.h>
+
 #include "ecal_def.h"
 #include "ecal_event_internal.h"
+#include "ecal_memfile_futex.h"
 #include "ecal_memfile_pool.h"
 
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -37,6 +43,18 @@
 #include <utility>
 #include <vector>
 
+namespace
+{
+  // number of observers one reactor thread can wait for at once (together with its own wake up word)
+  size_t ObserversPerReactorThread()
+  {
+#ifdef __linux__
+    if (eCAL::memfile::futex::WaitAnySupported()) return(eCAL::memfile::futex::wait_any_max - 1);
+#endif
+    return(std::numeric_limits<size_t>::max());
+  }
+}
+
 namespace eCAL
 {
   ////////////////////////////////////////
@@ -46,7 +64,18 @@ namespace eCAL
     m_created(false),
     m_do_stop(false),
     m_is_observing(false),
-    m_time_of_last_life_signal(std::chrono::steady_clock::now())
+    m_time_of_last_life_signal(std::chrono::steady_clock::now()),
+    m_timeout(0),
+    m_polled(false),
+    m_last_sample_clock(0),
+    m_has_unprocessed_data(false),
+    m_memfile_notify_seq(0),
+    m_ring_probed(false),
+    m_ring_read_seq(0),
+    m_ring_lost(0),
+    m_ring_notify_seq(0),
+    m_spin_time_max(std::chrono::microseconds(Config::GetMemfileSpinTimeUs())),
+    m_spin_time(m_spin_time_max)
   {
   }
 
@@ -70,6 +99,12 @@ namespace eCAL
     // create memory file access
     m_memfile.Create(memfile_name_.c_str(), false);
 
+    // check for ring layout, in that case we start reading with the next written sample
+    if (AttachRing())
+    {
+      m_ring_read_seq = m_ring.WriteSequence();
+    }
+
     m_created = true;
 
 #ifndef NDEBUG
@@ -84,6 +119,12 @@ namespace eCAL
   {
     if (!m_created) return false;
 
+    // detach ring
+    m_ring = CMemFileRing();
+
+    // close shared acknowledge counter
+    m_ack.Destroy();
+
     // destroy memory file (access only)
     m_memfile.Destroy(false);
 
@@ -101,7 +142,7 @@ namespace eCAL
     return true;
   }
 
-  bool CMemFileObserver::Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_)
+  bool CMemFileObserver::Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_, bool polled_ /*= false*/)
   {
     if (!m_created)     return false;
     if (m_is_observing) return false;
@@ -109,11 +150,24 @@ namespace eCAL
     // assign callback
     m_data_callback = std::move(callback_);
 
+    // reset observation state
+    m_topic_name               = topic_name_;
+    m_topic_id                 = topic_id_;
+    m_timeout                  = timeout_;
+    m_polled                   = polled_;
+    m_last_sample_clock        = 0;
+    m_has_unprocessed_data     = false;
+    m_do_stop                  = false;
+    m_time_of_last_life_signal = std::chrono::steady_clock::now();
+
     // mark as running
     m_is_observing = true;
 
-    // start observer thread
-    m_thread = std::thread(&CMemFileObserver::Observe, this, topic_name_, topic_id_, timeout_);
+    // start observer thread, in polled mode the owner calls Poll
+    if (!m_polled)
+    {
+      m_thread = std::thread(&CMemFileObserver::Observe, this);
+    }
 
 #ifndef NDEBUG
     // log it
@@ -133,8 +187,19 @@ namespace eCAL
       // signal observer to stop
       m_do_stop = true;
 
-      // set sync event to unlock loop
-      gSetEvent(m_event_snd);
+      if (m_polled)
+      {
+        // no thread to unlock, the owner does not poll anymore
+        m_is_observing = false;
+      }
+      else
+      {
+        // set sync event to unlock loop
+        gSetEvent(m_event_snd);
+
+        // wake up ring notification wait as well
+        m_ring.WakeUp();
+      }
     }
 
     // wait for finalization
@@ -152,150 +217,279 @@ namespace eCAL
     return true;
   }
 
-  void CMemFileObserver::Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_)
+  bool CMemFileObserver::Poll()
+  {
+    if (!m_is_observing) return false;
+
+    if (IsTimedOut())
+    {
+#ifndef NDEBUG
+      // log it
+      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " timeout"));
+#endif
+      // mark as stopped
+      m_is_observing = false;
+      return false;
+    }
+
+    // lock-free ring with futex notification, the publisher does not fire the update event
+    if (m_ring.IsValid() && CMemFileRing::NotificationSupported())
+    {
+      // take the notification counter first, so the owner will not miss a notification
+      // that comes in after the check below (see GetNotification)
+      m_ring_notify_seq = m_ring.NotifySequence();
+      if (m_ring.WriteSequence() <= m_ring_read_seq) return false;
+
+      // We got new data from the publisher! It is alive! So we reset the time since the last live signal
+      m_time_of_last_life_signal = std::chrono::steady_clock::now();
+
+      ReadRing(m_topic_name, m_topic_id, m_receive_buffer);
+      return true;
+    }
+
+    if (!m_has_unprocessed_data)
+    {
+      // take the notification counter first, the publisher sets the update event before it notifies
+      m_memfile_notify_seq = m_memfile.NotifySequence();
+
+      // check for memory file update event from shm writer without waiting
+      m_has_unprocessed_data = gWaitForEvent(m_event_snd, 0);
+
+      if (m_has_unprocessed_data)
+      {
+        // We got a signal from the publisher! It is alive! So we reset the time since the last live signal
+        m_time_of_last_life_signal = std::chrono::steady_clock::now();
+      }
+      else
+      {
+        // the memory file layout could not be checked on creation, a ring publisher does not fire update events,
+        // so we check it here again (not on every poll, AttachRing needs the memory file mutex)
+        const auto now = std::chrono::steady_clock::now();
+        if (!m_ring_probed && (now - m_ring_probe_time > std::chrono::milliseconds(20)))
+        {
+          m_ring_probe_time = now;
+          if (AttachRing())
+          {
+            const uint64_t write_seq = m_ring.WriteSequence();
+            m_ring_read_seq = (write_seq > 0) ? write_seq - 1 : 0;
+          }
+        }
+        return false;
+      }
+    }
+
+    ProcessMemFile();
+    return true;
+  }
+
+  bool CMemFileObserver::GetNotification(const std::atomic<std::uint32_t>*& word_, std::uint32_t& value_) const
   {
-    // internal clock sample update checking
-    uint64_t last_sample_clock(0);
+    if (m_ring.IsValid() && CMemFileRing::NotificationSupported())
+    {
+      word_  = m_ring.NotifyAddress();
+      value_ = m_ring_notify_seq;
+      return true;
+    }
 
-    // buffer to store memory file content
-    std::vector<char> receive_buffer;
+    // classic memory file, the header of older publishers does not contain a notification counter
+    word_ = m_memfile.NotifyAddress();
+    if (word_ == nullptr) return false;
 
-    // Boolean that tells whether the SHM file has new data that we have NOT already accessed
-    bool has_unprocessed_data = false;
+    value_ = m_memfile_notify_seq;
+    return true;
+  }
+
+  bool CMemFileObserver::IsTimedOut() const
+  {
+    return(std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point(m_time_of_last_life_signal) >= std::chrono::milliseconds(m_timeout));
+  }
 
+  void CMemFileObserver::Observe()
+  {
     // runs as long as there is no timeout and no external stop request
-    while(std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point(m_time_of_last_life_signal) < std::chrono::milliseconds(timeout_)
-           && !m_do_stop)
+    while(!IsTimedOut() && !m_do_stop)
     {
-      if (!has_unprocessed_data)
+      // lock-free ring with futex notification, the publisher does not fire the update event
+      if (m_ring.IsValid() && CMemFileRing::NotificationSupported())
+      {
+        if (WaitForRingData(20))
+        {
+          // We got new data from the publisher! It is alive! So we reset the time since the last live signal
+          m_time_of_last_life_signal = std::chrono::steady_clock::now();
+
+          // last chance to stop ..
+          if (m_do_stop) break;
+
+          ReadRing(m_topic_name, m_topic_id, m_receive_buffer);
+        }
+        continue;
+      }
+
+      if (!m_has_unprocessed_data)
       {
         // Only wait for the new-data-event, if we haven't processed the data, yet
         // check for memory file update event from shm writer (20 ms)
-        has_unprocessed_data = gWaitForEvent(m_event_snd, 20);
+        m_has_unprocessed_data = gWaitForEvent(m_event_snd, 20);
 
-        if (has_unprocessed_data)
+        if (m_has_unprocessed_data)
         {
           // We got a signal from the publisher! It is alive! So we reset the time since the last live signal
           m_time_of_last_life_signal = std::chrono::steady_clock::now();
         }
+        else if (!m_ring_probed && AttachRing())
+        {
+          // the memory file layout could not be checked on creation,
+          // a ring publisher does not fire update events, so we check it here again
+          const uint64_t write_seq = m_ring.WriteSequence();
+          m_ring_read_seq = (write_seq > 0) ? write_seq - 1 : 0;
+          continue;
+        }
       }
 
       // If we have unprocessed data, we try to access (and process!) it
-      if(has_unprocessed_data)
+      if(m_has_unprocessed_data)
       {
         // last chance to stop ..
         if(m_do_stop) break;
 
-        // try to open memory file (timeout 5 ms)
-        if(m_memfile.GetReadAccess(5))
-        {
-          // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
-          has_unprocessed_data = false;
+        ProcessMemFile();
+      }
+    }
 
-          // read the file header
-          SMemFileHeader mfile_hdr;
-          ReadFileHeader(mfile_hdr);
+#ifndef NDEBUG
+    // log it
+    if(m_do_stop)
+    {
+      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " stopped"));
+    }
+    else
+    {
+      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " timeout"));
+    }
+#endif
 
-          // check for new content
-          if (mfile_hdr.clock <= last_sample_clock)
-          {
-            // release access and leave
-            m_memfile.ReleaseReadAccess();
-          }
-          else
+    // mark as stopped
+    m_is_observing = false; //-V1020
+  }
+
+  void CMemFileObserver::ProcessMemFile()
+  {
+    // lock-free ring, no need to open the memory file
+    if (m_ring.IsValid())
+    {
+      m_has_unprocessed_data = false;
+      ReadRing(m_topic_name, m_topic_id, m_receive_buffer);
+      return;
+    }
+
+    // try to open memory file (timeout 5 ms)
+    if(m_memfile.GetReadAccess(5))
+    {
+      // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
+      m_has_unprocessed_data = false;
+
+      // read the file header
+      SMemFileHeader mfile_hdr;
+      ReadFileHeader(mfile_hdr);
+
+      // check for new content
+      if (mfile_hdr.clock <= m_last_sample_clock)
+      {
+        // release access and leave
+        m_memfile.ReleaseReadAccess();
+
+        // the memory file was not organized as ring when we created the observer (not initialized yet)
+        // attach now and process the latest sample
+        if ((mfile_hdr.options.ring_buffer != 0) && AttachRing())
+        {
+          const uint64_t write_seq = m_ring.WriteSequence();
+          m_ring_read_seq = (write_seq > 0) ? write_seq - 1 : 0;
+          ReadRing(m_topic_name, m_topic_id, m_receive_buffer);
+        }
+      }
+      else
+      {
+        const bool zero_copy_allowed = mfile_hdr.options.zero_copy != 0;
+        bool post_process_buffer(false);
+        std::shared_ptr<std::vector<char>> handoff_buffer;
+        // -------------------------------------------------------------------------
+        // zero copy mode
+        // -------------------------------------------------------------------------
+        // That means we call the user callback (ApplySample) from within the opened memory file.
+        // So we do not waste time by copying the payload in an intermediate buffer
+        // but the file keeps opened and blocked until the callback returns.
+        // Other subscriber can not access the content this time !
+        // -------------------------------------------------------------------------
+        if (zero_copy_allowed)
+        {
+          if (m_data_callback)
           {
-            const bool zero_copy_allowed = mfile_hdr.options.zero_copy != 0;
-            bool post_process_buffer(false);
-            // -------------------------------------------------------------------------
-            // zero copy mode
-            // -------------------------------------------------------------------------
-            // That means we call the user callback (ApplySample) from within the opened memory file.
-            // So we do not waste time by copying the payload in an intermediate buffer
-            // but the file keeps opened and blocked until the callback returns.
-            // Other subscriber can not access the content this time !
-            // -------------------------------------------------------------------------
-            if (zero_copy_allowed)
+            const char* data_buf = nullptr;
+            if (mfile_hdr.data_size > 0)
             {
-              if (m_data_callback)
+              // acquire memory file payload pointer (no copying here)
+              const void* buf(nullptr);
+              if (m_memfile.GetReadAddress(buf, mfile_hdr.data_size) > 0)
               {
-                const char* data_buf = nullptr;
-                if (mfile_hdr.data_size > 0)
-                {
-                  // acquire memory file payload pointer (no copying here)
-                  const void* buf(nullptr);
-                  if (m_memfile.GetReadAddress(buf, mfile_hdr.data_size) > 0)
-                  {
-                    // calculate user payload address
-                    data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
-                    // call user callback function
-                    m_data_callback(topic_name_, topic_id_, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-                  }
-                }
-                else
-                {
-                  // call user callback function
-                  m_data_callback(topic_name_, topic_id_, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-                }
+                // calculate user payload address
+                data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
+                // call user callback function
+                m_data_callback(m_topic_name, m_topic_id, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, nullptr);
               }
             }
-            // -------------------------------------------------------------------------
-            // buffered mode
-            // -------------------------------------------------------------------------
-            // we copy the data into the receive buffer (standard mode for eCAL < 5.10)
-            // and close the file immediately
             else
             {
-              // need to resize the buffer especially if data_size = 0, otherwise it might contain stale data.
-              receive_buffer.resize((size_t)mfile_hdr.data_size);
+              // call user callback function
+              m_data_callback(m_topic_name, m_topic_id, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, nullptr);
+            }
+          }
+        }
+        // -------------------------------------------------------------------------
+        // buffered mode
+        // -------------------------------------------------------------------------
+        // we copy the data into the receive buffer (standard mode for eCAL < 5.10)
+        // and close the file immediately
+        else
+        {
+          // the buffer is handed over to the subscriber, so a callback executor can process it later without copying
+          handoff_buffer = GetHandoffBuffer();
+          std::vector<char>& receive_buffer = handoff_buffer ? *handoff_buffer : m_receive_buffer;
 
-              // read payload
-              // if data length == 0, there is no need to further read data
-              // we just flag to process the empty buffer
-              if (mfile_hdr.data_size != 0)
-              {
-                m_memfile.Read(receive_buffer.data(), (size_t)mfile_hdr.data_size, mfile_hdr.hdr_size);
-              }
+          // need to resize the buffer especially if data_size = 0, otherwise it might contain stale data.
+          receive_buffer.resize((size_t)mfile_hdr.data_size);
 
-              post_process_buffer = true;
-            }
+          // read payload
+          // if data length == 0, there is no need to further read data
+          // we just flag to process the empty buffer
+          if (mfile_hdr.data_size != 0)
+          {
+            m_memfile.Read(receive_buffer.data(), (size_t)mfile_hdr.data_size, mfile_hdr.hdr_size);
+          }
 
-            // store clock
-            last_sample_clock = mfile_hdr.clock;
+          post_process_buffer = true;
+        }
 
-            // release access
-            m_memfile.ReleaseReadAccess();
+        // store clock
+        m_last_sample_clock = mfile_hdr.clock;
 
-            // process receive buffer if buffered mode read some data in
-            if (post_process_buffer)
-            {
-              // add sample to data reader (and call user callback function)
-              if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-            }
+        // release access
+        m_memfile.ReleaseReadAccess();
 
-            // send acknowledge event
-            if (mfile_hdr.ack_timout_ms != 0)
-            {
-              gSetEvent(m_event_ack);
-            }
-          }
+        // process receive buffer if buffered mode read some data in
+        if (post_process_buffer)
+        {
+          // add sample to data reader (and call user callback function)
+          const std::vector<char>& receive_buffer = handoff_buffer ? *handoff_buffer : m_receive_buffer;
+          if (m_data_callback) m_data_callback(m_topic_name, m_topic_id, receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, handoff_buffer);
         }
-      }
-    }
 
-#ifndef NDEBUG
-    // log it
-    if(m_do_stop)
-    {
-      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " stopped"));
-    }
-    else
-    {
-      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " timeout"));
+        // send acknowledge event
+        if ((mfile_hdr.ack_timout_ms != 0) && !AcknowledgeViaCounter(mfile_hdr))
+        {
+          gSetEvent(m_event_ack);
+        }
+      }
     }
-#endif
-
-    // mark as stopped
-    m_is_observing = false; //-V1020
   }
 
   bool CMemFileObserver::ReadFileHeader(SMemFileHeader& mfile_hdr_)
@@ -321,6 +515,366 @@ namespace eCAL
     return false;
   }
 
+  bool CMemFileObserver::AttachRing()
+  {
+    if (m_ring.IsValid()) return true;
+
+    // the ring memory is accessed without mutex later on,
+    // we only need read access once to get the (stable) memory address
+    if (!m_memfile.GetReadAccess(PUB_MEMFILE_OPEN_TO)) return false;
+
+    bool attached(false);
+    SMemFileHeader mfile_hdr;
+    m_ring_probed = ReadFileHeader(mfile_hdr);
+    if (m_ring_probed && (mfile_hdr.options.ring_buffer != 0))
+    {
+      const size_t buffer_size = m_memfile.CurDataSize();
+      const void* buf(nullptr);
+      if ((buffer_size > mfile_hdr.hdr_size) && (m_memfile.GetReadAddress(buf, buffer_size) > 0))
+      {
+        // CMemFileRing has no write access on reader side, SetBaseAddress validates only
+        attached = m_ring.SetBaseAddress(const_cast<char*>(static_cast<const char*>(buf)) + mfile_hdr.hdr_size, buffer_size - mfile_hdr.hdr_size, false);
+      }
+    }
+
+    m_memfile.ReleaseReadAccess();
+
+    return attached;
+  }
+
+  bool CMemFileObserver::WaitForRingData(const int timeout_)
+  {
+    // take the notification counter first, so a notification
+    // that comes in after the check below will not be missed
+    const uint32_t notify_seq = m_ring.NotifySequence();
+    if (m_ring.WriteSequence() > m_ring_read_seq) return true;
+
+    // busy spin some time before we go to sleep, this saves the system call
+    // and the wakeup latency for high frequency publishers
+    const auto spin_start = std::chrono::steady_clock::now();
+    if (m_spin_time.count() > 0)
+    {
+      while (!m_do_stop && (std::chrono::steady_clock::now() - spin_start < m_spin_time))
+      {
+        if (m_ring.WriteSequence() > m_ring_read_seq)
+        {
+          // data came in while spinning, spin a little bit longer next time
+          m_spin_time = std::min(m_spin_time_max, m_spin_time * 2);
+          return true;
+        }
+      }
+    }
+
+    // go to sleep
+    const bool notified = m_ring.WaitForNotification(notify_seq, timeout_) || (m_ring.WriteSequence() > m_ring_read_seq);
+
+    // adapt spin time
+    //   if the data came in shortly after spinning we spin longer next time,
+    //   otherwise spinning is a waste of cpu time and we reduce it
+    if (m_spin_time_max.count() > 0)
+    {
+      if (notified && (std::chrono::steady_clock::now() - spin_start < m_spin_time_max))
+      {
+        m_spin_time = std::min(m_spin_time_max, std::max(std::chrono::microseconds(1), m_spin_time * 2));
+      }
+      else
+      {
+        m_spin_time = m_spin_time / 2;
+      }
+    }
+
+    return notified;
+  }
+
+  std::shared_ptr<std::vector<char>> CMemFileObserver::GetHandoffBuffer()
+  {
+    // a buffer only referenced by us is not used by a subscriber anymore
+    for (const auto& buffer : m_handoff_buffers)
+    {
+      if (buffer.use_count() == 1)
+      {
+        // synchronize with the release of the last subscriber reference
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return(buffer);
+      }
+    }
+
+    // all buffers are pending, the payload will be copied by the subscriber
+    if (m_handoff_buffers.size() >= SUB_MEMFILE_HANDOFF_BUFFERS) return(nullptr);
+
+    m_handoff_buffers.push_back(std::make_shared<std::vector<char>>());
+    return(m_handoff_buffers.back());
+  }
+
+  void CMemFileObserver::ReadRing(const std::string& topic_name_, const std::string& topic_id_, std::vector<char>& receive_buffer_)
+  {
+    // process all samples written since the last event
+    bool send_ack(false);
+    const uint64_t lost_before = m_ring_lost;
+    while (!m_do_stop && m_ring.Read(m_ring_read_seq, receive_buffer_, m_ring_lost))
+    {
+      // every slot starts with its own SMemFileHeader
+      if (receive_buffer_.size() < 2) continue;
+
+      SMemFileHeader mfile_hdr;
+      uint16_t rcv_hdr_size(0);
+      std::memcpy(&rcv_hdr_size, receive_buffer_.data(), sizeof(rcv_hdr_size));
+      const size_t hdr_bytes2copy = std::min(static_cast<size_t>(rcv_hdr_size), sizeof(SMemFileHeader));
+      if (rcv_hdr_size > receive_buffer_.size()) continue;
+      std::memcpy(&mfile_hdr, receive_buffer_.data(), hdr_bytes2copy);
+      if (rcv_hdr_size + mfile_hdr.data_size > receive_buffer_.size()) continue;
+
+      // add sample to data reader (and call user callback function)
+      if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer_.data() + rcv_hdr_size, (size_t)mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, nullptr);
+
+      if ((mfile_hdr.ack_timout_ms != 0) && !AcknowledgeViaCounter(mfile_hdr))
+      {
+        send_ack = true;
+      }
+    }
+
+    // send acknowledge event
+    if (send_ack)
+    {
+      gSetEvent(m_event_ack);
+    }
+
+#ifndef NDEBUG
+    if (m_ring_lost != lost_before)
+    {
+      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " lost " + std::to_string(m_ring_lost - lost_before) + " samples (ring overrun)"));
+    }
+#else
+    (void)lost_before;
+#endif
+  }
+
+  bool CMemFileObserver::AcknowledgeViaCounter(const SMemFileHeader& mfile_hdr_)
+  {
+    if (mfile_hdr_.options.ack_counter == 0) return false;
+
+    // open the publishers acknowledge counter on first use
+    if (!m_ack.IsCreated() && !m_ack.Create(m_memfile.Name(), false)) return false;
+
+    m_ack.Acknowledge(mfile_hdr_.clock);
+    return true;
+  }
+
+  ////////////////////////////////////////
+  // CMemFileReactor
+  ////////////////////////////////////////
+  CMemFileReactor::CMemFileReactor() :
+    m_running(false),
+    m_do_stop(false)
+  {
+  }
+
+  CMemFileReactor::~CMemFileReactor()
+  {
+    Stop();
+  }
+
+  bool CMemFileReactor::Start(size_t thread_count_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    if (m_running)         return false;
+    if (thread_count_ == 0) return false;
+
+    m_do_stop = false;
+    for (size_t i = 0; i < thread_count_; ++i)
+    {
+      m_threads.emplace_back(std::make_unique<SReactorThread>());
+      SReactorThread& reactor_thread = *m_threads.back();
+      reactor_thread.thread = std::thread(&CMemFileReactor::Run, this, std::ref(reactor_thread));
+    }
+    m_running = true;
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug2, std::string("CMemFileReactor started (" + std::to_string(thread_count_) + " threads)"));
+#endif
+
+    return true;
+  }
+
+  bool CMemFileReactor::Stop()
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    if (!m_running) return false;
+
+    m_do_stop = true;
+    for (auto& reactor_thread : m_threads)
+    {
+      WakeUp(*reactor_thread);
+      if (reactor_thread->thread.joinable()) reactor_thread->thread.join();
+    }
+    m_threads.clear();
+    m_running = false;
+
+    return true;
+  }
+
+  bool CMemFileReactor::Add(const std::shared_ptr<CMemFileObserver>& observer_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    if (!m_running) return false;
+
+    // choose the thread with the lowest number of observers
+    SReactorThread* target(nullptr);
+    size_t          target_load(0);
+    for (auto& reactor_thread : m_threads)
+    {
+      const std::lock_guard<std::mutex> thread_lock(reactor_thread->mtx);
+      if ((target == nullptr) || (reactor_thread->observers.size() < target_load))
+      {
+        target      = reactor_thread.get();
+        target_load = reactor_thread->observers.size();
+      }
+    }
+
+    // all threads wait for as many memory files as possible, otherwise they would have to poll them
+    if (target_load >= ObserversPerReactorThread())
+    {
+      m_threads.emplace_back(std::make_unique<SReactorThread>());
+      target = m_threads.back().get();
+      target->thread = std::thread(&CMemFileReactor::Run, this, std::ref(*target));
+
+#ifndef NDEBUG
+      // log it
+      Logging::Log(log_level_debug2, std::string("CMemFileReactor thread added (" + std::to_string(m_threads.size()) + " threads)"));
+#endif
+    }
+
+    {
+      const std::lock_guard<std::mutex> thread_lock(target->mtx);
+      target->observers.push_back(observer_);
+    }
+    WakeUp(*target);
+
+    return true;
+  }
+
+  bool CMemFileReactor::Remove(const std::shared_ptr<CMemFileObserver>& observer_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    if (!m_running) return false;
+
+    for (auto& reactor_thread : m_threads)
+    {
+      std::unique_lock<std::mutex> thread_lock(reactor_thread->mtx);
+      auto& observers = reactor_thread->observers;
+      auto  iter      = std::find(observers.begin(), observers.end(), observer_);
+      if (iter != observers.end())
+      {
+        observers.erase(iter);
+
+        // wait for a running poll of the observer (unless we are called from its data callback)
+        if (reactor_thread->thread.get_id() != std::this_thread::get_id())
+        {
+          reactor_thread->idle_cv.wait(thread_lock, [&]() -> bool { return !reactor_thread->polling; });
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void CMemFileReactor::Run(SReactorThread& reactor_thread_)
+  {
+    std::vector<std::shared_ptr<CMemFileObserver>> observers;
+    std::vector<std::shared_ptr<CMemFileObserver>> timed_out_observers;
+    std::vector<const std::atomic<std::uint32_t>*> notify_words;
+    std::vector<std::uint32_t>                     notify_values;
+
+    while (!m_do_stop)
+    {
+      // take the wake up counter first, so added observers are not missed
+      const std::uint32_t wake_seq = reactor_thread_.wake_seq.load();
+
+      // the observers are polled without holding the lock, their data callbacks may add or remove observers
+      {
+        const std::lock_guard<std::mutex> lock(reactor_thread_.mtx);
+        observers = reactor_thread_.observers;
+        reactor_thread_.polling = true;
+      }
+
+      bool busy(false);
+      bool all_notified(true);
+      timed_out_observers.clear();
+      notify_words.clear();
+      notify_values.clear();
+      for (const auto& observer : observers)
+      {
+        if (observer->Poll()) busy = true;
+
+        // drop timed out observers, the thread pool cleans them up
+        if (!observer->IsObserving())
+        {
+          timed_out_observers.push_back(observer);
+          continue;
+        }
+
+        const std::atomic<std::uint32_t>* word(nullptr);
+        std::uint32_t                     value(0);
+        if (observer->GetNotification(word, value))
+        {
+          notify_words.push_back(word);
+          notify_values.push_back(value);
+        }
+        else
+        {
+          all_notified = false;
+        }
+      }
+      observers.clear();
+
+      {
+        const std::lock_guard<std::mutex> lock(reactor_thread_.mtx);
+        for (const auto& observer : timed_out_observers)
+        {
+          auto& thread_observers = reactor_thread_.observers;
+          thread_observers.erase(std::remove(thread_observers.begin(), thread_observers.end(), observer), thread_observers.end());
+        }
+        reactor_thread_.polling = false;
+      }
+      reactor_thread_.idle_cv.notify_all();
+
+      // poll again as long as there is new content
+      if (busy) continue;
+
+      // memory files without notification have to be polled
+      const int timeout = all_notified ? 20 : SUB_MEMFILE_OBSERVER_POLL_MS;
+
+#ifdef __linux__
+      // sleep until one of the publishers notifies new content or the thread is woken up
+      if (memfile::futex::WaitAnySupported() && !notify_words.empty() && (notify_words.size() < memfile::futex::wait_any_max))
+      {
+        notify_words.push_back(&reactor_thread_.wake_seq);
+        notify_values.push_back(wake_seq);
+        memfile::futex::WaitAny(notify_words.data(), notify_values.data(), notify_words.size(), timeout);
+        continue;
+      }
+#endif
+
+      // no multi wait possible, memory files with notification have to be polled as well
+      const int wait_timeout = notify_words.empty() ? timeout : SUB_MEMFILE_OBSERVER_POLL_MS;
+      std::unique_lock<std::mutex> lock(reactor_thread_.mtx);
+      reactor_thread_.cv.wait_for(lock, std::chrono::milliseconds(wait_timeout), [&]() -> bool { return m_do_stop || (reactor_thread_.wake_seq.load() != wake_seq); });
+    }
+  }
+
+  void CMemFileReactor::WakeUp(SReactorThread& reactor_thread_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(reactor_thread_.mtx);
+      reactor_thread_.wake_seq.fetch_add(1);
+    }
+    reactor_thread_.cv.notify_all();
+#ifdef __linux__
+    memfile::futex::WakeAll(&reactor_thread_.wake_seq);
+#endif
+  }
+
   ////////////////////////////////////////
   // CMemFileThreadPool
   ////////////////////////////////////////
@@ -339,6 +893,10 @@ namespace eCAL
   {
     if(m_created) return;
 
+    // start shared observer threads, otherwise every memory file gets its own observer thread
+    const size_t observer_threads = Config::GetMemfileObserverThreadCount();
+    if (observer_threads > 0) m_reactor.Start(observer_threads);
+
     // start cleanup thread
     m_do_cleanup = true;
     m_cleanup_thread = std::thread(&CMemFileThreadPool::CleanupPoolThread, this);
@@ -362,11 +920,14 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
 
     // stop all running observers
-    for (auto & observer : m_observer_pool) observer.second->Stop();
+    for (auto & observer : m_observer_pool) StopObserver(observer.second);
 
     // clear pool (and destroy all)
     m_observer_pool.clear();
 
+    // stop shared observer threads
+    m_reactor.Stop();
+
     m_created = false;
   }
 
@@ -392,8 +953,8 @@ namespace eCAL
       }
       else
       {
-        observer->Stop();
-        observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_);
+        StopObserver(observer);
+        StartObserver(observer, topic_name_, topic_id_, timeout_observation_ms, callback_);
       }
 
       return(true);
@@ -403,7 +964,7 @@ namespace eCAL
     {
       auto observer = std::make_shared<CMemFileObserver>();
       observer->Create(memfile_name_, memfile_event_);
-      observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_);
+      StartObserver(observer, topic_name_, topic_id_, timeout_observation_ms, callback_);
       m_observer_pool[memfile_name_] = observer;
 #ifndef NDEBUG
       // log it
@@ -446,6 +1007,7 @@ namespace eCAL
         // log it
         Logging::Log(log_level_debug2, std::string("CMemFileThreadPool::ObserveFile " + observer->first + " removed"));
 #endif
+        StopObserver(observer->second);
         observer = m_observer_pool.erase(observer);
       }
       else
@@ -454,4 +1016,26 @@ namespace eCAL
       }
     }
   }
+
+  void CMemFileThreadPool::StartObserver(const std::shared_ptr<CMemFileObserver>& observer_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_)
+  {
+    if (m_reactor.IsRunning())
+    {
+      // observed by the shared reactor threads
+      observer_->Start(topic_name_, topic_id_, timeout_observation_ms, callback_, true);
+      m_reactor.Add(observer_);
+    }
+    else
+    {
+      // observed by its own thread
+      observer_->Start(topic_name_, topic_id_, timeout_observation_ms, callback_);
+    }
+  }
+
+  void CMemFileThreadPool::StopObserver(const std::shared_ptr<CMemFileObserver>& observer_)
+  {
+    // make sure the reactor does not poll the observer anymore
+    if (m_reactor.IsRunning()) m_reactor.Remove(observer_);
+    observer_->Stop();
+  }
 }
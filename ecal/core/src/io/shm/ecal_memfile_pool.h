@@ -25,11 +25,14 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <ecal/ecal_event.h>
 #include <ecal/ecal_log.h>
 
 #include "ecal_memfile.h"
+#include "ecal_memfile_ack.h"
 #include "ecal_memfile_header.h"
+#include "ecal_memfile_ring.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -39,10 +42,13 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace eCAL
 {
-  using MemFileDataCallbackT = std::function<size_t (const std::string &, const std::string &, const char *, size_t, long long, long long, long long, size_t)>;
+  // receive buffer handed over with the payload, the receiver may keep it to process the payload later (buffered mode only)
+  using MemFileBufferT       = std::shared_ptr<const std::vector<char>>;
+  using MemFileDataCallbackT = std::function<size_t (const std::string &, const std::string &, const char *, size_t, long long, long long, long long, size_t, const MemFileBufferT &)>;
 
   ////////////////////////////////////////
   // CMemFileObserver
@@ -61,16 +67,43 @@ namespace eCAL
     bool Create(const std::string& memfile_name_, const std::string& memfile_event_);
     bool Destroy();
 
-    bool Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_);
+    /**
+     * @brief Start observing the memory file.
+     *
+     * @param polled_  Do not start an observer thread, the memory file is observed by calling Poll (CMemFileReactor).
+    **/
+    bool Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_, bool polled_ = false);
     bool Stop();
     bool IsObserving() {return(m_is_observing);};
 
     bool ResetTimeout();
 
+    /**
+     * @brief Process new memory file content without blocking (polled mode only).
+     *
+     * @return  true if new content was processed.
+    **/
+    bool Poll();
+
+    /**
+     * @brief Futex word and its value seen by the last Poll call, to sleep until the publisher notifies new content.
+     *
+     * @return  false if the memory file has to be polled (publisher without notification counter or no futex support).
+    **/
+    bool GetNotification(const std::atomic<std::uint32_t>*& word_, std::uint32_t& value_) const;
+
   protected:
-    void Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_);
+    void Observe();
+    void ProcessMemFile();
+    bool IsTimedOut() const;
     bool ReadFileHeader(SMemFileHeader& memfile_hdr);
 
+    bool AttachRing();
+    bool WaitForRingData(int timeout_);
+    bool AcknowledgeViaCounter(const SMemFileHeader& mfile_hdr_);
+    void ReadRing(const std::string& topic_name_, const std::string& topic_id_, std::vector<char>& receive_buffer_);
+    std::shared_ptr<std::vector<char>> GetHandoffBuffer();
+
     std::atomic<bool>       m_created;
     std::atomic<bool>       m_do_stop;
     std::atomic<bool>       m_is_observing;
@@ -78,11 +111,91 @@ namespace eCAL
     std::atomic<std::chrono::steady_clock::time_point> m_time_of_last_life_signal;
 
     MemFileDataCallbackT    m_data_callback;
+    std::string             m_topic_name;
+    std::string             m_topic_id;
+    int                     m_timeout;
+    bool                    m_polled;
+
+    uint64_t                m_last_sample_clock;
+    std::vector<char>       m_receive_buffer;
+    std::vector<std::shared_ptr<std::vector<char>>> m_handoff_buffers;
+    bool                    m_has_unprocessed_data;
+    uint32_t                m_memfile_notify_seq;
 
     std::thread             m_thread;
     EventHandleT            m_event_snd;
     EventHandleT            m_event_ack;
     CMemoryFile             m_memfile;
+
+    CMemFileAck             m_ack;
+
+    CMemFileRing            m_ring;
+    bool                    m_ring_probed;
+    uint64_t                m_ring_read_seq;
+    uint64_t                m_ring_lost;
+    uint32_t                m_ring_notify_seq;
+    std::chrono::steady_clock::time_point m_ring_probe_time;
+
+    std::chrono::microseconds m_spin_time_max;
+    std::chrono::microseconds m_spin_time;
+  };
+
+  ////////////////////////////////////////
+  // CMemFileReactor
+  ////////////////////////////////////////
+  /**
+   * @brief A fixed number of threads observing (polling) a set of memory files.
+   *
+   * Every observer is owned by one reactor thread, so its samples are processed in order.
+   * Idle threads sleep on the futex words of all observed memory files at once (futex_waitv),
+   * memory files without futex notification are polled in a short interval (SUB_MEMFILE_OBSERVER_POLL_MS).
+   * A thread waits for at most futex::wait_any_max - 1 memory files, further threads are started if needed.
+  **/
+  class CMemFileReactor
+  {
+  public:
+    CMemFileReactor();
+    ~CMemFileReactor();
+
+    CMemFileReactor(const CMemFileReactor&) = delete;
+    CMemFileReactor& operator=(const CMemFileReactor&) = delete;
+    CMemFileReactor(CMemFileReactor&& rhs) = delete;
+    CMemFileReactor& operator=(CMemFileReactor&& rhs) = delete;
+
+    bool Start(size_t thread_count_);
+    bool Stop();
+    bool IsRunning() const {return(m_running);};
+
+    /**
+     * @brief Add a started (polled) observer to the least loaded reactor thread.
+    **/
+    bool Add(const std::shared_ptr<CMemFileObserver>& observer_);
+
+    /**
+     * @brief Remove an observer, the observer is not polled anymore when this function returns
+     *        (unless it is called from the data callback of an observer of the same reactor thread).
+    **/
+    bool Remove(const std::shared_ptr<CMemFileObserver>& observer_);
+
+  protected:
+    struct SReactorThread
+    {
+      std::mutex                                      mtx;
+      std::condition_variable                         cv;
+      std::condition_variable                         idle_cv;
+      std::vector<std::shared_ptr<CMemFileObserver>>  observers;
+      bool                                            polling{false};
+      std::atomic<std::uint32_t>                      wake_seq{0};
+      std::thread                                     thread;
+    };
+
+    void Run(SReactorThread& reactor_thread_);
+    static void WakeUp(SReactorThread& reactor_thread_);
+
+    std::mutex                                    m_sync;
+    std::vector<std::unique_ptr<SReactorThread>>  m_threads;
+    std::atomic<bool>                             m_running;
+    std::atomic<bool>                             m_do_stop;
   };
 
   ////////////////////////////////////////
@@ -102,6 +215,8 @@ namespace eCAL
   protected:
     void CleanupPoolThread();
     void CleanupPool();
+    void StartObserver(const std::shared_ptr<CMemFileObserver>& observer_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
+    void StopObserver(const std::shared_ptr<CMemFileObserver>& observer_);
 
     std::atomic<bool>                                         m_created;
     std::mutex                                                m_observer_pool_sync;
@@ -111,5 +226,7 @@ namespace eCAL
     std::condition_variable                                   m_do_cleanup_cv;
     std::mutex                                                m_do_cleanup_mtx;
     std::thread                                               m_cleanup_thread;
+
+    CMemFileReactor                                           m_reactor;
   };
 }
@@ -0,0 +1,278 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  lock-free slot ring for shared memory files
+**/
+
+#include "ecal_memfile_ring.h"
+#include "ecal_memfile_futex.h"
+
+#include <cstring>
+
+namespace
+{
+  std::size_t AlignUp(std::size_t value_, std::size_t align_)
+  {
+    return (value_ + align_ - 1) / align_ * align_;
+  }
+}
+
+namespace eCAL
+{
+  constexpr std::uint32_t CMemFileRing::ring_version;
+  constexpr std::size_t   CMemFileRing::ring_align;
+
+  CMemFileRing::CMemFileRing() :
+    m_header(nullptr),
+    m_size(0)
+  {
+    static_assert(sizeof(SRingHeader)  == 2 * ring_align, "Unexpected ring header layout.");
+    static_assert(sizeof(SSlotControl) == ring_align,     "Unexpected ring slot layout.");
+    static_assert(sizeof(std::atomic<std::uint64_t>) == sizeof(std::uint64_t), "Atomic 64 bit integers are not usable in shared memory on this platform.");
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "Atomic 32 bit integers are not usable as futex word on this platform.");
+  }
+
+  std::size_t CMemFileRing::PresumablyOccupiedMemorySize(std::uint32_t slot_count_, std::size_t slot_size_)
+  {
+    const std::size_t slot_stride = sizeof(SSlotControl) + AlignUp(slot_size_, ring_align);
+    // reserve one alignment unit, the base address of the ring does not need to be aligned
+    return ring_align + sizeof(SRingHeader) + static_cast<std::size_t>(slot_count_) * slot_stride;
+  }
+
+  bool CMemFileRing::SetBaseAddress(void* base_address_, std::size_t size_, bool reset_, std::uint32_t slot_count_ /*= 0*/, std::size_t slot_size_ /*= 0*/)
+  {
+    m_header = nullptr;
+    m_size   = 0;
+
+    if (base_address_ == nullptr) return(false);
+
+    // align ring to cache line boundary
+    // (memory files are mapped page aligned, so writer and reader end up with the same offset)
+    const auto        base_address = reinterpret_cast<std::uintptr_t>(base_address_);
+    const std::size_t align_offset = AlignUp(base_address, ring_align) - base_address;
+    if (size_ < align_offset + sizeof(SRingHeader)) return(false);
+
+    auto* header = reinterpret_cast<SRingHeader*>(base_address + align_offset);
+    const std::size_t size = size_ - align_offset;
+
+    if (reset_)
+    {
+      if (slot_count_ == 0) return(false);
+      if (PresumablyOccupiedMemorySize(slot_count_, slot_size_) > size_) return(false);
+
+      header->version     = ring_version;
+      header->slot_count  = slot_count_;
+      header->slot_size   = slot_size_;
+      header->slot_stride = sizeof(SSlotControl) + AlignUp(slot_size_, ring_align);
+      header->write_seq.store(0, std::memory_order_relaxed);
+      header->notify_seq.store(0, std::memory_order_relaxed);
+
+      m_header = header;
+      m_size   = size;
+
+      for (std::uint64_t seq = 0; seq < slot_count_; ++seq)
+      {
+        SSlotControl* slot = Slot(seq);
+        slot->len = 0;
+        slot->seq.store(0, std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+    else
+    {
+      // validate an existing ring
+      if (header->version    != ring_version) return(false);
+      if (header->slot_count == 0)            return(false);
+      if (header->slot_stride < sizeof(SSlotControl) + header->slot_size) return(false);
+      if (sizeof(SRingHeader) + header->slot_count * header->slot_stride > size) return(false);
+
+      m_header = header;
+      m_size   = size;
+    }
+
+    return(true);
+  }
+
+  std::uint32_t CMemFileRing::SlotCount() const
+  {
+    if (m_header == nullptr) return(0);
+    return(m_header->slot_count);
+  }
+
+  std::size_t CMemFileRing::SlotSize() const
+  {
+    if (m_header == nullptr) return(0);
+    return(static_cast<std::size_t>(m_header->slot_size));
+  }
+
+  std::uint64_t CMemFileRing::WriteSequence() const
+  {
+    if (m_header == nullptr) return(0);
+    return(m_header->write_seq.load(std::memory_order_acquire));
+  }
+
+  void* CMemFileRing::BeginWrite(std::size_t len_)
+  {
+    if (m_header == nullptr)         return(nullptr);
+    if (len_ > m_header->slot_size)  return(nullptr);
+
+    // there is only one writer, so no need for synchronization on the write sequence
+    const std::uint64_t seq  = m_header->write_seq.load(std::memory_order_relaxed);
+    SSlotControl*       slot = Slot(seq);
+
+    // mark slot as "write in progress", readers copying the old content will detect the overwrite
+    slot->seq.store(2 * seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return(reinterpret_cast<char*>(slot) + sizeof(SSlotControl));
+  }
+
+  void CMemFileRing::EndWrite(std::size_t len_)
+  {
+    if (m_header == nullptr) return;
+
+    const std::uint64_t seq  = m_header->write_seq.load(std::memory_order_relaxed);
+    SSlotControl*       slot = Slot(seq);
+
+    slot->len = static_cast<std::uint64_t>(len_);
+
+    // publish the slot content and the new write position
+    slot->seq.store(2 * seq + 2, std::memory_order_release);
+    m_header->write_seq.store(seq + 1, std::memory_order_release);
+  }
+
+  bool CMemFileRing::Read(std::uint64_t& read_seq_, std::vector<char>& buffer_, std::uint64_t& lost_) const
+  {
+    if (m_header == nullptr) return(false);
+
+    for (;;)
+    {
+      const std::uint64_t write_seq = m_header->write_seq.load(std::memory_order_acquire);
+
+      // nothing new
+      if (read_seq_ >= write_seq) return(false);
+
+      // we are too slow, the oldest samples are already overwritten
+      const std::uint64_t slot_count = m_header->slot_count;
+      const std::uint64_t oldest_seq = (write_seq > slot_count) ? write_seq - slot_count : 0;
+      if (read_seq_ < oldest_seq)
+      {
+        lost_     += oldest_seq - read_seq_;
+        read_seq_  = oldest_seq;
+      }
+
+      const SSlotControl* slot     = Slot(read_seq_);
+      const std::uint64_t seq_pre  = slot->seq.load(std::memory_order_acquire);
+      const std::uint64_t expected = 2 * read_seq_ + 2;
+
+      // the slot is already (being) overwritten by a newer sample
+      if (seq_pre != expected)
+      {
+        ++lost_;
+        ++read_seq_;
+        continue;
+      }
+
+      // copy slot content
+      const std::uint64_t len = slot->len;
+      if (len > m_header->slot_size)
+      {
+        ++lost_;
+        ++read_seq_;
+        continue;
+      }
+      buffer_.resize(static_cast<std::size_t>(len));
+      if (len > 0) std::memcpy(buffer_.data(), reinterpret_cast<const char*>(slot) + sizeof(SSlotControl), static_cast<std::size_t>(len));
+
+      // check that the writer did not touch the slot while copying
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const std::uint64_t seq_post = slot->seq.load(std::memory_order_relaxed);
+
+      ++read_seq_;
+
+      if (seq_post != seq_pre)
+      {
+        ++lost_;
+        continue;
+      }
+
+      // slot content was marked as invalid by the writer
+      if (len == 0) continue;
+
+      return(true);
+    }
+  }
+
+  bool CMemFileRing::NotificationSupported()
+  {
+    return(memfile::futex::Supported());
+  }
+
+  std::uint32_t CMemFileRing::NotifySequence() const
+  {
+    if (m_header == nullptr) return(0);
+    return(m_header->notify_seq.load(std::memory_order_seq_cst));
+  }
+
+  void CMemFileRing::Notify()
+  {
+    if (m_header == nullptr) return;
+
+    m_header->notify_seq.fetch_add(1, std::memory_order_seq_cst);
+#ifdef __linux__
+    memfile::futex::WakeAll(&m_header->notify_seq);
+#endif
+  }
+
+  bool CMemFileRing::WaitForNotification(std::uint32_t notify_seq_, int timeout_) const
+  {
+    if (m_header == nullptr) return(false);
+
+#ifdef __linux__
+    // returns immediately if the counter was already changed
+    memfile::futex::Wait(&m_header->notify_seq, notify_seq_, timeout_);
+#else
+    (void)timeout_;
+#endif
+    return(m_header->notify_seq.load(std::memory_order_seq_cst) != notify_seq_);
+  }
+
+  void CMemFileRing::WakeUp() const
+  {
+    if (m_header == nullptr) return;
+
+#ifdef __linux__
+    memfile::futex::WakeAll(&m_header->notify_seq);
+#endif
+  }
+
+  const std::atomic<std::uint32_t>* CMemFileRing::NotifyAddress() const
+  {
+    if (m_header == nullptr) return(nullptr);
+    return(&m_header->notify_seq);
+  }
+
+  CMemFileRing::SSlotControl* CMemFileRing::Slot(std::uint64_t seq_) const
+  {
+    const std::uint64_t index = seq_ % m_header->slot_count;
+    char* slot_address = reinterpret_cast<char*>(m_header) + sizeof(SRingHeader) + index * m_header->slot_stride;
+    return(reinterpret_cast<SSlotControl*>(slot_address));
+  }
+}
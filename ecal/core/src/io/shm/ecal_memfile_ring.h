@@ -0,0 +1,177 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  lock-free slot ring for shared memory files
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Single writer / multiple reader ring of sample slots placed into a memory file.
+   *
+   * Every slot is protected by its own sequence number (seqlock). The writer never waits
+   * for any reader, it marks a slot as "in progress" (odd sequence), writes the content
+   * and publishes it (even sequence). Readers copy a slot and check afterwards if its
+   * sequence is still the same, so an overwritten slot is detected instead of being locked.
+   *
+   * Every reader keeps its own cursor (the sequence number of the next sample to read),
+   * the writer does not know anything about its readers.
+   *
+   * On Linux the ring header contains a futex word, so one Notify call of the writer
+   * wakes up all waiting readers (of all processes) with a single system call.
+  **/
+  class CMemFileRing
+  {
+  public:
+    static constexpr std::uint32_t ring_version  = 1;
+    static constexpr std::size_t   ring_align    = 64;
+
+    CMemFileRing();
+
+    /**
+     * @brief Memory size needed to hold a ring (including alignment reserve).
+     *
+     * @param slot_count_  Number of slots.
+     * @param slot_size_   Maximum number of bytes per slot.
+     *
+     * @return  The needed size in bytes.
+    **/
+    static std::size_t PresumablyOccupiedMemorySize(std::uint32_t slot_count_, std::size_t slot_size_);
+
+    /**
+     * @brief Attach the ring to a memory area.
+     *
+     * @param base_address_  Start of the memory area (any alignment).
+     * @param size_          Size of the memory area.
+     * @param reset_         Initialize the ring (writer) or validate an existing one (reader).
+     * @param slot_count_    Number of slots (only if reset_ == true).
+     * @param slot_size_     Maximum number of bytes per slot (only if reset_ == true).
+     *
+     * @return  true if the memory area contains a valid ring.
+    **/
+    bool SetBaseAddress(void* base_address_, std::size_t size_, bool reset_, std::uint32_t slot_count_ = 0, std::size_t slot_size_ = 0);
+
+    bool IsValid() const { return(m_header != nullptr); };
+
+    std::uint32_t SlotCount() const;
+    std::size_t   SlotSize() const;
+
+    /**
+     * @brief Sequence number of the next sample that will be written.
+     *        Readers start observing from here to receive only new samples.
+    **/
+    std::uint64_t WriteSequence() const;
+
+    /**
+     * @brief Claim the next slot for writing (writer side only).
+     *
+     * @param len_  Number of bytes that will be written.
+     *
+     * @return  Slot address or nullptr if len_ exceeds the slot size.
+    **/
+    void* BeginWrite(std::size_t len_);
+
+    /**
+     * @brief Publish the slot claimed by BeginWrite.
+     *
+     * @param len_  Number of valid bytes (0 marks the slot content as invalid).
+    **/
+    void EndWrite(std::size_t len_);
+
+    /**
+     * @brief Copy the next available sample (reader side).
+     *
+     * @param read_seq_  Reader cursor, sequence number of the next sample to read (will be advanced).
+     * @param buffer_    Target buffer.
+     * @param lost_      Incremented by the number of samples that were overwritten before they could be read.
+     *
+     * @return  true if a sample was copied into buffer_.
+    **/
+    bool Read(std::uint64_t& read_seq_, std::vector<char>& buffer_, std::uint64_t& lost_) const;
+
+    /**
+     * @brief Futex based notification is available on this platform.
+    **/
+    static bool NotificationSupported();
+
+    /**
+     * @brief Current value of the notification counter.
+     *        Has to be taken before checking for new samples and passed to WaitForNotification afterwards.
+    **/
+    std::uint32_t NotifySequence() const;
+
+    /**
+     * @brief Wake up all waiting readers (writer side only, after EndWrite).
+    **/
+    void Notify();
+
+    /**
+     * @brief Wait until the notification counter differs from notify_seq_.
+     *
+     * @param notify_seq_  The notification counter value seen before.
+     * @param timeout_     Timeout in ms.
+     *
+     * @return  true if notified, false on timeout or spurious wakeup.
+    **/
+    bool WaitForNotification(std::uint32_t notify_seq_, int timeout_) const;
+
+    /**
+     * @brief Wake up all waiting readers without notification (used to unblock a stopping reader).
+    **/
+    void WakeUp() const;
+
+    /**
+     * @brief Address of the notification counter (futex word), to wait for multiple rings at once.
+    **/
+    const std::atomic<std::uint32_t>* NotifyAddress() const;
+
+  private:
+    struct SRingHeader
+    {
+      std::uint32_t              version;
+      std::uint32_t              slot_count;
+      std::uint64_t              slot_size;
+      std::uint64_t              slot_stride;
+      std::uint8_t               _reserved_0[ring_align - 24];
+      std::atomic<std::uint64_t> write_seq;
+      std::atomic<std::uint32_t> notify_seq;  // futex word
+      std::uint8_t               _reserved_1[ring_align - sizeof(std::atomic<std::uint64_t>) - sizeof(std::atomic<std::uint32_t>)];
+    };
+
+    struct SSlotControl
+    {
+      std::atomic<std::uint64_t> seq;   // odd -> write in progress, even -> 2 * (sample sequence + 1)
+      std::uint64_t              len;
+      std::uint8_t               _reserved_0[ring_align - sizeof(std::atomic<std::uint64_t>) - sizeof(std::uint64_t)];
+    };
+
+    SSlotControl* Slot(std::uint64_t seq_) const;
+
+    SRingHeader*  m_header;
+    std::size_t   m_size;
+  };
+}
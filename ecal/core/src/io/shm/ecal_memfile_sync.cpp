@@ -32,6 +32,7 @@
 #include "ecal_memfile_sync.h"
 
 #include <chrono>
+#include <cstring>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -90,6 +91,10 @@ namespace eCAL
       // Set the ack event to valid again, so we will wait for the subscriber
       iter->second.event_ack_is_invalid = false;
 
+      // the shared acknowledge counter can not tell which subscriber did not acknowledge in time,
+      // so we expect all of them again
+      m_ack_missing = 0;
+
       return true;
     }
   }
@@ -120,8 +125,9 @@ namespace eCAL
   {
     if (!m_created) return false;
 
-    // we recreate a memory file if the file size is too small
-    const bool file_to_small = m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_);
+    // we recreate a memory file if the file size (or rather the ring slot size) is too small
+    const size_t available_size = (m_attr.ring_slots > 0) ? m_ring.SlotSize() : m_memfile.MaxDataSize();
+    const bool file_to_small = available_size < (sizeof(SMemFileHeader) + size_);
     if (file_to_small)
     {
 #ifndef NDEBUG
@@ -148,6 +154,10 @@ namespace eCAL
       return false;
     }
 
+    // pipelined acknowledge mode, the subscribers had time to process the
+    // last sample while we were away, now we have to wait before overwriting it
+    WaitForAcknowledge();
+
     // store acknowledge timeout parameter
     m_attr.timeout_ack_ms = data_.acknowledge_timeout_ms;
     if (m_attr.timeout_ack_ms < 0) m_attr.timeout_ack_ms = 0;
@@ -171,9 +181,23 @@ namespace eCAL
     memfile_hdr.hash              = static_cast<uint64_t>(data_.hash);
     // set zero copy
     memfile_hdr.options.zero_copy = static_cast<unsigned char>(data_.zero_copy);
+    // set acknowledge via shared counter
+    memfile_hdr.options.ack_counter = static_cast<unsigned char>(m_ack.IsCreated());
     // set acknowledge timeout
     memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
 
+    // ring mode, write into the next slot without locking the memory file
+    if (m_attr.ring_slots > 0)
+    {
+      const bool written = WriteRing(payload_, memfile_hdr);
+
+      // and fire the publish event for local subscriber
+      if (written) SyncContent(memfile_hdr.clock);
+      else         Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::Write - FAILED (ring write failed)");
+
+      return written;
+    }
+
     // acquire write access
     bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
 
@@ -214,7 +238,7 @@ namespace eCAL
     m_memfile.ReleaseWriteAccess();
 
     // and fire the publish event for local subscriber
-    if (written) SyncContent();
+    if (written) SyncContent(memfile_hdr.clock);
 
     if (written)
     {
@@ -252,6 +276,12 @@ namespace eCAL
     // create new memory file object
     // with additional space for SMemFileHeader
     size_t memfile_size = sizeof(SMemFileHeader) + size_;
+    // in ring mode every slot holds its own SMemFileHeader followed by the payload
+    const size_t slot_size = sizeof(SMemFileHeader) + size_;
+    if (m_attr.ring_slots > 0)
+    {
+      memfile_size = sizeof(SMemFileHeader) + CMemFileRing::PresumablyOccupiedMemorySize(static_cast<uint32_t>(m_attr.ring_slots), slot_size);
+    }
     // check for minimal size
     if (memfile_size < m_attr.min_size) memfile_size = m_attr.min_size;
 
@@ -266,11 +296,33 @@ namespace eCAL
     Logging::Log(log_level_debug2, std::string("CSyncMemoryFile::Create SUCCESS : ") + m_memfile_name);
 #endif
 
-    // initialize memory file with empty header
-    struct SMemFileHeader memfile_hdr;
-    m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
-    m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
-    m_memfile.ReleaseWriteAccess();
+    if (m_attr.ring_slots > 0)
+    {
+      // initialize memory file with ring header and empty slots
+      if (!CreateRing(slot_size))
+      {
+        Logging::Log(log_level_error, std::string("CSyncMemoryFile::Create FAILED (ring initialization) : ") + m_memfile_name);
+        m_memfile.Destroy(true);
+        return false;
+      }
+    }
+    else
+    {
+      // initialize memory file with empty header
+      struct SMemFileHeader memfile_hdr;
+      m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+      m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
+      m_memfile.ReleaseWriteAccess();
+    }
+
+    // create shared acknowledge counter
+    if (m_attr.ack_counter && CMemFileAck::Supported())
+    {
+      if (!m_ack.Create(m_memfile_name, true))
+      {
+        Logging::Log(log_level_warning, std::string("CSyncMemoryFile::Create - shared acknowledge counter creation failed, using events : ") + m_memfile_name);
+      }
+    }
 
     // it's created
     m_created = true;
@@ -291,6 +343,13 @@ namespace eCAL
     // disconnect all processes
     DisconnectAll();
 
+    // detach ring
+    m_ring = CMemFileRing();
+
+    // destroy shared acknowledge counter
+    m_ack.Destroy();
+    m_ack_pending = false;
+
     // destroy the file
     if (!m_memfile.Destroy(true))
     {
@@ -333,68 +392,176 @@ namespace eCAL
     return true;
   }
 
-  void CSyncMemoryFile::SyncContent()
+  bool CSyncMemoryFile::CreateRing(size_t slot_size_)
+  {
+    // the memory file starts with a SMemFileHeader flagged as ring buffer,
+    // its clock stays 0, so readers not knowing the ring layout will never process the content
+    struct SMemFileHeader memfile_hdr;
+    memfile_hdr.options.ring_buffer = 1;
+
+    if (!m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms))) return false;
+
+    bool ring_created(false);
+    void* wbuf(nullptr);
+    if (m_memfile.GetWriteAddress(wbuf, m_memfile.MaxDataSize()) != 0u)
+    {
+      std::memcpy(wbuf, &memfile_hdr, memfile_hdr.hdr_size);
+      ring_created = m_ring.SetBaseAddress(static_cast<char*>(wbuf) + memfile_hdr.hdr_size, m_memfile.MaxDataSize() - memfile_hdr.hdr_size, true, static_cast<uint32_t>(m_attr.ring_slots), slot_size_);
+    }
+
+    // the ring is accessed without the memory file mutex from now on
+    m_memfile.ReleaseWriteAccess();
+
+    return ring_created;
+  }
+
+  bool CSyncMemoryFile::WriteRing(CPayloadWriter& payload_, const SMemFileHeader& memfile_hdr_)
+  {
+    const size_t slot_len = memfile_hdr_.hdr_size + static_cast<size_t>(memfile_hdr_.data_size);
+    void* slot = m_ring.BeginWrite(slot_len);
+    if (slot == nullptr) return false;
+
+    // write the user file header
+    std::memcpy(slot, &memfile_hdr_, memfile_hdr_.hdr_size);
+
+    // write the buffer, slots are reused round robin so we always need a full write
+    bool written(true);
+    if (memfile_hdr_.data_size > 0)
+    {
+      written = payload_.WriteFull(static_cast<char*>(slot) + memfile_hdr_.hdr_size, static_cast<size_t>(memfile_hdr_.data_size));
+    }
+
+    // publish slot (or mark it as invalid)
+    m_ring.EndWrite(written ? slot_len : 0);
+
+    return written;
+  }
+
+  void CSyncMemoryFile::SyncContent(uint64_t clock_)
   {
     if (!m_created) return;
 
     // fire the publisher events
     // connected subscribers will read the content from the memory file
+    SignalContent(clock_);
 
+    if (m_attr.timeout_ack_ms == 0) return;
+
+    // wait for acknowledgment from receiver side now
+    // or (pipelined) right before the memory file is written again
+    m_ack_pending       = true;
+    m_ack_pending_clock = clock_;
+    if (!m_attr.ack_pipelining) WaitForAcknowledge();
+  }
+
+  void CSyncMemoryFile::SignalContent(uint64_t clock_)
+  {
     const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
 
-    // "eat" old acknowledge events :)
     if (m_attr.timeout_ack_ms != 0)
     {
-      for (const auto& event_handle : m_event_handle_map)
+      if (m_ack.IsCreated())
+      {
+        // start new acknowledge round
+        m_ack.Reset(clock_);
+      }
+      else
       {
-        while (gWaitForEvent(event_handle.second.event_ack, 0)) {}
+        // "eat" old acknowledge events :)
+        for (const auto& event_handle : m_event_handle_map)
+        {
+          while (gWaitForEvent(event_handle.second.event_ack, 0)) {}
+        }
       }
     }
 
     // send sync (memory file update) event
-    for (const auto& event_handle : m_event_handle_map)
+    if (m_ring.IsValid() && CMemFileRing::NotificationSupported())
     {
-      // send sync event
-      gSetEvent(event_handle.second.event_snd);
+      // wake up all waiting readers with one futex call
+      m_ring.Notify();
     }
-
-    // wait for acknowledgment event from receiver side
-    if (m_attr.timeout_ack_ms != 0)
+    else
     {
-      // take start time for all acknowledge timeouts
-      const auto start_time = std::chrono::steady_clock::now();
-
-      for (auto& event_handle : m_event_handle_map)
+      for (const auto& event_handle : m_event_handle_map)
       {
-        const auto time_since_start = std::chrono::steady_clock::now() - start_time;
-        const auto time_to_wait     = std::chrono::milliseconds(m_attr.timeout_ack_ms)- time_since_start;
-        long       time_to_wait_ms  = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
-        if (time_to_wait_ms <= 0) time_to_wait_ms = 0;
+        // send sync event
+        gSetEvent(event_handle.second.event_snd);
+      }
 
-        if (event_handle.second.event_ack_is_invalid)
-        {
-          // The ack event has timeouted before. Thus, we don't wait for it
-          // anymore, until the subscriber notifies us via registration layer
-          // that it is still alive.
-          continue;
-        }
+      // wake up readers sleeping on the memory file (shared observer threads),
+      // after setting the events, so a reader woken up here will find its event set
+      m_memfile.Notify();
+    }
 
-        if (!gWaitForEvent(event_handle.second.event_ack, time_to_wait_ms))
-        {
-          // Remember that this event has timeouted. This will not cause the
-          // publisher to wait for it anymore, until the subscriber actively
-          // requests that via registration layer again.
-          event_handle.second.event_ack_is_invalid = true;
 #ifndef NDEBUG
-          Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK event timeout");
+    Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten");
 #endif
-        }
+  }
+
+  void CSyncMemoryFile::WaitForAcknowledge()
+  {
+    if (!m_ack_pending) return;
+    m_ack_pending = false;
+
+    if (!m_created) return;
+
+    // shared acknowledge counter, we do not need to lock the event map while waiting
+    if (m_ack.IsCreated())
+    {
+      size_t expected(0);
+      {
+        const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+        expected = m_event_handle_map.size();
+        expected = (expected > m_ack_missing) ? expected - m_ack_missing : 0;
       }
+      if (expected == 0) return;
+
+      const size_t received = m_ack.Wait(m_ack_pending_clock, expected, static_cast<int>(m_attr.timeout_ack_ms));
+      if (received < expected)
+      {
+        // Remember the number of subscribers that did not acknowledge in time. We will not wait for them
+        // anymore, until the subscribers notify us via registration layer that they are still alive.
+        const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+        m_ack_missing += expected - received;
+#ifndef NDEBUG
+        Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::WaitForAcknowledge - ACK counter timeout");
+#endif
+      }
+      return;
     }
 
+    const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+
+    // take start time for all acknowledge timeouts
+    const auto start_time = std::chrono::steady_clock::now();
+
+    for (auto& event_handle : m_event_handle_map)
+    {
+      const auto time_since_start = std::chrono::steady_clock::now() - start_time;
+      const auto time_to_wait     = std::chrono::milliseconds(m_attr.timeout_ack_ms)- time_since_start;
+      long       time_to_wait_ms  = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
+      if (time_to_wait_ms <= 0) time_to_wait_ms = 0;
+
+      if (event_handle.second.event_ack_is_invalid)
+      {
+        // The ack event has timeouted before. Thus, we don't wait for it
+        // anymore, until the subscriber notifies us via registration layer
+        // that it is still alive.
+        continue;
+      }
+
+      if (!gWaitForEvent(event_handle.second.event_ack, time_to_wait_ms))
+      {
+        // Remember that this event has timeouted. This will not cause the
+        // publisher to wait for it anymore, until the subscriber actively
+        // requests that via registration layer again.
+        event_handle.second.event_ack_is_invalid = true;
 #ifndef NDEBUG
-    Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten");
+        Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK event timeout");
 #endif
+      }
+    }
   }
 
   void CSyncMemoryFile::DisconnectAll()
@@ -30,6 +30,9 @@
 
 #include "readwrite/ecal_writer_data.h"
 #include "ecal_memfile.h"
+#include "ecal_memfile_ack.h"
+#include "ecal_memfile_header.h"
+#include "ecal_memfile_ring.h"
 
 #include <mutex>
 #include <string>
@@ -43,6 +46,9 @@ namespace eCAL
     size_t  reserve;            //!< dynamic file size reserve before recreating memory file if payload size changes [%]
     int64_t timeout_open_ms;    //!< timeout to open a memory file using mutex lock [ms]
     int64_t timeout_ack_ms;     //!< timeout for memory read acknowledge signal from data reader [ms]
+    size_t  ring_slots;         //!< number of sample slots of the lock-free memory file ring (0 = classic single sample memory file)
+    bool    ack_pipelining;     //!< wait for the acknowledge signals right before the memory file is written again instead of directly after writing
+    bool    ack_counter;        //!< acknowledge via shared counter instead of one event per data reader (if supported by the platform)
   };
 
   class CSyncMemoryFile
@@ -66,12 +72,19 @@ namespace eCAL
     bool Destroy();
     bool Recreate(size_t size_);
 
-    void SyncContent();
+    bool CreateRing(size_t slot_size_);
+    bool WriteRing(CPayloadWriter& payload_, const SMemFileHeader& memfile_hdr_);
+
+    void SyncContent(uint64_t clock_);
+    void SignalContent(uint64_t clock_);
+    void WaitForAcknowledge();
     void DisconnectAll();
 
     std::string         m_base_name;
     std::string         m_memfile_name;
     CMemoryFile         m_memfile;
+    CMemFileRing        m_ring;
+    CMemFileAck         m_ack;
     SSyncMemoryFileAttr m_attr;
     bool                m_created;
 
@@ -84,5 +97,9 @@ namespace eCAL
     using EventHandleMapT = std::unordered_map<std::string, SEventHandlePair>;
     std::mutex       m_event_handle_map_sync;
     EventHandleMapT  m_event_handle_map;
+
+    bool             m_ack_pending       = false;  //!< the last written sample still has to be acknowledged
+    uint64_t         m_ack_pending_clock = 0;
+    size_t           m_ack_missing       = 0;      //!< number of data readers that did not acknowledge via shared counter in time
   };
 }
@@ -40,7 +40,7 @@ namespace eCAL
     namespace os
     {
 
-      bool AllocFile(const std::string& name_, const bool create_, SMemFileInfo& mem_file_info_)
+      bool AllocFile(const std::string& name_, const bool create_, const bool writable_, SMemFileInfo& mem_file_info_)
       {
         int previous_umask = umask(000);  // set umask to nothing, so we can create files with all possible permission bits
         mem_file_info_.name = name_.size() ? ((name_[0] != '/') ? "/" + name_ : name_) : name_; // make memory file path compatible for all posix systems
@@ -54,9 +54,11 @@ namespace eCAL
           }
         }
         else {
-          mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_RDONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          // never add the file to the system, if it does not exist (any more)
+          mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), writable_ ? O_RDWR : O_RDONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
           mem_file_info_.exists = true;
         }
+        mem_file_info_.writable = create_ || writable_;
         umask(previous_umask);            // reset umask to previous permissions
         if (mem_file_info_.memfile == -1)
         {
@@ -71,6 +73,7 @@ namespace eCAL
           mem_file_info_.memfile = 0;
           mem_file_info_.name = "";
           mem_file_info_.exists = false;
+          mem_file_info_.writable = false;
           return(false);
         }
 
@@ -114,7 +117,7 @@ namespace eCAL
 
           // get address
           int         prot = PROT_READ;
-          if (create_) prot |= PROT_WRITE;
+          if (mem_file_info_.writable) prot |= PROT_WRITE;
 
           mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, MAP_SHARED, mem_file_info_.memfile, 0);
           if (mem_file_info_.mem_address == MAP_FAILED)
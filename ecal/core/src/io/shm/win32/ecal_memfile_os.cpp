@@ -29,10 +29,11 @@ namespace eCAL
   {
     namespace os
     {
-      bool AllocFile(const std::string& name_, const bool /*create_*/, SMemFileInfo& mem_file_info_)
+      bool AllocFile(const std::string& name_, const bool create_, const bool writable_, SMemFileInfo& mem_file_info_)
       {
-        mem_file_info_.name = name_;
-        mem_file_info_.size = 0;
+        mem_file_info_.name     = name_;
+        mem_file_info_.size     = 0;
+        mem_file_info_.writable = create_ || writable_;
         return(true);
       }
 
@@ -52,24 +53,34 @@ namespace eCAL
       {
         if (mem_file_info_.map_region == nullptr)
         {
-          DWORD flProtect = 0;
-          if (create_)
+          if (!create_ && mem_file_info_.writable)
           {
-            flProtect = PAGE_READWRITE;
+            // never add the file to the system, if it does not exist (any more)
+            mem_file_info_.map_region = OpenFileMapping(FILE_MAP_ALL_ACCESS, FALSE, mem_file_info_.name.c_str());
+            if (mem_file_info_.map_region == NULL) return(false);
+            mem_file_info_.exists = true;
           }
           else
           {
-            flProtect = PAGE_READONLY;
+            DWORD flProtect = 0;
+            if (create_)
+            {
+              flProtect = PAGE_READWRITE;
+            }
+            else
+            {
+              flProtect = PAGE_READONLY;
+            }
+            mem_file_info_.map_region = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, flProtect, 0, (DWORD)mem_file_info_.size, mem_file_info_.name.c_str());
+            if (mem_file_info_.map_region == NULL) return(false);
+            if (GetLastError() == ERROR_ALREADY_EXISTS) mem_file_info_.exists = true;
           }
-          mem_file_info_.map_region = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, flProtect, 0, (DWORD)mem_file_info_.size, mem_file_info_.name.c_str());
-          if (mem_file_info_.map_region == NULL) return(false);
-          if (GetLastError() == ERROR_ALREADY_EXISTS) mem_file_info_.exists = true;
         }
 
         if (mem_file_info_.mem_address == nullptr)
         {
           DWORD dwDesiredAccess = 0;
-          if (create_)
+          if (mem_file_info_.writable)
           {
             dwDesiredAccess = FILE_MAP_ALL_ACCESS;
           }
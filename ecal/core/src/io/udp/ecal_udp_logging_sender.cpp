@@ -24,6 +24,7 @@
 #include "ecal_udp_logging_sender.h"
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace eCAL
 {
@@ -46,5 +47,28 @@ namespace eCAL
 
       return 0;
     }
+
+    size_t CLoggingSender::Send(const std::vector<eCAL::pb::LogMessage>& ecal_log_messages_)
+    {
+      if (!m_udp_sender) return(0);
+
+      // keep the serialized messages (and their capacity) for the next batch
+      if (m_logmessages_s.size() < ecal_log_messages_.size()) m_logmessages_s.resize(ecal_log_messages_.size());
+      m_send_buffers.clear();
+
+      for (size_t i = 0; i < ecal_log_messages_.size(); ++i)
+      {
+        std::string& logmessage_s = m_logmessages_s[i];
+        if (!ecal_log_messages_[i].SerializeToString(&logmessage_s) || logmessage_s.empty()) continue;
+
+        IO::UDP::SSendBuffer buffer;
+        buffer.data     = logmessage_s.data();
+        buffer.data_len = logmessage_s.size();
+        m_send_buffers.push_back(buffer);
+      }
+
+      if (m_send_buffers.empty()) return(0);
+      return m_udp_sender->Send(m_send_buffers.data(), m_send_buffers.size());
+    }
   }
 }
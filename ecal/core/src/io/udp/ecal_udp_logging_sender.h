@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -47,11 +48,16 @@ namespace eCAL
       CLoggingSender(const IO::UDP::SSenderAttr& attr_);
       size_t Send(const eCAL::pb::LogMessage& ecal_log_message_);
 
+      // send a batch of log messages (one datagram per message) with a single socket call
+      size_t Send(const std::vector<eCAL::pb::LogMessage>& ecal_log_messages_);
+
     private:
       IO::UDP::SSenderAttr                 m_attr;
       std::shared_ptr<IO::UDP::CUDPSender> m_udp_sender;
 
       std::string                          m_logmessage_s;
+      std::vector<std::string>             m_logmessages_s;
+      std::vector<IO::UDP::SSendBuffer>    m_send_buffers;
     };
   }
 }
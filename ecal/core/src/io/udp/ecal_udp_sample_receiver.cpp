@@ -24,6 +24,7 @@
 #include "ecal_udp_sample_receiver.h"
 #include "io/udp/fragmentation/msg_type.h"
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -34,10 +35,26 @@
 #include <vector>
 #include <iostream>
 
+namespace
+{
+  std::atomic<unsigned long long> g_socket_drops(0);
+  std::atomic<unsigned long long> g_incomplete_messages(0);
+  std::atomic<unsigned long long> g_reassembly_timeouts(0);
+}
+
 namespace eCAL
 {
   namespace UDP
   {
+    SReceiveStatistics GetReceiveStatistics()
+    {
+      SReceiveStatistics statistics;
+      statistics.socket_drops        = g_socket_drops.load(std::memory_order_relaxed);
+      statistics.incomplete_messages = g_incomplete_messages.load(std::memory_order_relaxed);
+      statistics.reassembly_timeouts = g_reassembly_timeouts.load(std::memory_order_relaxed);
+      return(statistics);
+    }
+
     CSampleReceiver::CSampleDefragmentation::CSampleDefragmentation(CSampleReceiver* sample_receiver_)
       : m_sample_receiver(sample_receiver_)
     {
@@ -74,6 +91,9 @@ namespace eCAL
 
       if (m_sample_receiver->m_has_sample_callback(sample_name))
       {
+        // raw sample, no protobuf parsing needed
+        if (m_sample_receiver->ApplyRawSample(sample_name, msg_buffer_.data() + payload_offset, msg_buffer_.size() - payload_offset)) return(0);
+
         // read sample
         if (!m_ecal_sample.ParseFromArray(msg_buffer_.data() + payload_offset, static_cast<int>(msg_buffer_.size() - (sizeof(sample_name_size) + sample_name_size)))) return(0);
 #ifndef NDEBUG
@@ -125,14 +145,19 @@ namespace eCAL
       return(0);
     }
 
-    CSampleReceiver::CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_) :
-      m_has_sample_callback(has_sample_callback_), m_apply_sample_callback(apply_sample_callback_)
+    CSampleReceiver::CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_, ApplyRawSampleCallbackT apply_raw_sample_callback_) :
+      m_has_sample_callback(has_sample_callback_), m_apply_sample_callback(apply_sample_callback_), m_apply_raw_sample_callback(apply_raw_sample_callback_), m_socket_drops(0)
     {
       // create udp receiver
       m_udp_receiver.Create(attr_);
 
-      // allocate receive buffer
-      m_msg_buffer.resize(MSG_BUFFER_SIZE);
+      // allocate receive buffers
+      m_msg_buffer.resize(static_cast<size_t>(NET_UDP_RECEIVE_BATCH) * MSG_BUFFER_SIZE);
+      m_msg_buffer_len.resize(NET_UDP_RECEIVE_BATCH);
+      for (size_t i = 0; i < NET_UDP_RECEIVE_BATCH; ++i)
+      {
+        m_msg_buffer_ptr.push_back(m_msg_buffer.data() + i * MSG_BUFFER_SIZE);
+      }
 
       // start receiver thread
       m_udp_receiver_thread = std::make_shared<eCAL::CCallbackThread>(std::bind(&CSampleReceiver::ReceiveThread, this));
@@ -162,12 +187,63 @@ namespace eCAL
 
     void CSampleReceiver::ReceiveThread()
     {
-      // wait for any incoming message
-      const size_t recv_len = m_udp_receiver.Receive(m_msg_buffer.data(), m_msg_buffer.size(), CMN_UDP_RECEIVE_THREAD_CYCLE_TIME_MS);
-      if (recv_len > 0)
+      // wait for any incoming messages and fetch all queued ones at once
+      const size_t recv_num = m_udp_receiver.ReceiveBatch(m_msg_buffer_ptr.data(), MSG_BUFFER_SIZE, m_msg_buffer_len.data(), m_msg_buffer_ptr.size(), CMN_UDP_RECEIVE_THREAD_CYCLE_TIME_MS);
+      for (size_t i = 0; i < recv_num; ++i)
+      {
+        if (m_msg_buffer_len[i] > 0)
+        {
+          Process(m_msg_buffer_ptr[i], m_msg_buffer_len[i]);
+        }
+      }
+
+      // socket drops are reported as total per socket
+      const unsigned long long socket_drops = m_udp_receiver.GetSocketDrops();
+      if (socket_drops > m_socket_drops)
       {
-        Process(m_msg_buffer.data(), recv_len);
+        g_socket_drops += socket_drops - m_socket_drops;
+        m_socket_drops  = socket_drops;
       }
+
+      CleanupDefragmentation();
+    }
+
+    bool CSampleReceiver::ApplyRawSample(const std::string& sample_name_, const char* buf_, size_t len_)
+    {
+      if (!m_apply_raw_sample_callback) return(false);
+
+      // a serialized protobuf sample never starts with a zero byte, a binary sample header always does
+      if ((len_ == 0) || (buf_[0] != 0)) return(false);
+
+      m_apply_raw_sample_callback(sample_name_, buf_, len_);
+      return(true);
+    }
+
+    std::shared_ptr<CSampleReceiver::CSampleDefragmentation> CSampleReceiver::AcquireDefragmentation()
+    {
+      if (m_defrag_pool.empty())
+      {
+        return(std::make_shared<CSampleDefragmentation>(this));
+      }
+
+      std::shared_ptr<CSampleDefragmentation> defrag = std::move(m_defrag_pool.back());
+      m_defrag_pool.pop_back();
+      return(defrag);
+    }
+
+    void CSampleReceiver::ReleaseDefragmentation(std::shared_ptr<CSampleDefragmentation>&& defrag_)
+    {
+      if (!defrag_) return;
+
+      // count messages that could not be reassembled
+      if (defrag_->HasAborted()) g_incomplete_messages++;
+
+      if (m_defrag_pool.size() < NET_UDP_RECBUFFER_POOL_SIZE)
+      {
+        defrag_->Reset();
+        m_defrag_pool.push_back(std::move(defrag_));
+      }
+      defrag_.reset();
     }
 
     void CSampleReceiver::Process(const char* sample_buffer_, size_t sample_buffer_len_)
@@ -244,8 +320,14 @@ namespace eCAL
 
         if (m_has_sample_callback(sample_name))
         {
+          const size_t payload_offset = sizeof(sample_name_size) + sample_name_size;
+          if (payload_offset > static_cast<size_t>(ecal_message->header.len)) return;
+
+          // raw sample, no protobuf parsing needed
+          if (ApplyRawSample(sample_name, ecal_message->payload + payload_offset, static_cast<size_t>(ecal_message->header.len) - payload_offset)) return;
+
           // read sample
-          if (!m_ecal_sample.ParseFromArray(ecal_message->payload + static_cast<size_t>(sizeof(sample_name_size) + sample_name_size), static_cast<int>(static_cast<size_t>(ecal_message->header.len) - (sizeof(sample_name_size) + sample_name_size)))) return;
+          if (!m_ecal_sample.ParseFromArray(ecal_message->payload + payload_offset, static_cast<int>(static_cast<size_t>(ecal_message->header.len) - payload_offset))) return;
 
 #ifndef NDEBUG
           // log it
@@ -301,10 +383,15 @@ namespace eCAL
       // so we have to wait for the first payload package :-(
       case IO::UDP::msg_type_header:
       {
-        // create new receive defragmentation buffer
-        std::shared_ptr<CSampleDefragmentation> receive_defragmentation_buf(nullptr);
-        receive_defragmentation_buf = std::make_shared<CSampleDefragmentation>(CSampleDefragmentation(this));
-        m_defrag_sample_map[ecal_message->header.id] = receive_defragmentation_buf;
+        // get a (pooled) receive defragmentation buffer
+        std::shared_ptr<CSampleDefragmentation>& receive_defragmentation_buf = m_defrag_sample_map[ecal_message->header.id];
+        if (receive_defragmentation_buf)
+        {
+          // a message with the same id was still in progress, it will never be completed
+          if (!receive_defragmentation_buf->HasFinished()) g_incomplete_messages++;
+          ReleaseDefragmentation(std::move(receive_defragmentation_buf));
+        }
+        receive_defragmentation_buf = AcquireDefragmentation();
         // apply message
         receive_defragmentation_buf->ApplyMessage(*ecal_message);
       }
@@ -332,6 +419,7 @@ namespace eCAL
               // log timeouted defragmentation buffers
               eCAL::Logging::Log(log_level_debug3, "CUDPSampleReceiver::Receive - DISCARD PACKAGE FOR TOPIC: " + sample_name);
 #endif
+              ReleaseDefragmentation(std::move(riter->second));
               m_defrag_sample_map.erase(riter);
               break;
             }
@@ -350,7 +438,10 @@ namespace eCAL
       default:
         break;
       }
+    }
 
+    void CSampleReceiver::CleanupDefragmentation()
+    {
       // cleanup finished or zombie received defragmentation buffers
       auto diff_time = std::chrono::steady_clock::now() - m_cleanup_start;
       const std::chrono::duration<double> step_time = std::chrono::milliseconds(NET_UDP_RECBUFFER_CLEANUP);
@@ -368,6 +459,8 @@ namespace eCAL
             const int32_t total_len = riter->second->GetMessageTotalLength();
             const int32_t current_len = riter->second->GetMessageCurrentLength();
 #endif
+            if (timeouted && !finished) g_reassembly_timeouts++;
+            ReleaseDefragmentation(std::move(riter->second));
             riter = m_defrag_sample_map.erase(riter);
 #ifndef NDEBUG
             // log timeouted defragmentation buffer
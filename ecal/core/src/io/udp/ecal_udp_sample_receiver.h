@@ -48,13 +48,25 @@ namespace eCAL
 {
   namespace UDP
   {
+    struct SReceiveStatistics
+    {
+      unsigned long long socket_drops        = 0;  // datagrams dropped by the sockets (receive buffer overflow)
+      unsigned long long incomplete_messages = 0;  // fragmented messages with missing or out of order fragments
+      unsigned long long reassembly_timeouts = 0;  // fragmented messages discarded after NET_UDP_RECBUFFER_TIMEOUT
+    };
+
+    // accumulated statistics of all sample receivers of this process
+    SReceiveStatistics GetReceiveStatistics();
+
     class CSampleReceiver
     {
     public:
       using HasSampleCallbackT   = std::function<bool(const std::string& sample_name_)>;
       using ApplySampleCallbackT = std::function<void(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_)>;
+      // raw samples start with a binary sample header instead of a protobuf sample
+      using ApplyRawSampleCallbackT = std::function<void(const std::string& sample_name_, const char* buf_, size_t len_)>;
 
-      CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_);
+      CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_, ApplyRawSampleCallbackT apply_raw_sample_callback_ = nullptr);
       virtual ~CSampleReceiver();
 
       bool AddMultiCastGroup(const char* ipaddr_);
@@ -63,16 +75,24 @@ namespace eCAL
     protected:
       void ReceiveThread();
       void Process(const char* sample_buffer_, size_t sample_buffer_len_);
+      void CleanupDefragmentation();
+      bool ApplyRawSample(const std::string& sample_name_, const char* buf_, size_t len_);
 
       HasSampleCallbackT                      m_has_sample_callback;
       ApplySampleCallbackT                    m_apply_sample_callback;
+      ApplyRawSampleCallbackT                 m_apply_raw_sample_callback;
 
       IO::UDP::CUDPReceiver                   m_udp_receiver;
       std::shared_ptr<eCAL::CCallbackThread>  m_udp_receiver_thread;
 
+      // NET_UDP_RECEIVE_BATCH receive buffers of MSG_BUFFER_SIZE in one contiguous block
       std::vector<char>                       m_msg_buffer;
+      std::vector<char*>                      m_msg_buffer_ptr;
+      std::vector<size_t>                     m_msg_buffer_len;
       eCAL::pb::Sample                        m_ecal_sample;
 
+      unsigned long long                      m_socket_drops;
+
       std::chrono::steady_clock::time_point   m_cleanup_start;
 
       class CSampleDefragmentation : public IO::UDP::CMsgDefragmentation
@@ -88,6 +108,12 @@ namespace eCAL
         eCAL::pb::Sample m_ecal_sample;
       };
 
+      std::shared_ptr<CSampleDefragmentation> AcquireDefragmentation();
+      void ReleaseDefragmentation(std::shared_ptr<CSampleDefragmentation>&& defrag_);
+
+      // finished defragmentation objects are reused (with their receive buffers) for the next messages
+      std::vector<std::shared_ptr<CSampleDefragmentation>> m_defrag_pool;
+
       using SampleDefragmentationMapT = std::unordered_map<int32_t, std::shared_ptr<CSampleDefragmentation>>;
       SampleDefragmentationMapT               m_defrag_sample_map;
     };
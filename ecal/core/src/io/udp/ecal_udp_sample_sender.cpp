@@ -25,6 +25,7 @@
 #include "io/udp/fragmentation/snd_fragments.h"
 
 #include <cstddef>
+#include <cstring>
 #include <ecal/ecal_log.h>
 #include <functional>
 #include <memory>
@@ -33,9 +34,9 @@
 
 namespace
 {
-  size_t TransmitToUDP(const void* buf_, const size_t len_, const std::shared_ptr<IO::UDP::CUDPSender>& sample_sender_, const std::string& mcast_address_)
+  size_t TransmitToUDP(const IO::UDP::SSendBuffer* buffers_, const size_t count_, const std::shared_ptr<IO::UDP::CUDPSender>& sample_sender_, const std::string& mcast_address_)
   {
-    return (sample_sender_->Send(buf_, len_, mcast_address_.c_str()));
+    return (sample_sender_->Send(buffers_, count_, mcast_address_.c_str()));
   }
 }
 
@@ -59,8 +60,9 @@ namespace eCAL
       const size_t data_size = IO::UDP::CreateSampleBuffer(sample_name_, ecal_sample_, m_payload);
       if (data_size > 0)
       {
-        // and send it
-        sent_sum = SendFragmentedMessage(m_payload.data(), data_size, bandwidth_, std::bind(TransmitToUDP, std::placeholders::_1, std::placeholders::_2, m_udp_sender, m_attr.address));
+        // and send it (all fragments at once, as far as the bandwidth limitation allows)
+        m_pacer.SetBandwidth(bandwidth_);
+        sent_sum = SendFragmentedMessageBatch(m_payload.data(), data_size, m_pacer, std::bind(TransmitToUDP, std::placeholders::_1, std::placeholders::_2, m_udp_sender, m_attr.address));
 
 #ifndef NDEBUG
         // log it
@@ -71,5 +73,30 @@ namespace eCAL
       // return bytes sent
       return(sent_sum);
     }
+
+    size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& sample_header_, const void* payload_, size_t payload_len_, long bandwidth_)
+    {
+      if (!m_udp_sender) return(0);
+
+      std::lock_guard<std::mutex> const send_lock(m_payload_mutex);
+
+      // message prefix: sample name size, sample name, sample header
+      const unsigned short sample_name_size = static_cast<unsigned short>(sample_name_.size() + 1);
+      m_prefix.resize(sizeof(sample_name_size) + sample_name_size + sample_header_.size());
+      memcpy(m_prefix.data(), &sample_name_size, sizeof(sample_name_size));
+      memcpy(m_prefix.data() + sizeof(sample_name_size), sample_name_.c_str(), sample_name_size);
+      memcpy(m_prefix.data() + sizeof(sample_name_size) + sample_name_size, sample_header_.data(), sample_header_.size());
+
+      m_pacer.SetBandwidth(bandwidth_);
+      const size_t sent_sum = SendFragmentedMessageBatch(m_prefix.data(), m_prefix.size(), static_cast<const char*>(payload_), payload_len_, m_pacer, std::bind(TransmitToUDP, std::placeholders::_1, std::placeholders::_2, m_udp_sender, m_attr.address));
+
+#ifndef NDEBUG
+      // log it
+      eCAL::Logging::Log(log_level_debug4, "UDP Raw Sample Sent (" + std::to_string(sent_sum) + " Bytes)");
+#endif
+
+      // return bytes sent
+      return(sent_sum);
+    }
   }
 }
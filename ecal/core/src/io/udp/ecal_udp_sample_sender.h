@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "io/udp/fragmentation/snd_token_bucket.h"
 #include "io/udp/sendreceive/udp_sender.h"
 #include <cstddef>
 #include <string>
@@ -49,12 +50,17 @@ namespace eCAL
       CSampleSender(const IO::UDP::SSenderAttr& attr_);
       size_t Send(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, long bandwidth_);
 
+      // send a raw sample (binary sample header + payload), the payload is gathered without copying it
+      size_t Send(const std::string& sample_name_, const std::vector<char>& sample_header_, const void* payload_, size_t payload_len_, long bandwidth_);
+
     private:
       IO::UDP::SSenderAttr                 m_attr;
       std::shared_ptr<IO::UDP::CUDPSender> m_udp_sender;
+      IO::UDP::CTokenBucket                m_pacer;
 
       std::mutex                           m_payload_mutex;
       std::vector<char>                    m_payload;
+      std::vector<char>                    m_prefix;
     };
   }
 }
@@ -49,6 +49,18 @@ namespace IO
 
     CMsgDefragmentation::~CMsgDefragmentation() = default;
 
+    void CMsgDefragmentation::Reset()
+    {
+      m_timeout           = std::chrono::duration<double>(0.0);
+      m_recv_mode         = rcm_waiting;
+      m_message_id        = 0;
+      m_message_total_num = 0;
+      m_message_total_len = 0;
+      m_message_curr_num  = 0;
+      m_message_curr_len  = 0;
+      m_recv_buffer.clear();
+    }
+
     int CMsgDefragmentation::ApplyMessage(const struct SUDPMessage& ecal_message_)
     {
       // reset timeout
@@ -91,7 +103,8 @@ namespace IO
       m_message_curr_num = 0;
       m_message_curr_len = 0;
 
-      // prepare receive buffer
+      // prepare receive buffer (a reused buffer keeps its capacity)
+      m_recv_buffer.clear();
       m_recv_buffer.reserve(static_cast<size_t>(m_message_total_len));
 
       // switch to reading mode
@@ -41,7 +41,12 @@ namespace IO
 
       int ApplyMessage(const struct SUDPMessage& ecal_message_);
 
+      // reset to waiting state, the receive buffer keeps its capacity for the next message
+      void Reset();
+
       bool HasFinished() { return((m_recv_mode == rcm_aborted) || (m_recv_mode == rcm_completed)); };
+      bool HasAborted() const   { return(m_recv_mode == rcm_aborted); };
+      bool HasCompleted() const { return(m_recv_mode == rcm_completed); };
       bool HasTimedOut(const std::chrono::duration<double>& diff_time_) { m_timeout += diff_time_; return(m_timeout >= std::chrono::milliseconds(NET_UDP_RECBUFFER_TIMEOUT)); };
 
       int32_t GetMessageTotalLength() const   { return(m_message_total_len); };
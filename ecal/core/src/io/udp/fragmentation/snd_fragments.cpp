@@ -22,15 +22,16 @@
 **/
 
 #include "snd_fragments.h"
+#include "snd_token_bucket.h"
 #include "msg_type.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <mutex>
 #include <string>
-#include <thread>
 #include <vector>
 
 namespace
@@ -50,6 +51,21 @@ namespace
 
     return z;
   }
+
+  // create random number for message id
+  int32_t CreateMessageId()
+  {
+    static std::mutex xorshf96_mtx;
+    const std::lock_guard<std::mutex> lock(xorshf96_mtx);
+
+    static unsigned long x = static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::high_resolution_clock::now().time_since_epoch()).count()
+      );
+    static unsigned long y = 362436069;
+    static unsigned long z = 521288629;
+
+    return static_cast<int32_t>(xorshf96(x, y, z));
+  }
 }
 
 namespace IO
@@ -123,32 +139,13 @@ namespace IO
       break;
       default:
       {
-        // calculate bandwidth timing parameter
-        long long send_sleep_us(0);
-        if (bandwidth_ > 0)
-        {
-          send_sleep_us = MSG_BUFFER_SIZE;
-          send_sleep_us *= 1000 * 1000;
-          send_sleep_us /= bandwidth_;
-        }
+        // bandwidth limitation
+        CTokenBucket pacer;
+        pacer.SetBandwidth(bandwidth_);
 
         // create start package
         msg_header.type = msg_type_header;
-        {
-          // create random number for message id
-          {
-            static std::mutex xorshf96_mtx;
-            const std::lock_guard<std::mutex> lock(xorshf96_mtx);
-
-            static unsigned long x = static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
-              std::chrono::high_resolution_clock::now().time_since_epoch()).count()
-              );
-            static unsigned long y = 362436069;
-            static unsigned long z = 521288629;
-
-            msg_header.id = xorshf96(x, y, z);
-          }
-        }
+        msg_header.id   = CreateMessageId();
         msg_header.num = total_packet_num;
         msg_header.len = int32_t(buf_len_);
 
@@ -183,13 +180,9 @@ namespace IO
             memcpy(buf_ + static_cast<size_t>(current_packet_num) * MSG_PAYLOAD_SIZE, &msg_header, sizeof(struct SUDPMessageHead));
 
             // send data package
+            pacer.Consume(sizeof(struct SUDPMessageHead) + current_snd_len);
             sent = transmit_cb_(buf_ + static_cast<size_t>(current_packet_num) * MSG_PAYLOAD_SIZE, sizeof(struct SUDPMessageHead) + current_snd_len);
             if (sent == 0) return(sent);
-            if (send_sleep_us != 0)
-            {
-              auto start = std::chrono::steady_clock::now();
-              std::this_thread::sleep_until(start + std::chrono::microseconds(send_sleep_us));
-            }
 
 #ifndef NDEBUG
             // log it
@@ -204,5 +197,123 @@ namespace IO
 
       return(sent_sum);
     }
+
+    size_t SendFragmentedMessageBatch(char* buf_, size_t buf_len_, CTokenBucket& pacer_, const TransmitBatchCallbackT& transmit_cb_)
+    {
+      if (buf_ == nullptr) return(0);
+
+      // the reserved header space in front of the payload is not needed, headers are gathered
+      return(SendFragmentedMessageBatch(nullptr, 0, buf_ + sizeof(struct SUDPMessageHead), buf_len_, pacer_, transmit_cb_));
+    }
+
+    size_t SendFragmentedMessageBatch(const char* prefix_, size_t prefix_len_, const char* payload_, size_t payload_len_, CTokenBucket& pacer_, const TransmitBatchCallbackT& transmit_cb_)
+    {
+      if ((prefix_ == nullptr) && (prefix_len_ > 0)) return(0);
+      if ((payload_ == nullptr) && (payload_len_ > 0)) return(0);
+      if (prefix_len_ > MSG_PAYLOAD_SIZE) return(0);
+
+      const size_t msg_len = prefix_len_ + payload_len_;
+      int32_t total_packet_num = int32_t(msg_len / MSG_PAYLOAD_SIZE);
+      if (msg_len % MSG_PAYLOAD_SIZE) total_packet_num++;
+
+      // every fragment gets its own header (gathered with the payload, the payload buffer is not touched),
+      // the prefix is appended to the header of the first data package
+      thread_local std::vector<SUDPMessageHead> msg_headers;
+      thread_local std::vector<char>            first_head;
+      thread_local std::vector<SSendBuffer>     buffers;
+
+      first_head.resize(sizeof(struct SUDPMessageHead) + prefix_len_);
+      if (prefix_len_ > 0) memcpy(first_head.data() + sizeof(struct SUDPMessageHead), prefix_, prefix_len_);
+
+      // single header + data package
+      if (total_packet_num <= 1)
+      {
+        struct SUDPMessageHead msg_header;
+        msg_header.type = msg_type_header_with_content;
+        msg_header.id   = -1;  // not needed for combined header / data message
+        msg_header.num  = 1;
+        msg_header.len  = int32_t(msg_len);
+        memcpy(first_head.data(), &msg_header, sizeof(struct SUDPMessageHead));
+
+        SSendBuffer buffer;
+        buffer.head     = first_head.data();
+        buffer.head_len = first_head.size();
+        buffer.data     = payload_;
+        buffer.data_len = payload_len_;
+
+        pacer_.Consume(buffer.head_len + buffer.data_len);
+        return(transmit_cb_(&buffer, 1));
+      }
+
+      msg_headers.resize(static_cast<size_t>(total_packet_num) + 1);
+      buffers.resize(static_cast<size_t>(total_packet_num) + 1);
+
+      // start package
+      msg_headers[0].type = msg_type_header;
+      msg_headers[0].id   = CreateMessageId();
+      msg_headers[0].num  = total_packet_num;
+      msg_headers[0].len  = int32_t(msg_len);
+      buffers[0].head     = &msg_headers[0];
+      buffers[0].head_len = sizeof(struct SUDPMessageHead);
+      buffers[0].data     = nullptr;
+      buffers[0].data_len = 0;
+
+      // data packages
+      for (int32_t current_packet_num = 0; current_packet_num < total_packet_num; current_packet_num++)
+      {
+        const size_t offset          = static_cast<size_t>(current_packet_num) * MSG_PAYLOAD_SIZE;
+        const size_t current_snd_len = std::min(msg_len - offset, static_cast<size_t>(MSG_PAYLOAD_SIZE));
+
+        SUDPMessageHead& msg_header = msg_headers[static_cast<size_t>(current_packet_num) + 1];
+        msg_header.type = msg_type_content;
+        msg_header.id   = msg_headers[0].id;
+        msg_header.num  = current_packet_num;
+        msg_header.len  = int32_t(current_snd_len);
+
+        SSendBuffer& buffer = buffers[static_cast<size_t>(current_packet_num) + 1];
+        if (current_packet_num == 0)
+        {
+          memcpy(first_head.data(), &msg_header, sizeof(struct SUDPMessageHead));
+          buffer.head     = first_head.data();
+          buffer.head_len = first_head.size();
+          buffer.data     = payload_;
+          buffer.data_len = current_snd_len - prefix_len_;
+        }
+        else
+        {
+          buffer.head     = &msg_header;
+          buffer.head_len = sizeof(struct SUDPMessageHead);
+          buffer.data     = payload_ + (offset - prefix_len_);
+          buffer.data_len = current_snd_len;
+        }
+      }
+
+      // send as many packages at once as the bandwidth limitation allows, at least one
+      size_t sent_sum(0);
+      size_t packet_idx(0);
+      while (packet_idx < buffers.size())
+      {
+        const size_t available = pacer_.Available();
+        size_t batch_num(0);
+        size_t batch_len(0);
+        while (packet_idx + batch_num < buffers.size())
+        {
+          const SSendBuffer& buffer = buffers[packet_idx + batch_num];
+          const size_t       len    = buffer.head_len + buffer.data_len;
+          if ((batch_num > 0) && (batch_len + len > available)) break;
+          batch_len += len;
+          batch_num++;
+        }
+
+        pacer_.Consume(batch_len);
+        const size_t sent = transmit_cb_(&buffers[packet_idx], batch_num);
+        if (sent != batch_len) return(0);
+
+        sent_sum   += sent;
+        packet_idx += batch_num;
+      }
+
+      return(sent_sum);
+    }
   }
 }
@@ -21,6 +21,10 @@
  * @brief  raw message buffer handling
 **/
 
+#pragma once
+
+#include "io/udp/sendreceive/udp_sender.h"
+
 #include <cstddef>
 #include <functional>
 #include <string>
@@ -42,5 +46,34 @@ namespace IO
 
     using TransmitCallbackT = std::function<size_t(const void*, const size_t)>;
     size_t SendFragmentedMessage(char* buf_, size_t buf_len_, long bandwidth_, const TransmitCallbackT& transmit_cb_);
+
+    class CTokenBucket;
+    using TransmitBatchCallbackT = std::function<size_t(const SSendBuffer*, const size_t)>;
+
+    /**
+     * @brief Send a message in fragments, handing over as many fragments as possible to one transmit call.
+     *
+     * @param buf_          Message buffer, starting with space reserved for one SUDPMessageHead.
+     * @param buf_len_      Message size (without the reserved header space).
+     * @param pacer_        Bandwidth limitation, shared by all messages of a sender.
+     * @param transmit_cb_  Transmit function sending multiple datagrams, returns the number of bytes sent.
+     *
+     * @return  Number of bytes sent, 0 on failure.
+    **/
+    size_t SendFragmentedMessageBatch(char* buf_, size_t buf_len_, CTokenBucket& pacer_, const TransmitBatchCallbackT& transmit_cb_);
+
+    /**
+     * @brief Send a message, made of a small prefix and a payload, in fragments without copying the payload.
+     *
+     * @param prefix_       Message prefix (sample name, sample header).
+     * @param prefix_len_   Prefix size, has to fit into the first fragment.
+     * @param payload_      Message payload.
+     * @param payload_len_  Payload size.
+     * @param pacer_        Bandwidth limitation, shared by all messages of a sender.
+     * @param transmit_cb_  Transmit function sending multiple datagrams, returns the number of bytes sent.
+     *
+     * @return  Number of bytes sent, 0 on failure.
+    **/
+    size_t SendFragmentedMessageBatch(const char* prefix_, size_t prefix_len_, const char* payload_, size_t payload_len_, CTokenBucket& pacer_, const TransmitBatchCallbackT& transmit_cb_);
   }
 }
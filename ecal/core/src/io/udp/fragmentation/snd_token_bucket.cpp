@@ -0,0 +1,91 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  token bucket bandwidth limitation for fragmented messages
+**/
+
+#include "snd_token_bucket.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+  // minimum burst size, one maximum sized datagram has to fit into the bucket
+  const double min_burst_bytes = 64.0 * 1024.0;
+  // the bucket holds the tokens of this time span
+  const double burst_time_s    = 0.01;
+}
+
+namespace IO
+{
+  namespace UDP
+  {
+    CTokenBucket::CTokenBucket() :
+      m_bandwidth(0),
+      m_burst(0.0),
+      m_tokens(0.0),
+      m_last_refill(std::chrono::steady_clock::now())
+    {
+    }
+
+    void CTokenBucket::SetBandwidth(long bandwidth_)
+    {
+      if (bandwidth_ == m_bandwidth) return;
+
+      m_bandwidth   = bandwidth_;
+      m_burst       = std::max(min_burst_bytes, static_cast<double>(bandwidth_) * burst_time_s);
+      m_tokens      = m_burst;
+      m_last_refill = std::chrono::steady_clock::now();
+    }
+
+    size_t CTokenBucket::Available()
+    {
+      if (m_bandwidth <= 0) return(static_cast<size_t>(-1));
+
+      Refill();
+      return(m_tokens > 0.0 ? static_cast<size_t>(m_tokens) : 0);
+    }
+
+    void CTokenBucket::Consume(size_t bytes_)
+    {
+      if (m_bandwidth <= 0) return;
+
+      Refill();
+      m_tokens -= static_cast<double>(bytes_);
+
+      // wait until the deficit is refilled
+      if (m_tokens < 0.0)
+      {
+        const auto wait_time = std::chrono::duration<double>(-m_tokens / static_cast<double>(m_bandwidth));
+        std::this_thread::sleep_for(std::chrono::duration_cast<std::chrono::microseconds>(wait_time));
+      }
+    }
+
+    void CTokenBucket::Refill()
+    {
+      const auto now     = std::chrono::steady_clock::now();
+      const auto elapsed = std::chrono::duration<double>(now - m_last_refill).count();
+      m_last_refill = now;
+
+      m_tokens = std::min(m_burst, m_tokens + elapsed * static_cast<double>(m_bandwidth));
+    }
+  }
+}
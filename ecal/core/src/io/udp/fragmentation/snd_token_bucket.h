@@ -0,0 +1,74 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  token bucket bandwidth limitation for fragmented messages
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace IO
+{
+  namespace UDP
+  {
+    /**
+     * @brief Token bucket pacer limiting the send rate to a given bandwidth.
+     *
+     * Tokens (bytes) are refilled continuously with the configured rate up to a small burst size.
+     * Consuming more tokens than available blocks until the deficit is refilled, so the long-term rate
+     * stays exact independent of the number and size of the sent datagrams.
+    **/
+    class CTokenBucket
+    {
+    public:
+      CTokenBucket();
+
+      /**
+       * @brief Set the bandwidth limit.
+       *
+       * @param bandwidth_  Bandwidth in bytes/s, <= 0 means no limitation.
+      **/
+      void SetBandwidth(long bandwidth_);
+      long GetBandwidth() const { return(m_bandwidth); };
+
+      /**
+       * @brief Number of bytes that can be sent without waiting.
+      **/
+      size_t Available();
+
+      /**
+       * @brief Take tokens for bytes to send, blocks until the rate allows sending them.
+       *
+       * @param bytes_  Number of bytes to send.
+      **/
+      void Consume(size_t bytes_);
+
+    protected:
+      void Refill();
+
+      long                                   m_bandwidth;
+      double                                 m_burst;
+      double                                 m_tokens;
+      std::chrono::steady_clock::time_point  m_last_refill;
+    };
+  }
+}
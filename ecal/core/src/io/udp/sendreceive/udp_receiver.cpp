@@ -38,6 +38,17 @@ namespace IO
 {
   namespace UDP
   {
+    ////////////////////////////////////////////////////////
+    // udp receiver implementation base class
+    ////////////////////////////////////////////////////////
+    size_t CUDPReceiverImpl::ReceiveBatch(char* const* bufs_, size_t buf_len_, size_t* lens_, size_t count_, int timeout_)
+    {
+      if (count_ == 0) return(0);
+
+      lens_[0] = Receive(bufs_[0], buf_len_, timeout_);
+      return((lens_[0] > 0) ? 1 : 0);
+    }
+
     ////////////////////////////////////////////////////////
     // udp receiver class
     ////////////////////////////////////////////////////////
@@ -103,5 +114,21 @@ namespace IO
       const std::lock_guard<std::mutex> lock(m_socket_mtx);
       return(m_socket_impl->Receive(buf_, len_, timeout_, address_));
     }
+
+    size_t CUDPReceiver::ReceiveBatch(char* const* bufs_, size_t buf_len_, size_t* lens_, size_t count_, int timeout_)
+    {
+      if (!m_socket_impl) return(0);
+
+      const std::lock_guard<std::mutex> lock(m_socket_mtx);
+      return(m_socket_impl->ReceiveBatch(bufs_, buf_len_, lens_, count_, timeout_));
+    }
+
+    unsigned long long CUDPReceiver::GetSocketDrops()
+    {
+      if (!m_socket_impl) return(0);
+
+      const std::lock_guard<std::mutex> lock(m_socket_mtx);
+      return(m_socket_impl->GetSocketDrops());
+    }
   }
 }
@@ -70,6 +70,12 @@ namespace IO
       virtual bool RemMultiCastGroup(const char* ipaddr_) = 0;
 
       virtual size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_ = nullptr) = 0;
+
+      // receive up to count_ datagrams with one call, default implementation receives a single datagram
+      virtual size_t ReceiveBatch(char* const* bufs_, size_t buf_len_, size_t* lens_, size_t count_, int timeout_);
+
+      // number of datagrams dropped by the socket (receive buffer overflow), if supported by the platform
+      virtual unsigned long long GetSocketDrops() { return(0); };
     };
 
     class CUDPReceiver
@@ -85,6 +91,21 @@ namespace IO
 
       size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_ = nullptr);
 
+      /**
+       * @brief Receive multiple datagrams at once (recvmmsg on linux).
+       *
+       * @param bufs_      Receive buffers.
+       * @param buf_len_   Size of every receive buffer.
+       * @param lens_      Sizes of the received datagrams.
+       * @param count_     Number of receive buffers.
+       * @param timeout_   Maximum time to wait for the first datagram in ms.
+       *
+       * @return  Number of received datagrams.
+      **/
+      size_t ReceiveBatch(char* const* bufs_, size_t buf_len_, size_t* lens_, size_t count_, int timeout_);
+
+      unsigned long long GetSocketDrops();
+
     protected:
       bool m_use_npcap;
       std::mutex                        m_socket_mtx;
@@ -26,6 +26,8 @@
 
 #ifdef __linux__
 #include "linux/socket_os.h"
+#include <cerrno>
+#include <poll.h>
 #endif
 
 #include <iostream>
@@ -42,6 +44,9 @@ namespace IO
       m_created(false),
       m_broadcast(attr_.broadcast),
       m_socket(m_iocontext)
+#ifdef __linux__
+      , m_socket_drops(0)
+#endif
     {
       // create socket
       const asio::ip::udp::endpoint listen_endpoint(asio::ip::udp::v4(), static_cast<unsigned short>(attr_.port));
@@ -100,6 +105,17 @@ namespace IO
         }
       }
 
+#ifdef __linux__
+      // let the kernel report the number of dropped datagrams (receive buffer overflow)
+      {
+        const int rxq_ovfl = 1;
+        if (setsockopt(m_socket.native_handle(), SOL_SOCKET, SO_RXQ_OVFL, &rxq_ovfl, sizeof(rxq_ovfl)) != 0)
+        {
+          std::cerr << "CUDPReceiverAsio: Unable to enable drop counter: " << strerror(errno) << std::endl;
+        }
+      }
+#endif
+
       // join multicast group
       AddMultiCastGroup(attr_.address.c_str());
 
@@ -209,6 +225,70 @@ namespace IO
       return (reclen);
     }
 
+#ifdef __linux__
+    size_t CUDPReceiverAsio::ReceiveBatch(char* const* bufs_, size_t buf_len_, size_t* lens_, size_t count_, int timeout_)
+    {
+      if (!m_created) return 0;
+      if (count_ == 0) return 0;
+
+      const int fd = m_socket.native_handle();
+
+      // wait for the first datagram
+      struct pollfd pfd;
+      pfd.fd      = fd;
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+      if (poll(&pfd, 1, timeout_) <= 0) return 0;
+
+      // one control buffer per datagram for the drop counter
+      const size_t control_len = CMSG_SPACE(sizeof(uint32_t));
+      if (m_mmsg_vec.size() < count_)
+      {
+        m_mmsg_vec.resize(count_);
+        m_iovec_vec.resize(count_);
+        m_control_vec.resize(count_ * control_len);
+      }
+
+      for (size_t i = 0; i < count_; ++i)
+      {
+        m_iovec_vec[i].iov_base = bufs_[i];
+        m_iovec_vec[i].iov_len  = buf_len_;
+
+        struct msghdr& hdr = m_mmsg_vec[i].msg_hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_iov        = &m_iovec_vec[i];
+        hdr.msg_iovlen     = 1;
+        hdr.msg_control    = &m_control_vec[i * control_len];
+        hdr.msg_controllen = control_len;
+        m_mmsg_vec[i].msg_len = 0;
+      }
+
+      // fetch everything that is already queued, but do not block again
+      const int received = recvmmsg(fd, m_mmsg_vec.data(), static_cast<unsigned int>(count_), MSG_DONTWAIT, nullptr);
+      if (received <= 0) return 0;
+
+      for (int i = 0; i < received; ++i)
+      {
+        lens_[i] = m_mmsg_vec[i].msg_len;
+
+        // the kernel passes the total number of drops of the socket with every datagram
+        // (drops are reported with the first datagram queued after them)
+        struct msghdr& hdr = m_mmsg_vec[i].msg_hdr;
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+        {
+          if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_RXQ_OVFL))
+          {
+            uint32_t drops(0);
+            memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+            m_socket_drops = drops;
+          }
+        }
+      }
+
+      return static_cast<size_t>(received);
+    }
+#endif
+
     void CUDPReceiverAsio::RunIOContext(const asio::chrono::steady_clock::duration& timeout)
     {
       // restart the io_context, as it may have been left in the "stopped" state by a previous operation
@@ -21,6 +21,12 @@
 
 #include "udp_receiver.h"
 #include <cstddef>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -48,6 +54,11 @@ namespace IO
 
       size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_ = nullptr) override;
 
+#ifdef __linux__
+      size_t ReceiveBatch(char* const* bufs_, size_t buf_len_, size_t* lens_, size_t count_, int timeout_) override;
+      unsigned long long GetSocketDrops() override { return(m_socket_drops); };
+#endif
+
     protected:
       void RunIOContext(const asio::chrono::steady_clock::duration& timeout);
 
@@ -56,6 +67,13 @@ namespace IO
       asio::io_context        m_iocontext;
       asio::ip::udp::socket   m_socket;
       asio::ip::udp::endpoint m_sender_endpoint;
+
+#ifdef __linux__
+      std::vector<struct mmsghdr> m_mmsg_vec;
+      std::vector<struct iovec>   m_iovec_vec;
+      std::vector<char>           m_control_vec;
+      unsigned long long          m_socket_drops;
+#endif
     };
   }
 }
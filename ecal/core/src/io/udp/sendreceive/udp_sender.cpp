@@ -23,9 +23,18 @@
 
 #include "udp_sender.h"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <iostream>
 #include <memory>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/uio.h>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -48,6 +57,7 @@ namespace IO
     public:
       CUDPSenderImpl(const SSenderAttr& attr_);
       size_t Send(const void* buf_, size_t len_, const char* ipaddr_ = nullptr);
+      size_t Send(const SSendBuffer* buffers_, size_t count_, const char* ipaddr_ = nullptr);
 
     protected:
       bool                    m_broadcast;
@@ -55,6 +65,11 @@ namespace IO
       asio::ip::udp::endpoint m_endpoint;
       asio::ip::udp::socket   m_socket;
       unsigned short          m_port;
+
+#ifdef __linux__
+      std::vector<struct mmsghdr> m_mmsg_vec;
+      std::vector<struct iovec>   m_iovec_vec;
+#endif
     };
 
     CUDPSenderImpl::CUDPSenderImpl(const SSenderAttr& attr_) :
@@ -117,6 +132,66 @@ namespace IO
       return(sent);
     }
 
+    size_t CUDPSenderImpl::Send(const SSendBuffer* buffers_, const size_t count_, const char* ipaddr_)
+    {
+      if ((buffers_ == nullptr) || (count_ == 0)) return(0);
+
+      asio::ip::udp::endpoint endpoint(m_endpoint);
+      if ((ipaddr_ != nullptr) && (ipaddr_[0] != '\0')) endpoint = asio::ip::udp::endpoint(asio::ip::make_address(ipaddr_), m_port);
+
+      size_t sent(0);
+#ifdef __linux__
+      // gather header and payload of every datagram, send all of them with one system call
+      m_mmsg_vec.resize(count_);
+      m_iovec_vec.resize(2 * count_);
+      for (size_t i = 0; i < count_; ++i)
+      {
+        struct iovec* iov = &m_iovec_vec[2 * i];
+        iov[0].iov_base = const_cast<void*>(buffers_[i].head);
+        iov[0].iov_len  = buffers_[i].head_len;
+        iov[1].iov_base = const_cast<void*>(buffers_[i].data);
+        iov[1].iov_len  = buffers_[i].data_len;
+
+        struct mmsghdr& mmsg = m_mmsg_vec[i];
+        std::memset(&mmsg, 0, sizeof(mmsg));
+        mmsg.msg_hdr.msg_name    = endpoint.data();
+        mmsg.msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+        mmsg.msg_hdr.msg_iov     = iov;
+        mmsg.msg_hdr.msg_iovlen  = (buffers_[i].data_len > 0) ? 2 : 1;
+      }
+
+      size_t sent_num(0);
+      while (sent_num < count_)
+      {
+        const size_t batch_num = std::min(count_ - sent_num, static_cast<size_t>(UIO_MAXIOV));
+        const int    result    = sendmmsg(m_socket.native_handle(), &m_mmsg_vec[sent_num], static_cast<unsigned int>(batch_num), 0);
+        if (result < 0)
+        {
+          if (errno == EINTR) continue;
+          std::cout << "CUDPSender::Send failed with: \'" << std::strerror(errno) << "\'" << std::endl;
+          break;
+        }
+        for (int i = 0; i < result; ++i) sent += m_mmsg_vec[sent_num + static_cast<size_t>(i)].msg_len;
+        sent_num += static_cast<size_t>(result);
+      }
+#else
+      const asio::socket_base::message_flags flags(0);
+      for (size_t i = 0; i < count_; ++i)
+      {
+        const std::array<asio::const_buffer, 2> buffers = { asio::buffer(buffers_[i].head, buffers_[i].head_len), asio::buffer(buffers_[i].data, buffers_[i].data_len) };
+        asio::error_code ec;
+        const size_t datagram_sent = m_socket.send_to(buffers, endpoint, flags, ec);
+        if (ec)
+        {
+          std::cout << "CUDPSender::Send failed with: \'" << ec.message() << "\'" << std::endl;
+          break;
+        }
+        sent += datagram_sent;
+      }
+#endif
+      return(sent);
+    }
+
     ////////////////////////////////////////////////////////
     // udp sender class
     ////////////////////////////////////////////////////////
@@ -130,5 +205,11 @@ namespace IO
       if (!m_socket_impl) return(0);
       return(m_socket_impl->Send(buf_, len_, ipaddr_));
     }
+
+    size_t CUDPSender::Send(const SSendBuffer* buffers_, const size_t count_, const char* ipaddr_)
+    {
+      if (!m_socket_impl) return(0);
+      return(m_socket_impl->Send(buffers_, count_, ipaddr_));
+    }
   }
 }
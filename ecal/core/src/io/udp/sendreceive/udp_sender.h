@@ -53,6 +53,15 @@ namespace IO
       int         sndbuf    = 1024 * 1024;
     };
 
+    // one datagram, gathered from a header and a payload part
+    struct SSendBuffer
+    {
+      const void* head     = nullptr;
+      size_t      head_len = 0;
+      const void* data     = nullptr;
+      size_t      data_len = 0;
+    };
+
     class CUDPSenderImpl;
 
     class CUDPSender
@@ -61,6 +70,13 @@ namespace IO
       CUDPSender(const SSenderAttr& attr_);
       size_t Send(const void* buf_, size_t len_, const char* ipaddr_ = nullptr);
 
+      /**
+       * @brief Send multiple datagrams with as few system calls as possible (sendmmsg on linux).
+       *
+       * @return  Number of bytes sent, sending stops on the first failing datagram.
+      **/
+      size_t Send(const SSendBuffer* buffers_, size_t count_, const char* ipaddr_ = nullptr);
+
     protected:
       std::shared_ptr<CUDPSenderImpl> m_socket_impl;
     };
@@ -28,6 +28,7 @@
 #include "ecal_log_impl.h"
 #include "io/udp/ecal_udp_configurations.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <functional>
 #include <mutex>
@@ -39,6 +40,7 @@
 #include <iomanip>
 #include <ctime>
 #include <chrono>
+#include <thread>
 
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
@@ -101,10 +103,25 @@ static std::string get_time_str()
 }
 #endif
 
+namespace
+{
+  // distinguishes the thread log rings of successive Create calls
+  std::atomic<unsigned long long> g_log_generation(0);
+
+  // maximum time a log message stays in a thread log ring (asynchronous logging)
+  constexpr std::chrono::milliseconds log_flush_interval(10);
+}
+
 namespace eCAL
 {
   CLog::CLog() :
           m_created(false),
+          m_async(false),
+          m_queue_size(0),
+          m_overflow_block(false),
+          m_generation(0),
+          m_flush_requested(false),
+          m_flush_stop(false),
           m_pid(0),
           m_logfile(nullptr),
           m_level(log_level_none),
@@ -173,6 +190,18 @@ namespace eCAL
     const UDP::CLoggingReceiver::LogMessageCallbackT log_message_callback = std::bind(&CLog::RegisterLogMessage, this, std::placeholders::_1);
     m_log_receiver = std::make_shared<UDP::CLoggingReceiver>(attr, log_message_callback);
 
+    // start asynchronous logging
+    m_async          = Config::IsLogAsyncEnabled();
+    m_queue_size     = Config::GetLogQueueSize();
+    m_overflow_block = (Config::GetLogOverflowMode() == 1);
+    if(m_async)
+    {
+      m_generation      = ++g_log_generation;
+      m_flush_requested = false;
+      m_flush_stop      = false;
+      m_flush_thread    = std::thread(&CLog::FlushThread, this);
+    }
+
     m_created = true;
   }
 
@@ -180,112 +209,292 @@ namespace eCAL
   {
     if(!m_created) return;
 
+    // stop logging first, blocked logging threads give up
+    m_created = false;
+
+    // write the buffered log messages
+    if(m_flush_thread.joinable())
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_flush_sync);
+        m_flush_stop = true;
+      }
+      m_flush_cv.notify_one();
+      m_flush_thread.join();
+
+      const std::lock_guard<std::mutex> lock(m_rings_sync);
+      m_rings.clear();
+    }
+
     const std::lock_guard<std::mutex> lock(m_log_sync);
 
     m_udp_logging_sender.reset();
 
     if(m_logfile != nullptr) fclose(m_logfile);
     m_logfile = nullptr;
-
-    m_created = false;
   }
 
   void CLog::SetLogLevel(const eCAL_Logging_eLogLevel level_)
   {
-    const std::lock_guard<std::mutex> lock(m_log_sync);
     m_level = level_;
   }
 
   eCAL_Logging_eLogLevel CLog::GetLogLevel()
   {
-    const std::lock_guard<std::mutex> lock(m_log_sync);
     return(m_level);
   }
 
   void CLog::Log(const eCAL_Logging_eLogLevel level_, const std::string& msg_)
   {
-    const std::lock_guard<std::mutex> lock(m_log_sync);
-
     if(!m_created) return;
     if(msg_.empty()) return;
 
-    const eCAL_Logging_Filter log_con  = level_ & m_filter_mask_con;
-    const eCAL_Logging_Filter log_file = level_ & m_filter_mask_file;
-    const eCAL_Logging_Filter log_udp  = level_ & m_filter_mask_udp;
-    if((log_con | log_file | log_udp) == 0) return;
+    if((level_ & (m_filter_mask_con | m_filter_mask_file | m_filter_mask_udp)) == 0) return;
 
-    static eCAL::pb::LogMessage ecal_msg;
-    static std::string        ecal_msg_s;
-    auto                      log_time = eCAL::Time::ecal_clock::now();
+    if(m_async)
+    {
+      LogAsync(level_, msg_);
+      return;
+    }
 
-    if(log_con != 0)
+    const std::lock_guard<std::mutex> lock(m_log_sync);
+    if(!m_created) return;
+
+    const long long log_time = std::chrono::duration_cast<std::chrono::microseconds>(eCAL::Time::ecal_clock::now().time_since_epoch()).count();
+    WriteLogMessage(log_time, level_, msg_);
+  }
+
+  void CLog::WriteLogMessage(const long long time_, const eCAL_Logging_eLogLevel level_, const std::string& msg_)
+  {
+    if((level_ & m_filter_mask_con) != 0)
     {
       std::cout << msg_ << std::endl;
     }
 
-    if((log_file != 0) && (m_logfile != nullptr))
+    if(((level_ & m_filter_mask_file) != 0) && (m_logfile != nullptr))
+    {
+      FormatLogLine(m_log_line, time_, level_, msg_);
+      m_log_line.push_back('\n');
+
+      fwrite(m_log_line.data(), 1, m_log_line.size(), m_logfile);
+      fflush(m_logfile);
+    }
+
+    if(((level_ & m_filter_mask_udp) != 0) && m_udp_logging_sender)
+    {
+      FormatLogMessage(m_log_msg, time_, level_, msg_);
+      m_udp_logging_sender->Send(m_log_msg);
+    }
+  }
+
+  void CLog::FormatLogLine(std::string& line_, const long long time_, const eCAL_Logging_eLogLevel level_, const std::string& msg_) const
+  {
+    line_.clear();
+    line_ += std::to_string(time_ / 1000);
+    line_ += " ms";
+    line_ += " | ";
+    line_ += m_hname;
+    line_ += " | ";
+    line_ += eCAL::Process::GetUnitName();
+    line_ += " | ";
+    line_ += std::to_string(m_pid);
+    line_ += " | ";
+    switch(level_)
+    {
+    case log_level_none:
+    case log_level_all:
+      break;
+    case log_level_info:
+      line_ += "info";
+      break;
+    case log_level_warning:
+      line_ += "warning";
+      break;
+    case log_level_error:
+      line_ += "error";
+      break;
+    case log_level_fatal:
+      line_ += "fatal";
+      break;
+    case log_level_debug1:
+      line_ += "debug1";
+      break;
+    case log_level_debug2:
+      line_ += "debug2";
+      break;
+    case log_level_debug3:
+      line_ += "debug3";
+      break;
+    case log_level_debug4:
+      line_ += "debug4";
+      break;
+    }
+    line_ += " | ";
+    line_ += msg_;
+  }
+
+  void CLog::FormatLogMessage(eCAL::pb::LogMessage& log_msg_, const long long time_, const eCAL_Logging_eLogLevel level_, const std::string& msg_) const
+  {
+    log_msg_.Clear();
+    log_msg_.set_time(time_);
+    log_msg_.set_hname(m_hname);
+    log_msg_.set_pid(m_pid);
+    log_msg_.set_pname(m_pname);
+    log_msg_.set_uname(eCAL::Process::GetUnitName());
+    log_msg_.set_level(level_);
+    log_msg_.set_content(msg_);
+  }
+
+  void CLog::LogAsync(const eCAL_Logging_eLogLevel level_, const std::string& msg_)
+  {
+    const long long log_time = std::chrono::duration_cast<std::chrono::microseconds>(eCAL::Time::ecal_clock::now().time_since_epoch()).count();
+
+    CLogRing* ring = GetThreadRing();
+    if(ring->Push(log_time, level_, msg_))
+    {
+      // wake up the flush thread before the ring runs full
+      if(ring->Size() == (ring->Capacity() + 1) / 2) RequestFlush();
+      return;
+    }
+
+    if(!m_overflow_block)
+    {
+      ring->Drop();
+      return;
+    }
+
+    // wait for the flush thread to make room
+    while(m_created)
+    {
+      RequestFlush();
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      if(ring->Push(log_time, level_, msg_)) return;
+    }
+  }
+
+  CLogRing* CLog::GetThreadRing()
+  {
+    struct SThreadRing
+    {
+      unsigned long long         generation = 0;
+      std::shared_ptr<CLogRing>  ring;
+    };
+    thread_local SThreadRing thread_ring;
+
+    // first message of this thread (since the last Create)
+    const unsigned long long generation = m_generation;
+    if((thread_ring.generation != generation) || !thread_ring.ring)
+    {
+      thread_ring.ring       = std::make_shared<CLogRing>(m_queue_size);
+      thread_ring.generation = generation;
+
+      const std::lock_guard<std::mutex> lock(m_rings_sync);
+      m_rings.push_back(thread_ring.ring);
+    }
+    return(thread_ring.ring.get());
+  }
+
+  void CLog::RequestFlush()
+  {
     {
-      std::stringstream msg_stream;
-      msg_stream << std::chrono::duration_cast<std::chrono::milliseconds>(log_time.time_since_epoch()).count();
-      msg_stream << " ms";
-      msg_stream << " | ";
-      msg_stream << m_hname;
-      msg_stream << " | ";
-      msg_stream << eCAL::Process::GetUnitName();
-      msg_stream << " | ";
-      msg_stream << m_pid;
-      msg_stream << " | ";
-      switch(level_)
+      const std::lock_guard<std::mutex> lock(m_flush_sync);
+      m_flush_requested = true;
+    }
+    m_flush_cv.notify_one();
+  }
+
+  void CLog::FlushThread()
+  {
+    std::unique_lock<std::mutex> lock(m_flush_sync);
+    while(!m_flush_stop)
+    {
+      m_flush_cv.wait_for(lock, log_flush_interval, [this]() { return(m_flush_requested || m_flush_stop); });
+      m_flush_requested = false;
+
+      lock.unlock();
+      FlushRings();
+      lock.lock();
+    }
+    lock.unlock();
+
+    // write the remaining log messages
+    FlushRings();
+  }
+
+  void CLog::FlushRings()
+  {
+    m_flush_records.clear();
+    long long drops(0);
+    {
+      const std::lock_guard<std::mutex> lock(m_rings_sync);
+      auto iter = m_rings.begin();
+      while(iter != m_rings.end())
       {
-      case log_level_none:
-      case log_level_all:
-        break;
-      case log_level_info:
-        msg_stream << "info";
-        break;
-      case log_level_warning:
-        msg_stream << "warning";
-        break;
-      case log_level_error:
-        msg_stream << "error";
-        break;
-      case log_level_fatal:
-        msg_stream << "fatal";
-        break;
-      case log_level_debug1:
-        msg_stream << "debug1";
-        break;
-      case log_level_debug2:
-        msg_stream << "debug2";
-        break;
-      case log_level_debug3:
-        msg_stream << "debug3";
-        break;
-      case log_level_debug4:
-        msg_stream << "debug4";
-        break;
+        (*iter)->Pop(m_flush_records);
+        drops += (*iter)->TakeDrops();
+
+        // logging thread terminated
+        if(((*iter).use_count() == 1) && (*iter)->Empty()) iter = m_rings.erase(iter);
+        else                                               ++iter;
       }
-      msg_stream << " | ";
-      msg_stream << msg_;
+    }
+
+    if(drops > 0)
+    {
+      SLogRecord record;
+      record.time  = std::chrono::duration_cast<std::chrono::microseconds>(eCAL::Time::ecal_clock::now().time_since_epoch()).count();
+      record.level = log_level_warning;
+      record.msg   = std::to_string(drops) + " log messages dropped (log buffer full)";
+      m_flush_records.push_back(std::move(record));
+    }
+    if(m_flush_records.empty()) return;
 
-      fprintf(m_logfile, "%s\n", msg_stream.str().c_str());
+    // merge the messages of all threads
+    std::stable_sort(m_flush_records.begin(), m_flush_records.end(), [](const SLogRecord& lhs_, const SLogRecord& rhs_) { return(lhs_.time < rhs_.time); });
+
+    const std::lock_guard<std::mutex> lock(m_log_sync);
+
+    m_flush_con.clear();
+    m_flush_file.clear();
+    size_t udp_count(0);
+    for(const auto& record : m_flush_records)
+    {
+      if((record.level & m_filter_mask_con) != 0)
+      {
+        m_flush_con += record.msg;
+        m_flush_con.push_back('\n');
+      }
+
+      if(((record.level & m_filter_mask_file) != 0) && (m_logfile != nullptr))
+      {
+        FormatLogLine(m_log_line, record.time, record.level, record.msg);
+        m_flush_file += m_log_line;
+        m_flush_file.push_back('\n');
+      }
+
+      if(((record.level & m_filter_mask_udp) != 0) && m_udp_logging_sender)
+      {
+        if(m_flush_msgs.size() <= udp_count) m_flush_msgs.emplace_back();
+        FormatLogMessage(m_flush_msgs[udp_count++], record.time, record.level, record.msg);
+      }
+    }
+
+    // one write per sink for the whole batch
+    if(!m_flush_con.empty())
+    {
+      std::cout << m_flush_con << std::flush;
+    }
+
+    if(!m_flush_file.empty())
+    {
+      fwrite(m_flush_file.data(), 1, m_flush_file.size(), m_logfile);
       fflush(m_logfile);
     }
 
-    if((log_udp != 0) && m_udp_logging_sender)
+    if(udp_count > 0)
     {
-      // set up log message
-      ecal_msg.Clear();
-      ecal_msg.set_time(std::chrono::duration_cast<std::chrono::microseconds>(log_time.time_since_epoch()).count());
-      ecal_msg.set_hname(m_hname);
-      ecal_msg.set_pid(m_pid);
-      ecal_msg.set_pname(m_pname);
-      ecal_msg.set_uname(eCAL::Process::GetUnitName());
-      ecal_msg.set_level(level_);
-      ecal_msg.set_content(msg_);
-
-      // sent it
-      m_udp_logging_sender->Send(ecal_msg);
+      m_flush_msgs.resize(udp_count);
+      m_udp_logging_sender->Send(m_flush_msgs);
     }
   }
 
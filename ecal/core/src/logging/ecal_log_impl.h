@@ -25,6 +25,7 @@
 
 #include "io/udp/ecal_udp_logging_receiver.h"
 #include "io/udp/ecal_udp_logging_sender.h"
+#include "logging/ecal_log_ring.h"
 
 #include <cstdio>
 #include <ecal/ecal.h>
@@ -36,10 +37,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace eCAL
 {
@@ -124,6 +128,18 @@ namespace eCAL
   private:
     void RegisterLogMessage(const eCAL::pb::LogMessage& log_msg_);
 
+    // write a log message to console, file and udp (m_log_sync locked)
+    void WriteLogMessage(long long time_, eCAL_Logging_eLogLevel level_, const std::string& msg_);
+    void FormatLogLine(std::string& line_, long long time_, eCAL_Logging_eLogLevel level_, const std::string& msg_) const;
+    void FormatLogMessage(eCAL::pb::LogMessage& log_msg_, long long time_, eCAL_Logging_eLogLevel level_, const std::string& msg_) const;
+
+    // asynchronous logging
+    void LogAsync(eCAL_Logging_eLogLevel level_, const std::string& msg_);
+    CLogRing* GetThreadRing();
+    void RequestFlush();
+    void FlushThread();
+    void FlushRings();
+
     CLog(const CLog&);                 // prevent copy-construction
     CLog& operator=(const CLog&);      // prevent assignment
 
@@ -131,6 +147,28 @@ namespace eCAL
 
     std::atomic<bool>                      m_created;
     std::unique_ptr<UDP::CLoggingSender>   m_udp_logging_sender;
+    eCAL::pb::LogMessage                   m_log_msg;
+    std::string                            m_log_line;
+
+    // asynchronous logging (per thread log rings, written by the flush thread)
+    bool                                   m_async;
+    size_t                                 m_queue_size;
+    bool                                   m_overflow_block;
+    std::atomic<unsigned long long>        m_generation;
+
+    std::mutex                             m_rings_sync;
+    std::vector<std::shared_ptr<CLogRing>> m_rings;
+
+    std::mutex                             m_flush_sync;
+    std::condition_variable                m_flush_cv;
+    bool                                   m_flush_requested;
+    bool                                   m_flush_stop;
+    std::thread                            m_flush_thread;
+
+    std::vector<SLogRecord>                m_flush_records;
+    std::vector<eCAL::pb::LogMessage>      m_flush_msgs;
+    std::string                            m_flush_con;
+    std::string                            m_flush_file;
 
     // log messages
     using LogMessageListT = std::list<eCAL::pb::LogMessage>;
@@ -147,7 +185,7 @@ namespace eCAL
     std::string                            m_logfile_name;
     FILE*                                  m_logfile;
 
-    eCAL_Logging_eLogLevel                 m_level;
+    std::atomic<eCAL_Logging_eLogLevel>    m_level;
     eCAL_Logging_Filter                    m_filter_mask_con;
     eCAL_Logging_Filter                    m_filter_mask_file;
     eCAL_Logging_Filter                    m_filter_mask_udp;
@@ -0,0 +1,149 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL log record ring buffer (asynchronous logging)
+**/
+
+#pragma once
+
+#include <ecal/ecal_log_level.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  struct SLogRecord
+  {
+    long long               time  = 0;                 // ecal clock time in us
+    eCAL_Logging_eLogLevel  level = log_level_none;
+    std::string             msg;
+  };
+
+  /**
+   * @brief Lock free ring buffer of log records, written by one thread and read by the log flusher.
+   *
+   * The record slots are reused, so the message strings keep their capacity and
+   * pushing a message does not allocate memory in the steady state.
+  **/
+  class CLogRing
+  {
+  public:
+    explicit CLogRing(size_t size_) :
+      m_slots(std::max<size_t>(size_, 1)),
+      m_read(0),
+      m_padding(),
+      m_write(0),
+      m_drops(0)
+    {
+    }
+
+    CLogRing(const CLogRing&) = delete;
+    CLogRing& operator=(const CLogRing&) = delete;
+
+    /**
+     * @brief Push a record (producer thread only).
+     *
+     * @return  False if the ring is full.
+    **/
+    bool Push(long long time_, eCAL_Logging_eLogLevel level_, const std::string& msg_)
+    {
+      const std::uint64_t write = m_write.load(std::memory_order_relaxed);
+      if (write - m_read.load(std::memory_order_acquire) >= m_slots.size()) return(false);
+
+      SLogRecord& slot = m_slots[write % m_slots.size()];
+      slot.time  = time_;
+      slot.level = level_;
+      slot.msg.assign(msg_);
+
+      m_write.store(write + 1, std::memory_order_release);
+      return(true);
+    }
+
+    /**
+     * @brief Count a record that was dropped because of a full ring (producer thread only).
+    **/
+    void Drop()
+    {
+      m_drops.store(m_drops.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Append all pushed records (flusher thread only).
+     *
+     * @return  Number of appended records.
+    **/
+    size_t Pop(std::vector<SLogRecord>& records_)
+    {
+      const std::uint64_t write = m_write.load(std::memory_order_acquire);
+      std::uint64_t       read  = m_read.load(std::memory_order_relaxed);
+      const size_t        count = static_cast<size_t>(write - read);
+
+      for (; read != write; ++read)
+      {
+        records_.push_back(m_slots[read % m_slots.size()]);
+      }
+
+      m_read.store(read, std::memory_order_release);
+      return(count);
+    }
+
+    /**
+     * @brief Number of dropped records since the last call (flusher thread only).
+    **/
+    long long TakeDrops()
+    {
+      const long long drops = m_drops.load(std::memory_order_relaxed);
+      const long long taken = drops - m_drops_taken;
+      m_drops_taken = drops;
+      return(taken);
+    }
+
+    bool Empty() const
+    {
+      return(m_read.load(std::memory_order_acquire) == m_write.load(std::memory_order_acquire));
+    }
+
+    size_t Size() const
+    {
+      const std::uint64_t read = m_read.load(std::memory_order_acquire);
+      return(static_cast<size_t>(m_write.load(std::memory_order_acquire) - read));
+    }
+
+    size_t Capacity() const
+    {
+      return(m_slots.size());
+    }
+
+  private:
+    std::vector<SLogRecord>     m_slots;
+
+    // read and write position on different cache lines
+    std::atomic<std::uint64_t>  m_read;
+    char                        m_padding[64];
+    std::atomic<std::uint64_t>  m_write;
+    std::atomic<long long>      m_drops;
+    long long                   m_drops_taken = 0;
+  };
+}
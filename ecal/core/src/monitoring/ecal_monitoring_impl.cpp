@@ -218,6 +218,9 @@ namespace eCAL
     const long long    did             = sample_topic.did();
     const long long    dclock          = sample_topic.dclock();
     const long long    message_drops   = sample_topic.message_drops();
+    const long long    queue_drops     = sample_topic.queue_drops();
+    const int          callback_depth  = sample_topic.callback_queue_depth();
+    const int          callback_time   = sample_topic.callback_time_us();
     const long         dfreq           = sample_topic.dfreq();
 
     // check blacklist topic filter
@@ -301,18 +304,21 @@ namespace eCAL
       TopicInfo.tdatatype.name        = std::move(topic_datatype_name);
       TopicInfo.tdatatype.descriptor  = std::move(topic_datatype_descriptor);
 
-      TopicInfo.attr               = std::map<std::string, std::string>{attr.begin(), attr.end()};
-      TopicInfo.tlayer_ecal_udp_mc = topic_tlayer_ecal_udp_mc;
-      TopicInfo.tlayer_ecal_shm    = topic_tlayer_ecal_shm;
-      TopicInfo.tlayer_ecal_tcp    = topic_tlayer_ecal_tcp;
-      TopicInfo.tlayer_inproc      = topic_tlayer_inproc;
-      TopicInfo.tsize              = static_cast<int>(topic_size);
-      TopicInfo.connections_loc    = static_cast<int>(connections_loc);
-      TopicInfo.connections_ext    = static_cast<int>(connections_ext);
-      TopicInfo.did                = did;
-      TopicInfo.dclock             = dclock;
-      TopicInfo.message_drops      = message_drops;
-      TopicInfo.dfreq              = dfreq;
+      TopicInfo.attr                 = std::map<std::string, std::string>{attr.begin(), attr.end()};
+      TopicInfo.tlayer_ecal_udp_mc   = topic_tlayer_ecal_udp_mc;
+      TopicInfo.tlayer_ecal_shm      = topic_tlayer_ecal_shm;
+      TopicInfo.tlayer_ecal_tcp      = topic_tlayer_ecal_tcp;
+      TopicInfo.tlayer_inproc        = topic_tlayer_inproc;
+      TopicInfo.tsize                = static_cast<int>(topic_size);
+      TopicInfo.connections_loc      = static_cast<int>(connections_loc);
+      TopicInfo.connections_ext      = static_cast<int>(connections_ext);
+      TopicInfo.did                  = did;
+      TopicInfo.dclock               = dclock;
+      TopicInfo.message_drops        = message_drops;
+      TopicInfo.queue_drops          = queue_drops;
+      TopicInfo.callback_queue_depth = callback_depth;
+      TopicInfo.callback_time_us     = callback_time;
+      TopicInfo.dfreq                = dfreq;
     }
 
     return(true);
@@ -362,6 +368,9 @@ namespace eCAL
     const int             component_init_state         = sample_process.component_init_state();
     const std::string&    component_init_info          = sample_process.component_init_info();
     const std::string&    ecal_runtime_version         = sample_process.ecal_runtime_version();
+    const long long       udp_socket_drops             = sample_process.udp_socket_drops();
+    const long long       udp_incomplete_msgs          = sample_process.udp_incomplete_msgs();
+    const long long       udp_defrag_timeouts          = sample_process.udp_defrag_timeouts();
 
     // create map key
     const std::string process_name_id = process_name + std::to_string(process_id);
@@ -395,6 +404,9 @@ namespace eCAL
     ProcessInfo.component_init_state = component_init_state;
     ProcessInfo.component_init_info  = component_init_info;
     ProcessInfo.ecal_runtime_version = ecal_runtime_version;
+    ProcessInfo.udp_socket_drops     = udp_socket_drops;
+    ProcessInfo.udp_incomplete_msgs  = udp_incomplete_msgs;
+    ProcessInfo.udp_defrag_timeouts  = udp_defrag_timeouts;
 
     return(true);
   }
@@ -450,6 +462,11 @@ namespace eCAL
 
     // update flexible content
     ServerInfo.rclock++;
+    ServerInfo.exec_mode  = sample_service.exec_mode();
+    ServerInfo.queued     = sample_service.queued();
+    ServerInfo.queued_max = sample_service.queued_max();
+    ServerInfo.in_flight  = sample_service.in_flight();
+    ServerInfo.rejected   = sample_service.rejected();
     ServerInfo.methods.clear();
     for (int i = 0; i < sample_.service().methods_size(); ++i)
     {
@@ -756,6 +773,11 @@ namespace eCAL
 
       // eCAL component runtime version
       pMonProcs->set_ecal_runtime_version(process.second.ecal_runtime_version);
+
+      // udp receive statistics
+      pMonProcs->set_udp_socket_drops(process.second.udp_socket_drops);
+      pMonProcs->set_udp_incomplete_msgs(process.second.udp_incomplete_msgs);
+      pMonProcs->set_udp_defrag_timeouts(process.second.udp_defrag_timeouts);
     }
   }
 
@@ -796,6 +818,13 @@ namespace eCAL
       pMonService->set_tcp_port_v0(server.second.tcp_port_v0);
       pMonService->set_tcp_port_v1(server.second.tcp_port_v1);
 
+      // method call execution
+      pMonService->set_exec_mode(server.second.exec_mode);
+      pMonService->set_queued(server.second.queued);
+      pMonService->set_queued_max(server.second.queued_max);
+      pMonService->set_in_flight(server.second.in_flight);
+      pMonService->set_rejected(server.second.rejected);
+
       // methods
       for (const auto& method : server.second.methods)
       {
@@ -947,6 +976,13 @@ namespace eCAL
       // data dropped
       pMonTopic->set_message_drops(google::protobuf::int32(topic.second.message_drops));
 
+      // data dropped by the receive queue
+      pMonTopic->set_queue_drops(google::protobuf::int32(topic.second.queue_drops));
+
+      // receive callback execution
+      pMonTopic->set_callback_queue_depth(topic.second.callback_queue_depth);
+      pMonTopic->set_callback_time_us(topic.second.callback_time_us);
+
       // data frequency
       pMonTopic->set_dfreq(topic.second.dfreq);
     }
@@ -28,7 +28,7 @@
 #include <set>
 
 #include "ecal_def.h"
-#include "util/ecal_expmap.h"
+#include "util/ecal_hash_expmap.h"
 
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
@@ -85,7 +85,7 @@ namespace eCAL
     bool RegisterTopic(const eCAL::pb::Sample& sample_, enum ePubSub pubsub_type_);
     bool UnregisterTopic(const eCAL::pb::Sample& sample_, enum ePubSub pubsub_type_);
 
-    using TopicMonMapT = eCAL::Util::CExpMap<std::string, eCAL::Monitoring::STopicMon>;
+    using TopicMonMapT = eCAL::Util::CHashExpMap<std::string, eCAL::Monitoring::STopicMon>;
     struct STopicMonMap
     {
       explicit STopicMonMap(const std::chrono::milliseconds& timeout_) :
@@ -96,7 +96,7 @@ namespace eCAL
       std::unique_ptr<TopicMonMapT>  map;
     };
 
-    using ProcessMonMapT = eCAL::Util::CExpMap<std::string, eCAL::Monitoring::SProcessMon>;
+    using ProcessMonMapT = eCAL::Util::CHashExpMap<std::string, eCAL::Monitoring::SProcessMon>;
     struct SProcessMonMap
     {
       explicit SProcessMonMap(const std::chrono::milliseconds& timeout_) :
@@ -107,7 +107,7 @@ namespace eCAL
       std::unique_ptr<ProcessMonMapT>  map;
     };
 
-    using ServerMonMapT = eCAL::Util::CExpMap<std::string, eCAL::Monitoring::SServerMon>;
+    using ServerMonMapT = eCAL::Util::CHashExpMap<std::string, eCAL::Monitoring::SServerMon>;
     struct SServerMonMap
     {
       explicit SServerMonMap(const std::chrono::milliseconds& timeout_) :
@@ -118,7 +118,7 @@ namespace eCAL
       std::unique_ptr<ServerMonMapT>  map;
     };
 
-    using ClientMonMapT = eCAL::Util::CExpMap<std::string, eCAL::Monitoring::SClientMon>;
+    using ClientMonMapT = eCAL::Util::CHashExpMap<std::string, eCAL::Monitoring::SClientMon>;
     struct SClientMonMap
     {
       explicit SClientMonMap(const std::chrono::milliseconds& timeout_) :
@@ -123,14 +123,14 @@ namespace eCAL
     subscription_info.process_id = std::to_string(ecal_sample.pid());
     const SDataTypeInformation topic_information{ eCALSampleToTopicInformation(ecal_sample_) };
 
-    std::string reader_par;
+    // layer parameter as protobuf message
+    // (merged parameter of all layers, every layer sets its own sub message)
+    eCAL::pb::ConnnectionPar reader_connection_par;
     for (const auto& layer : ecal_sample.tlayer())
     {
-      // layer parameter as protobuf message
-      // this parameter is not used at all currently
-      // for local subscriber registrations
-      reader_par = layer.par_layer().SerializeAsString();
+      reader_connection_par.MergeFrom(layer.par_layer());
     }
+    const std::string reader_par = reader_connection_par.SerializeAsString();
 
     // store description
     ApplyTopicToDescGate(topic_name, topic_information);
@@ -175,14 +175,14 @@ namespace eCAL
     subscription_info.process_id = std::to_string(ecal_sample.pid());
     const SDataTypeInformation topic_information{ eCALSampleToTopicInformation(ecal_sample_) };
 
-    std::string reader_par;
+    // layer parameter as protobuf message
+    // (merged parameter of all layers, every layer sets its own sub message)
+    eCAL::pb::ConnnectionPar reader_connection_par;
     for (const auto& layer : ecal_sample.tlayer())
     {
-      // layer parameter as protobuf message
-      // this parameter is not used at all currently
-      // for external subscriber registrations
-      reader_par = layer.par_layer().SerializeAsString();
+      reader_connection_par.MergeFrom(layer.par_layer());
     }
+    const std::string reader_par = reader_connection_par.SerializeAsString();
 
     // store description
     ApplyTopicToDescGate(topic_name, topic_information);
@@ -108,6 +108,13 @@ namespace eCAL
       iter->second->Destroy();
     }
 
+    // stop callback executor
+    {
+      const std::lock_guard<std::mutex> executor_lock(m_callback_executor_sync);
+      if (m_callback_executor) m_callback_executor->Stop();
+      m_callback_executor = nullptr;
+    }
+
     m_created = false;
   }
 
@@ -142,6 +149,18 @@ namespace eCAL
     return(ret_state);
   }
 
+  std::shared_ptr<CCallbackExecutor> CSubGate::GetCallbackExecutor()
+  {
+    if (!m_created) return(nullptr);
+
+    const std::lock_guard<std::mutex> lock(m_callback_executor_sync);
+    if (!m_callback_executor)
+    {
+      m_callback_executor = std::make_shared<CCallbackExecutor>(Config::GetCallbackExecutorThreadCount());
+    }
+    return(m_callback_executor);
+  }
+
   bool CSubGate::HasSample(const std::string& sample_name_)
   {
     const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
@@ -207,7 +226,7 @@ namespace eCAL
     return (sent > 0);
   }
 
-  bool CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_)
+  bool CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SharedPayloadT& buffer_ /* = nullptr */)
   {
     if(!m_created) return false;
 
@@ -232,7 +251,7 @@ namespace eCAL
 
     for (const auto& reader : readers_to_apply)
     {
-      sent = reader->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_);
+      sent = reader->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_, buffer_);
     }
 
     return (sent > 0);
@@ -24,11 +24,13 @@
 #pragma once
 
 #include "readwrite/ecal_reader.h"
+#include "readwrite/ecal_callback_executor.h"
 #include "util/ecal_thread.h"
 
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
@@ -49,7 +51,9 @@ namespace eCAL
 
     bool HasSample(const std::string& sample_name_);
     bool ApplySample(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_);
-    bool ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_);
+    bool ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SharedPayloadT& buffer_ = nullptr);
+
+    std::shared_ptr<CCallbackExecutor> GetCallbackExecutor();
 
     void ApplyLocPubRegistration(const eCAL::pb::Sample& ecal_sample_);
     void ApplyLocPubUnregistration(const eCAL::pb::Sample& ecal_sample_);
@@ -71,5 +75,9 @@ namespace eCAL
     TopicNameDataReaderMapT          m_topic_name_datareader_map;
 
     std::shared_ptr<CCallbackThread>  m_subtimeout_thread;
+
+    // shared executor for subscriber callbacks (created on first use)
+    std::mutex                         m_callback_executor_sync;
+    std::shared_ptr<CCallbackExecutor> m_callback_executor;
   };
 }
@@ -0,0 +1,338 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  executor for subscriber receive callbacks
+**/
+
+#include "ecal_callback_executor.h"
+
+#include <algorithm>
+
+namespace eCAL
+{
+  ////////////////////////////////////////
+  // CCallbackStrand
+  ////////////////////////////////////////
+  CCallbackStrand::CCallbackStrand(const std::weak_ptr<CCallbackExecutor>& executor_, size_t depth_, QOS::eQOSPolicy_Overflow overflow_, HandlerT handler_) :
+    m_executor(executor_),
+    m_overflow(overflow_),
+    m_handler(std::move(handler_)),
+    m_tasks(depth_ > 0 ? depth_ : 1),
+    m_read_pos(0),
+    m_write_pos(0),
+    m_scheduled(false),
+    m_running(false),
+    m_stopped(false),
+    m_queue_depth_max(0),
+    m_drops(0)
+  {
+  }
+
+  bool CCallbackStrand::Post(const char* buf_, size_t len_, long long id_, long long clock_, long long time_, const SharedPayloadT& owner_)
+  {
+    // copy the payload without holding the lock (if we can not keep the buffer of the transport layer)
+    if (!owner_) m_push_buf.assign(buf_, buf_ + len_);
+
+    bool schedule(false);
+    {
+      std::unique_lock<std::mutex> lock(m_sync);
+      if (m_stopped) return(false);
+
+      if (Full())
+      {
+        switch (m_overflow)
+        {
+        case QOS::drop_newest_overflow_qos:
+          m_drops++;
+          return(false);
+        case QOS::block_overflow_qos:
+          m_space_cv.wait(lock, [this]() { return(m_stopped || !Full()); });
+          if (m_stopped) return(false);
+          break;
+        case QOS::drop_oldest_overflow_qos:
+        default:
+          m_tasks[m_read_pos % m_tasks.size()].owner.reset();
+          m_read_pos++;
+          m_drops++;
+          break;
+        }
+      }
+
+      STask& task = m_tasks[m_write_pos % m_tasks.size()];
+      if (owner_)
+      {
+        task.owner = owner_;
+        task.buf   = buf_;
+      }
+      else
+      {
+        // hand over the buffer, the producer gets the old task buffer (and its capacity) back
+        task.copy.swap(m_push_buf);
+        task.buf = task.copy.data();
+      }
+      task.len   = len_;
+      task.id    = id_;
+      task.clock = clock_;
+      task.time  = time_;
+      m_write_pos++;
+
+      m_queue_depth_max = std::max(m_queue_depth_max, static_cast<size_t>(m_write_pos - m_read_pos));
+
+      // the strand is not known by the executor yet
+      if (!m_scheduled)
+      {
+        m_scheduled = true;
+        schedule    = true;
+      }
+    }
+
+    if (schedule)
+    {
+      auto executor = m_executor.lock();
+      if (executor)
+      {
+        executor->Schedule(shared_from_this());
+      }
+      else
+      {
+        const std::lock_guard<std::mutex> lock(m_sync);
+        m_scheduled = false;
+      }
+    }
+
+    return(true);
+  }
+
+  void CCallbackStrand::Stop()
+  {
+    std::unique_lock<std::mutex> lock(m_sync);
+    m_stopped = true;
+
+    // drop queued tasks and release the transport layer buffers
+    for (; m_read_pos < m_write_pos; ++m_read_pos)
+    {
+      m_tasks[m_read_pos % m_tasks.size()].owner.reset();
+    }
+    m_space_cv.notify_all();
+
+    // wait for a running callback (unless we are called from the callback itself)
+    if (m_running_thread != std::this_thread::get_id())
+    {
+      m_idle_cv.wait(lock, [this]() { return(!m_running); });
+    }
+  }
+
+  CCallbackStrand::SStatistics CCallbackStrand::GetStatistics()
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    SStatistics statistics;
+    statistics.queue_depth     = static_cast<size_t>(m_write_pos - m_read_pos);
+    statistics.queue_depth_max = m_queue_depth_max;
+    statistics.drops           = m_drops;
+
+    // start a new measurement interval
+    m_queue_depth_max = statistics.queue_depth;
+    return(statistics);
+  }
+
+  bool CCallbackStrand::RunOne()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      if (m_stopped || Empty())
+      {
+        m_scheduled = false;
+        return(false);
+      }
+
+      // take over the task, the task slot gets the old buffer (and its capacity) back
+      STask& task = m_tasks[m_read_pos % m_tasks.size()];
+      m_run_task.copy.swap(task.copy);
+      m_run_task.owner = std::move(task.owner);
+      m_run_task.buf   = task.buf;
+      m_run_task.len   = task.len;
+      m_run_task.id    = task.id;
+      m_run_task.clock = task.clock;
+      m_run_task.time  = task.time;
+      m_read_pos++;
+
+      m_running        = true;
+      m_running_thread = std::this_thread::get_id();
+    }
+    m_space_cv.notify_one();
+
+    // execute it
+    if (m_handler) m_handler(m_run_task.buf, m_run_task.len, m_run_task.id, m_run_task.clock, m_run_task.time);
+
+    // release the transport layer buffer
+    m_run_task.owner.reset();
+
+    bool more(false);
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      m_running        = false;
+      m_running_thread = std::thread::id();
+
+      more = !m_stopped && !Empty();
+      if (!more) m_scheduled = false;
+    }
+    m_idle_cv.notify_all();
+
+    return(more);
+  }
+
+  ////////////////////////////////////////
+  // CCallbackExecutor
+  ////////////////////////////////////////
+  CCallbackExecutor::CCallbackExecutor(size_t thread_count_) :
+    m_next_queue(0),
+    m_pending(0),
+    m_stop(false)
+  {
+    const size_t thread_count = std::max<size_t>(thread_count_, 1);
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+      m_queues.emplace_back(std::make_unique<SWorkerQueue>());
+    }
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+      m_threads.emplace_back(&CCallbackExecutor::Worker, this, i);
+    }
+  }
+
+  CCallbackExecutor::~CCallbackExecutor()
+  {
+    Stop();
+  }
+
+  std::shared_ptr<CCallbackStrand> CCallbackExecutor::CreateStrand(size_t depth_, QOS::eQOSPolicy_Overflow overflow_, CCallbackStrand::HandlerT handler_)
+  {
+    return(std::make_shared<CCallbackStrand>(shared_from_this(), depth_, overflow_, std::move(handler_)));
+  }
+
+  void CCallbackExecutor::Stop()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_sleep_sync);
+      m_stop = true;
+    }
+    m_sleep_cv.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+      if (!thread.joinable()) continue;
+      // the last reference may be released by a callback running on a worker
+      if (thread.get_id() == std::this_thread::get_id()) thread.detach();
+      else                                               thread.join();
+    }
+    m_threads.clear();
+
+    for (auto& queue : m_queues)
+    {
+      const std::lock_guard<std::mutex> lock(queue->sync);
+      queue->strands.clear();
+    }
+  }
+
+  void CCallbackExecutor::Schedule(const std::shared_ptr<CCallbackStrand>& strand_)
+  {
+    // distribute new work round robin, idle workers will steal it anyway
+    Schedule(strand_, m_next_queue++ % m_queues.size());
+  }
+
+  void CCallbackExecutor::Schedule(const std::shared_ptr<CCallbackStrand>& strand_, size_t queue_index_)
+  {
+    {
+      SWorkerQueue& queue = *m_queues[queue_index_];
+      const std::lock_guard<std::mutex> lock(queue.sync);
+      queue.strands.push_back(strand_);
+    }
+    {
+      const std::lock_guard<std::mutex> lock(m_sleep_sync);
+      m_pending++;
+    }
+    m_sleep_cv.notify_one();
+  }
+
+  std::shared_ptr<CCallbackStrand> CCallbackExecutor::Take(size_t queue_index_)
+  {
+    std::shared_ptr<CCallbackStrand> strand;
+
+    // own queue first (oldest strand), then steal from the other workers (newest strand)
+    for (size_t i = 0; (i < m_queues.size()) && !strand; ++i)
+    {
+      SWorkerQueue& queue = *m_queues[(queue_index_ + i) % m_queues.size()];
+      const std::lock_guard<std::mutex> lock(queue.sync);
+      if (queue.strands.empty()) continue;
+
+      if (i == 0)
+      {
+        strand = std::move(queue.strands.front());
+        queue.strands.pop_front();
+      }
+      else
+      {
+        strand = std::move(queue.strands.back());
+        queue.strands.pop_back();
+      }
+    }
+
+    if (strand)
+    {
+      const std::lock_guard<std::mutex> lock(m_sleep_sync);
+      m_pending--;
+    }
+    return(strand);
+  }
+
+  void CCallbackExecutor::Worker(size_t queue_index_)
+  {
+    for (;;)
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_sleep_sync);
+        m_sleep_cv.wait(lock, [this]() { return(m_stop || (m_pending > 0)); });
+        if (m_stop) return;
+      }
+
+      auto strand = Take(queue_index_);
+      if (!strand)
+      {
+        // another worker was faster
+        std::this_thread::yield();
+        continue;
+      }
+
+      // a callback may release the last reference to the executor (e.g. a subscriber owning its executor
+      // is destroyed in its own callback), so the executor is kept alive until the task is finished
+      std::shared_ptr<CCallbackExecutor> self = strand->m_executor.lock();
+      if (!self) return;
+
+      // a strand with more tasks stays with this worker
+      if (strand->RunOne()) Schedule(strand, queue_index_);
+      strand.reset();
+
+      // if this was the last reference, the executor has been destroyed on this (detached) worker thread
+      const std::weak_ptr<CCallbackExecutor> alive(self);
+      self.reset();
+      if (alive.expired()) return;
+    }
+  }
+}
@@ -0,0 +1,178 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  executor for subscriber receive callbacks
+**/
+
+#pragma once
+
+#include <ecal/ecal_qos.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  // receive buffer of a transport layer, handed over to the executor instead of copying the payload
+  using SharedPayloadT = std::shared_ptr<const std::vector<char>>;
+
+  class CCallbackExecutor;
+
+  /**
+   * @brief Bounded queue of callback tasks of one subscriber.
+   *
+   * The tasks of a strand are executed one after the other (never concurrently),
+   * so the user callback does not need to be thread safe.
+  **/
+  class CCallbackStrand : public std::enable_shared_from_this<CCallbackStrand>
+  {
+  public:
+    using HandlerT = std::function<void (const char* buf_, size_t len_, long long id_, long long clock_, long long time_)>;
+
+    struct SStatistics
+    {
+      size_t    queue_depth     = 0;  // currently queued tasks
+      size_t    queue_depth_max = 0;  // maximum number of queued tasks since the last GetStatistics call
+      long long drops           = 0;  // tasks dropped because of a full queue
+    };
+
+    CCallbackStrand(const std::weak_ptr<CCallbackExecutor>& executor_, size_t depth_, QOS::eQOSPolicy_Overflow overflow_, HandlerT handler_);
+
+    /**
+     * @brief Queue a callback task.
+     *
+     * @param buf_    Payload.
+     * @param len_    Payload size.
+     * @param owner_  Buffer containing the payload, kept alive until the task is executed (optional, otherwise the payload is copied).
+     *
+     * @return  True if the task was queued, false if it was dropped.
+    **/
+    bool Post(const char* buf_, size_t len_, long long id_, long long clock_, long long time_, const SharedPayloadT& owner_);
+
+    /**
+     * @brief Drop all queued tasks and wait until a running task is finished.
+    **/
+    void Stop();
+
+    SStatistics GetStatistics();
+
+  protected:
+    friend class CCallbackExecutor;
+
+    // execute the oldest task, returns true if there are more tasks queued
+    bool RunOne();
+
+    struct STask
+    {
+      std::vector<char> copy;
+      SharedPayloadT    owner;
+      const char*       buf   = nullptr;
+      size_t            len   = 0;
+      long long         id    = 0;
+      long long         clock = 0;
+      long long         time  = 0;
+    };
+
+    bool Full() const  { return(m_write_pos - m_read_pos >= m_tasks.size()); };
+    bool Empty() const { return(m_write_pos == m_read_pos); };
+
+    std::weak_ptr<CCallbackExecutor>  m_executor;
+    QOS::eQOSPolicy_Overflow          m_overflow;
+    HandlerT                          m_handler;
+
+    mutable std::mutex                m_sync;
+    std::condition_variable           m_space_cv;
+    std::condition_variable           m_idle_cv;
+    std::vector<STask>                m_tasks;
+    std::uint64_t                     m_read_pos;
+    std::uint64_t                     m_write_pos;
+    bool                              m_scheduled;
+    bool                              m_running;
+    std::thread::id                   m_running_thread;
+    bool                              m_stopped;
+    size_t                            m_queue_depth_max;
+    long long                         m_drops;
+
+    // only touched by the producer
+    std::vector<char>                 m_push_buf;
+    // only touched by the executing worker
+    STask                             m_run_task;
+  };
+
+  /**
+   * @brief Thread pool executing subscriber callbacks.
+   *
+   * Every worker has its own queue of ready strands, a strand with remaining
+   * tasks stays on the worker that executed it. Idle workers steal ready
+   * strands from the other workers.
+   *
+   * Must be created with std::make_shared, strands only keep a weak reference.
+  **/
+  class CCallbackExecutor : public std::enable_shared_from_this<CCallbackExecutor>
+  {
+  public:
+    explicit CCallbackExecutor(size_t thread_count_);
+    ~CCallbackExecutor();
+
+    CCallbackExecutor(const CCallbackExecutor&) = delete;
+    CCallbackExecutor& operator=(const CCallbackExecutor&) = delete;
+
+    /**
+     * @brief Create a strand (per subscriber task queue) executed by this executor.
+    **/
+    std::shared_ptr<CCallbackStrand> CreateStrand(size_t depth_, QOS::eQOSPolicy_Overflow overflow_, CCallbackStrand::HandlerT handler_);
+
+    /**
+     * @brief Stop and join all worker threads, queued tasks are not executed anymore.
+    **/
+    void Stop();
+
+  protected:
+    friend class CCallbackStrand;
+
+    void Schedule(const std::shared_ptr<CCallbackStrand>& strand_);
+    void Schedule(const std::shared_ptr<CCallbackStrand>& strand_, size_t queue_index_);
+    std::shared_ptr<CCallbackStrand> Take(size_t queue_index_);
+    void Worker(size_t queue_index_);
+
+    struct SWorkerQueue
+    {
+      std::mutex                                    sync;
+      std::deque<std::shared_ptr<CCallbackStrand>>  strands;
+    };
+
+    std::vector<std::unique_ptr<SWorkerQueue>>  m_queues;
+    std::vector<std::thread>                    m_threads;
+    std::atomic<size_t>                         m_next_queue;
+
+    std::mutex                                  m_sleep_sync;
+    std::condition_variable                     m_sleep_cv;
+    long long                                   m_pending;
+    bool                                        m_stop;
+  };
+}
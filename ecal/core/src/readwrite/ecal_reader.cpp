@@ -28,10 +28,12 @@
 
 #include "ecal_def.h"
 #include "registration/ecal_registration_provider.h"
+#include "pubsub/ecal_subgate.h"
 #include "ecal_descgate.h"
 #include "ecal_reader.h"
 #include "ecal_process.h"
 
+#include "readwrite/ecal_sample_header.h"
 #include "readwrite/udp/ecal_reader_udp_mc.h"
 #include "readwrite/shm/ecal_reader_shm.h"
 #include "readwrite/tcp/ecal_reader_tcp.h"
@@ -60,8 +62,10 @@ namespace eCAL
                  m_pname(Process::GetProcessName()),
                  m_topic_size(0),
                  m_connected(false),
-                 m_read_buf_received(false),
-                 m_read_time(0),
+                 m_receive_callback_thread(std::thread::id()),
+                 m_callback_count(0),
+                 m_callback_time_us(0),
+                 m_callback_time_avg_us(0),
                  m_receive_timeout(0),
                  m_receive_time(0),
                  m_clock(0),
@@ -109,6 +113,37 @@ namespace eCAL
     m_loc_pub_map.set_expiration(registration_timeout);
     m_ext_pub_map.set_expiration(registration_timeout);
 
+    // allocate receive queue (history kind, depth and overflow behavior from qos)
+    m_read_queue.Configure(m_qos.history_kind, static_cast<size_t>(m_qos.history_kind_depth), m_qos.overflow);
+
+    // allocate duplicate detection window
+    m_sample_hash_window.Reset(Config::GetDuplicateWindowSize());
+
+    // execute receive callbacks on the transport thread or hand them over to an executor
+    std::shared_ptr<CCallbackExecutor> callback_executor;
+    switch (Config::GetCallbackExecutorMode())
+    {
+    case 1:
+      if (g_subgate() != nullptr) callback_executor = g_subgate()->GetCallbackExecutor();
+      break;
+    case 2:
+      m_callback_executor = std::make_shared<CCallbackExecutor>(1);
+      callback_executor   = m_callback_executor;
+      break;
+    default:
+      break;
+    }
+    if (callback_executor)
+    {
+      // the reader may be destroyed in its own callback, so the executor keeps it alive while the callback runs
+      m_callback_strand = callback_executor->CreateStrand(Config::GetCallbackQueueSize(), m_qos.overflow,
+        [weak_me = std::weak_ptr<CDataReader>(shared_from_this())](const char* payload_, size_t size_, long long id_, long long clock_, long long time_)
+        {
+          const auto me = weak_me.lock();
+          if (me) me->ExecuteReceiveCallback(payload_, size_, id_, clock_, time_);
+        });
+    }
+
     // allow to share topic type
     m_use_ttype = Config::IsTopicTypeSharingEnabled();
 
@@ -136,14 +171,23 @@ namespace eCAL
     Logging::Log(log_level_debug1, m_topic_name + "::CDataReader::Destroy");
 #endif
 
+    // release receive calls and transport threads blocked by the receive queue
+    m_read_queue.Stop();
+
+    // drop pending callbacks and wait for a running one
+    if (m_callback_strand)   m_callback_strand->Stop();
+    if (m_callback_executor) m_callback_executor->Stop();
+
     // stop transport layers
     UnsubscribeFromLayers();
 
     // reset receive callback
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+      const std::lock_guard<std::mutex> exec_lock(m_receive_callback_exec_sync);
       m_receive_callback = nullptr;
     }
+    WaitForReceiveCallback();
 
     // reset event callback map
     {
@@ -252,6 +296,8 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_udp_mc);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_udp_mc_confirmed);
+      // announce binary sample header support
+      tlayer->mutable_par_layer()->mutable_layer_par_udpmc()->set_sample_header_version(SampleHeader::version);
     }
     // shm layer
     {
@@ -266,6 +312,8 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_tcp);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_tcp_confirmed);
+      // announce binary sample header support
+      tlayer->mutable_par_layer()->mutable_layer_par_tcp()->set_sample_header_version(SampleHeader::version);
     }
     // inproc layer
     {
@@ -281,6 +329,20 @@ namespace eCAL
     ecal_reg_sample_mutable_topic->set_dfreq(GetFrequency());
     ecal_reg_sample_mutable_topic->set_message_drops(google::protobuf::int32(m_message_drops));
 
+    // receive queue and callback execution statistics
+    long long queue_drops = m_read_queue.GetDrops();
+    if (m_callback_strand)
+    {
+      const CCallbackStrand::SStatistics callback_statistics = m_callback_strand->GetStatistics();
+      queue_drops += callback_statistics.drops;
+      ecal_reg_sample_mutable_topic->set_callback_queue_depth(google::protobuf::int32(callback_statistics.queue_depth_max));
+    }
+    const long long callback_count = m_callback_count.exchange(0);
+    const long long callback_time  = m_callback_time_us.exchange(0);
+    if (callback_count > 0) m_callback_time_avg_us = callback_time / callback_count;
+    ecal_reg_sample_mutable_topic->set_queue_drops(google::protobuf::int32(queue_drops));
+    ecal_reg_sample_mutable_topic->set_callback_time_us(google::protobuf::int32(m_callback_time_avg_us));
+
     size_t loc_connections(0);
     size_t ext_connections(0);
     {
@@ -302,6 +364,19 @@ namespace eCAL
       break;
   }
     ecal_reg_sample_mutable_topic->mutable_tqos()->set_history_depth(m_qos.history_kind_depth);
+    // qos Overflow
+    switch (m_qos.overflow)
+    {
+    case QOS::drop_oldest_overflow_qos:
+      ecal_reg_sample_mutable_topic->mutable_tqos()->set_overflow(eCAL::pb::QOS::drop_oldest_overflow_qos);
+      break;
+    case QOS::drop_newest_overflow_qos:
+      ecal_reg_sample_mutable_topic->mutable_tqos()->set_overflow(eCAL::pb::QOS::drop_newest_overflow_qos);
+      break;
+    case QOS::block_overflow_qos:
+      ecal_reg_sample_mutable_topic->mutable_tqos()->set_overflow(eCAL::pb::QOS::block_overflow_qos);
+      break;
+    }
     // qos Reliability
     switch (m_qos.reliability)
     {
@@ -393,47 +468,20 @@ namespace eCAL
   {
     if (!m_created) return(false);
 
-    std::unique_lock<std::mutex> read_buffer_lock(m_read_buf_mutex);
+    // take the oldest queued sample
+    if (!m_read_queue.Pop(buf_, time_, rcv_timeout_ms_)) return(false);
 
-    // No need to wait (for whatever time) if something has been received
-    if (!m_read_buf_received)
-    {
-      if (rcv_timeout_ms_ < 0)
-      {
-        m_read_buf_cv.wait(read_buffer_lock, [this]() { return this->m_read_buf_received; });
-      }
-      else if (rcv_timeout_ms_ > 0)
-      {
-        m_read_buf_cv.wait_for(read_buffer_lock, std::chrono::milliseconds(rcv_timeout_ms_), [this]() { return this->m_read_buf_received; });
-      }
-    }
-
-    // did we receive new samples ?
-    if (m_read_buf_received)
-    {
 #ifndef NDEBUG
-      // log it
-      Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::Receive");
+    // log it
+    Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::Receive");
 #endif
-      // copy content to target string
-      buf_.clear();
-      buf_.swap(m_read_buf);
-      m_read_buf_received = false;
-
-      // apply time
-      if(time_ != nullptr) *time_ = m_read_time;
-
-      // return success
-      return(true);
-    }
-
-    return(false);
+    return(true);
   }
 
-  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_)
+  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SharedPayloadT& buffer_ /* = nullptr */)
   {
     // ensure thread safety
-    const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+    std::unique_lock<std::mutex> lock(m_receive_callback_sync);
     if (!m_created) return(0);
 
     // store receive layer
@@ -442,13 +490,11 @@ namespace eCAL
     m_use_tcp_confirmed    |= layer_ == eCAL::pb::tl_ecal_tcp;
     m_use_inproc_confirmed |= layer_ == eCAL::pb::tl_inproc;
 
-    // number of hash values to track for duplicates
-    constexpr int hash_queue_size(64);
-
     // use hash to discard multiple receives of the same payload
-    //   if a hash is in the queue we received this message recently (on another transport layer ?)
-    //   so we return and do not process this sample again
-    if(std::find(m_sample_hash_queue.begin(), m_sample_hash_queue.end(), hash_) != m_sample_hash_queue.end())
+    //   if a hash is in the window we received this message recently (on another transport layer ?)
+    //   so we return and do not process this sample again, otherwise the hash is stored
+    //   (replacing the oldest one if the window is full)
+    if (!m_sample_hash_window.Insert(hash_))
     {
 #ifndef NDEBUG
       // log it
@@ -456,11 +502,6 @@ namespace eCAL
 #endif
       return(size_);
     }
-    //   this is a new sample -> store its hash
-    m_sample_hash_queue.push_back(hash_);
-
-    // limit size of hash queue to the last 64 messages
-    while (m_sample_hash_queue.size() > hash_queue_size) m_sample_hash_queue.pop_front();
 
     // check id
     if (!m_id_set.empty())
@@ -501,49 +542,80 @@ namespace eCAL
     m_topic_size = size_;
 
     // execute callback
-    bool processed = false;
+    if(m_receive_callback)
     {
-      // call user receive callback function
-      if(m_receive_callback)
+      if (m_callback_strand)
       {
-#ifndef NDEBUG
-        // log it
-        Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::ReceiveCallback");
-#endif
-        // prepare data struct
-        SReceiveCallbackData cb_data;
-        cb_data.buf   = const_cast<char*>(payload_);
-        cb_data.size  = long(size_);
-        cb_data.id    = id_;
-        cb_data.time  = time_;
-        cb_data.clock = clock_;
-        // execute it
-        (m_receive_callback)(m_topic_name.c_str(), &cb_data);
-        processed = true;
+        // hand over to the callback executor (keeps the transport layer buffer or copies the payload)
+        m_callback_strand->Post(payload_, size_, id_, clock_, time_, buffer_);
+      }
+      else
+      {
+        // the callback may (un)register callbacks or destroy the subscriber, so it is called without the lock
+        lock.unlock();
+        ExecuteReceiveCallback(payload_, size_, id_, clock_, time_);
       }
     }
-
     // if not consumed by user receive call
-    if(!processed)
+    else
     {
-      // push sample into read buffer
-      const std::lock_guard<std::mutex> read_buffer_lock(m_read_buf_mutex);
-      m_read_buf.clear();
-      m_read_buf.assign(payload_, payload_ + size_);
-      m_read_time = time_;
-      m_read_buf_received = true;
-
-      // inform receive
-      m_read_buf_cv.notify_one();
+      // push sample into receive queue (may block with overflow policy block_overflow_qos,
+      // so release the lock to not block other transport layers and (un)registering a callback)
+      lock.unlock();
+      const bool queued = m_read_queue.Push(payload_, size_, time_);
 #ifndef NDEBUG
       // log it
-      Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Receive::Buffered");
+      if (queued) Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Receive::Buffered");
+      else        Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Receive::Dropped");
+#else
+      (void)queued;
 #endif
     }
 
     return(size_);
   }
 
+  void CDataReader::ExecuteReceiveCallback(const char* payload_, size_t size_, long long id_, long long clock_, long long time_)
+  {
+    // the callback is executed without holding a lock of the callback registration (it may remove itself)
+    std::shared_ptr<ReceiveCallbackT> receive_callback;
+    {
+      const std::lock_guard<std::mutex> lock(m_receive_callback_exec_sync);
+      receive_callback = m_receive_callback;
+    }
+    if (!receive_callback) return;
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::ReceiveCallback");
+#endif
+    // prepare data struct
+    SReceiveCallbackData cb_data;
+    cb_data.buf   = const_cast<char*>(payload_);
+    cb_data.size  = long(size_);
+    cb_data.id    = id_;
+    cb_data.time  = time_;
+    cb_data.clock = clock_;
+
+    // execute it (callbacks of different transport layers are not executed concurrently)
+    const std::lock_guard<std::mutex> call_lock(m_receive_callback_call_sync);
+    m_receive_callback_thread = std::this_thread::get_id();
+    const auto start_time = std::chrono::steady_clock::now();
+    (*receive_callback)(m_topic_name.c_str(), &cb_data);
+    m_callback_time_us += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+    m_callback_count++;
+    m_receive_callback_thread = std::thread::id();
+  }
+
+  void CDataReader::WaitForReceiveCallback()
+  {
+    // wait for a running callback (unless we are called from the callback itself)
+    if (m_receive_callback_thread != std::this_thread::get_id())
+    {
+      const std::lock_guard<std::mutex> call_lock(m_receive_callback_call_sync);
+    }
+  }
+
   bool CDataReader::AddReceiveCallback(ReceiveCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -551,11 +623,12 @@ namespace eCAL
     // store receive callback
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+      const std::lock_guard<std::mutex> exec_lock(m_receive_callback_exec_sync);
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::AddReceiveCallback");
 #endif
-      m_receive_callback = std::move(callback_);
+      m_receive_callback = std::make_shared<ReceiveCallbackT>(std::move(callback_));
     }
 
     return(true);
@@ -568,12 +641,14 @@ namespace eCAL
     // reset receive callback
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+      const std::lock_guard<std::mutex> exec_lock(m_receive_callback_exec_sync);
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::RemReceiveCallback");
 #endif
       m_receive_callback = nullptr;
     }
+    WaitForReceiveCallback();
 
     return(true);
   }
@@ -995,8 +1070,10 @@ namespace eCAL
     out << indent_ << "m_topic_info.name:                  " << m_topic_info.name                  << std::endl;
     out << indent_ << "m_topic_info.descriptor:            " << m_topic_info.descriptor            << std::endl;
     out << indent_ << "m_topic_size:                       " << m_topic_size                       << std::endl;
-    out << indent_ << "m_read_buf.size():                  " << m_read_buf.size()                  << std::endl;
-    out << indent_ << "m_read_time:                        " << m_read_time                        << std::endl;
+    out << indent_ << "m_read_queue.Size():                " << m_read_queue.Size()                << std::endl;
+    out << indent_ << "m_read_queue.GetDrops():            " << m_read_queue.GetDrops()            << std::endl;
+    out << indent_ << "m_callback_strand:                  " << (m_callback_strand != nullptr)     << std::endl;
+    out << indent_ << "m_callback_time_avg_us:             " << m_callback_time_avg_us             << std::endl;
     out << indent_ << "m_clock:                            " << m_clock                            << std::endl;
     out << indent_ << "frequency [mHz]:                    " << GetFrequency()                     << std::endl;
     out << indent_ << "m_created:                          " << m_created                          << std::endl;
@@ -26,7 +26,6 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
-#include <deque>
 #include <ecal/ecal.h>
 #include <ecal/ecal_callback.h>
 #include <ecal/ecal_types.h>
@@ -41,6 +40,9 @@
 #endif
 
 #include "util/ecal_expmap.h"
+#include "util/ecal_hash_window.h"
+#include "ecal_reader_queue.h"
+#include "ecal_callback_executor.h"
 
 #include <condition_variable>
 #include <mutex>
@@ -49,13 +51,14 @@
 #include <queue>
 
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include <util/frequency_calculator.h>
 
 namespace eCAL
 {
-  class CDataReader
+  class CDataReader : public std::enable_shared_from_this<CDataReader>
   {
   public:
     CDataReader();
@@ -110,7 +113,7 @@ namespace eCAL
     void RefreshRegistration();
     void CheckReceiveTimeout();
 
-    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_);
+    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SharedPayloadT& buffer_ = nullptr);
 
   protected:
     void SubscribeToLayers();
@@ -122,6 +125,8 @@ namespace eCAL
     void Connect(const std::string& tid_, const SDataTypeInformation& topic_info_);
     void Disconnect();
     bool CheckMessageClock(const std::string& tid_, long long current_clock_);
+    void ExecuteReceiveCallback(const char* payload_, size_t size_, long long id_, long long clock_, long long time_);
+    void WaitForReceiveCallback();
 
     int32_t GetFrequency();
 
@@ -144,18 +149,22 @@ namespace eCAL
     ConnectedMapT                             m_loc_pub_map;
     ConnectedMapT                             m_ext_pub_map;
 
-    mutable std::mutex                        m_read_buf_mutex;
-    std::condition_variable                   m_read_buf_cv;
-    bool                                      m_read_buf_received;
-    std::string                               m_read_buf;
-    long long                                 m_read_time;
+    CReaderQueue                              m_read_queue;
 
     std::mutex                                m_receive_callback_sync;
-    ReceiveCallbackT                          m_receive_callback;
+    std::mutex                                m_receive_callback_exec_sync;
+    std::shared_ptr<ReceiveCallbackT>         m_receive_callback;
+    std::mutex                                m_receive_callback_call_sync;
+    std::atomic<std::thread::id>              m_receive_callback_thread;
+    std::shared_ptr<CCallbackExecutor>        m_callback_executor;
+    std::shared_ptr<CCallbackStrand>          m_callback_strand;
+    std::atomic<long long>                    m_callback_count;
+    std::atomic<long long>                    m_callback_time_us;
+    long long                                 m_callback_time_avg_us;
     std::atomic<int>                          m_receive_timeout;
     std::atomic<int>                          m_receive_time;
 
-    std::deque<size_t>                        m_sample_hash_queue;
+    Util::CHashWindow                         m_sample_hash_window;
 
     std::mutex                                m_event_callback_map_sync;
     using EventCallbackMapT = std::map<eCAL_Subscriber_Event, SubEventCallbackT>;
@@ -0,0 +1,163 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  receive queue of a data reader
+**/
+
+#include "ecal_reader_queue.h"
+
+#include <chrono>
+#include <utility>
+
+namespace eCAL
+{
+  CReaderQueue::CReaderQueue() :
+    m_samples(1),
+    m_read_pos(0),
+    m_write_pos(0),
+    m_history_kind(QOS::keep_last_history_qos),
+    m_overflow(QOS::drop_oldest_overflow_qos),
+    m_stopped(false),
+    m_drops(0)
+  {
+  }
+
+  void CReaderQueue::Configure(QOS::eQOSPolicy_HistoryKind history_kind_, size_t depth_, QOS::eQOSPolicy_Overflow overflow_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    m_samples      = std::vector<SSample>(depth_ > 0 ? depth_ : 1);
+    m_read_pos     = 0;
+    m_write_pos    = 0;
+    m_history_kind = history_kind_;
+    m_overflow     = overflow_;
+    m_stopped   = false;
+    m_drops     = 0;
+  }
+
+  void CReaderQueue::Stop()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      m_read_pos = m_write_pos;
+      m_stopped  = true;
+    }
+    m_data_cv.notify_all();
+    m_space_cv.notify_all();
+  }
+
+  bool CReaderQueue::Push(const char* payload_, size_t size_, long long time_)
+  {
+    const std::lock_guard<std::mutex> push_lock(m_push_sync);
+
+    // copy the payload without holding the queue lock
+    m_push_buf.assign(payload_, payload_ + size_);
+
+    {
+      std::unique_lock<std::mutex> lock(m_sync);
+      if (m_stopped) return(false);
+
+      if (Full() && (m_history_kind == QOS::keep_all_history_qos))
+      {
+        Grow();
+      }
+      else if (Full())
+      {
+        switch (m_overflow)
+        {
+        case QOS::drop_newest_overflow_qos:
+          m_drops++;
+          return(false);
+        case QOS::block_overflow_qos:
+          m_space_cv.wait(lock, [this]() { return(m_stopped || !Full()); });
+          if (m_stopped) return(false);
+          break;
+        case QOS::drop_oldest_overflow_qos:
+        default:
+          m_read_pos++;
+          m_drops++;
+          break;
+        }
+      }
+
+      // hand over the buffer, the producer gets the old slot buffer (and its capacity) back
+      SSample& sample = m_samples[m_write_pos % m_samples.size()];
+      sample.buf.swap(m_push_buf);
+      sample.time = time_;
+      m_write_pos++;
+    }
+
+    // inform receive
+    m_data_cv.notify_one();
+    return(true);
+  }
+
+  bool CReaderQueue::Pop(std::string& buf_, long long* time_, int timeout_ms_)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_sync);
+
+      // no need to wait (for whatever time) if something has been received
+      if (Empty())
+      {
+        auto pred = [this]() { return(m_stopped || !Empty()); };
+        if (timeout_ms_ < 0)
+        {
+          m_data_cv.wait(lock, pred);
+        }
+        else if (timeout_ms_ > 0)
+        {
+          m_data_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms_), pred);
+        }
+      }
+      if (Empty()) return(false);
+
+      // swap content to target string
+      SSample& sample = m_samples[m_read_pos % m_samples.size()];
+      buf_.clear();
+      buf_.swap(sample.buf);
+      if (time_ != nullptr) *time_ = sample.time;
+      m_read_pos++;
+    }
+
+    // inform a blocked producer
+    m_space_cv.notify_one();
+    return(true);
+  }
+
+  void CReaderQueue::Grow()
+  {
+    // move the queued samples (oldest first) to the front of the doubled buffers
+    std::vector<SSample> samples(m_samples.size() * 2);
+    const size_t count = static_cast<size_t>(m_write_pos - m_read_pos);
+    for (size_t i = 0; i < count; ++i)
+    {
+      samples[i] = std::move(m_samples[(m_read_pos + i) % m_samples.size()]);
+    }
+    m_samples.swap(samples);
+    m_read_pos  = 0;
+    m_write_pos = count;
+  }
+
+  size_t CReaderQueue::Size() const
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    return(static_cast<size_t>(m_write_pos - m_read_pos));
+  }
+}
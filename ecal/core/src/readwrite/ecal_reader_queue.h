@@ -0,0 +1,118 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  receive queue of a data reader
+**/
+
+#pragma once
+
+#include <ecal/ecal_qos.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Queue of received samples, polled by CDataReader::Receive.
+   *
+   * All sample buffers are allocated once and swapped between the queue and
+   * the producer / consumer, so in steady state no memory is allocated.
+   * The payload is copied outside of the queue lock, the lock is only held to
+   * move the read / write positions and to swap the buffers. A keep all queue
+   * doubles its buffers whenever it is full.
+   *
+   * Push and Pop may be called from any thread, producers are serialized by
+   * the queue, so a blocked Push only blocks other producers.
+  **/
+  class CReaderQueue
+  {
+  public:
+    CReaderQueue();
+
+    /**
+     * @brief Allocate the queue and drop all queued samples.
+     *
+     * @param history_kind_  Keep last (bounded) or keep all (growing) samples.
+     * @param depth_         Maximum number of queued samples (at least 1), initial size for keep all.
+     * @param overflow_      Behavior if a sample is pushed into a full keep last queue.
+    **/
+    void Configure(QOS::eQOSPolicy_HistoryKind history_kind_, size_t depth_, QOS::eQOSPolicy_Overflow overflow_);
+
+    /**
+     * @brief Drop all queued samples and release blocked Push / Pop calls.
+    **/
+    void Stop();
+
+    /**
+     * @brief Queue a received sample.
+     *
+     * @return  True if the sample was queued, false if it was dropped.
+    **/
+    bool Push(const char* payload_, size_t size_, long long time_);
+
+    /**
+     * @brief Take the oldest queued sample.
+     *
+     * @param buf_         Target buffer (swapped with the queue buffer).
+     * @param time_        Receive time of the sample (optional).
+     * @param timeout_ms_  Maximum time to wait for a sample (-1 = infinite, 0 = no wait).
+     *
+     * @return  True if a sample was taken.
+    **/
+    bool Pop(std::string& buf_, long long* time_, int timeout_ms_);
+
+    size_t    Size()     const;
+    long long GetDrops() const { return(m_drops); };
+
+  protected:
+    struct SSample
+    {
+      std::string buf;
+      long long   time = 0;
+    };
+
+    bool Full() const  { return(m_write_pos - m_read_pos >= m_samples.size()); };
+    bool Empty() const { return(m_write_pos == m_read_pos); };
+    void Grow();
+
+    mutable std::mutex        m_sync;
+    std::condition_variable   m_data_cv;
+    std::condition_variable   m_space_cv;
+
+    std::vector<SSample>      m_samples;
+    std::uint64_t             m_read_pos;
+    std::uint64_t             m_write_pos;
+    QOS::eQOSPolicy_HistoryKind m_history_kind;
+    QOS::eQOSPolicy_Overflow  m_overflow;
+    bool                      m_stopped;
+
+    // serializes the producers, only touched by the producer holding it
+    std::mutex                m_push_sync;
+    std::string               m_push_buf;
+
+    std::atomic<long long>    m_drops;
+  };
+}
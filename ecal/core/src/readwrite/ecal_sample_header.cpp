@@ -0,0 +1,142 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  binary payload sample header (udp / tcp layer)
+**/
+
+#include "ecal_sample_header.h"
+
+#include "ecal_utils/portable_endian.h"
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+  const size_t fixed_header_size = 48;
+  const size_t alignment_bytes   = 8;
+
+  template <typename T>
+  void Write(char* buf_, T value_)
+  {
+    std::memcpy(buf_, &value_, sizeof(T));
+  }
+
+  template <typename T>
+  T Read(const char* buf_)
+  {
+    T value;
+    std::memcpy(&value, buf_, sizeof(T));
+    return value;
+  }
+}
+
+namespace eCAL
+{
+  namespace SampleHeader
+  {
+    size_t Create(const std::string& topic_name_, const std::string& topic_id_, const SWriterAttr& attr_, size_t align_offset_, std::vector<char>& header_)
+    {
+      const size_t max_string_size = std::numeric_limits<std::uint16_t>::max();
+      if ((topic_name_.size() > max_string_size) || (topic_id_.size() > max_string_size)) return(0);
+
+      const size_t unaligned_size = fixed_header_size + topic_name_.size() + topic_id_.size();
+      const size_t padding_size   = (alignment_bytes - ((align_offset_ + unaligned_size) % alignment_bytes)) % alignment_bytes;
+      const size_t header_size    = unaligned_size + padding_size;
+      if (header_size > max_string_size) return(0);
+
+      header_.resize(header_size);
+      char* buf = header_.data();
+
+      Write<std::uint8_t> (buf +  0, 0);
+      Write<std::uint8_t> (buf +  1, static_cast<std::uint8_t>(version));
+      Write<std::uint16_t>(buf +  2, htole16(static_cast<std::uint16_t>(header_size)));
+      Write<std::uint16_t>(buf +  4, htole16(static_cast<std::uint16_t>(topic_name_.size())));
+      Write<std::uint16_t>(buf +  6, htole16(static_cast<std::uint16_t>(topic_id_.size())));
+      Write<std::uint64_t>(buf +  8, htole64(static_cast<std::uint64_t>(attr_.id)));
+      Write<std::uint64_t>(buf + 16, htole64(static_cast<std::uint64_t>(attr_.clock)));
+      Write<std::uint64_t>(buf + 24, htole64(static_cast<std::uint64_t>(attr_.time)));
+      Write<std::uint64_t>(buf + 32, htole64(static_cast<std::uint64_t>(attr_.hash)));
+      Write<std::uint64_t>(buf + 40, htole64(static_cast<std::uint64_t>(attr_.len)));
+
+      std::memcpy(buf + fixed_header_size, topic_name_.data(), topic_name_.size());
+      std::memcpy(buf + fixed_header_size + topic_name_.size(), topic_id_.data(), topic_id_.size());
+      if (padding_size > 0) std::memset(buf + unaligned_size, 0, padding_size);
+
+      return(header_size);
+    }
+
+    bool Parse(const char* buf_, size_t len_, SSampleHeader& header_, const char*& payload_)
+    {
+      if (len_ < fixed_header_size)   return(false);
+      if (!IsSampleHeader(buf_, len_)) return(false);
+      if (Read<std::uint8_t>(buf_ + 1) != static_cast<std::uint8_t>(version)) return(false);
+
+      const size_t header_size = le16toh(Read<std::uint16_t>(buf_ + 2));
+      const size_t tname_size  = le16toh(Read<std::uint16_t>(buf_ + 4));
+      const size_t tid_size    = le16toh(Read<std::uint16_t>(buf_ + 6));
+      if (fixed_header_size + tname_size + tid_size > header_size) return(false);
+      if (header_size > len_)                                       return(false);
+
+      header_.id    = static_cast<long long>(le64toh(Read<std::uint64_t>(buf_ +  8)));
+      header_.clock = static_cast<long long>(le64toh(Read<std::uint64_t>(buf_ + 16)));
+      header_.time  = static_cast<long long>(le64toh(Read<std::uint64_t>(buf_ + 24)));
+      header_.hash  = le64toh(Read<std::uint64_t>(buf_ + 32));
+      header_.size  = le64toh(Read<std::uint64_t>(buf_ + 40));
+      if (header_.size > len_ - header_size) return(false);
+
+      // assign keeps the capacity of the strings, so parsing a sample of the same topic does not allocate
+      header_.topic_name.assign(buf_ + fixed_header_size, tname_size);
+      header_.topic_id.assign(buf_ + fixed_header_size + tname_size, tid_size);
+
+      payload_ = buf_ + header_size;
+      return(true);
+    }
+
+    void CNegotiation::AddConnection(const std::string& connection_key_, std::int32_t reader_version_)
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      m_connection_versions[connection_key_] = reader_version_;
+      Update();
+    }
+
+    void CNegotiation::RemConnection(const std::string& connection_key_)
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      m_connection_versions.erase(connection_key_);
+      Update();
+    }
+
+    void CNegotiation::Update()
+    {
+      // without known readers we stay compatible
+      bool binary = !m_connection_versions.empty();
+      for (const auto& connection : m_connection_versions)
+      {
+        if (connection.second < version)
+        {
+          binary = false;
+          break;
+        }
+      }
+      m_binary = binary;
+    }
+  }
+}
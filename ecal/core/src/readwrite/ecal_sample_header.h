@@ -0,0 +1,127 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  binary payload sample header (udp / tcp layer)
+**/
+
+#pragma once
+
+#include "ecal_writer_data.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace SampleHeader
+  {
+    // current binary sample header version, announced by readers in the layer parameter
+    const std::int32_t version = 1;
+
+    /**
+     * @brief Payload sample attributes, transported in front of the payload.
+     *
+     * Wire layout (little endian):
+     *
+     *   uint8   marker       always 0, a serialized protobuf message never starts with 0
+     *   uint8   version
+     *   uint16  header_size  complete header size (offset of the payload)
+     *   uint16  tname_size
+     *   uint16  tid_size
+     *   int64   id
+     *   int64   clock
+     *   int64   time
+     *   uint64  hash
+     *   uint64  size         payload size
+     *   char    tname[tname_size]
+     *   char    tid[tid_size]
+     *   padding (payload alignment)
+    **/
+    struct SSampleHeader
+    {
+      std::string    topic_name;
+      std::string    topic_id;
+      long long      id    = 0;
+      long long      clock = 0;
+      long long      time  = 0;
+      std::uint64_t  hash  = 0;
+      std::uint64_t  size  = 0;
+    };
+
+    /**
+     * @brief Create the binary header of a payload sample.
+     *
+     * @param topic_name_    Topic name.
+     * @param topic_id_      Topic id.
+     * @param attr_          Payload sample attributes.
+     * @param align_offset_  Offset of the header in the sent message, the payload behind the header is 8 byte aligned relative to it.
+     * @param header_        Target buffer.
+     *
+     * @return  Size of the header.
+    **/
+    size_t Create(const std::string& topic_name_, const std::string& topic_id_, const SWriterAttr& attr_, size_t align_offset_, std::vector<char>& header_);
+
+    /**
+     * @brief Check if a buffer starts with a binary sample header (instead of a protobuf sample).
+    **/
+    inline bool IsSampleHeader(const char* buf_, size_t len_) { return((len_ > 0) && (buf_[0] == 0)); }
+
+    /**
+     * @brief Parse the binary header of a payload sample.
+     *
+     * @param buf_      Received message.
+     * @param len_      Size of the received message.
+     * @param header_   Parsed header.
+     * @param payload_  Pointer to the payload behind the header.
+     *
+     * @return  true if it succeeds, false if the message is damaged or has an unknown version.
+    **/
+    bool Parse(const char* buf_, size_t len_, SSampleHeader& header_, const char*& payload_);
+
+    /**
+     * @brief Tracks the sample header versions supported by the connected readers of a writer.
+     *
+     * The binary header is used only if all connected readers announced it,
+     * so older readers still receive protobuf samples.
+    **/
+    class CNegotiation
+    {
+    public:
+      CNegotiation() : m_binary(false) {};
+
+      void AddConnection(const std::string& connection_key_, std::int32_t reader_version_);
+      void RemConnection(const std::string& connection_key_);
+
+      bool UseBinaryHeader() const { return(m_binary); };
+
+    protected:
+      void Update();
+
+      std::mutex                          m_sync;
+      std::map<std::string, std::int32_t> m_connection_versions;
+      std::atomic<bool>                   m_binary;
+    };
+  }
+}
@@ -30,7 +30,7 @@
 #include <ecal/ecal_types.h>
 
 #include "ecal_def.h"
-#include "util/ecal_expmap.h"
+#include "util/ecal_hash_expmap.h"
 #include <util/frequency_calculator.h>
 
 
@@ -40,6 +40,7 @@
 #include "inproc/ecal_writer_inproc.h"
 
 #include <atomic>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <string>
@@ -62,6 +63,21 @@ namespace eCAL
         return std::tie(l.host_name, l.process_id, l.topic_id)
           < std::tie(r.host_name, r.process_id, r.topic_id);
       }
+
+      friend bool operator==(const SExternalSubscriptionInfo& l, const SExternalSubscriptionInfo& r)
+      {
+        return std::tie(l.host_name, l.process_id, l.topic_id)
+          == std::tie(r.host_name, r.process_id, r.topic_id);
+      }
+
+      struct Hash
+      {
+        size_t operator()(const SExternalSubscriptionInfo& info_) const
+        {
+          const std::hash<std::string> hash;
+          return (hash(info_.host_name) * 31 + hash(info_.process_id)) * 31 + hash(info_.topic_id);
+        }
+      };
     };
 
     struct SLocalSubscriptionInfo
@@ -74,6 +90,21 @@ namespace eCAL
         return std::tie(l.process_id, l.topic_id)
           < std::tie(r.process_id, r.topic_id);
       }
+
+      friend bool operator==(const SLocalSubscriptionInfo& l, const SLocalSubscriptionInfo& r)
+      {
+        return std::tie(l.process_id, l.topic_id)
+          == std::tie(r.process_id, r.topic_id);
+      }
+
+      struct Hash
+      {
+        size_t operator()(const SLocalSubscriptionInfo& info_) const
+        {
+          const std::hash<std::string> hash;
+          return hash(info_.process_id) * 31 + hash(info_.topic_id);
+        }
+      };
     };
 
     CDataWriter();
@@ -169,8 +200,8 @@ namespace eCAL
 
     std::atomic<bool>  m_connected;
 
-    using LocalConnectedMapT = Util::CExpMap<SLocalSubscriptionInfo, bool>;
-    using ExternalConnectedMapT = Util::CExpMap<SExternalSubscriptionInfo, bool>;
+    using LocalConnectedMapT = Util::CHashExpMap<SLocalSubscriptionInfo, bool, SLocalSubscriptionInfo::Hash>;
+    using ExternalConnectedMapT = Util::CHashExpMap<SExternalSubscriptionInfo, bool, SExternalSubscriptionInfo::Hash>;
     mutable std::mutex    m_sub_map_sync;
     LocalConnectedMapT    m_loc_sub_map;
     ExternalConnectedMapT m_ext_sub_map;
@@ -25,6 +25,7 @@
 
 #include "ecal_def.h"
 #include "readwrite/ecal_reader_layer.h"
+#include "io/shm/ecal_memfile_pool.h"
 
 #include <cstddef>
 #include <memory>
@@ -48,6 +49,6 @@ namespace eCAL
     void SetConnectionParameter(SReaderLayerPar& par_) override;
 
   private:
-    size_t OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_);
+    size_t OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, const MemFileBufferT& buffer_);
   };
 }
@@ -81,6 +81,9 @@ namespace eCAL
     m_memory_file_attr.reserve         = Config::GetMemfileOverprovisioningPercentage();
     m_memory_file_attr.timeout_open_ms = PUB_MEMFILE_OPEN_TO;
     m_memory_file_attr.timeout_ack_ms  = Config::GetMemfileAckTimeoutMs();
+    m_memory_file_attr.ring_slots      = Config::GetMemfileRingSlotCount();
+    m_memory_file_attr.ack_pipelining  = Config::IsMemfileAckPipeliningEnabled();
+    m_memory_file_attr.ack_counter     = Config::IsMemfileAckCounterEnabled();
 
     // initialize memory file buffer
     m_created = SetBufferCount(m_buffer_count);;
@@ -107,6 +107,29 @@ namespace eCAL
     // extract data payload
     const char* data_payload   = header_payload + header_size;
 
+    // binary sample header
+    if (SampleHeader::IsSampleHeader(header_payload, header_size))
+    {
+      const char* payload(nullptr);
+      if (SampleHeader::Parse(header_payload, data_.buffer_->size() - header_length, m_sample_header, payload))
+      {
+        if (g_subgate() != nullptr)
+        {
+          g_subgate()->ApplySample(
+            m_sample_header.topic_name,
+            m_sample_header.topic_id,
+            payload,
+            static_cast<size_t>(m_sample_header.size),
+            m_sample_header.id,
+            m_sample_header.clock,
+            m_sample_header.time,
+            static_cast<size_t>(m_sample_header.hash),
+            eCAL::pb::tl_ecal_tcp);
+        }
+      }
+      return;
+    }
+
     // parse header
     if (m_ecal_header.ParseFromArray(header_payload, static_cast<int>(header_size)))
     {
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "readwrite/ecal_reader_layer.h"
+#include "readwrite/ecal_sample_header.h"
 
 #include <cstdint>
 #include <memory>
@@ -61,6 +62,7 @@ namespace eCAL
     std::shared_ptr<tcp_pubsub::Subscriber> m_subscriber;
     bool                                    m_callback_active;
     eCAL::pb::Sample                        m_ecal_header;
+    SampleHeader::SSampleHeader             m_sample_header;
   };
 
   ////////////////
@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -114,6 +115,34 @@ namespace eCAL
   {
     if (!m_publisher) return false;
 
+    // create header (binary if all readers support it, protobuf otherwise)
+    if (m_sample_header_negotiation.UseBinaryHeader())
+    {
+      CreateBinaryHeader(attr_);
+    }
+    else
+    {
+      CreateProtoHeader(attr_);
+    }
+
+    // create tcp send buffer
+    std::vector<std::pair<const char* const, const size_t>> send_vec;
+    send_vec.reserve(2);
+
+    // push header data
+    send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
+    // push payload data
+    send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
+
+    // send it
+    const bool success = m_publisher->send(send_vec);
+
+    // return success
+    return success;
+  }
+
+  void CDataWriterTCP::CreateProtoHeader(const SWriterAttr& attr_)
+  {
     // create new sample (header information only, no payload)
     m_ecal_header.Clear();
     auto *ecal_sample_mutable_topic = m_ecal_header.mutable_topic();
@@ -173,21 +202,54 @@ namespace eCAL
     m_header_buffer[1] = 'C';
     m_header_buffer[2] = 'A';
     m_header_buffer[3] = 'L';
+  }
 
-    // create tcp send buffer
-    std::vector<std::pair<const char* const, const size_t>> send_vec;
-    send_vec.reserve(2);
+  void CDataWriterTCP::CreateBinaryHeader(const SWriterAttr& attr_)
+  {
+    // Compute size of "ECAL" pre-header
+    constexpr size_t ecal_magic_size(4 * sizeof(char));
 
-    // push header data
-    send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
-    // push payload data
-    send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
+    // binary header right behind the size field, padded for aligning the payload
+    const size_t header_size = SampleHeader::Create(m_topic_name, m_topic_id, attr_, ecal_magic_size + sizeof(uint16_t), m_sample_header);
 
-    // send it
-    const bool success = m_publisher->send(send_vec);
+    //                     ECAL            +  header size field +  binary header
+    m_header_buffer.resize(ecal_magic_size + sizeof(uint16_t)   +  header_size);
 
-    // return success
-    return success;
+    // add size
+    *reinterpret_cast<uint16_t*>(&m_header_buffer[ecal_magic_size]) = htole16(static_cast<uint16_t>(header_size));
+
+    // copy header right after size field
+    if (header_size > 0) memcpy(m_header_buffer.data() + ecal_magic_size + sizeof(uint16_t), m_sample_header.data(), header_size);
+
+    // add magic ecal header :-)
+    m_header_buffer[0] = 'E';
+    m_header_buffer[1] = 'C';
+    m_header_buffer[2] = 'A';
+    m_header_buffer[3] = 'L';
+  }
+
+  void CDataWriterTCP::AddLocConnection(const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_)
+  {
+    eCAL::pb::ConnnectionPar connection_par;
+    connection_par.ParseFromString(conn_par_);
+    m_sample_header_negotiation.AddConnection(process_id_ + topic_id_, connection_par.layer_par_tcp().sample_header_version());
+  }
+
+  void CDataWriterTCP::RemLocConnection(const std::string& process_id_, const std::string& topic_id_)
+  {
+    m_sample_header_negotiation.RemConnection(process_id_ + topic_id_);
+  }
+
+  void CDataWriterTCP::AddExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_)
+  {
+    eCAL::pb::ConnnectionPar connection_par;
+    connection_par.ParseFromString(conn_par_);
+    m_sample_header_negotiation.AddConnection(host_name_ + process_id_ + topic_id_, connection_par.layer_par_tcp().sample_header_version());
+  }
+
+  void CDataWriterTCP::RemExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_)
+  {
+    m_sample_header_negotiation.RemConnection(host_name_ + process_id_ + topic_id_);
   }
 
   std::string CDataWriterTCP::GetConnectionParameter()
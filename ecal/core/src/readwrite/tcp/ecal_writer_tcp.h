@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "readwrite/ecal_sample_header.h"
 #include "readwrite/ecal_writer_base.h"
 
 #include <cstdint>
@@ -60,9 +61,18 @@ namespace eCAL
 
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
 
+    void AddLocConnection(const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_) override;
+    void RemLocConnection(const std::string& process_id_, const std::string& topic_id_) override;
+
+    void AddExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_) override;
+    void RemExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_) override;
+
     std::string GetConnectionParameter() override;
 
   private:
+    void CreateProtoHeader(const SWriterAttr& attr_);
+    void CreateBinaryHeader(const SWriterAttr& attr_);
+
     static std::mutex                            g_tcp_writer_executor_mtx;
     static std::shared_ptr<tcp_pubsub::Executor> g_tcp_writer_executor;
 
@@ -71,5 +81,7 @@ namespace eCAL
 
     eCAL::pb::Sample                             m_ecal_header;
     std::vector<char>                            m_header_buffer;
+    std::vector<char>                            m_sample_header;
+    SampleHeader::CNegotiation                   m_sample_header_negotiation;
   };
 }
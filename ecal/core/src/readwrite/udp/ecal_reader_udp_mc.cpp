@@ -63,7 +63,8 @@ namespace eCAL
       attr.rcvbuf    = Config::GetUdpMulticastRcvBufSizeBytes();
 
       // start payload sample receiver
-      m_payload_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CUDPReaderLayer::HasSample, this, std::placeholders::_1), std::bind(&CUDPReaderLayer::ApplySample, this, std::placeholders::_1));
+      m_payload_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CUDPReaderLayer::HasSample, this, std::placeholders::_1), std::bind(&CUDPReaderLayer::ApplySample, this, std::placeholders::_1),
+        std::bind(&CUDPReaderLayer::ApplyRawSample, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 
       m_started = true;
     }
@@ -112,4 +113,24 @@ namespace eCAL
     if (g_subgate() == nullptr) return false;
     return g_subgate()->ApplySample(ecal_sample_, eCAL::pb::eTLayerType::tl_ecal_udp_mc);
   }
+
+  bool CUDPReaderLayer::ApplyRawSample(const std::string& /*sample_name_*/, const char* buf_, size_t len_)
+  {
+    if (g_subgate() == nullptr) return false;
+
+    // only called from the receive thread, so the header can be reused
+    const char* payload(nullptr);
+    if (!SampleHeader::Parse(buf_, len_, m_sample_header, payload)) return false;
+
+    return g_subgate()->ApplySample(
+      m_sample_header.topic_name,
+      m_sample_header.topic_id,
+      payload,
+      static_cast<size_t>(m_sample_header.size),
+      m_sample_header.id,
+      m_sample_header.clock,
+      m_sample_header.time,
+      static_cast<size_t>(m_sample_header.hash),
+      eCAL::pb::eTLayerType::tl_ecal_udp_mc);
+  }
 }
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "readwrite/ecal_reader_layer.h"
+#include "readwrite/ecal_sample_header.h"
 
 #include "io/udp/ecal_udp_sample_receiver.h"
 
@@ -52,10 +53,12 @@ namespace eCAL
   private:
     bool HasSample(const std::string& sample_name_);
     bool ApplySample(const eCAL::pb::Sample& ecal_sample_);
+    bool ApplyRawSample(const std::string& sample_name_, const char* buf_, size_t len_);
 
     bool                                   m_started;
     bool                                   m_local_mode;
     std::shared_ptr<UDP::CSampleReceiver>  m_payload_receiver;
     std::map<std::string, int>             m_topic_name_mcast_map;
+    SampleHeader::SSampleHeader            m_sample_header;
   };
 }
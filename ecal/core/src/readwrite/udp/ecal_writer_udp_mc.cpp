@@ -98,43 +98,41 @@ namespace eCAL
   {
     if (!m_created) return false;
 
-    // create new sample
-    m_ecal_sample.Clear();
-    m_ecal_sample.set_cmd_type(eCAL::pb::bct_set_sample);
-    auto *ecal_sample_mutable_topic = m_ecal_sample.mutable_topic();
-    ecal_sample_mutable_topic->set_hname(m_host_name);
-    ecal_sample_mutable_topic->set_tname(m_topic_name);
-    ecal_sample_mutable_topic->set_tid(m_topic_id);
-
-    // set layer
-    auto *layer = ecal_sample_mutable_topic->add_tlayer();
-    layer->set_type(eCAL::pb::eTLayerType::tl_ecal_udp_mc);
-    layer->set_confirmed(true);
-
-    // append content
-    auto *ecal_sample_mutable_content = m_ecal_sample.mutable_content();
-    ecal_sample_mutable_content->set_id(attr_.id);
-    ecal_sample_mutable_content->set_clock(attr_.clock);
-    ecal_sample_mutable_content->set_time(attr_.time);
-    ecal_sample_mutable_content->set_hash(attr_.hash);
-    ecal_sample_mutable_content->set_size((google::protobuf::int32)attr_.len);
-    ecal_sample_mutable_content->set_payload(buf_, attr_.len);
-
-    // send it
     size_t sent = 0;
-    if (attr_.loopback)
+    if (m_sample_header_negotiation.UseBinaryHeader())
     {
-      if (m_sample_sender_loopback)
+      // binary sample header, the payload is gathered without copying it
+      if (SampleHeader::Create(m_topic_name, m_topic_id, attr_, 0, m_sample_header) > 0)
       {
-        sent = m_sample_sender_loopback->Send(m_ecal_sample.topic().tname(), m_ecal_sample, attr_.bandwidth);
+        sent = Send(m_topic_name, buf_, attr_);
       }
     }
     else
     {
-      if (m_sample_sender_no_loopback)
-      {
-        sent = m_sample_sender_no_loopback->Send(m_ecal_sample.topic().tname(), m_ecal_sample, attr_.bandwidth);
-      }
+      // create new sample
+      m_ecal_sample.Clear();
+      m_ecal_sample.set_cmd_type(eCAL::pb::bct_set_sample);
+      auto *ecal_sample_mutable_topic = m_ecal_sample.mutable_topic();
+      ecal_sample_mutable_topic->set_hname(m_host_name);
+      ecal_sample_mutable_topic->set_tname(m_topic_name);
+      ecal_sample_mutable_topic->set_tid(m_topic_id);
+
+      // set layer
+      auto *layer = ecal_sample_mutable_topic->add_tlayer();
+      layer->set_type(eCAL::pb::eTLayerType::tl_ecal_udp_mc);
+      layer->set_confirmed(true);
+
+      // append content
+      auto *ecal_sample_mutable_content = m_ecal_sample.mutable_content();
+      ecal_sample_mutable_content->set_id(attr_.id);
+      ecal_sample_mutable_content->set_clock(attr_.clock);
+      ecal_sample_mutable_content->set_time(attr_.time);
+      ecal_sample_mutable_content->set_hash(attr_.hash);
+      ecal_sample_mutable_content->set_size((google::protobuf::int32)attr_.len);
+      ecal_sample_mutable_content->set_payload(buf_, attr_.len);
+
+      // send it
+      sent = Send(m_ecal_sample.topic().tname(), nullptr, attr_);
     }
 
     // log it
@@ -145,4 +143,41 @@ namespace eCAL
 
     return(sent > 0);
   }
+
+  size_t CDataWriterUdpMC::Send(const std::string& sample_name_, const void* buf_, const SWriterAttr& attr_)
+  {
+    const std::shared_ptr<UDP::CSampleSender>& sample_sender = attr_.loopback ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+    if (!sample_sender) return(0);
+
+    // buf_ is set for raw samples only, otherwise the payload is part of the protobuf sample
+    if (buf_ != nullptr)
+    {
+      return(sample_sender->Send(sample_name_, m_sample_header, buf_, attr_.len, attr_.bandwidth));
+    }
+    return(sample_sender->Send(sample_name_, m_ecal_sample, attr_.bandwidth));
+  }
+
+  void CDataWriterUdpMC::AddLocConnection(const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_)
+  {
+    eCAL::pb::ConnnectionPar connection_par;
+    connection_par.ParseFromString(conn_par_);
+    m_sample_header_negotiation.AddConnection(process_id_ + topic_id_, connection_par.layer_par_udpmc().sample_header_version());
+  }
+
+  void CDataWriterUdpMC::RemLocConnection(const std::string& process_id_, const std::string& topic_id_)
+  {
+    m_sample_header_negotiation.RemConnection(process_id_ + topic_id_);
+  }
+
+  void CDataWriterUdpMC::AddExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_)
+  {
+    eCAL::pb::ConnnectionPar connection_par;
+    connection_par.ParseFromString(conn_par_);
+    m_sample_header_negotiation.AddConnection(host_name_ + process_id_ + topic_id_, connection_par.layer_par_udpmc().sample_header_version());
+  }
+
+  void CDataWriterUdpMC::RemExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_)
+  {
+    m_sample_header_negotiation.RemConnection(host_name_ + process_id_ + topic_id_);
+  }
 }
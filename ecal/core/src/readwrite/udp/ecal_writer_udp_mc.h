@@ -35,9 +35,11 @@
 #endif
 
 #include "io/udp/ecal_udp_sample_sender.h"
+#include "readwrite/ecal_sample_header.h"
 #include "readwrite/ecal_writer_base.h"
 
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -55,8 +57,18 @@ namespace eCAL
 
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
 
+    void AddLocConnection(const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_) override;
+    void RemLocConnection(const std::string& process_id_, const std::string& topic_id_) override;
+
+    void AddExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_) override;
+    void RemExtConnection(const std::string& host_name_, const std::string& process_id_, const std::string& topic_id_) override;
+
   protected:
+    size_t Send(const std::string& sample_name_, const void* buf_, const SWriterAttr& attr_);
+
     eCAL::pb::Sample                    m_ecal_sample;
+    SampleHeader::CNegotiation          m_sample_header_negotiation;
+    std::vector<char>                   m_sample_header;
 
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_loopback;
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_no_loopback;
@@ -0,0 +1,243 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL delta registration
+**/
+
+#include "ecal_registration_delta.h"
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include <initializer_list>
+#include <memory>
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    namespace
+    {
+      void IgnoreFields(google::protobuf::util::MessageDifferencer& differencer_, const google::protobuf::Descriptor* descriptor_, std::initializer_list<const char*> field_names_)
+      {
+        for (const char* field_name : field_names_)
+        {
+          const google::protobuf::FieldDescriptor* field = descriptor_->FindFieldByName(field_name);
+          if (field != nullptr) differencer_.IgnoreField(field);
+        }
+      }
+    }
+
+    bool IsSameState(const eCAL::pb::Sample& sample1_, const eCAL::pb::Sample& sample2_)
+    {
+      // the samples are compared field by field, without copying or serializing them (map fields are compared as maps)
+      thread_local std::unique_ptr<google::protobuf::util::MessageDifferencer> differencer;
+      if (!differencer)
+      {
+        differencer.reset(new google::protobuf::util::MessageDifferencer());
+
+        // delta registration fields and statistics
+        IgnoreFields(*differencer, eCAL::pb::Sample::descriptor(),  { "reg_sequence", "reg_version" });
+        IgnoreFields(*differencer, eCAL::pb::Topic::descriptor(),   { "rclock", "tsize", "message_drops", "queue_drops", "callback_queue_depth", "callback_time_us", "did", "dclock", "dfreq" });
+        IgnoreFields(*differencer, eCAL::pb::Service::descriptor(), { "rclock", "queued", "queued_max", "in_flight", "rejected" });
+        IgnoreFields(*differencer, eCAL::pb::Method::descriptor(),  { "call_count" });
+        IgnoreFields(*differencer, eCAL::pb::Client::descriptor(),  { "rclock" });
+      }
+      return(differencer->Compare(sample1_, sample2_));
+    }
+
+    bool IsSameSample(const eCAL::pb::Sample& sample1_, const eCAL::pb::Sample& sample2_)
+    {
+      thread_local std::unique_ptr<google::protobuf::util::MessageDifferencer> differencer;
+      if (!differencer)
+      {
+        differencer.reset(new google::protobuf::util::MessageDifferencer());
+
+        // delta registration fields and registration clock
+        IgnoreFields(*differencer, eCAL::pb::Sample::descriptor(),  { "reg_sequence", "reg_version" });
+        IgnoreFields(*differencer, eCAL::pb::Topic::descriptor(),   { "rclock" });
+        IgnoreFields(*differencer, eCAL::pb::Service::descriptor(), { "rclock" });
+        IgnoreFields(*differencer, eCAL::pb::Client::descriptor(),  { "rclock" });
+      }
+      return(differencer->Compare(sample1_, sample2_));
+    }
+
+    const std::string& GetEntityId(const eCAL::pb::Sample& sample_)
+    {
+      if (sample_.has_service()) return(sample_.service().sid());
+      if (sample_.has_client())  return(sample_.client().sid());
+      return(sample_.topic().tid());
+    }
+
+    void GetProcess(const eCAL::pb::Sample& sample_, std::string& host_name_, int& process_id_)
+    {
+      if (sample_.has_heartbeat())
+      {
+        host_name_  = sample_.heartbeat().hname();
+        process_id_ = sample_.heartbeat().pid();
+      }
+      else if (sample_.has_service())
+      {
+        host_name_  = sample_.service().hname();
+        process_id_ = sample_.service().pid();
+      }
+      else if (sample_.has_client())
+      {
+        host_name_  = sample_.client().hname();
+        process_id_ = sample_.client().pid();
+      }
+      else if (sample_.has_process())
+      {
+        host_name_  = sample_.process().hname();
+        process_id_ = sample_.process().pid();
+      }
+      else
+      {
+        host_name_  = sample_.topic().hname();
+        process_id_ = sample_.topic().pid();
+      }
+    }
+
+    std::string GetProcessKey(const eCAL::pb::Sample& sample_)
+    {
+      std::string host_name;
+      int         process_id(0);
+      GetProcess(sample_, host_name, process_id);
+      return(GetProcessKey(host_name, process_id));
+    }
+
+    std::string GetProcessKey(const std::string& host_name_, int process_id_)
+    {
+      return(host_name_ + ":" + std::to_string(process_id_));
+    }
+  }
+
+  bool CRegistrationDeltaCache::ApplySample(const SampleT& sample_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    SProcess& process = m_process_map[Registration::GetProcessKey(*sample_)];
+    process.last_seen = ClockT::now();
+
+    // every sample gets the next sequence number, a larger step means we lost one
+    const long long sequence = sample_->reg_sequence();
+    const bool      in_sync  = sequence <= process.sequence + 1;
+    if (sequence > process.sequence) process.sequence = sequence;
+
+    const std::string& id = Registration::GetEntityId(*sample_);
+    switch (sample_->cmd_type())
+    {
+    case eCAL::pb::bct_unreg_publisher:
+    case eCAL::pb::bct_unreg_subscriber:
+    case eCAL::pb::bct_unreg_service:
+    case eCAL::pb::bct_unreg_client:
+      process.entities.erase(id);
+      break;
+    default:
+    {
+      SEntity& entity = process.entities[id];
+      // a reordered sample must not replace a newer registration
+      if (!entity.sample || (sample_->reg_version() >= entity.version))
+      {
+        entity.sample    = sample_;
+        entity.version   = sample_->reg_version();
+        entity.heartbeat = process.heartbeat;
+        entity.applied   = process.last_seen;
+      }
+    }
+    break;
+    }
+
+    return(in_sync);
+  }
+
+  bool CRegistrationDeltaCache::ApplyHeartbeat(const eCAL::pb::Sample& heartbeat_, std::chrono::milliseconds refresh_interval_, SampleListT& refresh_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    SProcess& process = m_process_map[Registration::GetProcessKey(heartbeat_)];
+    const auto now = ClockT::now();
+    process.last_seen = now;
+
+    // the heartbeat is sent after all changes, its sequence number is the one of the last sample
+    //   (lost samples are reported once, the following samples are in sequence again)
+    bool in_sync = heartbeat_.reg_sequence() <= process.sequence;
+    if (!in_sync) process.sequence = heartbeat_.reg_sequence();
+
+    // keep all entities of the heartbeat, apply the ones again that were not applied for the refresh interval
+    process.heartbeat++;
+    for (const auto& heartbeat_entity : heartbeat_.heartbeat().entities())
+    {
+      auto iter = process.entities.find(heartbeat_entity.id());
+      if ((iter != process.entities.end()) && (iter->second.version == heartbeat_entity.version()))
+      {
+        iter->second.heartbeat = process.heartbeat;
+        if (now - iter->second.applied >= refresh_interval_)
+        {
+          iter->second.applied = now;
+          refresh_.push_back(iter->second.sample);
+        }
+      }
+      else
+      {
+        in_sync = false;
+      }
+    }
+
+    // entities not listed anymore have been unregistered
+    for (auto iter = process.entities.begin(); iter != process.entities.end();)
+    {
+      if (iter->second.heartbeat != process.heartbeat) iter = process.entities.erase(iter);
+      else                                             ++iter;
+    }
+
+    return(in_sync);
+  }
+
+  void CRegistrationDeltaCache::RemoveProcess(const std::string& process_key_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    m_process_map.erase(process_key_);
+  }
+
+  bool CRegistrationDeltaCache::AcquireResync(const std::string& process_key_, std::chrono::milliseconds interval_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    SProcess& process = m_process_map[process_key_];
+
+    const auto now = ClockT::now();
+    if ((process.last_resync != ClockT::time_point()) && (now - process.last_resync < interval_)) return(false);
+    process.last_resync = now;
+    return(true);
+  }
+
+  void CRegistrationDeltaCache::RemoveExpired(std::chrono::milliseconds timeout_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+
+    // called for every heartbeat, check only every 1/10 of the timeout
+    const auto now = ClockT::now();
+    if (now - m_last_expired_check < timeout_ / 10) return;
+    m_last_expired_check = now;
+
+    for (auto iter = m_process_map.begin(); iter != m_process_map.end();)
+    {
+      if (now - iter->second.last_seen > timeout_) iter = m_process_map.erase(iter);
+      else                                         ++iter;
+    }
+  }
+}
@@ -0,0 +1,154 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL delta registration
+ *
+ * In delta registration mode a process sends the registration sample of an entity
+ * (topic, service, client) only if the registration changed. Every registration
+ * refresh it sends a heartbeat with the id and the version of all its entities.
+ *
+ * Receivers keep the last registration sample of every entity. A heartbeat applies
+ * it again only if it was not applied for the refresh interval, this keeps the
+ * entity from expiring without dispatching every sample on every heartbeat.
+ * If a heartbeat lists an unknown version or a sequence number gap shows a lost
+ * sample the receiver requests the full registration state.
+ *
+**/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <ecal/core/pb/ecal.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    /**
+     * @brief Compare the registration state of two samples of an entity.
+     *
+     * Statistics changing with every registration refresh (registration clock,
+     * data clock, frequency, drops ..) are not part of the state.
+    **/
+    bool IsSameState(const eCAL::pb::Sample& sample1_, const eCAL::pb::Sample& sample2_);
+
+    /**
+     * @brief Compare the registration state and the statistics of two samples of an entity.
+     *
+     * Only the registration clock is ignored, it changes with every registration refresh.
+    **/
+    bool IsSameSample(const eCAL::pb::Sample& sample1_, const eCAL::pb::Sample& sample2_);
+
+    /**
+     * @brief Id of the registered entity (topic id, service id or client id).
+    **/
+    const std::string& GetEntityId(const eCAL::pb::Sample& sample_);
+
+    /**
+     * @brief Host name and process id of the sending process.
+    **/
+    void GetProcess(const eCAL::pb::Sample& sample_, std::string& host_name_, int& process_id_);
+
+    /**
+     * @brief Key of the sending process (host name and process id).
+    **/
+    std::string GetProcessKey(const eCAL::pb::Sample& sample_);
+    std::string GetProcessKey(const std::string& host_name_, int process_id_);
+  }
+
+  /**
+   * @brief Registration state of all processes using delta registration.
+  **/
+  class CRegistrationDeltaCache
+  {
+  public:
+    using SampleT     = std::shared_ptr<const eCAL::pb::Sample>;
+    using SampleListT = std::vector<SampleT>;
+
+    /**
+     * @brief Remember a (un)registration sample.
+     *
+     * @return  False if samples of the sending process were lost (resync required).
+    **/
+    bool ApplySample(const SampleT& sample_);
+
+    /**
+     * @brief Apply a heartbeat.
+     *
+     * @param heartbeat_         The heartbeat sample.
+     * @param refresh_interval_  Entities applied within the interval are not refreshed.
+     * @param refresh_           Registration samples of the known entities listed in the heartbeat to apply again.
+     *
+     * @return  False if the registration state of the sending process is outdated (resync required).
+    **/
+    bool ApplyHeartbeat(const eCAL::pb::Sample& heartbeat_, std::chrono::milliseconds refresh_interval_, SampleListT& refresh_);
+
+    /**
+     * @brief Forget a process.
+    **/
+    void RemoveProcess(const std::string& process_key_);
+
+    /**
+     * @brief Check if a resync of a process may be requested (at most once per interval).
+    **/
+    bool AcquireResync(const std::string& process_key_, std::chrono::milliseconds interval_);
+
+    /**
+     * @brief Forget processes without heartbeat for the timeout.
+    **/
+    void RemoveExpired(std::chrono::milliseconds timeout_);
+
+  protected:
+    using ClockT = std::chrono::steady_clock;
+
+    struct SEntity
+    {
+      SampleT            sample;
+      long long          version   = 0;
+      unsigned long      heartbeat = 0;
+      ClockT::time_point applied;
+    };
+
+    struct SProcess
+    {
+      long long                                 sequence  = 0;
+      unsigned long                             heartbeat = 0;
+      ClockT::time_point                        last_seen;
+      ClockT::time_point                        last_resync;
+      std::unordered_map<std::string, SEntity>  entities;
+    };
+
+    std::mutex                                  m_sync;
+    std::unordered_map<std::string, SProcess>   m_process_map;
+    ClockT::time_point                          m_last_expired_check;
+  };
+}
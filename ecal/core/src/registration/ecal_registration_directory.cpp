@@ -0,0 +1,168 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL shared memory registration directory
+**/
+
+#include "ecal_registration_directory.h"
+#include "ecal_registration_delta.h"
+#include "ecal_sample_to_topicinfo.h"
+
+#include <cstring>
+
+namespace eCAL
+{
+  ////////////////////////////////////////
+  // CRegistrationDirectoryWriter
+  ////////////////////////////////////////
+  bool CRegistrationDirectoryWriter::Set(const std::string& key_, const eCAL::pb::Sample& sample_, long long version_, bool refresh_)
+  {
+    SSlot& slot = m_slots[key_];
+    if (slot.id == 0) slot.id = m_next_slot_id++;
+
+    // serialize only if the readers have to decode it
+    if ((slot.sequence == 0) || slot.unregistered || (version_ != slot.version) || refresh_ || !Registration::IsSameSample(slot.sample, sample_))
+    {
+      slot.sample = sample_;
+      slot.sample.SerializeToString(&slot.data);
+      slot.sequence++;
+      slot.version      = version_;
+      slot.unregistered = false;
+      return(true);
+    }
+    return(false);
+  }
+
+  void CRegistrationDirectoryWriter::Unregister(const std::string& key_, const eCAL::pb::Sample& sample_)
+  {
+    SSlot& slot = m_slots[key_];
+    if (slot.id == 0) slot.id = m_next_slot_id++;
+
+    slot.sample = sample_;
+    slot.sample.SerializeToString(&slot.data);
+    slot.sequence++;
+    slot.unregistered = true;
+  }
+
+  void CRegistrationDirectoryWriter::Remove(const std::string& key_)
+  {
+    m_slots.erase(key_);
+  }
+
+  void CRegistrationDirectoryWriter::RemoveUnregistered()
+  {
+    for (auto iter = m_slots.begin(); iter != m_slots.end();)
+    {
+      if (iter->second.unregistered) iter = m_slots.erase(iter);
+      else                           ++iter;
+    }
+  }
+
+  const std::string& CRegistrationDirectoryWriter::GetBuffer()
+  {
+    size_t data_size(0);
+    for (const auto& slot : m_slots) data_size += slot.second.data.size();
+
+    const size_t table_size = sizeof(Registration::SDirectoryHeader) + m_slots.size() * sizeof(Registration::SDirectorySlot);
+    m_buffer.resize(table_size + data_size);
+
+    Registration::SDirectoryHeader header;
+    header.magic      = Registration::directory_magic;
+    header.slot_count = static_cast<std::uint32_t>(m_slots.size());
+    std::memcpy(&m_buffer[0], &header, sizeof(header));
+
+    size_t table_pos = sizeof(header);
+    size_t data_pos  = table_size;
+    for (const auto& iter : m_slots)
+    {
+      const SSlot& slot = iter.second;
+
+      Registration::SDirectorySlot directory_slot;
+      directory_slot.id       = slot.id;
+      directory_slot.sequence = slot.sequence;
+      directory_slot.offset   = static_cast<std::uint32_t>(data_pos);
+      directory_slot.size     = static_cast<std::uint32_t>(slot.data.size());
+      std::memcpy(&m_buffer[table_pos], &directory_slot, sizeof(directory_slot));
+      table_pos += sizeof(directory_slot);
+
+      if (!slot.data.empty()) std::memcpy(&m_buffer[data_pos], slot.data.data(), slot.data.size());
+      data_pos += slot.data.size();
+    }
+
+    return(m_buffer);
+  }
+
+  ////////////////////////////////////////
+  // CRegistrationDirectoryReader
+  ////////////////////////////////////////
+  int CRegistrationDirectoryReader::Read(const char* buffer_, size_t size_, std::chrono::milliseconds refresh_interval_, SampleListT& samples_)
+  {
+    samples_.clear();
+
+    Registration::SDirectoryHeader header;
+    if (size_ < sizeof(header)) return(-1);
+    std::memcpy(&header, buffer_, sizeof(header));
+    if (header.magic != Registration::directory_magic) return(-1);
+    if ((size_ - sizeof(header)) / sizeof(Registration::SDirectorySlot) < header.slot_count) return(-1);
+
+    m_scan++;
+    const auto now = ClockT::now();
+    int decoded(0);
+    for (std::uint32_t i = 0; i < header.slot_count; ++i)
+    {
+      Registration::SDirectorySlot directory_slot;
+      std::memcpy(&directory_slot, buffer_ + sizeof(header) + i * sizeof(directory_slot), sizeof(directory_slot));
+      if ((directory_slot.offset > size_) || (directory_slot.size > size_ - directory_slot.offset)) continue;
+
+      SSlot& slot = m_slots[directory_slot.id];
+      const bool changed = (slot.sequence != directory_slot.sequence);
+      if (changed)
+      {
+        // decode the changed slot
+        if (!m_parse_sample.ParseFromArray(buffer_ + directory_slot.offset, static_cast<int>(directory_slot.size)))
+        {
+          m_slots.erase(directory_slot.id);
+          continue;
+        }
+        //Remove in eCAL6
+        ModifyIncomingSampleForBackwardsCompatibility(m_parse_sample, slot.sample);
+        slot.sequence = directory_slot.sequence;
+        decoded++;
+      }
+      slot.scan = m_scan;
+
+      // report changed slots and refresh the unchanged ones before they expire
+      if (changed || (now - slot.reported >= refresh_interval_))
+      {
+        slot.reported = now;
+        samples_.push_back(&slot.sample);
+      }
+    }
+
+    // forget removed slots
+    for (auto iter = m_slots.begin(); iter != m_slots.end();)
+    {
+      if (iter->second.scan != m_scan) iter = m_slots.erase(iter);
+      else                             ++iter;
+    }
+
+    return(decoded);
+  }
+}
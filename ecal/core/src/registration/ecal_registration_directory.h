@@ -0,0 +1,172 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL shared memory registration directory
+ *
+ * Every process writes its registration samples into its own memory file (see
+ * ecal_memfile_broadcast_writer.h). The memory file is a directory, every
+ * entity (process, topic, service, client) owns a slot:
+ *
+ *   SDirectoryHeader | SDirectorySlot[slot_count] | serialized samples
+ *
+ * The sequence number of a slot changes only if the registration or the statistics
+ * of the entity changed, so readers keep the decoded samples and only decode and
+ * apply slots with a new sequence number. Unchanged slots are applied again before
+ * they expire.
+ *
+ * Processes of older eCAL versions write a SampleList of all registration samples
+ * into the memory file instead, readers detect it by the missing directory magic.
+ *
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <ecal/core/pb/ecal.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace eCAL
+{
+  namespace Registration
+  {
+#pragma pack(push, 1)
+    struct SDirectoryHeader
+    {
+      std::uint32_t magic;
+      std::uint32_t slot_count;
+    };
+
+    struct SDirectorySlot
+    {
+      std::uint64_t id;        // unique slot id (per writer)
+      std::uint64_t sequence;  // changes with every new sample content
+      std::uint32_t offset;    // sample offset from the start of the directory
+      std::uint32_t size;      // serialized sample size
+    };
+#pragma pack(pop)
+
+    constexpr std::uint32_t directory_magic = 0x44524345;  // "ECRD"
+  }
+
+  /**
+   * @brief Builds the registration directory of a process.
+  **/
+  class CRegistrationDirectoryWriter
+  {
+  public:
+    /**
+     * @brief Set the registration sample of an entity.
+     *
+     * @param key_       Entity key.
+     * @param sample_    Registration sample.
+     * @param version_   Registration version.
+     * @param refresh_   Update the sample even if it did not change (refresh the registration clock).
+     *
+     * The sample is only updated if the version, the statistics or refresh_ require it.
+     *
+     * @return  True if the slot has been updated.
+    **/
+    bool Set(const std::string& key_, const eCAL::pb::Sample& sample_, long long version_, bool refresh_);
+
+    /**
+     * @brief Set the unregistration sample of an entity, the slot is removed by RemoveUnregistered.
+    **/
+    void Unregister(const std::string& key_, const eCAL::pb::Sample& sample_);
+
+    /**
+     * @brief Remove the slot of an entity without unregistration sample.
+    **/
+    void Remove(const std::string& key_);
+
+    /**
+     * @brief Remove the slots of all unregistered entities.
+    **/
+    void RemoveUnregistered();
+
+    /**
+     * @brief Serialize the directory.
+    **/
+    const std::string& GetBuffer();
+
+  protected:
+    struct SSlot
+    {
+      std::uint64_t id           = 0;
+      std::uint64_t sequence     = 0;
+      long long     version      = 0;
+      bool             unregistered = false;
+      eCAL::pb::Sample sample;
+      std::string      data;
+    };
+
+    std::unordered_map<std::string, SSlot>  m_slots;
+    std::uint64_t                           m_next_slot_id = 1;
+    std::string                             m_buffer;
+  };
+
+  /**
+   * @brief Decodes the registration directory of a process.
+   *
+   * Keeps the decoded samples of all slots, a slot is only decoded again if its sequence number changed.
+  **/
+  class CRegistrationDirectoryReader
+  {
+  public:
+    using SampleListT = std::vector<const eCAL::pb::Sample*>;
+
+    /**
+     * @brief Read a directory.
+     *
+     * @param buffer_            The directory.
+     * @param size_              The directory size.
+     * @param refresh_interval_  Unchanged slots are reported again after this interval.
+     * @param samples_           Samples of the changed slots and of the slots due for refresh (valid until the next Read call).
+     *
+     * @return  Number of decoded slots, -1 for an invalid directory.
+    **/
+    int Read(const char* buffer_, size_t size_, std::chrono::milliseconds refresh_interval_, SampleListT& samples_);
+
+  protected:
+    using ClockT = std::chrono::steady_clock;
+
+    struct SSlot
+    {
+      std::uint64_t      sequence = 0;
+      unsigned long      scan     = 0;
+      ClockT::time_point reported;
+      eCAL::pb::Sample   sample;
+    };
+
+    std::unordered_map<std::uint64_t, SSlot>  m_slots;
+    unsigned long                             m_scan = 0;
+    eCAL::pb::Sample                          m_parse_sample;
+  };
+}
@@ -24,6 +24,12 @@
  * 
  * These information will be send cyclic (registration refresh) via UDP to external eCAL processes.
  * 
+ * In delta registration mode only changed entities are sent, followed by a heartbeat
+ * listing all entities (see ecal_registration_delta.h).
+ * 
+ * Shared memory monitoring writes a registration directory with one slot per entity,
+ * local readers only decode the slots that changed (see ecal_registration_directory.h).
+ * 
 **/
 
 #include <atomic>
@@ -32,9 +38,11 @@
 #include "ecal_def.h"
 #include "ecal_globals.h"
 #include "ecal_registration_provider.h"
+#include "ecal_registration_delta.h"
 #include "ecal_descgate.h"
 
 #include "io/udp/ecal_udp_configurations.h"
+#include "io/udp/ecal_udp_sample_receiver.h"
 #include "io/udp/ecal_udp_sample_sender.h"
 
 #include <chrono>
@@ -56,11 +64,21 @@ namespace eCAL
 
   std::atomic<bool> CRegistrationProvider::m_created;
 
+  namespace
+  {
+    // directory slot of the process registration (entity keys end with the numeric entity id)
+    const std::string directory_process_key("process");
+  }
+
   CRegistrationProvider::CRegistrationProvider() :
                     m_reg_refresh(CMN_REGISTRATION_REFRESH),
                     m_reg_topics(false),
                     m_reg_services(false),
                     m_reg_process(false),
+                    m_reg_delta(CMN_REGISTRATION_DELTA),
+                    m_reg_full_state_refresh(CMN_REGISTRATION_FULL_STATE_REFRESH),
+                    m_reg_full_state_requested(false),
+                    m_reg_sequence(0),
                     m_use_network_monitoring(false),
                     m_use_shm_monitoring(false)
 
@@ -82,6 +100,10 @@ namespace eCAL
     m_reg_services    = services_;
     m_reg_process     = process_;
 
+    m_reg_delta              = Config::IsRegistrationDeltaEnabled();
+    m_reg_full_state_refresh = std::chrono::milliseconds(Config::GetRegistrationFullStateRefreshMs());
+    m_reg_full_state_time    = std::chrono::steady_clock::time_point();
+
     m_use_shm_monitoring     = Config::Experimental::IsShmMonitoringEnabled();
     m_use_network_monitoring = !Config::Experimental::IsNetworkMonitoringDisabled();
 
@@ -147,13 +169,16 @@ namespace eCAL
     if(!m_reg_topics) return(false);
 
     const std::lock_guard<std::mutex> lock(m_topics_map_sync);
-    m_topics_map[topic_name_ + topic_id_] = ecal_sample_;
+    const std::string entry_key(topic_name_ + topic_id_);
+    SRegEntry& entry = m_topics_map[entry_key];
+    UpdateEntry(entry, ecal_sample_);
     if(force_)
     {
       RegisterProcess();
       // apply registration sample
-      ApplySample(topic_name_, ecal_sample_);
-      SendSampleList(false);
+      ApplyEntry(topic_name_, entry);
+      SetDirectoryEntry(entry_key, entry, false);
+      SendDirectory(false);
     }
 
     return(true);
@@ -163,15 +188,19 @@ namespace eCAL
   {
     if(!m_created) return(false);
 
+    SampleMapT::iterator iter;
+    const std::lock_guard<std::mutex> lock(m_topics_map_sync);
+
+    // remove the entity from the shared memory directory (map locked, the refresh cycle must not set it again)
+    UnregisterDirectoryEntry(topic_name_ + topic_id_, ecal_sample_, force_);
+
     if (force_)
     {
       // apply unregistration sample
-      ApplySample(topic_name_, ecal_sample_);
-      SendSampleList(false);
+      ApplyUnregistration(topic_name_, ecal_sample_);
+      SendDirectory(false);
     }
 
-    SampleMapT::iterator iter;
-    const std::lock_guard<std::mutex> lock(m_topics_map_sync);
     iter = m_topics_map.find(topic_name_ + topic_id_);
     if(iter != m_topics_map.end())
     {
@@ -188,31 +217,45 @@ namespace eCAL
     if(!m_reg_services) return(false);
 
     const std::lock_guard<std::mutex> lock(m_server_map_sync);
-    m_server_map[service_name_ + service_id_] = ecal_sample_;
+    const std::string entry_key(service_name_ + service_id_);
+    SRegEntry& entry = m_server_map[entry_key];
+    UpdateEntry(entry, ecal_sample_);
     if(force_)
     {
       RegisterProcess();
       // apply registration sample
-      ApplySample(service_name_, ecal_sample_);
-      SendSampleList(false);
+      ApplyEntry(service_name_, entry);
+      SetDirectoryEntry(entry_key, entry, false);
+      SendDirectory(false);
     }
 
     return(true);
   }
 
+  bool CRegistrationProvider::IsServerPublished(const std::string& service_name_, const std::string& service_id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_server_map_sync);
+    const auto iter = m_server_map.find(service_name_ + service_id_);
+    return((iter != m_server_map.end()) && iter->second.published);
+  }
+
   bool CRegistrationProvider::UnregisterServer(const std::string& service_name_, const std::string& service_id_, const eCAL::pb::Sample& ecal_sample_, const bool force_)
   {
     if(!m_created) return(false);
 
+    SampleMapT::iterator iter;
+    const std::lock_guard<std::mutex> lock(m_server_map_sync);
+
+    // remove the entity from the shared memory directory (map locked, the refresh cycle must not set it again)
+    UnregisterDirectoryEntry(service_name_ + service_id_, ecal_sample_, force_);
+
     if (force_)
     {
       // apply unregistration sample
-      ApplySample(service_name_, ecal_sample_);
-      SendSampleList(false);
+      ApplyUnregistration(service_name_, ecal_sample_);
+      SendDirectory(false);
     }
 
-    SampleMapT::iterator iter;
-    const std::lock_guard<std::mutex> lock(m_server_map_sync);
     iter = m_server_map.find(service_name_ + service_id_);
     if(iter != m_server_map.end())
     {
@@ -229,13 +272,16 @@ namespace eCAL
     if (!m_reg_services) return(false);
 
     const std::lock_guard<std::mutex> lock(m_client_map_sync);
-    m_client_map[client_name_ + client_id_] = ecal_sample_;
+    const std::string entry_key(client_name_ + client_id_);
+    SRegEntry& entry = m_client_map[entry_key];
+    UpdateEntry(entry, ecal_sample_);
     if (force_)
     {
       RegisterProcess();
       // apply registration sample
-      ApplySample(client_name_, ecal_sample_);
-      SendSampleList(false);
+      ApplyEntry(client_name_, entry);
+      SetDirectoryEntry(entry_key, entry, false);
+      SendDirectory(false);
     }
 
     return(true);
@@ -245,15 +291,19 @@ namespace eCAL
   {
     if (!m_created) return(false);
 
+    SampleMapT::iterator iter;
+    const std::lock_guard<std::mutex> lock(m_client_map_sync);
+
+    // remove the entity from the shared memory directory (map locked, the refresh cycle must not set it again)
+    UnregisterDirectoryEntry(client_name_ + client_id_, ecal_sample_, force_);
+
     if (force_)
     {
       // apply unregistration sample
-      ApplySample(client_name_, ecal_sample_);
-      SendSampleList(false);
+      ApplyUnregistration(client_name_, ecal_sample_);
+      SendDirectory(false);
     }
 
-    SampleMapT::iterator iter;
-    const std::lock_guard<std::mutex> lock(m_client_map_sync);
     iter = m_client_map.find(client_name_ + client_id_);
     if (iter != m_client_map.end())
     {
@@ -328,9 +378,22 @@ namespace eCAL
 
     process_sample_mutable_process->set_ecal_runtime_version(eCAL::GetVersionString());
 
+    // udp receive statistics
+    const UDP::SReceiveStatistics udp_statistics = UDP::GetReceiveStatistics();
+    process_sample_mutable_process->set_udp_socket_drops(google::protobuf::int64(udp_statistics.socket_drops));
+    process_sample_mutable_process->set_udp_incomplete_msgs(google::protobuf::int64(udp_statistics.incomplete_messages));
+    process_sample_mutable_process->set_udp_defrag_timeouts(google::protobuf::int64(udp_statistics.reassembly_timeouts));
+
     // apply registration sample
     const bool return_value = ApplySample(Process::GetHostName(), process_sample);
 
+    // the process statistics change with every refresh
+    if (m_use_shm_monitoring)
+    {
+      const std::lock_guard<std::mutex> lock(m_directory_sync);
+      m_directory.Set(directory_process_key, process_sample, 0, true);
+    }
+
     return return_value;
   }
 
@@ -350,22 +413,28 @@ namespace eCAL
     // apply unregistration sample
     const bool return_value = ApplySample(Process::GetHostName(), process_sample);
 
+    if (m_use_shm_monitoring)
+    {
+      const std::lock_guard<std::mutex> lock(m_directory_sync);
+      m_directory.Unregister(directory_process_key, process_sample);
+    }
+
 	  return return_value;
   }
 
-  bool CRegistrationProvider::RegisterServer()
+  bool CRegistrationProvider::RegisterServer(const bool full_state_, const bool refresh_statistics_)
   {
     if(!m_created)      return(false);
     if(!m_reg_services) return(false);
 
     bool return_value {true};
     const std::lock_guard<std::mutex> lock(m_server_map_sync);
-    for(SampleMapT::const_iterator iter = m_server_map.begin(); iter != m_server_map.end(); ++iter)
+    for(SampleMapT::iterator iter = m_server_map.begin(); iter != m_server_map.end(); ++iter)
     {
       //////////////////////////////////////////////
       // update description
       //////////////////////////////////////////////
-      const auto& ecal_sample_service = iter->second.service();
+      const auto& ecal_sample_service = iter->second.sample.service();
       for (const auto& method : ecal_sample_service.methods())
       {
         SDataTypeInformation request_type;
@@ -381,59 +450,159 @@ namespace eCAL
       //////////////////////////////////////////////
       // send sample to registration layer
       //////////////////////////////////////////////
-      return_value &= ApplySample(iter->second.service().sname(), iter->second);
+      if (full_state_ || iter->second.changed)
+        return_value &= ApplyEntry(iter->second.sample.service().sname(), iter->second);
+      SetDirectoryEntry(iter->first, iter->second, refresh_statistics_);
     }
 
     return return_value;
   }
 
-  bool CRegistrationProvider::RegisterClient()
+  bool CRegistrationProvider::RegisterClient(const bool full_state_, const bool refresh_statistics_)
   {
     if (!m_created)      return(false);
     if (!m_reg_services) return(false);
 
     bool return_value {true};
     const std::lock_guard<std::mutex> lock(m_client_map_sync);
-    for (SampleMapT::const_iterator iter = m_client_map.begin(); iter != m_client_map.end(); ++iter)
+    for (SampleMapT::iterator iter = m_client_map.begin(); iter != m_client_map.end(); ++iter)
     {
       // apply registration sample
-      return_value &= ApplySample(iter->second.client().sname(), iter->second);
+      if (full_state_ || iter->second.changed)
+        return_value &= ApplyEntry(iter->second.sample.client().sname(), iter->second);
+      SetDirectoryEntry(iter->first, iter->second, refresh_statistics_);
     }
 
     return return_value;
   }
 
-  bool CRegistrationProvider::RegisterTopics()
+  bool CRegistrationProvider::RegisterTopics(const bool full_state_, const bool refresh_statistics_)
   {
     if(!m_created)    return(false);
     if(!m_reg_topics) return(false);
 
     bool return_value {true};
     const std::lock_guard<std::mutex> lock(m_topics_map_sync);
-    for(SampleMapT::const_iterator iter = m_topics_map.begin(); iter != m_topics_map.end(); ++iter)
+    for(SampleMapT::iterator iter = m_topics_map.begin(); iter != m_topics_map.end(); ++iter)
     {
       //////////////////////////////////////////////
       // update description
       //////////////////////////////////////////////
       // read attributes
-      const std::string topic_name(iter->second.topic().tname());
+      const std::string topic_name(iter->second.sample.topic().tname());
       SDataTypeInformation topic_info;
-      const auto& pb_topic_datatype = iter->second.topic().tdatatype();
+      const auto& pb_topic_datatype = iter->second.sample.topic().tdatatype();
       topic_info.encoding = pb_topic_datatype.encoding();
       topic_info.name = pb_topic_datatype.name();
       topic_info.descriptor = pb_topic_datatype.desc();
-      const bool        topic_is_a_publisher(iter->second.cmd_type() == eCAL::pb::eCmdType::bct_reg_publisher);
+      const bool        topic_is_a_publisher(iter->second.sample.cmd_type() == eCAL::pb::eCmdType::bct_reg_publisher);
       ApplyTopicToDescGate(topic_name, topic_info, topic_is_a_publisher);
 
       //////////////////////////////////////////////
       // send sample to registration layer
       //////////////////////////////////////////////
-      return_value &= ApplySample(iter->second.topic().tname(), iter->second);
+      if (full_state_ || iter->second.changed)
+        return_value &= ApplyEntry(iter->second.sample.topic().tname(), iter->second);
+      SetDirectoryEntry(iter->first, iter->second, refresh_statistics_);
     }
 
     return return_value;
   }
 
+  bool CRegistrationProvider::RegisterHeartbeat()
+  {
+    if(!m_created) return(false);
+
+    eCAL::pb::Sample heartbeat_sample;
+    heartbeat_sample.set_cmd_type(eCAL::pb::bct_reg_heartbeat);
+    auto* heartbeat = heartbeat_sample.mutable_heartbeat();
+    heartbeat->set_hname(Process::GetHostName());
+    heartbeat->set_pid(Process::GetProcessID());
+
+    // list id and version of all entities
+    auto add_entities = [heartbeat](const SampleMapT& sample_map_)
+    {
+      for (const auto& iter : sample_map_)
+      {
+        auto* entity = heartbeat->add_entities();
+        entity->set_id(Registration::GetEntityId(iter.second.sample));
+        entity->set_version(iter.second.version);
+      }
+    };
+    {
+      const std::lock_guard<std::mutex> lock(m_server_map_sync);
+      add_entities(m_server_map);
+    }
+    {
+      const std::lock_guard<std::mutex> lock(m_client_map_sync);
+      add_entities(m_client_map);
+    }
+    {
+      const std::lock_guard<std::mutex> lock(m_topics_map_sync);
+      add_entities(m_topics_map);
+    }
+
+    // the heartbeat carries the sequence number of the last sent sample
+    const std::lock_guard<std::mutex> lock(m_reg_sequence_sync);
+    heartbeat_sample.set_reg_sequence(m_reg_sequence);
+    return ApplySample(Process::GetHostName(), heartbeat_sample);
+  }
+
+  void CRegistrationProvider::RequestFullState()
+  {
+    m_reg_full_state_requested = true;
+  }
+
+  bool CRegistrationProvider::RequestResync(const std::string& host_name_, int process_id_)
+  {
+    if(!m_created) return(false);
+
+    eCAL::pb::Sample resync_sample;
+    resync_sample.set_cmd_type(eCAL::pb::bct_reg_resync);
+    auto* resync_sample_mutable_process = resync_sample.mutable_process();
+    resync_sample_mutable_process->set_hname(host_name_);
+    resync_sample_mutable_process->set_pid(process_id_);
+
+    // shared memory readers always see the full directory, the request is sent via network only
+    return ApplySample(host_name_, resync_sample);
+  }
+
+  void CRegistrationProvider::UpdateEntry(SRegEntry& entry_, const eCAL::pb::Sample& sample_)
+  {
+    // the version is needed for delta registration and the shared memory directory,
+    // changing statistics do not count as registration change
+    if ((m_reg_delta || m_use_shm_monitoring) && ((entry_.version == 0) || !Registration::IsSameState(entry_.sample, sample_)))
+    {
+      entry_.version++;
+      entry_.changed = true;
+    }
+    entry_.sample    = sample_;
+    entry_.published = false;
+  }
+
+  bool CRegistrationProvider::ApplyEntry(const std::string& sample_name_, SRegEntry& entry_)
+  {
+    entry_.published = true;
+    if (!m_reg_delta) return ApplySample(sample_name_, entry_.sample);
+
+    // number the samples in send order, receivers detect lost samples by gaps
+    const std::lock_guard<std::mutex> lock(m_reg_sequence_sync);
+    entry_.sample.set_reg_sequence(++m_reg_sequence);
+    entry_.sample.set_reg_version(entry_.version);
+    entry_.changed = false;
+    return ApplySample(sample_name_, entry_.sample);
+  }
+
+  bool CRegistrationProvider::ApplyUnregistration(const std::string& sample_name_, const eCAL::pb::Sample& sample_)
+  {
+    if (!m_reg_delta) return ApplySample(sample_name_, sample_);
+
+    eCAL::pb::Sample unreg_sample(sample_);
+    const std::lock_guard<std::mutex> lock(m_reg_sequence_sync);
+    unreg_sample.set_reg_sequence(++m_reg_sequence);
+    return ApplySample(sample_name_, unreg_sample);
+  }
+
   bool CRegistrationProvider::ApplySample(const std::string& sample_name_, const eCAL::pb::Sample& sample_)
   {
     if(!m_created) return(false);
@@ -443,29 +612,41 @@ namespace eCAL
     if (m_use_network_monitoring && m_reg_sample_snd)
       return_value &= (m_reg_sample_snd->Send(sample_name_, sample_, -1) != 0);
 
-    if(m_use_shm_monitoring)
-    {
-      const std::lock_guard<std::mutex> lock(m_sample_list_sync);
-      m_sample_list.mutable_samples()->Add()->CopyFrom(sample_);
-    }
-
     return return_value;
   }
 
-  bool CRegistrationProvider::SendSampleList(bool reset_sample_list_)
+  void CRegistrationProvider::SetDirectoryEntry(const std::string& key_, SRegEntry& entry_, bool refresh_statistics_)
+  {
+    if(!m_use_shm_monitoring) return;
+
+    // the slot is only rewritten if the registration state or the statistics changed (or with the full state refresh cycle)
+    const std::lock_guard<std::mutex> lock(m_directory_sync);
+    if (m_directory.Set(key_, entry_.sample, entry_.version, refresh_statistics_)) entry_.published = true;
+  }
+
+  void CRegistrationProvider::UnregisterDirectoryEntry(const std::string& key_, const eCAL::pb::Sample& sample_, bool force_)
+  {
+    if(!m_use_shm_monitoring) return;
+
+    const std::lock_guard<std::mutex> lock(m_directory_sync);
+    if (force_) m_directory.Unregister(key_, sample_);
+    else        m_directory.Remove(key_);
+  }
+
+  bool CRegistrationProvider::SendDirectory(bool remove_unregistered_)
   {
     if(!m_created) return(false);
     bool return_value {true};
 
     if(m_use_shm_monitoring)
     {
-      const std::lock_guard<std::mutex> lock(m_sample_list_sync);
-      m_sample_list.SerializeToString(&m_sample_list_buffer);
-      if(reset_sample_list_)
-        m_sample_list.clear_samples();
+      const std::lock_guard<std::mutex> lock(m_directory_sync);
+      const std::string& directory_buffer = m_directory.GetBuffer();
+      return_value &= m_memfile_broadcast_writer.Write(directory_buffer.data(), directory_buffer.size());
 
-      if(!m_sample_list_buffer.empty())
-        return_value &=m_memfile_broadcast_writer.Write(m_sample_list_buffer.data(), m_sample_list_buffer.size());
+      // unregistrations are written with one registration refresh
+      if(remove_unregistered_)
+        m_directory.RemoveUnregistered();
     }
 
     return return_value;
@@ -493,20 +674,40 @@ namespace eCAL
     // refresh client registration
     if (g_clientgate() != nullptr) g_clientgate()->RefreshRegistrations();
 
+    // full state refresh cycle (a refresh of 0 disables the cycle, the shared memory directory is rewritten every time then)
+    const auto now = std::chrono::steady_clock::now();
+    bool refresh_statistics(true);
+    if (m_reg_full_state_refresh.count() > 0)
+    {
+      refresh_statistics = (now - m_reg_full_state_time >= m_reg_full_state_refresh);
+      if (refresh_statistics) m_reg_full_state_time = now;
+    }
+
+    // delta registration, send all entities on request or with the full state refresh cycle, otherwise only the changed ones
+    bool full_state(true);
+    if (m_reg_delta)
+    {
+      full_state = m_reg_full_state_requested.exchange(false);
+      if ((m_reg_full_state_refresh.count() > 0) && refresh_statistics) full_state = true;
+    }
+
     // register process
     RegisterProcess();
 
     // register server
-    RegisterServer();
+    RegisterServer(full_state, refresh_statistics);
 
     // register clients
-    RegisterClient();
+    RegisterClient(full_state, refresh_statistics);
 
     // register topics
-    RegisterTopics();
+    RegisterTopics(full_state, refresh_statistics);
+
+    // list all entities
+    if (m_reg_delta) RegisterHeartbeat();
 
-    // write sample list to shared memory
-    SendSampleList();
+    // write registration directory to shared memory
+    SendDirectory();
  }
 
   bool CRegistrationProvider::ApplyTopicToDescGate(const std::string& topic_name_
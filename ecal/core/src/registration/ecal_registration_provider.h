@@ -24,6 +24,12 @@
  *
  * These information will be send cyclic (registration refresh) via UDP to external eCAL processes.
  *
+ * In delta registration mode only changed entities are sent, followed by a heartbeat
+ * listing all entities (see ecal_registration_delta.h).
+ *
+ * Shared memory monitoring writes a registration directory with one slot per entity,
+ * local readers only decode the slots that changed (see ecal_registration_directory.h).
+ *
 **/
 
 #pragma once
@@ -33,9 +39,12 @@
 #include "io/shm/ecal_memfile_broadcast.h"
 #include "io/shm/ecal_memfile_broadcast_writer.h"
 
+#include "ecal_registration_directory.h"
+
 #include "util/ecal_thread.h"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -66,19 +75,43 @@ namespace eCAL
 
     bool RegisterServer(const std::string& service_name_, const std::string& service_id_, const eCAL::pb::Sample& ecal_sample_, bool force_);
     bool UnregisterServer(const std::string& service_name_, const std::string& service_id_, const eCAL::pb::Sample& ecal_sample_, bool force_);
+    // the last registration sample of the server (with its statistics) has been sent or written to the shared memory directory
+    bool IsServerPublished(const std::string& service_name_, const std::string& service_id_);
 
     bool RegisterClient(const std::string& client_name_, const std::string& client_id_, const eCAL::pb::Sample& ecal_sample_, bool force_);
     bool UnregisterClient(const std::string& client_name_, const std::string& client_id_, const eCAL::pb::Sample& ecal_sample_, bool force_);
 
+    // delta registration, send the full registration state with the next refresh
+    void RequestFullState();
+    // delta registration, ask another process to send its full registration state
+    bool RequestResync(const std::string& host_name_, int process_id_);
+
   protected:
+    struct SRegEntry
+    {
+      eCAL::pb::Sample sample;
+      long long        version    = 0;      // incremented on every change of the registration state (statistics excluded)
+      bool             changed    = true;   // changed since the last send
+      bool             published  = false;  // the sample (with its statistics) has been sent or written to the directory
+    };
+    using SampleMapT = std::unordered_map<std::string, SRegEntry>;
+
     bool RegisterProcess();
     bool UnregisterProcess();
       
-    bool RegisterServer();
-    bool RegisterClient();
-    bool RegisterTopics();
+    bool RegisterServer(bool full_state_, bool refresh_statistics_);
+    bool RegisterClient(bool full_state_, bool refresh_statistics_);
+    bool RegisterTopics(bool full_state_, bool refresh_statistics_);
+    bool RegisterHeartbeat();
+
+    void UpdateEntry(SRegEntry& entry_, const eCAL::pb::Sample& sample_);
+    bool ApplyEntry(const std::string& sample_name_, SRegEntry& entry_);
+    bool ApplyUnregistration(const std::string& sample_name_, const eCAL::pb::Sample& sample_);
 
     bool ApplySample(const std::string& sample_name_, const eCAL::pb::Sample& sample_);
+
+    void SetDirectoryEntry(const std::string& key_, SRegEntry& entry_, bool refresh_statistics_);
+    void UnregisterDirectoryEntry(const std::string& key_, const eCAL::pb::Sample& sample_, bool force_);
       
     void RegisterSendThread();
 
@@ -91,7 +124,7 @@ namespace eCAL
       , const SDataTypeInformation& request_type_information_
       , const SDataTypeInformation& response_type_information_);
 
-    bool SendSampleList(bool reset_sample_list_ = true);
+    bool SendDirectory(bool remove_unregistered_ = true);
 
     static std::atomic<bool>            m_created;
     int                                 m_reg_refresh;
@@ -102,7 +135,13 @@ namespace eCAL
     std::shared_ptr<UDP::CSampleSender> m_reg_sample_snd;
     std::shared_ptr<CCallbackThread>    m_reg_sample_snd_thread;
 
-    using SampleMapT = std::unordered_map<std::string, eCAL::pb::Sample>;
+    bool                                m_reg_delta;
+    std::chrono::milliseconds           m_reg_full_state_refresh;
+    std::chrono::steady_clock::time_point m_reg_full_state_time;
+    std::atomic<bool>                   m_reg_full_state_requested;
+    std::mutex                          m_reg_sequence_sync;
+    long long                           m_reg_sequence;
+
     std::mutex                          m_topics_map_sync;
     SampleMapT                          m_topics_map;
 
@@ -112,9 +151,8 @@ namespace eCAL
     std::mutex                          m_client_map_sync;
     SampleMapT                          m_client_map;
 
-    std::mutex                          m_sample_list_sync;
-    eCAL::pb::SampleList                m_sample_list;
-    std::string                         m_sample_list_buffer;
+    std::mutex                          m_directory_sync;
+    CRegistrationDirectoryWriter        m_directory;
 
     eCAL::CMemoryFileBroadcast          m_memfile_broadcast;
     eCAL::CMemoryFileBroadcastWriter    m_memfile_broadcast_writer;
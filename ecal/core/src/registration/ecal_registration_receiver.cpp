@@ -26,6 +26,7 @@
 **/
 
 #include "ecal_registration_receiver.h"
+#include "ecal_registration_provider.h"
 
 #include "pubsub/ecal_subgate.h"
 #include "pubsub/ecal_pubgate.h"
@@ -35,6 +36,7 @@
 #include "io/udp/ecal_udp_configurations.h"
 #include "ecal_sample_to_topicinfo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -44,6 +46,16 @@
 
 namespace eCAL
 {
+  namespace
+  {
+    // unchanged registrations are applied again before they expire in the gates or the monitoring
+    std::chrono::milliseconds GetRegistrationRefreshInterval()
+    {
+      const int expiration_ms = (std::min)(Config::GetRegistrationTimeoutMs(), Config::GetMonitoringTimeoutMs());
+      return(std::chrono::milliseconds(expiration_ms / 2));
+    }
+  }
+
   //////////////////////////////////////////////////////////////////
   // CMemfileRegistrationReceiver
   //////////////////////////////////////////////////////////////////
@@ -84,17 +96,38 @@ namespace eCAL
     MemfileBroadcastMessageListT message_list;
     if (m_memfile_broadcast_reader->Read(message_list, 0))
     {
-      eCAL::pb::SampleList sample_list;
-
+      const auto now = std::chrono::steady_clock::now();
+      const auto refresh_interval = GetRegistrationRefreshInterval();
       for (const auto& message : message_list)
       {
-        if (sample_list.ParseFromArray(message.data, static_cast<int>(message.size)))
+        // decode and apply only the registrations that changed since the last update or are due for refresh
+        SDirectory& directory = m_directories[message.event_id];
+        directory.last_seen = now;
+        if (directory.reader.Read(static_cast<const char*>(message.data), message.size, refresh_interval, m_directory_samples) < 0)
         {
-          for (const auto& sample : sample_list.samples())
+          // processes of older eCAL versions write all their samples as sample list
+          if (m_sample_list.ParseFromArray(message.data, static_cast<int>(message.size)))
           {
-            if (g_registration_receiver()) g_registration_receiver()->ApplySample(sample);
+            for (const auto& sample : m_sample_list.samples())
+            {
+              if (g_registration_receiver()) g_registration_receiver()->ApplySample(sample);
+            }
           }
+          continue;
         }
+
+        for (const auto* sample : m_directory_samples)
+        {
+          if (g_registration_receiver()) g_registration_receiver()->ApplyDirectorySample(*sample);
+        }
+      }
+
+      // forget the directories of terminated processes
+      const std::chrono::milliseconds timeout(Config::GetRegistrationTimeoutMs());
+      for (auto iter = m_directories.begin(); iter != m_directories.end();)
+      {
+        if (now - iter->second.last_seen > timeout) iter = m_directories.erase(iter);
+        else                                        ++iter;
       }
     }
   }
@@ -198,15 +231,58 @@ namespace eCAL
   {
     if(!m_created) return false;
 
+    // delta registration control samples
+    switch (ecal_sample_.cmd_type())
+    {
+    case eCAL::pb::bct_reg_heartbeat:
+      ApplyHeartbeat(ecal_sample_);
+      return true;
+    case eCAL::pb::bct_reg_resync:
+      ApplyResyncRequest(ecal_sample_);
+      return true;
+    case eCAL::pb::bct_unreg_process:
+      m_delta_cache.RemoveProcess(Registration::GetProcessKey(ecal_sample_));
+      break;
+    default:
+      break;
+    }
+
     //Remove in eCAL6
     // for the time being we need to copy the incoming sample and set the incompatible fields
-    eCAL::pb::Sample modified_ttype_sample;
-    ModifyIncomingSampleForBackwardsCompatibility(ecal_sample_, modified_ttype_sample);
+    auto modified_ttype_sample = std::make_shared<eCAL::pb::Sample>();
+    ModifyIncomingSampleForBackwardsCompatibility(ecal_sample_, *modified_ttype_sample);
+
+    // delta registration, keep the sample to apply it again on every heartbeat
+    if (modified_ttype_sample->reg_sequence() != 0)
+    {
+      if (!m_delta_cache.ApplySample(modified_ttype_sample))
+      {
+        std::string host_name;
+        int         process_id(0);
+        Registration::GetProcess(*modified_ttype_sample, host_name, process_id);
+        RequestResync(host_name, process_id);
+      }
+    }
 
+    ApplyRegistration(*modified_ttype_sample);
+    return true;
+  }
+
+  bool CRegistrationReceiver::ApplyDirectorySample(const eCAL::pb::Sample& ecal_sample_)
+  {
+    if(!m_created) return false;
+
+    // directory samples are complete and already converted, no delta registration handling needed
+    ApplyRegistration(ecal_sample_);
+    return true;
+  }
+
+  void CRegistrationReceiver::ApplyRegistration(const eCAL::pb::Sample& ecal_sample_)
+  {
     // forward all registration samples to outside "customer" (e.g. Monitoring)
     {
       const std::lock_guard<std::mutex> lock(m_callback_custom_apply_sample_mtx);
-      m_callback_custom_apply_sample(modified_ttype_sample);
+      m_callback_custom_apply_sample(ecal_sample_);
     }
 
     std::string reg_sample;
@@ -217,10 +293,10 @@ namespace eCAL
       || m_callback_process
       )
     {
-      reg_sample = modified_ttype_sample.SerializeAsString();
+      reg_sample = ecal_sample_.SerializeAsString();
     }
 
-    switch(modified_ttype_sample.cmd_type())
+    switch(ecal_sample_.cmd_type())
     {
     case eCAL::pb::bct_none:
     case eCAL::pb::bct_set_sample:
@@ -231,7 +307,7 @@ namespace eCAL
       if (m_callback_process) m_callback_process(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
       break;
     case eCAL::pb::bct_reg_service:
-      if (g_clientgate() != nullptr)  g_clientgate()->ApplyServiceRegistration(modified_ttype_sample);
+      if (g_clientgate() != nullptr)  g_clientgate()->ApplyServiceRegistration(ecal_sample_);
       if (m_callback_service) m_callback_service(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
       break;
     case eCAL::pb::bct_unreg_service:
@@ -248,20 +324,50 @@ namespace eCAL
       break;
     case eCAL::pb::bct_reg_subscriber:
     case eCAL::pb::bct_unreg_subscriber:
-      ApplySubscriberRegistration(modified_ttype_sample);
+      ApplySubscriberRegistration(ecal_sample_);
       if (m_callback_sub) m_callback_sub(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
       break;
     case eCAL::pb::bct_reg_publisher:
     case eCAL::pb::bct_unreg_publisher:
-      ApplyPublisherRegistration(modified_ttype_sample);
+      ApplyPublisherRegistration(ecal_sample_);
       if (m_callback_pub) m_callback_pub(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
       break;
     default:
       eCAL::Logging::Log(log_level_debug1, "CRegistrationReceiver::ApplySample : unknown sample type");
       break;
     }
+  }
 
-    return true;
+  void CRegistrationReceiver::ApplyHeartbeat(const eCAL::pb::Sample& ecal_sample_)
+  {
+    // apply the registrations of the known entities again if they are due for refresh
+    CRegistrationDeltaCache::SampleListT refresh_list;
+    const bool in_sync = m_delta_cache.ApplyHeartbeat(ecal_sample_, GetRegistrationRefreshInterval(), refresh_list);
+    for (const auto& sample : refresh_list)
+    {
+      ApplyRegistration(*sample);
+    }
+
+    // we lost samples or joined late
+    if (!in_sync) RequestResync(ecal_sample_.heartbeat().hname(), ecal_sample_.heartbeat().pid());
+
+    m_delta_cache.RemoveExpired(std::chrono::milliseconds(Config::GetRegistrationTimeoutMs()));
+  }
+
+  void CRegistrationReceiver::ApplyResyncRequest(const eCAL::pb::Sample& ecal_sample_)
+  {
+    // another process asks us for our full registration state
+    if ((ecal_sample_.process().hname() == Process::GetHostName()) && (ecal_sample_.process().pid() == Process::GetProcessID()))
+    {
+      if (g_registration_provider() != nullptr) g_registration_provider()->RequestFullState();
+    }
+  }
+
+  void CRegistrationReceiver::RequestResync(const std::string& host_name_, int process_id_)
+  {
+    // one request per registration refresh, the full state is sent with the next refresh
+    if (!m_delta_cache.AcquireResync(Registration::GetProcessKey(host_name_, process_id_), std::chrono::milliseconds(Config::GetRegistrationRefreshMs()))) return;
+    if (g_registration_provider() != nullptr) g_registration_provider()->RequestResync(host_name_, process_id_);
   }
 
   bool CRegistrationReceiver::AddRegistrationCallback(enum eCAL_Registration_Event event_, const RegistrationCallbackT& callback_)
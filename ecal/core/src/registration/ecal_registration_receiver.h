@@ -30,6 +30,8 @@
 #include <ecal/ecal.h>
 
 #include "ecal_def.h"
+#include "ecal_registration_delta.h"
+#include "ecal_registration_directory.h"
 
 #include "io/udp/ecal_udp_sample_receiver.h"
 
@@ -37,11 +39,13 @@
 #include "io/shm/ecal_memfile_broadcast_reader.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
@@ -74,9 +78,20 @@ namespace eCAL
   private:
     void Receive();
 
+    struct SDirectory
+    {
+      CRegistrationDirectoryReader           reader;
+      std::chrono::steady_clock::time_point  last_seen;
+    };
+
     CMemoryFileBroadcastReader*       m_memfile_broadcast_reader = nullptr;
     std::shared_ptr<CCallbackThread>  m_memfile_broadcast_reader_thread;
 
+    // registration directory of every process (by payload memory file)
+    std::unordered_map<std::uint64_t, SDirectory>  m_directories;
+    CRegistrationDirectoryReader::SampleListT      m_directory_samples;
+    eCAL::pb::SampleList                           m_sample_list;
+
     bool m_created = false;
   };
 
@@ -96,6 +111,7 @@ namespace eCAL
 
     bool HasSample(const std::string& /*sample_name_*/) { return(true); };
     bool ApplySample(const eCAL::pb::Sample& ecal_sample_);
+    bool ApplyDirectorySample(const eCAL::pb::Sample& ecal_sample_);
 
     bool AddRegistrationCallback(enum eCAL_Registration_Event event_, const RegistrationCallbackT& callback_);
     bool RemRegistrationCallback(enum eCAL_Registration_Event event_);
@@ -104,6 +120,11 @@ namespace eCAL
     void RemCustomApplySampleCallback();
 
   protected:
+    void ApplyRegistration(const eCAL::pb::Sample& ecal_sample_);
+    void ApplyHeartbeat(const eCAL::pb::Sample& ecal_sample_);
+    void ApplyResyncRequest(const eCAL::pb::Sample& ecal_sample_);
+    void RequestResync(const std::string& host_name_, int process_id_);
+
     void ApplySubscriberRegistration(const eCAL::pb::Sample& ecal_sample_);
     void ApplyPublisherRegistration(const eCAL::pb::Sample& ecal_sample_);
 
@@ -133,5 +154,7 @@ namespace eCAL
     ApplySampleCallbackT                  m_callback_custom_apply_sample;
 
     std::string                           m_host_group_name;
+
+    CRegistrationDeltaCache               m_delta_cache;
   };
 }
@@ -112,6 +112,7 @@ namespace eCAL
     service.version     = static_cast<unsigned int>(ecal_sample_service.version());
     service.tcp_port_v0 = static_cast<unsigned short>(ecal_sample_service.tcp_port_v0());
     service.tcp_port_v1 = static_cast<unsigned short>(ecal_sample_service.tcp_port_v1());
+    service.shm_name    = ecal_sample_service.shm_name();
 
     // store description
     for (const auto& method : ecal_sample_service.methods())
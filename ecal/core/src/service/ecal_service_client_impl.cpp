@@ -21,12 +21,15 @@
  * @brief  eCAL service client implementation
 **/
 
+#include <ecal/ecal_config.h>
+
 #include "ecal_global_accessors.h"
 
 #include "registration/ecal_registration_provider.h"
 #include "ecal_clientgate.h"
 #include "ecal_service_client_impl.h"
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
@@ -217,7 +220,7 @@ namespace eCAL
           auto response_shared_ptr = std::make_shared<std::string>();
           *request_shared_ptr      = request_pb.SerializeAsString();
           
-          auto error = client->second->call_service(request_shared_ptr, response_shared_ptr);
+          auto error = client->second.call_service(request_shared_ptr, response_shared_ptr);
           if (!error)
           {
             fromSerializedProtobuf(*response_shared_ptr, service_response_);
@@ -327,7 +330,7 @@ namespace eCAL
                         };
 
             // Call service asynchronously
-            const bool call_success = client->second->async_call_service(request_shared_ptr, response_callback);
+            const bool call_success = client->second.async_call_service(request_shared_ptr, response_callback);
 
             if (!call_success)
             {
@@ -569,7 +572,7 @@ namespace eCAL
                           }
                         };
 
-          if (client->second->async_call_service(request_shared_ptr, response_callback))
+          if (client->second.async_call_service(request_shared_ptr, response_callback))
             at_least_one_service_was_called = true;
         }
       }
@@ -688,7 +691,7 @@ namespace eCAL
       std::lock_guard<std::mutex> const lock(m_client_map_sync);
       for (auto& client : m_client_map)
       {
-        if (client.second->get_state() == eCAL::service::State::FAILED)
+        if (client.second.get_state() == eCAL::service::State::FAILED)
         {
           std::string const service_key = client.first;
 
@@ -757,6 +760,17 @@ namespace eCAL
                     // I have no idea why, but for some reason the event callbacks of the actual connetions are not even used. The connect / disconnect callbacks are executed whenever a new connection is found, and not when the client has actually connected or disconnected. I am preserving the previous behavior.
                   };
 
+        // Use the shared memory transport if the service runs on the same host
+        if (!iter.shm_name.empty() && (iter.hname == Process::GetHostName()) && Config::IsServiceShmTransportEnabled())
+        {
+          auto new_shm_session = std::make_shared<CServiceShmClient>();
+          if (new_shm_session->Create(iter.shm_name, Config::GetServiceShmBufferSize()))
+          {
+            m_client_map[iter.key].shm = new_shm_session;
+            continue;
+          }
+        }
+
         // Only connect via V0 protocol / V0 port, if V1 port is not available
         const auto protocol_version = (iter.tcp_port_v1 != 0 ? iter.version : 0);
         const auto port_to_use = (protocol_version == 0 ? iter.tcp_port_v0 : iter.tcp_port_v1);
@@ -764,7 +778,19 @@ namespace eCAL
         // Create the client and add it to the map
         const auto new_client_session = client_manager->create_client(static_cast<uint8_t>(protocol_version), iter.hname, port_to_use, event_callback);
         if (new_client_session)
-          m_client_map[iter.key] = new_client_session;
+          m_client_map[iter.key].tcp = new_client_session;
+      }
+    }
+
+    // close the shared memory sessions of services that are not registered anymore (crashed servers)
+    {
+      std::lock_guard<std::mutex> const lock(m_client_map_sync);
+      for (auto& client : m_client_map)
+      {
+        if (!client.second.shm) continue;
+
+        const bool registered = std::any_of(service_vec.begin(), service_vec.end(), [&client](const SServiceAttr& service) { return service.key == client.first; });
+        if (!registered) client.second.shm->Stop();
       }
     }
   }
@@ -27,6 +27,8 @@
 
 #include <ecal/service/client_session.h>
 
+#include "ecal_service_shm.h"
+
 #include <atomic>
 #include <map>
 #include <mutex>
@@ -108,7 +110,29 @@ namespace eCAL
 
     void ErrorCallback(const std::string &method_name_, const std::string &error_message_);
 
-    using ClientMapT = std::map<std::string, std::shared_ptr<eCAL::service::ClientSession>>;
+    // service session, shared memory transport for services on the same host, tcp otherwise
+    struct SClientSession
+    {
+      std::shared_ptr<eCAL::service::ClientSession> tcp;
+      std::shared_ptr<CServiceShmClient>            shm;
+
+      bool async_call_service(const std::shared_ptr<const std::string>& request_, const eCAL::service::ClientResponseCallbackT& callback_) const
+      {
+        return shm ? shm->CallAsync(request_, callback_) : tcp->async_call_service(request_, callback_);
+      }
+
+      eCAL::service::Error call_service(const std::shared_ptr<const std::string>& request_, std::shared_ptr<std::string>& response_) const
+      {
+        return shm ? shm->Call(request_, response_) : tcp->call_service(request_, response_);
+      }
+
+      eCAL::service::State get_state() const
+      {
+        return shm ? shm->GetState() : tcp->get_state();
+      }
+    };
+
+    using ClientMapT = std::map<std::string, SClientSession>;
     std::mutex            m_client_map_sync;
     ClientMapT            m_client_map;
 
@@ -123,7 +147,7 @@ namespace eCAL
     using ServiceAttrMapT = std::map<std::string, SServiceAttr>;
     ServiceAttrMapT       m_connected_services_map;
 
-    static constexpr int  m_client_version = 1;
+    static constexpr int  m_client_version = 2;
 
     std::string           m_service_name;
     std::string           m_service_id;
@@ -200,4 +200,28 @@ namespace eCAL
     if (!m_created) return false;
     return m_service_server_impl->IsConnected();
   }
+
+  /**
+   * @brief Set the execution policy of the method callbacks.
+   *
+   * @param policy_  The execution policy.
+   *
+   * @return  True if succeeded, false if not.
+  **/
+  bool CServiceServer::SetExecutionPolicy(const SServerExecutionPolicy& policy_)
+  {
+    if (!m_created) return false;
+    return m_service_server_impl->SetExecutionPolicy(policy_);
+  }
+
+  /**
+   * @brief Get the execution policy of the method callbacks.
+   *
+   * @return  The execution policy.
+  **/
+  SServerExecutionPolicy CServiceServer::GetExecutionPolicy()
+  {
+    if (!m_created) return SServerExecutionPolicy();
+    return m_service_server_impl->GetExecutionPolicy();
+  }
 }
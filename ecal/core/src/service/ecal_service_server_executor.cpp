@@ -0,0 +1,174 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  executor for service server method callbacks
+**/
+
+#include "ecal_service_server_executor.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace eCAL
+{
+  CServiceServerExecutor::CServiceServerExecutor(const SServerExecutionPolicy& policy_) :
+    m_policy(policy_),
+    m_stop(false),
+    m_queued(0),
+    m_queued_max(0),
+    m_queued_max_since_read(0),
+    m_in_flight(0),
+    m_rejected(0)
+  {
+  }
+
+  bool CServiceServerExecutor::Execute(const std::string& method_, TaskT task_)
+  {
+    if (m_policy.mode == server_execution_inline)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_sync);
+        if (m_stop) return(false);
+        m_in_flight++;
+      }
+      task_(true);
+      {
+        const std::lock_guard<std::mutex> lock(m_sync);
+        m_in_flight--;
+      }
+      return(true);
+    }
+
+    const std::lock_guard<std::mutex> lock(m_sync);
+    if (m_stop) return(false);
+
+    SQueue* queue = GetQueue(method_);
+    if (queue->tasks.size() >= std::max<size_t>(m_policy.queue_size, 1))
+    {
+      m_rejected++;
+      return(false);
+    }
+
+    queue->tasks.push_back(std::move(task_));
+    m_queued++;
+    m_queued_max            = std::max(m_queued_max, m_queued);
+    m_queued_max_since_read = std::max(m_queued_max_since_read, m_queued);
+    queue->cv.notify_one();
+    return(true);
+  }
+
+  void CServiceServerExecutor::Stop()
+  {
+    std::vector<TaskT>        discarded;
+    std::vector<std::thread>  threads;
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      if (m_stop) return;
+      m_stop = true;
+
+      auto discard = [&discarded](SQueue& queue_)
+      {
+        for (auto& task : queue_.tasks) discarded.push_back(std::move(task));
+        queue_.tasks.clear();
+        queue_.cv.notify_all();
+      };
+      discard(m_pool_queue);
+      for (auto& queue : m_method_queues) discard(*queue.second);
+      m_queued = 0;
+
+      threads.swap(m_threads);
+    }
+
+    // the sessions still wait for a response
+    for (const auto& task : discarded) task(false);
+
+    for (auto& thread : threads)
+    {
+      // stopped from a method callback
+      if (thread.get_id() == std::this_thread::get_id()) thread.detach();
+      else                                               thread.join();
+    }
+  }
+
+  CServiceServerExecutor::SStatistics CServiceServerExecutor::GetStatistics(bool published_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+
+    // the maximum of the last call has been published, a new measurement interval started with that call
+    if (published_) m_queued_max = m_queued_max_since_read;
+    m_queued_max_since_read = m_queued;
+
+    SStatistics statistics;
+    statistics.queued     = m_queued;
+    statistics.queued_max = m_queued_max;
+    statistics.in_flight  = m_in_flight;
+    statistics.rejected   = m_rejected;
+    return(statistics);
+  }
+
+  CServiceServerExecutor::SQueue* CServiceServerExecutor::GetQueue(const std::string& method_)
+  {
+    // threads are started with the first call (m_sync locked)
+    if (m_policy.mode == server_execution_method_thread)
+    {
+      auto& queue = m_method_queues[method_];
+      if (!queue)
+      {
+        queue = std::make_unique<SQueue>();
+        SQueue* method_queue = queue.get();
+        m_threads.emplace_back([me = shared_from_this(), method_queue]() { me->Worker(*method_queue); });
+      }
+      return(queue.get());
+    }
+
+    if (m_threads.empty())
+    {
+      const size_t thread_count = std::max<size_t>(m_policy.worker_threads, 1);
+      for (size_t i = 0; i < thread_count; ++i)
+      {
+        m_threads.emplace_back([me = shared_from_this()]() { me->Worker(me->m_pool_queue); });
+      }
+    }
+    return(&m_pool_queue);
+  }
+
+  void CServiceServerExecutor::Worker(SQueue& queue_)
+  {
+    std::unique_lock<std::mutex> lock(m_sync);
+    for (;;)
+    {
+      queue_.cv.wait(lock, [this, &queue_]() { return(m_stop || !queue_.tasks.empty()); });
+      if (m_stop) return;
+
+      TaskT task = std::move(queue_.tasks.front());
+      queue_.tasks.pop_front();
+      m_queued--;
+      m_in_flight++;
+
+      lock.unlock();
+      task(true);
+      // release the captured session before waiting again
+      task = nullptr;
+      lock.lock();
+
+      m_in_flight--;
+    }
+  }
+}
@@ -0,0 +1,117 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  executor for service server method callbacks
+**/
+
+#pragma once
+
+#include <ecal/ecal_service_info.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Executes the method calls of a service server according to its execution policy.
+   *
+   * The transport sessions hand over a call and wait for its response before they hand
+   * over the next one, so the calls of one client session are never executed concurrently
+   * or out of order.
+   *
+   * Must be created with std::make_shared and stopped before the last reference is released.
+  **/
+  class CServiceServerExecutor : public std::enable_shared_from_this<CServiceServerExecutor>
+  {
+  public:
+    // execute_ is false if the queued task was discarded (executor stopped)
+    using TaskT = std::function<void (bool execute_)>;
+
+    struct SStatistics
+    {
+      size_t    queued        = 0;  // currently queued calls
+      size_t    queued_max    = 0;  // maximum number of queued calls since the last published statistics
+      size_t    in_flight     = 0;  // currently executed calls
+      long long rejected      = 0;  // calls rejected because of a full queue
+    };
+
+    explicit CServiceServerExecutor(const SServerExecutionPolicy& policy_);
+
+    CServiceServerExecutor(const CServiceServerExecutor&) = delete;
+    CServiceServerExecutor& operator=(const CServiceServerExecutor&) = delete;
+
+    /**
+     * @brief Execute (inline) or queue a method call.
+     *
+     * @param method_  Method name (selects the thread in method thread mode).
+     * @param task_    The call.
+     *
+     * @return  False if the call was rejected (full queue or stopped), the task is not called then.
+    **/
+    bool Execute(const std::string& method_, TaskT task_);
+
+    /**
+     * @brief Discard all queued calls and join the threads (running calls are finished).
+    **/
+    void Stop();
+
+    /**
+     * @brief Get the execution statistics.
+     *
+     * @param published_  The statistics of the last call have been published, the maximum restarts with that call.
+    **/
+    SStatistics GetStatistics(bool published_);
+
+    const SServerExecutionPolicy& GetPolicy() const { return(m_policy); }
+
+  protected:
+    struct SQueue
+    {
+      std::deque<TaskT>         tasks;
+      std::condition_variable   cv;
+    };
+
+    SQueue* GetQueue(const std::string& method_);
+    void Worker(SQueue& queue_);
+
+    const SServerExecutionPolicy                     m_policy;
+
+    std::mutex                                       m_sync;
+    SQueue                                           m_pool_queue;
+    std::map<std::string, std::unique_ptr<SQueue>>   m_method_queues;
+    std::vector<std::thread>                         m_threads;
+    bool                                             m_stop;
+
+    size_t                                           m_queued;
+    size_t                                           m_queued_max;
+    size_t                                           m_queued_max_since_read;
+    size_t                                           m_in_flight;
+    long long                                        m_rejected;
+  };
+}
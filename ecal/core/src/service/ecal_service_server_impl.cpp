@@ -30,6 +30,7 @@
 #include "ecal_service_server_impl.h"
 
 #include <chrono>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -39,6 +40,29 @@
 
 #include "ecal_service_singleton_manager.h"
 
+namespace
+{
+  eCAL::SServerExecutionPolicy GetConfiguredExecutionPolicy()
+  {
+    eCAL::SServerExecutionPolicy policy;
+    switch (eCAL::Config::GetServiceServerExecutorMode())
+    {
+    case 1:
+      policy.mode = eCAL::server_execution_method_thread;
+      break;
+    case 2:
+      policy.mode = eCAL::server_execution_worker_pool;
+      break;
+    default:
+      policy.mode = eCAL::server_execution_inline;
+      break;
+    }
+    policy.worker_threads = eCAL::Config::GetServiceServerThreadCount();
+    policy.queue_size     = eCAL::Config::GetServiceServerQueueSize();
+    return policy;
+  }
+}
+
 namespace eCAL
 {
   std::shared_ptr<CServiceServerImpl> CServiceServerImpl::CreateInstance()
@@ -81,6 +105,12 @@ namespace eCAL
     if (!server_manager || server_manager->is_stopped())
       return false;
 
+    // create method call executor
+    {
+      const std::lock_guard<std::mutex> lock(m_executor_sync);
+      m_executor = std::make_shared<CServiceServerExecutor>(GetConfiguredExecutionPolicy());
+    }
+
     // Create callback functions
     const eCAL::service::Server::EventCallbackT event_callback
             = [weak_me = std::weak_ptr<CServiceServerImpl>(shared_from_this())]
@@ -105,15 +135,16 @@ namespace eCAL
                   me->EventCallback(ecal_server_event, message);
               };
     
-    const eCAL::service::Server::ServiceCallbackT service_callback
+    // the request is executed by the executor, the response is sent when the method callback returned
+    const eCAL::service::Server::AsyncServiceCallbackT service_callback
             = [weak_me = std::weak_ptr<CServiceServerImpl>(shared_from_this())]
-              (const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> int
+              (const std::shared_ptr<const std::string>& request, const eCAL::service::ServerResponseCallbackT& response_callback)
               {
                 auto me = weak_me.lock();
                 if (me)
-                  return me->RequestCallback(*request, *response);
+                  me->ExecuteRequest(request, response_callback);
                 else
-                  return -1;
+                  response_callback(std::make_shared<std::string>());
               };
 
     // start service protocol version 0
@@ -122,10 +153,49 @@ namespace eCAL
       m_tcp_server_v0 = server_manager->create_server(0, 0, service_callback, true, event_callback);
     }
 
-    // start service protocol version 1
+    // start service protocol version 1 (the handshake negotiates version 2 with pipelining clients)
     if (Config::IsServiceProtocolV1Enabled())
     {
-      m_tcp_server_v1 = server_manager->create_server(1, 0, service_callback, true, event_callback);
+      m_tcp_server_v1 = server_manager->create_server(m_server_version, 0, service_callback, true, event_callback);
+    }
+
+    // start shared memory transport (clients on the same host)
+    if (Config::IsServiceShmTransportEnabled())
+    {
+      const CServiceShmServer::RequestCallbackT shm_service_callback
+              = [weak_me = std::weak_ptr<CServiceServerImpl>(shared_from_this())]
+                (const std::string& request, std::string& response) -> int
+                {
+                  auto me = weak_me.lock();
+                  if (!me) return -1;
+
+                  // the channel thread waits for the response, so the calls of a client are executed in order
+                  auto response_promise = std::make_shared<std::promise<std::shared_ptr<std::string>>>();
+                  auto response_future  = response_promise->get_future();
+                  me->ExecuteRequest(std::make_shared<const std::string>(request)
+                                    , [response_promise](const std::shared_ptr<std::string>& response_)
+                                      {
+                                        response_promise->set_value(response_);
+                                      });
+                  response = std::move(*response_future.get());
+                  return 0;
+                };
+
+      const CServiceShmServer::EventCallbackT shm_event_callback
+              = [weak_me = std::weak_ptr<CServiceServerImpl>(shared_from_this())]
+                (bool connected)
+                {
+                  auto me = weak_me.lock();
+                  if (me)
+                    me->EventCallback(connected ? eCAL_Server_Event::server_event_connected : eCAL_Server_Event::server_event_disconnected, "");
+                };
+
+      m_shm_server = std::make_shared<CServiceShmServer>();
+      if (!m_shm_server->Create(shm_service_callback, shm_event_callback))
+      {
+        // clients fall back to tcp
+        m_shm_server.reset();
+      }
     }
 
     // mark as created
@@ -159,6 +229,22 @@ namespace eCAL
     if (m_tcp_server_v1)
       m_tcp_server_v1->stop();
 
+    if (m_shm_server)
+    {
+      m_shm_server->Destroy();
+      m_shm_server.reset();
+    }
+
+    // queued calls fail
+    {
+      const std::lock_guard<std::mutex> lock(m_executor_sync);
+      if (m_executor)
+      {
+        m_executor->Stop();
+        m_executor.reset();
+      }
+    }
+
     // mark as no more created (and prevent reregistering)
     m_created = false;
 
@@ -171,8 +257,9 @@ namespace eCAL
 
     {
       const std::lock_guard<std::mutex> connected_lock(m_connected_mutex);
-      m_connected_v0 = false;
-      m_connected_v1 = false;
+      m_connected_v0  = false;
+      m_connected_v1  = false;
+      m_connected_shm = false;
     }
 
     return(true);
@@ -307,7 +394,35 @@ namespace eCAL
     if (!m_created) return false;
 
     return (m_tcp_server_v0 && m_tcp_server_v0->is_connected())
-            || (m_tcp_server_v1 && m_tcp_server_v1->is_connected());
+            || (m_tcp_server_v1 && m_tcp_server_v1->is_connected())
+            || (m_shm_server    && m_shm_server->IsConnected());
+  }
+
+  bool CServiceServerImpl::SetExecutionPolicy(const SServerExecutionPolicy& policy_)
+  {
+    if (!m_created) return false;
+
+    std::shared_ptr<CServiceServerExecutor> old_executor;
+    {
+      const std::lock_guard<std::mutex> lock(m_executor_sync);
+      old_executor = m_executor;
+      m_executor   = std::make_shared<CServiceServerExecutor>(policy_);
+    }
+
+    // calls queued by the old executor fail
+    if (old_executor) old_executor->Stop();
+
+    // update registration
+    Register(false);
+
+    return true;
+  }
+
+  SServerExecutionPolicy CServiceServerImpl::GetExecutionPolicy()
+  {
+    const std::lock_guard<std::mutex> lock(m_executor_sync);
+    if (m_executor) return m_executor->GetPolicy();
+    return GetConfiguredExecutionPolicy();
   }
 
   // called by the eCAL::CServiceGate to register a client
@@ -349,6 +464,25 @@ namespace eCAL
     service_mutable_service->set_sid(m_service_id);
     service_mutable_service->set_tcp_port_v0(server_tcp_port_v0);
     service_mutable_service->set_tcp_port_v1(server_tcp_port_v1);
+    if (m_shm_server) service_mutable_service->set_shm_name(m_shm_server->GetName());
+
+    // add method call execution statistics
+    std::shared_ptr<CServiceServerExecutor> executor;
+    {
+      const std::lock_guard<std::mutex> lock(m_executor_sync);
+      executor = m_executor;
+    }
+    if (executor)
+    {
+      // the maximum queue length is measured from one published registration to the next
+      const bool published = (g_registration_provider() != nullptr) && g_registration_provider()->IsServerPublished(m_service_name, m_service_id);
+      const auto statistics = executor->GetStatistics(published);
+      service_mutable_service->set_exec_mode(static_cast<google::protobuf::int32>(executor->GetPolicy().mode));
+      service_mutable_service->set_queued(static_cast<google::protobuf::int32>(statistics.queued));
+      service_mutable_service->set_queued_max(static_cast<google::protobuf::int32>(statistics.queued_max));
+      service_mutable_service->set_in_flight(static_cast<google::protobuf::int32>(statistics.in_flight));
+      service_mutable_service->set_rejected(statistics.rejected);
+    }
 
     // add methods
     {
@@ -389,36 +523,83 @@ namespace eCAL
     if (g_registration_provider() != nullptr) g_registration_provider()->UnregisterServer(m_service_name, m_service_id, sample, true);
   }
 
-  int CServiceServerImpl::RequestCallback(const std::string& request_, std::string& response_)
+  void CServiceServerImpl::ExecuteRequest(const std::shared_ptr<const std::string>& request_, const eCAL::service::ServerResponseCallbackT& response_callback_)
   {
-    // prepare response
-    eCAL::pb::Response response_pb;
-    auto* response_pb_mutable_header = response_pb.mutable_header();
-    response_pb_mutable_header->set_hname(eCAL::Process::GetHostName());
-    response_pb_mutable_header->set_sname(m_service_name);
-    response_pb_mutable_header->set_sid(m_service_id);
-
     // try to parse request
-    eCAL::pb::Request  request_pb;
-    if (!request_pb.ParseFromString(request_))
+    auto request_pb = std::make_shared<eCAL::pb::Request>();
+    if (!request_pb->ParseFromString(*request_))
     {
-      Logging::Log(log_level_error, m_service_name + "::CServiceServerImpl::RequestCallback failed to parse request message");
+      Logging::Log(log_level_error, m_service_name + "::CServiceServerImpl::ExecuteRequest failed to parse request message");
+      response_callback_(std::make_shared<std::string>(CreateFailedResponse("", "Service '" + m_service_name + "' request message could not be parsed.")));
+      return;
+    }
 
-      response_pb_mutable_header->set_state(eCAL::pb::ServiceHeader_eCallState_failed);
-      std::string const emsg = "Service '" + m_service_name + "' request message could not be parsed.";
-      response_pb_mutable_header->set_error(emsg);
+    std::shared_ptr<CServiceServerExecutor> executor;
+    {
+      const std::lock_guard<std::mutex> lock(m_executor_sync);
+      executor = m_executor;
+    }
 
-      // serialize response and return "request message could not be parsed"
-      response_ = response_pb.SerializeAsString();
+    // unknown methods are answered directly, they would start a thread per method name otherwise
+    const std::string& method_name = request_pb->header().mname();
+    bool method_exists(true);
+    if (executor && (executor->GetPolicy().mode != server_execution_inline))
+    {
+      std::lock_guard<std::mutex> const lock(m_method_map_sync);
+      method_exists = (m_method_map.find(method_name) != m_method_map.end());
+    }
 
-      // Return Failed (error_code = -1), as parsing the request failed. The
-      // return value is not propagated to the remote caller.
-      return -1;
+    if (!executor || !method_exists)
+    {
+      auto response = std::make_shared<std::string>();
+      RequestCallback(*request_pb, *response);
+      response_callback_(response);
+      return;
     }
 
+    const bool accepted = executor->Execute(method_name
+                          , [weak_me = std::weak_ptr<CServiceServerImpl>(shared_from_this()), request_pb, response_callback_](bool execute_)
+                            {
+                              auto me = weak_me.lock();
+                              auto response = std::make_shared<std::string>();
+                              if (me && execute_)
+                                me->RequestCallback(*request_pb, *response);
+                              else if (me)
+                                *response = me->CreateFailedResponse(request_pb->header().mname(), "Service call was discarded, the server execution was stopped.");
+                              response_callback_(response);
+                            });
+
+    if (!accepted)
+    {
+      response_callback_(std::make_shared<std::string>(CreateFailedResponse(method_name, "Service '" + m_service_name + "' rejected the call, the execution queue is full or stopped.")));
+    }
+  }
+
+  std::string CServiceServerImpl::CreateFailedResponse(const std::string& method_name_, const std::string& error_)
+  {
+    eCAL::pb::Response response_pb;
+    auto* response_pb_mutable_header = response_pb.mutable_header();
+    response_pb_mutable_header->set_hname(eCAL::Process::GetHostName());
+    response_pb_mutable_header->set_sname(m_service_name);
+    response_pb_mutable_header->set_sid(m_service_id);
+    response_pb_mutable_header->set_mname(method_name_);
+    response_pb_mutable_header->set_state(eCAL::pb::ServiceHeader_eCallState_failed);
+    response_pb_mutable_header->set_error(error_);
+    return response_pb.SerializeAsString();
+  }
+
+  int CServiceServerImpl::RequestCallback(const eCAL::pb::Request& request_pb_, std::string& response_)
+  {
+    // prepare response
+    eCAL::pb::Response response_pb;
+    auto* response_pb_mutable_header = response_pb.mutable_header();
+    response_pb_mutable_header->set_hname(eCAL::Process::GetHostName());
+    response_pb_mutable_header->set_sname(m_service_name);
+    response_pb_mutable_header->set_sid(m_service_id);
+
     // get method
     SMethod method;
-    const auto& request_pb_header = request_pb.header();
+    const auto& request_pb_header = request_pb_.header();
     response_pb_mutable_header->set_mname(request_pb_header.mname());
     {
       std::lock_guard<std::mutex> const lock(m_method_map_sync);
@@ -451,7 +632,7 @@ namespace eCAL
     }
 
     // execute method (outside lock guard)
-    const std::string& request_s = request_pb.request();
+    const std::string& request_s = request_pb_.request();
     std::string response_s;
     int const service_return_state = method.callback(method.method_pb.mname(), method.method_pb.req_type(), method.method_pb.resp_type(), request_s, response_s);
 
@@ -514,6 +695,26 @@ namespace eCAL
           Logging::Log(log_level_debug2, m_service_name + ": " + "client with protocol version 1 connected");
         }
       }
+
+      // shared memory transport
+      if (m_connected_shm)
+      {
+        if (m_shm_server && !m_shm_server->IsConnected())
+        {
+          mode_changed    = true;
+          m_connected_shm = false;
+          Logging::Log(log_level_debug2, m_service_name + ": " + "client with shared memory transport disconnected");
+        }
+      }
+      else
+      {
+        if (m_shm_server && m_shm_server->IsConnected())
+        {
+          mode_changed    = true;
+          m_connected_shm = true;
+          Logging::Log(log_level_debug2, m_service_name + ": " + "client with shared memory transport connected");
+        }
+      }
     }
 
     if (mode_changed)
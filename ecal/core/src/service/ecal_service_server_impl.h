@@ -43,6 +43,9 @@
 
 #include <ecal/service/server.h>
 
+#include "ecal_service_server_executor.h"
+#include "ecal_service_shm.h"
+
 namespace eCAL
 {
   /**
@@ -84,6 +87,10 @@ namespace eCAL
     // check connection state
     bool IsConnected();
 
+    // set / get the execution policy of the method callbacks
+    bool SetExecutionPolicy(const SServerExecutionPolicy& policy_);
+    SServerExecutionPolicy GetExecutionPolicy();
+
     // called by the eCAL::CServiceGate to register a client
     void RegisterClient(const std::string& key_, const SClientAttr& client_);
 
@@ -96,15 +103,28 @@ namespace eCAL
     void Register(bool force_);
     void Unregister();
 
+    /**
+     * @brief Executes a service request according to the execution policy
+     * 
+     * @param request_            The service request in serialized protobuf form
+     * @param response_callback_  Called exactly once with the serialized protobuf response (from the executing thread)
+     */
+    void ExecuteRequest(const std::shared_ptr<const std::string>& request_, const eCAL::service::ServerResponseCallbackT& response_callback_);
+
     /**
      * @brief Calls the request callback based on the request and fills the response
      * 
-     * @param[in]  request_   The service request in serialized protobuf form
-     * @param[out] response_  A serialized protobuf response. My not be set at all.
+     * @param[in]  request_pb_  The service request
+     * @param[out] response_    A serialized protobuf response. My not be set at all.
      * 
      * @return  0 if succeeded, -1 if not.
      */
-    int RequestCallback(const std::string& request_, std::string& response_);
+    int RequestCallback(const eCAL::pb::Request& request_pb_, std::string& response_);
+
+    /**
+     * @brief Creates a serialized response with call state 'failed'
+     */
+    std::string CreateFailedResponse(const std::string& method_name_, const std::string& error_);
     void EventCallback(eCAL_Server_Event event_, const std::string& message_);
 
     bool ApplyServiceToDescGate(const std::string& method_name_
@@ -113,8 +133,9 @@ namespace eCAL
 
     std::shared_ptr<eCAL::service::Server> m_tcp_server_v0;
     std::shared_ptr<eCAL::service::Server> m_tcp_server_v1;
+    std::shared_ptr<CServiceShmServer>     m_shm_server;
 
-    static constexpr int  m_server_version = 1;
+    static constexpr int  m_server_version = 2;
     
     std::string           m_service_name;
     std::string           m_service_id;
@@ -132,9 +153,13 @@ namespace eCAL
     using EventCallbackMapT = std::map<eCAL_Server_Event, ServerEventCallbackT>;
     EventCallbackMapT     m_event_callback_map;
     
-    mutable std::mutex    m_connected_mutex;          //!< mutex protecting the m_connected_v0 and m_connected_v1 variable, as those are modified by the event callbacks in another thread.
-    bool                  m_connected_v0 = false;
-    bool                  m_connected_v1 = false;
+    mutable std::mutex    m_connected_mutex;          //!< mutex protecting the m_connected_v0, m_connected_v1 and m_connected_shm variable, as those are modified by the event callbacks in another thread.
+    bool                  m_connected_v0  = false;
+    bool                  m_connected_v1  = false;
+    bool                  m_connected_shm = false;
+
+    std::mutex                               m_executor_sync;
+    std::shared_ptr<CServiceServerExecutor>  m_executor;
 
     std::atomic<bool>     m_created;
   };
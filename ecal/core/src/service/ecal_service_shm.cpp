@@ -0,0 +1,637 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL shared memory service transport (service calls on the same host)
+**/
+
+#include <ecal/ecal_log.h>
+
+#include "ecal_def.h"
+#include "ecal_event_internal.h"
+#include "ecal_service_shm.h"
+#include "io/shm/ecal_memfile_naming.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  // interval to check for closed channels and stop requests while waiting for the peer
+  const long wait_interval_ms = 100;
+
+  // a client that did not increment its heartbeat for this time is assumed to be gone
+  const long client_timeout_ms = 5000;
+
+  // timeout for the memory file access while mapping the channel / listener
+  const int memfile_access_timeout_ms = 100;
+
+  bool MapMemoryFile(eCAL::CMemoryFile& memfile_, size_t size_, void*& address_)
+  {
+    address_ = nullptr;
+    if (memfile_.GetWriteAccess(memfile_access_timeout_ms))
+    {
+      if (memfile_.GetWriteAddress(address_, size_) == 0u) address_ = nullptr;
+      memfile_.ReleaseWriteAccess();
+    }
+    return(address_ != nullptr);
+  }
+}
+
+namespace eCAL
+{
+  ////////////////////////////////////////
+  // CServiceShmChannel
+  ////////////////////////////////////////
+  CServiceShmChannel::~CServiceShmChannel()
+  {
+    Destroy();
+  }
+
+  bool CServiceShmChannel::Create(const std::string& name_, size_t size_, bool client_)
+  {
+    if (m_header != nullptr) return(false);
+    if (size_ <= sizeof(ServiceShm::SChannelHeader)) return(false);
+
+    // the server needs write access, but must never create the channel on its own
+    const bool opened = client_ ? m_memfile.Create(name_.c_str(), true, size_) : m_memfile.OpenWritable(name_.c_str());
+    if (!opened) return(false);
+
+    void* address(nullptr);
+    if (!MapMemoryFile(m_memfile, size_, address))
+    {
+      m_memfile.Destroy(client_);
+      return(false);
+    }
+
+    // the channel is accessed without the memory file mutex from now on,
+    // client and server write in turn and hand over with the named events
+    m_header   = static_cast<ServiceShm::SChannelHeader*>(address);
+    m_buffer   = static_cast<char*>(address) + sizeof(ServiceShm::SChannelHeader);
+    m_capacity = size_ - sizeof(ServiceShm::SChannelHeader);
+    if (client_)
+    {
+      m_header->client_closed.store(0);
+      m_header->server_closed.store(0);
+      m_header->client_heartbeat.store(0);
+      m_header->type = 0;
+    }
+
+    gOpenNamedEvent(&m_request_event,  name_ + "_req",  client_);
+    gOpenNamedEvent(&m_response_event, name_ + "_resp", client_);
+
+    m_name      = name_;
+    m_size      = size_;
+    m_client    = client_;
+    m_peer_gone = false;
+    return(true);
+  }
+
+  void CServiceShmChannel::Destroy()
+  {
+    if (m_header == nullptr) return;
+
+    Close();
+
+    gCloseEvent(m_request_event);
+    gCloseEvent(m_response_event);
+    m_request_event  = EventHandleT();
+    m_response_event = EventHandleT();
+
+    // the owner of a gone client cannot remove the channel anymore
+    const bool remove = m_client || m_peer_gone;
+    if (m_peer_gone)
+    {
+      for (const auto& event_name : { m_name + "_req", m_name + "_resp" })
+      {
+        EventHandleT event;
+        gOpenNamedEvent(&event, event_name, true);
+        gCloseEvent(event);
+      }
+    }
+
+    m_header   = nullptr;
+    m_buffer   = nullptr;
+    m_capacity = 0;
+    m_memfile.Destroy(remove);
+  }
+
+  void CServiceShmChannel::Close()
+  {
+    if (m_header == nullptr) return;
+
+    if (m_client)
+    {
+      m_header->client_closed.store(1);
+      gSetEvent(m_request_event);
+    }
+    else
+    {
+      m_header->server_closed.store(1);
+      gSetEvent(m_response_event);
+    }
+  }
+
+  bool CServiceShmChannel::IsPeerClosed() const
+  {
+    if (m_header == nullptr) return(true);
+    if (m_peer_gone)         return(true);
+    return(m_client ? (m_header->server_closed.load() != 0) : (m_header->client_closed.load() != 0));
+  }
+
+  void CServiceShmChannel::Heartbeat()
+  {
+    if ((m_header == nullptr) || !m_client) return;
+    m_header->client_heartbeat.fetch_add(1);
+  }
+
+  bool CServiceShmChannel::WaitForPeer(const AbortFuncT& abort_)
+  {
+    const EventHandleT& event = m_client ? m_response_event : m_request_event;
+
+    std::uint32_t heartbeat      = m_header->client_heartbeat.load();
+    auto          heartbeat_time = std::chrono::steady_clock::now();
+    for (;;)
+    {
+      const bool signaled = gWaitForEvent(event, wait_interval_ms);
+
+      // a closing peer signals the event as well, the buffer content is invalid then
+      if (IsPeerClosed())        return(false);
+      if (signaled)              return(true);
+      if (abort_ && abort_())    return(false);
+
+      // the server gives up on a client that crashed without closing the channel
+      if (!m_client)
+      {
+        const std::uint32_t current_heartbeat = m_header->client_heartbeat.load();
+        const auto          now               = std::chrono::steady_clock::now();
+        if (current_heartbeat != heartbeat)
+        {
+          heartbeat      = current_heartbeat;
+          heartbeat_time = now;
+        }
+        else if (now - heartbeat_time > std::chrono::milliseconds(client_timeout_ms))
+        {
+          Logging::Log(log_level_warning, "CServiceShmChannel::WaitForPeer - client of channel " + m_name + " is gone");
+          m_peer_gone = true;
+          return(false);
+        }
+      }
+    }
+  }
+
+  bool CServiceShmChannel::Send(ServiceShm::eMessageType type_, std::uint64_t id_, const std::string& payload_, const AbortFuncT& abort_)
+  {
+    if (m_header == nullptr) return(false);
+
+    const EventHandleT& peer_event = m_client ? m_request_event : m_response_event;
+
+    size_t offset(0);
+    do
+    {
+      const size_t chunk_size = std::min(m_capacity, payload_.size() - offset);
+
+      m_header->type       = type_;
+      m_header->id         = id_;
+      m_header->total_size = payload_.size();
+      m_header->offset     = offset;
+      m_header->size       = chunk_size;
+      if (chunk_size > 0) std::memcpy(m_buffer, payload_.data() + offset, chunk_size);
+      offset += chunk_size;
+
+      gSetEvent(peer_event);
+
+      // wait until the peer requests the next chunk
+      if (offset < payload_.size())
+      {
+        if (!WaitForPeer(abort_)) return(false);
+        if ((m_header->type != ServiceShm::msg_next_chunk) || (m_header->id != id_) || (m_header->offset != offset)) return(false);
+      }
+    } while (offset < payload_.size());
+
+    return(true);
+  }
+
+  bool CServiceShmChannel::Receive(ServiceShm::eMessageType type_, std::uint64_t& id_, std::string& payload_, const AbortFuncT& abort_)
+  {
+    if (m_header == nullptr) return(false);
+
+    const EventHandleT& peer_event = m_client ? m_request_event : m_response_event;
+
+    payload_.clear();
+    for (;;)
+    {
+      if (!WaitForPeer(abort_)) return(false);
+
+      const ServiceShm::SChannelHeader& header = *m_header;
+      if (header.type != type_)                                 return(false);
+      if (header.size > m_capacity)                             return(false);
+      if (header.offset != payload_.size())                     return(false);
+      if (header.offset + header.size > header.total_size)      return(false);
+
+      if (header.offset == 0)
+      {
+        id_ = header.id;
+        payload_.reserve(static_cast<size_t>(header.total_size));
+      }
+      else if (header.id != id_)
+      {
+        return(false);
+      }
+      payload_.append(m_buffer, static_cast<size_t>(header.size));
+
+      if (payload_.size() >= header.total_size) return(true);
+
+      // request the next chunk
+      m_header->type   = ServiceShm::msg_next_chunk;
+      m_header->offset = payload_.size();
+      m_header->size   = 0;
+      gSetEvent(peer_event);
+    }
+  }
+
+  ////////////////////////////////////////
+  // CServiceShmServer
+  ////////////////////////////////////////
+  CServiceShmServer::~CServiceShmServer()
+  {
+    Destroy();
+  }
+
+  bool CServiceShmServer::Create(const RequestCallbackT& callback_, const EventCallbackT& event_callback_)
+  {
+    if (m_created) return(false);
+
+    m_name = memfile::BuildRandomMemFileName("ecal_svc_");
+    if (!m_listener.Create(m_name.c_str(), true, ServiceShm::listener_size))
+    {
+      Logging::Log(log_level_error, "CServiceShmServer::Create - failed to create listener " + m_name);
+      m_name.clear();
+      return(false);
+    }
+
+    void* address(nullptr);
+    if (!MapMemoryFile(m_listener, ServiceShm::listener_size, address))
+    {
+      Logging::Log(log_level_error, "CServiceShmServer::Create - failed to map listener " + m_name);
+      m_listener.Destroy(true);
+      m_name.clear();
+      return(false);
+    }
+    std::memset(address, 0, ServiceShm::listener_size);
+
+    gOpenNamedEvent(&m_listener_event, m_name, true);
+
+    m_callback       = callback_;
+    m_event_callback = event_callback_;
+    m_stop           = false;
+    m_listener_thread = std::thread(&CServiceShmServer::ListenerThread, this);
+
+    m_created = true;
+    return(true);
+  }
+
+  bool CServiceShmServer::Destroy()
+  {
+    if (!m_created) return(false);
+
+    // stop accepting new channels
+    m_stop = true;
+    if (m_listener_thread.joinable()) m_listener_thread.join();
+
+    // close all channels (clients waiting for a response are woken up)
+    std::list<SChannelThread> channels;
+    {
+      const std::lock_guard<std::mutex> lock(m_channels_sync);
+      channels.swap(m_channels);
+    }
+    for (auto& channel : channels) channel.channel->Close();
+    for (auto& channel : channels)
+    {
+      if (channel.thread.joinable()) channel.thread.join();
+    }
+    channels.clear();
+
+    gCloseEvent(m_listener_event);
+    m_listener_event = EventHandleT();
+    m_listener.Destroy(true);
+
+    m_name.clear();
+    m_created = false;
+    return(true);
+  }
+
+  bool CServiceShmServer::IsConnected()
+  {
+    const std::lock_guard<std::mutex> lock(m_channels_sync);
+    for (const auto& channel : m_channels)
+    {
+      if (!channel.finished->load()) return(true);
+    }
+    return(false);
+  }
+
+  void CServiceShmServer::ListenerThread()
+  {
+    while (!m_stop)
+    {
+      if (gWaitForEvent(m_listener_event, wait_interval_ms))
+      {
+        AcceptChannels();
+      }
+
+      // clean up channels of gone clients
+      size_t removed(0);
+      {
+        const std::lock_guard<std::mutex> lock(m_channels_sync);
+        for (auto iter = m_channels.begin(); iter != m_channels.end();)
+        {
+          if (iter->finished->load())
+          {
+            if (iter->thread.joinable()) iter->thread.join();
+            iter = m_channels.erase(iter);
+            removed++;
+          }
+          else
+          {
+            ++iter;
+          }
+        }
+      }
+      if ((removed > 0) && m_event_callback) m_event_callback(false);
+    }
+  }
+
+  void CServiceShmServer::AcceptChannels()
+  {
+    std::vector<ServiceShm::SListenerEntry> entries;
+    if (m_listener.GetWriteAccess(memfile_access_timeout_ms))
+    {
+      void* address(nullptr);
+      if (m_listener.GetWriteAddress(address, ServiceShm::listener_size) != 0u)
+      {
+        auto* header = static_cast<ServiceShm::SListenerHeader*>(address);
+        auto* entry  = reinterpret_cast<ServiceShm::SListenerEntry*>(header + 1);
+        const std::uint32_t count = std::min(header->count, ServiceShm::listener_max_entries);
+        entries.assign(entry, entry + count);
+        header->count = 0;
+      }
+      m_listener.ReleaseWriteAccess();
+    }
+
+    size_t accepted(0);
+    for (auto& entry : entries)
+    {
+      entry.name[sizeof(entry.name) - 1] = 0;
+
+      auto channel = std::make_shared<CServiceShmChannel>();
+      if (!channel->Create(entry.name, static_cast<size_t>(entry.size), false))
+      {
+        Logging::Log(log_level_warning, std::string("CServiceShmServer::AcceptChannels - failed to open channel ") + entry.name);
+        continue;
+      }
+
+      SChannelThread channel_thread;
+      channel_thread.channel  = channel;
+      channel_thread.finished = std::make_shared<std::atomic<bool>>(false);
+      channel_thread.thread   = std::thread([this, channel, finished = channel_thread.finished]()
+                                            {
+                                              ServeChannel(channel);
+                                              finished->store(true);
+                                            });
+
+      const std::lock_guard<std::mutex> lock(m_channels_sync);
+      m_channels.push_back(std::move(channel_thread));
+      accepted++;
+    }
+
+    if ((accepted > 0) && m_event_callback) m_event_callback(true);
+  }
+
+  void CServiceShmServer::ServeChannel(const std::shared_ptr<CServiceShmChannel>& channel_)
+  {
+    const CServiceShmChannel::AbortFuncT abort = [this]() { return(m_stop.load()); };
+
+    std::string request;
+    std::string response;
+    while (!m_stop)
+    {
+      std::uint64_t id(0);
+      if (!channel_->Receive(ServiceShm::msg_request, id, request, abort)) break;
+
+      response.clear();
+      m_callback(request, response);
+
+      if (!channel_->Send(ServiceShm::msg_response, id, response, abort)) break;
+    }
+
+    // the channel is destroyed when the thread is cleaned up
+  }
+
+  ////////////////////////////////////////
+  // CServiceShmClient
+  ////////////////////////////////////////
+  CServiceShmClient::~CServiceShmClient()
+  {
+    Destroy();
+  }
+
+  bool CServiceShmClient::Create(const std::string& listener_name_, size_t buffer_size_)
+  {
+    if (m_created) return(false);
+    if (listener_name_.empty()) return(false);
+
+    const std::string channel_name = memfile::BuildRandomMemFileName("ecal_svc_chn_");
+    if (channel_name.size() >= sizeof(ServiceShm::SListenerEntry::name)) return(false);
+    if (!m_channel.Create(channel_name, sizeof(ServiceShm::SChannelHeader) + buffer_size_, true)) return(false);
+
+    // announce the channel
+    bool announced(false);
+    {
+      // the listener is created by the server only
+      CMemoryFile listener;
+      if (listener.OpenWritable(listener_name_.c_str()))
+      {
+        if (listener.GetWriteAccess(memfile_access_timeout_ms))
+        {
+          void* address(nullptr);
+          if (listener.GetWriteAddress(address, ServiceShm::listener_size) != 0u)
+          {
+            auto* header = static_cast<ServiceShm::SListenerHeader*>(address);
+            if (header->count < ServiceShm::listener_max_entries)
+            {
+              ServiceShm::SListenerEntry entry{};
+              entry.size = m_channel.GetSize();
+              std::memcpy(entry.name, channel_name.c_str(), channel_name.size());
+              std::memcpy(reinterpret_cast<ServiceShm::SListenerEntry*>(header + 1) + header->count, &entry, sizeof(entry));
+              header->count++;
+              announced = true;
+            }
+          }
+          listener.ReleaseWriteAccess();
+        }
+        listener.Destroy(false);
+      }
+    }
+
+    if (!announced)
+    {
+      m_channel.Destroy();
+      return(false);
+    }
+
+    EventHandleT listener_event;
+    gOpenNamedEvent(&listener_event, listener_name_, false);
+    gSetEvent(listener_event);
+    gCloseEvent(listener_event);
+
+    {
+      const std::lock_guard<std::mutex> lock(m_calls_sync);
+      m_stop   = false;
+      m_failed = false;
+    }
+    m_worker    = std::thread(&CServiceShmClient::WorkerThread, this);
+    m_heartbeat = std::thread(&CServiceShmClient::HeartbeatThread, this);
+
+    m_created = true;
+    return(true);
+  }
+
+  bool CServiceShmClient::Destroy()
+  {
+    if (!m_created) return(false);
+
+    Stop();
+    if (m_worker.joinable())    m_worker.join();
+    if (m_heartbeat.joinable()) m_heartbeat.join();
+    m_channel.Destroy();
+
+    m_created = false;
+    return(true);
+  }
+
+  bool CServiceShmClient::CallAsync(const std::shared_ptr<const std::string>& request_, const eCAL::service::ClientResponseCallbackT& callback_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_calls_sync);
+      if (m_stop || m_failed) return(false);
+      m_calls.push_back(SCall{ request_, callback_ });
+    }
+    m_calls_cv.notify_one();
+    return(true);
+  }
+
+  eCAL::service::Error CServiceShmClient::Call(const std::shared_ptr<const std::string>& request_, std::shared_ptr<std::string>& response_)
+  {
+    auto promise = std::make_shared<std::promise<eCAL::service::Error>>();
+    auto future  = promise->get_future();
+
+    const bool queued = CallAsync(request_,
+                                  [promise, &response_](const eCAL::service::Error& error_, const std::shared_ptr<std::string>& response)
+                                  {
+                                    if (!error_) response_ = response;
+                                    promise->set_value(error_);
+                                  });
+    if (!queued) return(eCAL::service::Error(eCAL::service::Error::CONNECTION_CLOSED, "Shared memory channel closed"));
+
+    return(future.get());
+  }
+
+  void CServiceShmClient::Stop()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_calls_sync);
+      m_stop = true;
+    }
+    m_calls_cv.notify_all();
+    m_heartbeat_cv.notify_all();
+    m_channel.Close();
+  }
+
+  eCAL::service::State CServiceShmClient::GetState() const
+  {
+    const std::lock_guard<std::mutex> lock(m_calls_sync);
+    if (m_stop || m_failed || m_channel.IsPeerClosed()) return(eCAL::service::State::FAILED);
+    return(eCAL::service::State::CONNECTED);
+  }
+
+  void CServiceShmClient::WorkerThread()
+  {
+    const CServiceShmChannel::AbortFuncT abort = [this]()
+                                                 {
+                                                   const std::lock_guard<std::mutex> lock(m_calls_sync);
+                                                   return(m_stop);
+                                                 };
+
+    for (;;)
+    {
+      SCall call;
+      std::uint64_t id(0);
+      {
+        std::unique_lock<std::mutex> lock(m_calls_sync);
+        m_calls_cv.wait(lock, [this]() { return(m_stop || m_failed || !m_calls.empty()); });
+        if (m_calls.empty()) break;
+        call = std::move(m_calls.front());
+        m_calls.pop_front();
+        id = m_next_id++;
+
+        // stopped or failed, fail the remaining calls
+        if (m_stop || m_failed)
+        {
+          lock.unlock();
+          call.callback(eCAL::service::Error(eCAL::service::Error::CONNECTION_CLOSED, "Shared memory channel closed"), nullptr);
+          continue;
+        }
+      }
+
+      auto          response = std::make_shared<std::string>();
+      std::uint64_t response_id(0);
+      const bool    success = m_channel.Send(ServiceShm::msg_request, id, *call.request, abort)
+                           && m_channel.Receive(ServiceShm::msg_response, response_id, *response, abort)
+                           && (response_id == id);
+
+      if (success)
+      {
+        call.callback(eCAL::service::Error::OK, response);
+      }
+      else
+      {
+        {
+          const std::lock_guard<std::mutex> lock(m_calls_sync);
+          m_failed = true;
+        }
+        call.callback(eCAL::service::Error(eCAL::service::Error::CONNECTION_CLOSED, "Shared memory channel closed"), nullptr);
+      }
+    }
+  }
+
+  void CServiceShmClient::HeartbeatThread()
+  {
+    // the heartbeat runs independent of the worker, a long running response callback must not close the channel
+    std::unique_lock<std::mutex> lock(m_calls_sync);
+    while (!m_heartbeat_cv.wait_for(lock, std::chrono::milliseconds(wait_interval_ms), [this]() { return(m_stop); }))
+    {
+      m_channel.Heartbeat();
+    }
+  }
+}
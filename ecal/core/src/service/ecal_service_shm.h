@@ -0,0 +1,325 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL shared memory service transport (service calls on the same host)
+ *
+ * A service server creates a listener memory file and registers its name. A client
+ * on the same host creates a channel memory file with two named events (request,
+ * response) and appends the channel name to the listener. The server opens the
+ * channel and serves it with its own thread.
+ *
+ * Client and server exchange the messages in turn using the same channel buffer:
+ *
+ *   SChannelHeader | chunk
+ *
+ * Requests and responses larger than the buffer are transferred in chunks, the
+ * receiver requests every next chunk with a next_chunk message.
+ *
+ * The client increments a heartbeat counter in the channel header with its own
+ * thread, independent of running calls and response callbacks. A server waiting
+ * for a client that did not increment it for some seconds assumes the client has
+ * crashed, closes its channel thread and removes the channel memory file and events.
+ *
+ * The transport is selected automatically for servers on the same host
+ * (service/shm_transport).
+ *
+**/
+
+#pragma once
+
+#include "io/shm/ecal_memfile.h"
+
+#include <ecal/ecal_event.h>
+#include <ecal/service/client_session_types.h>
+#include <ecal/service/error.h>
+#include <ecal/service/state.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace eCAL
+{
+  namespace ServiceShm
+  {
+    struct SListenerHeader
+    {
+      std::uint32_t count;     // number of announced channels
+      std::uint32_t reserved;
+    };
+
+    struct SListenerEntry
+    {
+      std::uint64_t size;      // channel memory file size
+      char          name[56];  // channel memory file name
+    };
+
+    struct SChannelHeader
+    {
+      std::atomic<std::uint32_t> client_closed;
+      std::atomic<std::uint32_t> server_closed;
+      std::uint32_t              type;        // message type
+      std::atomic<std::uint32_t> client_heartbeat;  // incremented by a living client
+      std::uint64_t              id;          // call id
+      std::uint64_t              total_size;  // size of the complete request / response
+      std::uint64_t              offset;      // offset of the chunk in the request / response
+      std::uint64_t              size;        // size of the chunk following the header
+    };
+
+    enum eMessageType : std::uint32_t
+    {
+      msg_request    = 1,
+      msg_response   = 2,
+      msg_next_chunk = 3,
+    };
+
+    constexpr std::uint32_t listener_max_entries = 64;
+    constexpr size_t        listener_size        = sizeof(SListenerHeader) + listener_max_entries * sizeof(SListenerEntry);
+  }
+
+  /**
+   * @brief Shared memory channel between one service client and one service server.
+  **/
+  class CServiceShmChannel
+  {
+  public:
+    using AbortFuncT = std::function<bool()>;
+
+    CServiceShmChannel() = default;
+    ~CServiceShmChannel();
+
+    CServiceShmChannel(const CServiceShmChannel&) = delete;
+    CServiceShmChannel& operator=(const CServiceShmChannel&) = delete;
+    CServiceShmChannel(CServiceShmChannel&&) = delete;
+    CServiceShmChannel& operator=(CServiceShmChannel&&) = delete;
+
+    /**
+     * @brief Create (client) or open (server) a channel.
+     *
+     * @param name_     Channel memory file name.
+     * @param size_     Channel memory file size (header and buffer).
+     * @param client_   Client side, create the memory file and the events and remove them on destruction.
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool Create(const std::string& name_, size_t size_, bool client_);
+    void Destroy();
+
+    /**
+     * @brief Mark the own side as closed and wake up the peer.
+    **/
+    void Close();
+
+    /**
+     * @brief Peer side closed the channel (or the client is gone).
+    **/
+    bool IsPeerClosed() const;
+
+    /**
+     * @brief Signal the server that the client is still alive (client side only).
+    **/
+    void Heartbeat();
+
+    /**
+     * @brief Send a request (client) or response (server) to the peer.
+     *
+     * @param type_     Message type.
+     * @param id_       Call id.
+     * @param payload_  The complete request / response.
+     * @param abort_    Checked while waiting for the next chunk request of the peer.
+     *
+     * @return  true if it succeeds, false if the channel was closed or the peer did not follow the protocol.
+    **/
+    bool Send(ServiceShm::eMessageType type_, std::uint64_t id_, const std::string& payload_, const AbortFuncT& abort_);
+
+    /**
+     * @brief Receive a request (server) or response (client) from the peer.
+     *
+     * @param type_     Expected message type.
+     * @param id_       Call id of the received message.
+     * @param payload_  The complete request / response.
+     * @param abort_    Checked while waiting for the peer.
+     *
+     * @return  true if it succeeds, false if the channel was closed or the peer did not follow the protocol.
+    **/
+    bool Receive(ServiceShm::eMessageType type_, std::uint64_t& id_, std::string& payload_, const AbortFuncT& abort_);
+
+    const std::string& GetName() const { return(m_name); }
+    size_t             GetSize() const { return(m_size); }
+
+  private:
+    bool WaitForPeer(const AbortFuncT& abort_);
+
+    std::string                   m_name;
+    size_t                        m_size     = 0;
+    bool                          m_client   = false;
+    bool                          m_peer_gone = false;
+    CMemoryFile                   m_memfile;
+    ServiceShm::SChannelHeader*   m_header   = nullptr;
+    char*                         m_buffer   = nullptr;
+    size_t                        m_capacity = 0;
+    EventHandleT                  m_request_event;
+    EventHandleT                  m_response_event;
+  };
+
+  /**
+   * @brief Shared memory transport of a service server.
+  **/
+  class CServiceShmServer
+  {
+  public:
+    using RequestCallbackT = std::function<int(const std::string& request_, std::string& response_)>;
+    using EventCallbackT   = std::function<void(bool connected_)>;
+
+    CServiceShmServer() = default;
+    ~CServiceShmServer();
+
+    CServiceShmServer(const CServiceShmServer&) = delete;
+    CServiceShmServer& operator=(const CServiceShmServer&) = delete;
+    CServiceShmServer(CServiceShmServer&&) = delete;
+    CServiceShmServer& operator=(CServiceShmServer&&) = delete;
+
+    /**
+     * @brief Create the listener and start accepting channels.
+     *
+     * @param callback_        Called for every request (from the channel threads).
+     * @param event_callback_  Called if a client channel was opened or closed.
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool Create(const RequestCallbackT& callback_, const EventCallbackT& event_callback_);
+    bool Destroy();
+
+    /**
+     * @brief At least one client channel is open.
+    **/
+    bool IsConnected();
+
+    /**
+     * @brief Listener name, registered with the service.
+    **/
+    const std::string& GetName() const { return(m_name); }
+
+  private:
+    struct SChannelThread
+    {
+      std::shared_ptr<CServiceShmChannel> channel;
+      std::thread                         thread;
+      std::shared_ptr<std::atomic<bool>>  finished;
+    };
+
+    void ListenerThread();
+    void AcceptChannels();
+    void ServeChannel(const std::shared_ptr<CServiceShmChannel>& channel_);
+
+    std::string                 m_name;
+    RequestCallbackT            m_callback;
+    EventCallbackT              m_event_callback;
+    CMemoryFile                 m_listener;
+    EventHandleT                m_listener_event;
+    std::atomic<bool>           m_stop{ false };
+    std::thread                 m_listener_thread;
+
+    std::mutex                  m_channels_sync;
+    std::list<SChannelThread>   m_channels;
+
+    bool                        m_created = false;
+  };
+
+  /**
+   * @brief Shared memory transport of a service client to one service server.
+   *
+   * Calls are queued and executed one after the other by a worker thread, like the
+   * requests of one tcp client session.
+  **/
+  class CServiceShmClient
+  {
+  public:
+    CServiceShmClient() = default;
+    ~CServiceShmClient();
+
+    CServiceShmClient(const CServiceShmClient&) = delete;
+    CServiceShmClient& operator=(const CServiceShmClient&) = delete;
+    CServiceShmClient(CServiceShmClient&&) = delete;
+    CServiceShmClient& operator=(CServiceShmClient&&) = delete;
+
+    /**
+     * @brief Create a channel and announce it to the server listener.
+     *
+     * @param listener_name_  Listener name registered by the server.
+     * @param buffer_size_    Channel buffer size.
+     *
+     * @return  true if it succeeds, false if the listener does not exist (server on another host or already gone).
+    **/
+    bool Create(const std::string& listener_name_, size_t buffer_size_);
+    bool Destroy();
+
+    /**
+     * @brief Queue a call, the callback is executed by the worker thread.
+     *
+     * @return  false if the channel is closed (the callback will never be called).
+    **/
+    bool CallAsync(const std::shared_ptr<const std::string>& request_, const eCAL::service::ClientResponseCallbackT& callback_);
+
+    /**
+     * @brief Blocking call.
+    **/
+    eCAL::service::Error Call(const std::shared_ptr<const std::string>& request_, std::shared_ptr<std::string>& response_);
+
+    /**
+     * @brief Close the channel, pending calls fail.
+    **/
+    void Stop();
+
+    eCAL::service::State GetState() const;
+
+  private:
+    struct SCall
+    {
+      std::shared_ptr<const std::string>       request;
+      eCAL::service::ClientResponseCallbackT   callback;
+    };
+
+    void WorkerThread();
+    void HeartbeatThread();
+
+    CServiceShmChannel          m_channel;
+    std::thread                 m_worker;
+    std::thread                 m_heartbeat;
+
+    mutable std::mutex          m_calls_sync;
+    std::condition_variable     m_calls_cv;
+    std::condition_variable     m_heartbeat_cv;
+    std::deque<SCall>           m_calls;
+    bool                        m_stop   = false;
+    bool                        m_failed = false;
+    std::uint64_t               m_next_id = 1;
+
+    bool                        m_created = false;
+  };
+}
@@ -0,0 +1,489 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL hash map with time expiration
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief A time expiration hash map (same interface as CExpMap).
+    *
+    * The elements are stored in a dense vector, an open addressing hash table
+    * (linear probing, load factor at most 1/2) holds the precomputed hash and
+    * the element index. Every element is linked into the bucket of its last
+    * access time in a timer wheel, so an access moves it in constant time and
+    * remove_deprecated only visits the buckets that expired since the last call.
+    *
+    * Unlike CExpMap the iteration order is unspecified and inserting or erasing
+    * an element invalidates iterators and references.
+    **/
+    template<class Key,
+      class T,
+      class Hash = std::hash<Key>,
+      class KeyEqual = std::equal_to<Key> >
+      class CHashExpMap
+    {
+    public:
+      using clock_type = std::chrono::steady_clock;
+
+      using value_type = std::pair<Key, T>;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using key_type = Key;
+      using mapped_type = T;
+      using hasher = Hash;
+      using key_equal = KeyEqual;
+
+    private:
+      struct SEntry
+      {
+        value_type              value;
+        std::size_t             hash;
+        clock_type::time_point  time;
+        std::size_t             prev;  // timer wheel bucket list
+        std::size_t             next;
+      };
+      using entry_list_type = std::vector<SEntry>;
+
+      struct SSlot
+      {
+        std::size_t hash;
+        std::size_t index;
+      };
+
+    public:
+      class iterator
+      {
+        friend class const_iterator;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename CHashExpMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const value_type*;
+        using reference         = const value_type&;
+
+        iterator(const typename entry_list_type::iterator _it)
+          : it(_it)
+        {}
+
+        iterator& operator++()
+        {
+          it++;
+          return *this;
+        } //prefix increment
+
+        iterator& operator--()
+        {
+          it--;
+          return *this;
+        } //prefix decrement
+
+        reference operator*()  const { return it->value; }
+        pointer   operator->() const { return &it->value; }
+
+        bool operator==(const iterator& rhs) const { return it == rhs.it; }
+        bool operator!=(const iterator& rhs) const { return it != rhs.it; }
+
+      private:
+        typename entry_list_type::iterator it;
+      };
+
+      class const_iterator
+      {
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename CHashExpMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const value_type*;
+        using reference         = const value_type&;
+
+        const_iterator(const iterator& other)
+          : it(other.it)
+        {}
+
+        const_iterator(const typename entry_list_type::const_iterator _it)
+          : it(_it)
+        {}
+
+        const_iterator& operator++()
+        {
+          it++;
+          return *this;
+        } //prefix increment
+
+        const_iterator& operator--()
+        {
+          it--;
+          return *this;
+        } //prefix decrement
+
+        reference operator*()  const { return it->value; }
+        pointer   operator->() const { return &it->value; }
+
+        bool operator==(const const_iterator& rhs) const { return it == rhs.it; }
+        bool operator!=(const const_iterator& rhs) const { return it != rhs.it; }
+
+      private:
+        typename entry_list_type::const_iterator it;
+      };
+
+      // Constructor specifies the timeout of the map
+      CHashExpMap() : CHashExpMap(std::chrono::milliseconds(5000)) {};
+      CHashExpMap(clock_type::duration t)
+      {
+        _wheel.assign(wheel_size, std::size_t(npos));
+        rehash(min_table_size);
+        set_expiration(t);
+      };
+
+      /**
+      * @brief  set expiration time
+      **/
+      void set_expiration(clock_type::duration t)
+      {
+        _timeout = t;
+        _tick    = t / static_cast<int>(wheel_size / 2);
+        if (_tick <= clock_type::duration::zero()) _tick = clock_type::duration(1);
+
+        // the bucket of an element depends on the tick duration
+        _wheel.assign(wheel_size, std::size_t(npos));
+        for (std::size_t index = 0; index < _entries.size(); ++index) link(index);
+        _swept_tick = no_tick;
+      };
+
+      // Iterators:
+      iterator begin() noexcept
+      {
+        return iterator(_entries.begin());
+      }
+
+      iterator end() noexcept
+      {
+        return iterator(_entries.end());
+      }
+
+      const_iterator begin() const noexcept
+      {
+        return const_iterator(_entries.begin());
+      }
+
+      const_iterator end() const noexcept
+      {
+        return const_iterator(_entries.end());
+      }
+
+      // Const begin and end functions
+      const_iterator cbegin() const noexcept {
+        return const_iterator(_entries.cbegin());
+      }
+
+      const_iterator cend() const noexcept {
+        return const_iterator(_entries.cend());
+      }
+
+      // Capacity
+      bool empty() const noexcept
+      {
+        return _entries.empty();
+      }
+
+      size_type size() const noexcept
+      {
+        return _entries.size();
+      }
+
+      size_type max_size() const noexcept
+      {
+        return _entries.max_size();
+      }
+
+      // Element access
+      // Return the value for k and refresh its timestamp, insert a default value if k is unknown
+      T& operator[](const Key& k)
+      {
+        const std::size_t hash = _hasher(k);
+        const std::size_t slot = find_slot(k, hash);
+        if (slot != npos)
+        {
+          const std::size_t index = _table[slot].index;
+          update_timestamp(index);
+          return _entries[index].value.second;
+        }
+        return _entries[insert(k, T{}, hash)].value.second;
+      };
+
+      mapped_type& at(const key_type& k)
+      {
+        const std::size_t slot = find_slot(k, _hasher(k));
+        if (slot == npos) throw std::out_of_range("CHashExpMap::at");
+        return _entries[_table[slot].index].value.second;
+      }
+
+      const mapped_type& at(const key_type& k) const
+      {
+        const std::size_t slot = find_slot(k, _hasher(k));
+        if (slot == npos) throw std::out_of_range("CHashExpMap::at");
+        return _entries[_table[slot].index].value.second;
+      }
+
+      // Modifiers
+      std::pair<iterator, bool> insert(const value_type& val)
+      {
+        const std::size_t hash = _hasher(val.first);
+        const std::size_t slot = find_slot(val.first, hash);
+        if (slot != npos) return std::make_pair(iterator(_entries.begin() + _table[slot].index), false);
+
+        const std::size_t index = insert(val.first, val.second, hash);
+        return std::make_pair(iterator(_entries.begin() + index), true);
+      }
+
+      // Operations
+      iterator find(const key_type& k)
+      {
+        const std::size_t slot = find_slot(k, _hasher(k));
+        if (slot == npos) return end();
+        return iterator(_entries.begin() + _table[slot].index);
+      }
+
+      const_iterator find(const Key& k) const
+      {
+        const std::size_t slot = find_slot(k, _hasher(k));
+        if (slot == npos) return end();
+        return const_iterator(_entries.begin() + _table[slot].index);
+      }
+
+      // Purge the timed out elements from the cache
+      void remove_deprecated(std::list<Key>* key_erased = nullptr) //-V826
+      {
+        const clock_type::time_point eviction_limit = get_curr_time() - _timeout;
+        const long long              limit_tick     = tick(eviction_limit);
+
+        // visit the buckets expired since the last call (all of them once after a full turn),
+        // the bucket of the limit itself is partially expired and visited again next time
+        long long first_tick = _swept_tick + 1;
+        if ((_swept_tick == no_tick) || (limit_tick - _swept_tick > static_cast<long long>(wheel_size)))
+          first_tick = limit_tick - static_cast<long long>(wheel_size) + 1;
+
+        for (long long t = first_tick; t <= limit_tick; ++t)
+        {
+          std::size_t index = _wheel[bucket(t)];
+          while (index != npos)
+          {
+            std::size_t next = _entries[index].next;
+            // a bucket holds the elements of all wheel turns, check each one
+            if (_entries[index].time < eviction_limit)
+            {
+              if (key_erased != nullptr) key_erased->push_back(_entries[index].value.first);
+              // the last element is moved to the erased position
+              if (next == _entries.size() - 1) next = index;
+              erase_index(index);
+            }
+            index = next;
+          }
+        }
+        _swept_tick = limit_tick - 1;
+      }
+
+      // Remove specific element from the cache
+      bool erase(const Key& k)
+      {
+        const std::size_t slot = find_slot(k, _hasher(k));
+        if (slot == npos) return false;
+        erase_index(_table[slot].index);
+        return true;
+      }
+
+      // Remove all elements from the cache
+      void clear()
+      {
+        _entries.clear();
+        for (auto& slot : _table) slot.index = npos;
+        _wheel.assign(wheel_size, std::size_t(npos));
+        _swept_tick = no_tick;
+      }
+
+    private:
+      static constexpr std::size_t npos           = std::numeric_limits<std::size_t>::max();
+      static constexpr std::size_t wheel_size     = 64;
+      static constexpr std::size_t min_table_size = 16;
+      static constexpr long long   no_tick        = std::numeric_limits<long long>::min();
+
+      // fibonacci hashing, the upper bits spread similar hash values over the table
+      std::size_t table_index(std::size_t hash) const
+      {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> _shift);
+      }
+
+      std::size_t find_slot(const Key& k, std::size_t hash) const
+      {
+        for (std::size_t pos = table_index(hash); _table[pos].index != npos; pos = (pos + 1) & _mask)
+        {
+          if ((_table[pos].hash == hash) && _key_equal(_entries[_table[pos].index].value.first, k)) return pos;
+        }
+        return npos;
+      }
+
+      std::size_t find_slot_of_index(std::size_t index) const
+      {
+        std::size_t pos = table_index(_entries[index].hash);
+        while (_table[pos].index != index) pos = (pos + 1) & _mask;
+        return pos;
+      }
+
+      void place(std::size_t hash, std::size_t index)
+      {
+        std::size_t pos = table_index(hash);
+        while (_table[pos].index != npos) pos = (pos + 1) & _mask;
+        _table[pos].hash  = hash;
+        _table[pos].index = index;
+      }
+
+      void rehash(std::size_t table_size)
+      {
+        _table.assign(table_size, SSlot{ 0, npos });
+        _mask  = table_size - 1;
+        _shift = 64;
+        for (std::size_t size = table_size; size > 1; size >>= 1) _shift--;
+        for (std::size_t index = 0; index < _entries.size(); ++index) place(_entries[index].hash, index);
+      }
+
+      // Record a fresh key-value pair in the cache
+      std::size_t insert(const Key& k, const T& v, std::size_t hash)
+      {
+        if (2 * (_entries.size() + 1) > _table.size()) rehash(2 * _table.size());
+
+        const std::size_t index = _entries.size();
+        _entries.push_back(SEntry{ value_type(k, v), hash, get_curr_time(), npos, npos });
+        place(hash, index);
+        link(index);
+        return index;
+      }
+
+      void erase_index(std::size_t index)
+      {
+        // backward shift deletion, keeps the probe sequences free of holes
+        std::size_t pos  = find_slot_of_index(index);
+        std::size_t next = (pos + 1) & _mask;
+        while (_table[next].index != npos)
+        {
+          // move the slot into the hole if its home slot is not between the hole and the slot
+          const std::size_t home = table_index(_table[next].hash);
+          if (((next - home) & _mask) >= ((next - pos) & _mask))
+          {
+            _table[pos] = _table[next];
+            pos = next;
+          }
+          next = (next + 1) & _mask;
+        }
+        _table[pos].index = npos;
+        unlink(index);
+
+        // keep the elements dense, move the last one into the gap
+        const std::size_t last = _entries.size() - 1;
+        if (index != last)
+        {
+          _table[find_slot_of_index(last)].index = index;
+          _entries[index] = std::move(_entries[last]);
+          SEntry& moved = _entries[index];
+          if (moved.prev != npos) _entries[moved.prev].next = index;
+          else                    _wheel[bucket(tick(moved.time))] = index;
+          if (moved.next != npos) _entries[moved.next].prev = index;
+        }
+        _entries.pop_back();
+      }
+
+      long long tick(clock_type::time_point time) const
+      {
+        return static_cast<long long>(time.time_since_epoch() / _tick);
+      }
+
+      static std::size_t bucket(long long t)
+      {
+        return static_cast<std::size_t>(t) & (wheel_size - 1);
+      }
+
+      void link(std::size_t index)
+      {
+        SEntry& entry = _entries[index];
+        std::size_t& head = _wheel[bucket(tick(entry.time))];
+        entry.prev = npos;
+        entry.next = head;
+        if (head != npos) _entries[head].prev = index;
+        head = index;
+      }
+
+      void unlink(std::size_t index)
+      {
+        const SEntry& entry = _entries[index];
+        if (entry.prev != npos) _entries[entry.prev].next = entry.next;
+        else                    _wheel[bucket(tick(entry.time))] = entry.next;
+        if (entry.next != npos) _entries[entry.next].prev = entry.prev;
+      }
+
+      // move the element to the bucket of the current time
+      void update_timestamp(std::size_t index)
+      {
+        unlink(index);
+        _entries[index].time = get_curr_time();
+        link(index);
+      }
+
+      clock_type::time_point get_curr_time()
+      {
+        return clock_type::now();
+      }
+
+      // Elements
+      entry_list_type          _entries;
+
+      // Key-to-element lookup
+      std::vector<SSlot>       _table;
+      std::size_t              _mask  = 0;
+      unsigned                 _shift = 0;
+      Hash                     _hasher;
+      KeyEqual                 _key_equal;
+
+      // Timer wheel, first element of every bucket
+      std::vector<std::size_t> _wheel;
+      clock_type::duration     _tick;
+      long long                _swept_tick = no_tick;
+
+      // Timeout of map
+      clock_type::duration     _timeout;
+    };
+  }
+}
@@ -0,0 +1,202 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL set of the most recent hash values
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief A set of the last N unique hash values.
+    *
+    * The hash values are kept in a ring buffer (insertion order) and in an
+    * open addressing hash table (linear probing), so lookup, insertion and
+    * eviction of the oldest value take constant time. The table is filled to
+    * at most 1/8, short probe sequences avoid branch mispredictions (a window
+    * of 64 hashes still fits in 4 kB). Memory is only allocated by the
+    * constructor and Reset, the table starts at a cache line boundary.
+    *
+    * The class is not thread safe.
+    **/
+    class CHashWindow
+    {
+    public:
+      explicit CHashWindow(size_t window_ = 64)
+      {
+        Reset(window_);
+      }
+
+      CHashWindow(const CHashWindow&) = delete;
+      CHashWindow& operator=(const CHashWindow&) = delete;
+
+      /**
+      * @brief Allocate the window and forget all stored hash values.
+      *
+      * @param window_  Number of hash values to keep (at least 1).
+      **/
+      void Reset(size_t window_)
+      {
+        const size_t window = (window_ > 0) ? window_ : 1;
+
+        // power of two table with a load factor of at most 1/8
+        size_t capacity(slots_per_line);
+        m_shift = 64 - log2(slots_per_line);
+        while (capacity < 8 * window)
+        {
+          capacity <<= 1;
+          m_shift--;
+        }
+        m_mask = capacity - 1;
+
+        // over allocate to align the table to a cache line
+        m_table_buf.assign(capacity + slots_per_line, size_t(empty_slot));
+        const std::uintptr_t addr    = reinterpret_cast<std::uintptr_t>(m_table_buf.data());
+        const std::uintptr_t aligned = (addr + cache_line_size - 1) & ~static_cast<std::uintptr_t>(cache_line_size - 1);
+        m_table = m_table_buf.data() + (aligned - addr) / sizeof(size_t);
+
+        m_ring.assign(window, 0);
+        m_ring_pos     = 0;
+        m_size         = 0;
+        m_empty_stored = false;
+      }
+
+      /**
+      * @brief Insert a hash value, the oldest value is evicted if the window is full.
+      *
+      * @param hash_  The hash value.
+      *
+      * @return  False if the hash value is already in the window (not inserted).
+      **/
+      bool Insert(size_t hash_)
+      {
+        if (Contains(hash_)) return(false);
+
+        // evict the oldest hash value
+        if (m_size == m_ring.size())
+        {
+          Erase(m_ring[m_ring_pos]);
+          m_size--;
+        }
+
+        // store the new one
+        if (hash_ == empty_slot)
+        {
+          m_empty_stored = true;
+        }
+        else
+        {
+          size_t pos = Index(hash_);
+          while (m_table[pos] != empty_slot) pos = (pos + 1) & m_mask;
+          m_table[pos] = hash_;
+        }
+        m_ring[m_ring_pos] = hash_;
+        m_ring_pos = (m_ring_pos + 1) % m_ring.size();
+        m_size++;
+
+        return(true);
+      }
+
+      /**
+      * @brief Check if a hash value is in the window.
+      **/
+      bool Contains(size_t hash_) const
+      {
+        if (hash_ == empty_slot) return(m_empty_stored);
+
+        for (size_t pos = Index(hash_); m_table[pos] != empty_slot; pos = (pos + 1) & m_mask)
+        {
+          if (m_table[pos] == hash_) return(true);
+        }
+        return(false);
+      }
+
+      size_t size()   const { return(m_size); }
+      size_t window() const { return(m_ring.size()); }
+
+    protected:
+      static constexpr size_t cache_line_size = 64;
+      static constexpr size_t slots_per_line  = cache_line_size / sizeof(size_t);
+      // the value marking an unused table slot, a stored hash with this value is tracked separately
+      static constexpr size_t empty_slot      = 0;
+
+      static unsigned log2(size_t value_)
+      {
+        unsigned bits(0);
+        while (value_ > 1)
+        {
+          value_ >>= 1;
+          bits++;
+        }
+        return(bits);
+      }
+
+      // fibonacci hashing, the upper bits spread sequential hash values over the table
+      size_t Index(size_t hash_) const
+      {
+        return(static_cast<size_t>((static_cast<std::uint64_t>(hash_) * 0x9E3779B97F4A7C15ull) >> m_shift));
+      }
+
+      // backward shift deletion, keeps the probe sequences free of holes
+      void Erase(size_t hash_)
+      {
+        if (hash_ == empty_slot)
+        {
+          m_empty_stored = false;
+          return;
+        }
+
+        size_t pos = Index(hash_);
+        while (m_table[pos] != hash_) pos = (pos + 1) & m_mask;
+
+        size_t next = (pos + 1) & m_mask;
+        while (m_table[next] != empty_slot)
+        {
+          // move the entry into the hole if its home slot is not between the hole and the entry
+          const size_t home = Index(m_table[next]);
+          if (((next - home) & m_mask) >= ((next - pos) & m_mask))
+          {
+            m_table[pos] = m_table[next];
+            pos = next;
+          }
+          next = (next + 1) & m_mask;
+        }
+        m_table[pos] = empty_slot;
+      }
+
+      std::vector<size_t>  m_table_buf;
+      size_t*              m_table = nullptr;
+      size_t               m_mask  = 0;
+      unsigned             m_shift = 0;
+
+      std::vector<size_t>  m_ring;
+      size_t               m_ring_pos     = 0;
+      size_t               m_size         = 0;
+      bool                 m_empty_stored = false;
+    };
+  }
+}
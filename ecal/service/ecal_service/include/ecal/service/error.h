@@ -42,6 +42,7 @@ namespace eCAL
         UNKNOWN_SERVER,
         PROTOCOL_ERROR,
         STOPPED_BY_USER,
+        REQUEST_REJECTED,
       };
 
     //////////////////////////////////////////
@@ -68,6 +69,7 @@ namespace eCAL
         case UNKNOWN_SERVER:                        return "Unknown server";                                break;
         case PROTOCOL_ERROR:                        return "Protocol error";                                break;
         case STOPPED_BY_USER:                       return "Stopped by user";                               break;
+        case REQUEST_REJECTED:                      return "Request rejected by server";                    break;
 
         default:                                    return "Unknown error";
         }
@@ -82,8 +82,9 @@ namespace eCAL
     //////////////////////////////////////////////
     public:
       using EventCallbackT   = ServerEventCallbackT;
-      using ServiceCallbackT = ServerServiceCallbackT;
-      using DeleteCallbackT  = std::function<void(Server*)>;
+      using ServiceCallbackT      = ServerServiceCallbackT;
+      using AsyncServiceCallbackT = ServerAsyncServiceCallbackT;
+      using DeleteCallbackT       = std::function<void(Server*)>;
 
     ///////////////////////////////////////////
     // Constructor, Destructor, Create
@@ -106,7 +107,7 @@ namespace eCAL
        * =========================================================================
        * 
        * @param io_context                      The io_context to use for the server and all callbacks
-       * @param protocol_version                The protocol version to use. When this is 0, the buggy protocol version 0 will be used.
+       * @param protocol_version                The protocol version to use. When this is 0, the buggy protocol version 0 will be used. Otherwise it is the highest version accepted in the handshake (2 enables request pipelining).
        * @param port                            The port to listen on. When this is 0, the OS will chose a free port.
        * @param service_callback                The callback to use for service calls. Will be executed in the context of the io_context.
        * @param parallel_service_calls_enabled  When true, service calls will be executed in parallel. When false, service calls will be executed sequentially.
@@ -140,11 +141,51 @@ namespace eCAL
                                           , bool                                     parallel_service_calls_enabled
                                           , const EventCallbackT&                    event_callback
                                           , const DeleteCallbackT&                   delete_callback);
+      /**
+       * @brief Creates a new Server instance with an asynchronous service callback.
+       * 
+       * The service callback is executed in the context of the io_context
+       * like the synchronous one, but does not have to create the response
+       * before returning. It may hand the request over to another thread (e.g.
+       * a worker pool) and send the response from there by calling the
+       * response callback, so long running service calls do not block the
+       * io_context.
+       * The session of a client does not execute its next request, until the
+       * response of the current request was sent.
+       * 
+       * All other parameters are the same as for the synchronous service callback.
+       * 
+       * @return The new server instance.
+       */
+      static std::shared_ptr<Server> create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                             protocol_version
+                                          , std::uint16_t                            port
+                                          , const AsyncServiceCallbackT&             service_callback
+                                          , bool                                     parallel_service_calls_enabled
+                                          , const EventCallbackT&                    event_callback
+                                          , const LoggerT&                           logger
+                                          , const DeleteCallbackT&                   delete_callback);
+
+      static std::shared_ptr<Server> create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                             protocol_version
+                                          , std::uint16_t                            port
+                                          , const AsyncServiceCallbackT&             service_callback
+                                          , bool                                     parallel_service_calls_enabled
+                                          , const EventCallbackT&                    event_callback
+                                          , const LoggerT&                           logger = default_logger("Service Server"));
+
+      static std::shared_ptr<Server> create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                             protocol_version
+                                          , std::uint16_t                            port
+                                          , const AsyncServiceCallbackT&             service_callback
+                                          , bool                                     parallel_service_calls_enabled
+                                          , const EventCallbackT&                    event_callback
+                                          , const DeleteCallbackT&                   delete_callback);
     protected:
       Server(const std::shared_ptr<asio::io_context>& io_context
             , std::uint8_t                            protocol_version
             , std::uint16_t                           port
-            , const ServiceCallbackT&                 service_callback
+            , const AsyncServiceCallbackT&            service_callback
             , bool                                    parallel_service_calls_enabled
             , const EventCallbackT&                   event_callback
             , const LoggerT&                          logger);
@@ -143,6 +143,28 @@ namespace eCAL
                                           , bool                            parallel_service_calls_enabled
                                           , const Server::EventCallbackT&   event_callback);
 
+      /**
+       * @brief Create a new server instance with an asynchronous service callback, which is managed by this server manager.
+       * 
+       * The callback is called in the io_context thread, but may send the
+       * response later from any other thread by calling the response
+       * callback. Use this to execute long running service calls without
+       * blocking the io_context.
+       * 
+       * @param protocol_version                The protocol version, that will be used by this server
+       * @param port                            The port, that the server will listen on. If 0, the OS will choose a free port.
+       * @param service_callback                The callback, that will be called for each incoming service call.
+       * @param parallel_service_calls_enabled  If true, the server will handle incoming service calls in parallel. If false, the server will handle incoming service calls sequentially.
+       * @param event_callback                  The callback, that will be called whenever a client connects or disconnects. The callback will be executed in the io_context thread.
+       * 
+       * @return a shared pointer to the created server
+       */
+      std::shared_ptr<Server> create_server(std::uint8_t                         protocol_version
+                                          , std::uint16_t                        port
+                                          , const Server::AsyncServiceCallbackT& service_callback
+                                          , bool                                 parallel_service_calls_enabled
+                                          , const Server::EventCallbackT&        event_callback);
+
       /**
        * @brief Get the number of servers, that are currently managed by this server manager
        * @return The number of servers
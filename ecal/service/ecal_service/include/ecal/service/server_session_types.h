@@ -35,5 +35,19 @@ namespace eCAL
 
     using ServerServiceCallbackT = std::function<void(const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response)>;
     using ServerEventCallbackT   = std::function<void(ServerEventType, const std::string&)>;
+
+    /**
+     * @brief Sends the response of a service call, may be called from any thread (exactly once per request).
+     */
+    using ServerResponseCallbackT     = std::function<void(const std::shared_ptr<std::string>& response)>;
+
+    /**
+     * @brief Service callback that does not have to create the response before returning.
+     *
+     * The callback can hand the request over to another thread and send the
+     * response later with the response callback. The session does not read
+     * or execute another request until the response was sent.
+     */
+    using ServerAsyncServiceCallbackT = std::function<void(const std::shared_ptr<const std::string>& request, const ServerResponseCallbackT& response_callback)>;
   } // namespace service
 } // namespace eCAL
@@ -23,6 +23,7 @@
 #include "log_helpers.h"
 #include "log_defs.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -46,9 +47,10 @@ namespace eCAL
                                                             , const std::string&                      address
                                                             , std::uint16_t                           port
                                                             , const EventCallbackT&                   event_callback
-                                                            , const LoggerT&                          logger)
+                                                            , const LoggerT&                          logger
+                                                            , std::uint8_t                            max_protocol_version)
     {
-      std::shared_ptr<ClientSessionV1> instance(new ClientSessionV1(io_context, address, port, event_callback, logger));
+      std::shared_ptr<ClientSessionV1> instance(new ClientSessionV1(io_context, address, port, event_callback, logger, max_protocol_version));
 
       instance->resolve_endpoint();
 
@@ -59,8 +61,10 @@ namespace eCAL
                                     , const std::string&                      address
                                     , std::uint16_t                           port
                                     , const EventCallbackT&                   event_callback
-                                    , const LoggerT&                          logger)
+                                    , const LoggerT&                          logger
+                                    , std::uint8_t                            max_protocol_version)
       : ClientSessionBase(io_context, event_callback)
+      , max_protocol_version_     (std::max(MIN_SUPPORTED_PROTOCOL_VERSION, std::min(max_protocol_version, MAX_SUPPORTED_PROTOCOL_VERSION)))
       , address_                  (address)
       , port_                     (port)
       , service_call_queue_strand_(*io_context)
@@ -70,6 +74,7 @@ namespace eCAL
       , state_                    (State::NOT_CONNECTED)
       , stopped_by_user_          (false)
       , service_call_in_progress_ (false)
+      , next_request_id_          (1)
     {
       ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Created");
     }
@@ -185,7 +190,7 @@ namespace eCAL
       payload_buffer->resize(sizeof(ProtocolHandshakeRequestMessage), '\0');
       ProtocolHandshakeRequestMessage* handshake_request_message = reinterpret_cast<ProtocolHandshakeRequestMessage*>(const_cast<char*>(payload_buffer->data()));
       handshake_request_message->min_supported_protocol_version = MIN_SUPPORTED_PROTOCOL_VERSION;
-      handshake_request_message->max_supported_protocol_version = MAX_SUPPORTED_PROTOCOL_VERSION;
+      handshake_request_message->max_supported_protocol_version = max_protocol_version_;
 
       // Fill TCP Header
       header_buffer->package_size_n = htonl(sizeof(ProtocolHandshakeRequestMessage));
@@ -245,7 +250,7 @@ namespace eCAL
                                   const ProtocolHandshakeResponseMessage* handshake_response = reinterpret_cast<const ProtocolHandshakeResponseMessage*>(payload_buffer->data());
 
                                   if ((handshake_response->accepted_protocol_version >= MIN_SUPPORTED_PROTOCOL_VERSION)
-                                    && (handshake_response->accepted_protocol_version <= MIN_SUPPORTED_PROTOCOL_VERSION))
+                                    && (handshake_response->accepted_protocol_version <= me->max_protocol_version_))
                                   {
                                     {
                                       const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
@@ -259,6 +264,13 @@ namespace eCAL
                                     // Call event callback
                                     me->event_callback_(eCAL::service::ClientEventType::Connected, message);
 
+                                    // With protocol V2 the responses are received by a single loop
+                                    // that also notices when the server closes the connection.
+                                    if (me->accepted_protocol_version_ >= 2)
+                                    {
+                                      me->receive_pipelined_responses();
+                                    }
+
                                     // Start sending service requests, if there are any
                                     {
                                       const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
@@ -277,7 +289,8 @@ namespace eCAL
                                         // This will cause asio / the OS to notify us, when the server closed the connection.
 
                                         me->service_call_in_progress_ = false;
-                                        me->peek_for_error();
+                                        if (me->accepted_protocol_version_ < 2)
+                                          me->peek_for_error();
                                       }
                                     }
 
@@ -382,22 +395,41 @@ namespace eCAL
       header_buffer->message_type   = MessageType::ServiceRequest;
       header_buffer->header_size_n  = htons(sizeof(TcpHeaderV1));
 
+      const bool pipelined = (accepted_protocol_version_ >= 2);
+      if (pipelined)
+      {
+        // The response may arrive before the send handler is executed, so the
+        // request must be pending already. The caller holds the service_state_mutex_.
+        header_buffer->request_id = next_request_id_++;
+        pending_requests_.emplace(header_buffer->request_id, response_cb);
+      }
+
       eCAL::service::ProtocolV1::async_send_payload(socket_, socket_mutex_, header_buffer, request
-                              , service_call_queue_strand_.wrap([me = shared_from_this(), response_cb](asio::error_code ec)
+                              , service_call_queue_strand_.wrap([me = shared_from_this(), response_cb, pipelined](asio::error_code ec)
                                 {
                                   const std::string message = "Failed sending service request: " + ec.message();
                                   me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
+                                  if (pipelined)
+                                  {
+                                    // The callback is called with all other pending requests
+                                    me->handle_connection_loss_error(message);
+                                    return;
+                                  }
+
                                   // Call the callback with an error
                                   response_cb(Error(Error::ErrorCode::CONNECTION_CLOSED, message), nullptr);
                                   
                                   // Further handle the error, e.g. unwinding pending service calls and calling the event callback
                                   me->handle_connection_loss_error(message);
                                 })
-                              , [me = shared_from_this(), response_cb]()
+                              , [me = shared_from_this(), response_cb, pipelined]()
                                 {
                                   ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully sent service request.");
-                                  me->receive_service_response(response_cb);
+                                  if (pipelined)
+                                    me->send_next_queued_request();
+                                  else
+                                    me->receive_service_response(response_cb);
                                 });
     }
 
@@ -473,6 +505,94 @@ namespace eCAL
 
     }
 
+    void ClientSessionV1::receive_pipelined_responses()
+    {
+      ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Waiting for service responses...");
+
+      eCAL::service::ProtocolV1::async_receive_payload(socket_, socket_mutex_
+                            , service_call_queue_strand_.wrap([me = shared_from_this()](asio::error_code ec)
+                              {
+                                bool idle(false);
+                                {
+                                  const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+                                  idle = me->pending_requests_.empty();
+                                }
+
+                                const std::string message = (idle ? "Connection loss while idling: " : "Failed receiving service response: ") + ec.message();
+                                me->logger_((idle ? LogLevel::Info : LogLevel::Error), "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                                // Calls the callbacks of all pending requests with an error
+                                me->handle_connection_loss_error(message);
+                              })
+                            , service_call_queue_strand_.wrap([me = shared_from_this()](const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)
+                              {
+                                const TcpHeaderV1* header = reinterpret_cast<const TcpHeaderV1*>(header_buffer->data());
+                                if ((header->message_type != eCAL::service::MessageType::ServiceResponse)
+                                    && (header->message_type != eCAL::service::MessageType::ServiceRequestRejected))
+                                {
+                                  const std::string message = "Received invalid service response from server. Expected message type " 
+                                                              + std::to_string(static_cast<std::uint8_t>(eCAL::service::MessageType::ServiceResponse)) 
+                                                              + ", but received " + std::to_string(static_cast<std::uint8_t>(header->message_type));
+                                  me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                  me->handle_connection_loss_error(message);
+                                  return;
+                                }
+
+                                ResponseCallbackT response_cb;
+                                {
+                                  const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+                                  auto pending_request = me->pending_requests_.find(header->request_id);
+                                  if (pending_request != me->pending_requests_.end())
+                                  {
+                                    response_cb = std::move(pending_request->second);
+                                    me->pending_requests_.erase(pending_request);
+                                  }
+                                }
+
+                                if (!response_cb)
+                                {
+                                  const std::string message = "Received service response for unknown request id " + std::to_string(header->request_id);
+                                  me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                  me->handle_connection_loss_error(message);
+                                  return;
+                                }
+
+                                // Wait for the next response before calling the user's callback. The
+                                // handlers run in the strand, so the callbacks are never called in parallel.
+                                if (header->message_type == eCAL::service::MessageType::ServiceRequestRejected)
+                                {
+                                  const std::string message = "Service request rejected by server: " + *payload_buffer;
+                                  me->logger_(LogLevel::Warning, "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                                  me->receive_pipelined_responses();
+                                  response_cb(Error(Error::ErrorCode::REQUEST_REJECTED, *payload_buffer), nullptr);
+                                  return;
+                                }
+
+                                ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully received service response of " + std::to_string(payload_buffer->size()) + " bytes");
+
+                                me->receive_pipelined_responses();
+
+                                response_cb(Error::OK, payload_buffer);
+                              }));
+    }
+
+    void ClientSessionV1::send_next_queued_request()
+    {
+      const std::lock_guard<std::mutex> lock(service_state_mutex_);
+
+      if (!service_call_queue_.empty() && (state_ == State::CONNECTED))
+      {
+        ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + " Service call queue contains " + std::to_string(service_call_queue_.size()) + " Entries. Sending next service request.");
+        send_next_service_request(service_call_queue_.front().request, service_call_queue_.front().response_cb);
+        service_call_queue_.pop_front();
+      }
+      else
+      {
+        service_call_in_progress_ = false;
+      }
+    }
+
     //////////////////////////////////////
     // Status API
     //////////////////////////////////////
@@ -553,6 +673,20 @@ namespace eCAL
         // Set the state to FAILED
         state_ = State::FAILED;
 
+        // The requests waiting for their response (protocol V2) are older than the queued ones
+        if (!pending_requests_.empty())
+        {
+          std::vector<std::pair<std::uint64_t, ResponseCallbackT>> pending_requests(pending_requests_.begin(), pending_requests_.end());
+          pending_requests_.clear();
+
+          std::sort(pending_requests.begin(), pending_requests.end()
+                  , [](const std::pair<std::uint64_t, ResponseCallbackT>& lhs, const std::pair<std::uint64_t, ResponseCallbackT>& rhs) { return lhs.first < rhs.first; });
+          for (auto pending_request = pending_requests.rbegin(); pending_request != pending_requests.rend(); ++pending_request)
+          {
+            service_call_queue_.push_front(ServiceCall{nullptr, std::move(pending_request->second)});
+          }
+        }
+
         // call all callbacks from the queue with an error
         if (!service_call_queue_.empty())
         {
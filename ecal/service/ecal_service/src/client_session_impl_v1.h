@@ -28,6 +28,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace eCAL
 {
@@ -55,14 +56,16 @@ namespace eCAL
                                                     , const std::string&                      address
                                                     , std::uint16_t                           port
                                                     , const EventCallbackT&                   event_callback
-                                                    , const LoggerT&                          logger_ = default_logger("Service Client V1"));
+                                                    , const LoggerT&                          logger_ = default_logger("Service Client V1")
+                                                    , std::uint8_t                            max_protocol_version = MAX_SUPPORTED_PROTOCOL_VERSION);
 
     protected:
       ClientSessionV1(const std::shared_ptr<asio::io_context>& io_context
                     , const std::string&                       address
                     , std::uint16_t                            port
                     , const EventCallbackT&                    event_callback
-                    , const LoggerT&                           logger);
+                    , const LoggerT&                           logger
+                    , std::uint8_t                             max_protocol_version);
 
     public:
       // Delete copy / move constructor and assignment operator
@@ -93,6 +96,12 @@ namespace eCAL
     private:
       void send_next_service_request(const std::shared_ptr<const std::string>& request, const ResponseCallbackT& response_cb);
       void receive_service_response(const ResponseCallbackT& response_cb);
+
+      // Protocol V2 (pipelining): The requests are sent one after another
+      // without waiting for the responses. A single receive loop assigns the
+      // responses to the pending requests by their request id.
+      void receive_pipelined_responses();
+      void send_next_queued_request();
     
     //////////////////////////////////////
     // Status API
@@ -142,8 +151,9 @@ namespace eCAL
     //////////////////////////////////////
     private:
       static constexpr std::uint8_t MIN_SUPPORTED_PROTOCOL_VERSION = 1;
-      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 1;
+      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 2;
 
+      const std::uint8_t        max_protocol_version_;                          //!< The maximum protocol version offered in the handshake (<= MAX_SUPPORTED_PROTOCOL_VERSION)
       const std::string         address_;                                       //!< The original address that this client was created with.
       const std::uint16_t       port_;                                          //!< The original port that this client was created with.
 
@@ -158,7 +168,10 @@ namespace eCAL
       bool                      stopped_by_user_;           //!< Telling whether we actively stopped the client. Protected by service_state_mutex_. When set, the client will not accept any more async service calls.
 
       std::deque<ServiceCall>   service_call_queue_;
-      bool                      service_call_in_progress_;
+      bool                      service_call_in_progress_;  //!< Protocol V1: A request is waiting for its response. Protocol V2: A request is being sent.
+
+      std::uint64_t                                         next_request_id_;   //!< Protocol V2: Id of the next request. Protected by service_state_mutex_.
+      std::unordered_map<std::uint64_t, ResponseCallbackT>  pending_requests_;  //!< Protocol V2: Sent requests waiting for their response. Protected by service_state_mutex_.
     };
   }
 }
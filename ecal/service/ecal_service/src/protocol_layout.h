@@ -33,6 +33,7 @@ namespace eCAL
       ProtocolHandshakeResponse = 2,
       ServiceRequest            = 3,
       ServiceResponse           = 4,
+      ServiceRequestRejected    = 5,  // since protocol V2, sent instead of the response, the payload is an error message
     };
 
 #pragma pack(push, 1)
@@ -46,13 +47,16 @@ namespace eCAL
     // TCP Header
     //   - Used for service request since protocol version 1
     //   - Used for response since protocol version 0
+    //   - Since protocol version 2 the request id lets a client have multiple
+    //     requests in flight. The server copies it into the response, the
+    //     responses may arrive in any order.
     struct TcpHeaderV1
     {
       std::uint32_t package_size_n = 0;                        // package size in network byte order
       std::uint8_t  version        = 0;                        // protocol version                    (since protocol V1 / eCAL 5.12)
       MessageType   message_type   = MessageType::Undefined;   // message type                        (since protocol V1 / eCAL 5.12)
       std::uint16_t header_size_n  = 0;                        // header size in network byte order   (since protocol V1 / eCAL 5.12)
-      std::uint64_t reserved       = 0;                        // reserved
+      std::uint64_t request_id     = 0;                        // request id, opaque to the server    (since protocol V2, reserved before)
     };
 
     // Handshake Request Message, since protocol v1
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 
 #include "server_impl.h"
 
@@ -29,6 +30,20 @@ namespace eCAL
 {
   namespace service
   {
+    namespace
+    {
+      // Executes a synchronous service callback and sends the response directly
+      Server::AsyncServiceCallbackT to_async_service_callback(const Server::ServiceCallbackT& service_callback)
+      {
+        return [service_callback](const std::shared_ptr<const std::string>& request, const ServerResponseCallbackT& response_callback)
+               {
+                 const auto response = std::make_shared<std::string>();
+                 service_callback(request, response);
+                 response_callback(response);
+               };
+      }
+    }
+
     ///////////////////////////////////////////
     // Constructor, Destructor, Create
     ///////////////////////////////////////////
@@ -47,7 +62,7 @@ namespace eCAL
         delete server; // NOLINT(cppcoreguidelines-owning-memory)
       };
 
-      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger), deleter);
+      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, to_async_service_callback(service_callback), parallel_service_calls_enabled, event_callback, logger), deleter);
     }
 
     std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
@@ -58,7 +73,7 @@ namespace eCAL
                                           , const EventCallbackT&                   event_callback
                                           , const LoggerT&                          logger)
     {
-      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger));
+      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, to_async_service_callback(service_callback), parallel_service_calls_enabled, event_callback, logger));
     }
 
     std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
@@ -72,10 +87,50 @@ namespace eCAL
       return Server::create(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, default_logger("Service Server"), delete_callback);
     }
 
+    std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                            protocol_version
+                                          , std::uint16_t                           port
+                                          , const AsyncServiceCallbackT&            service_callback
+                                          , bool                                    parallel_service_calls_enabled
+                                          , const EventCallbackT&                   event_callback
+                                          , const LoggerT&                          logger
+                                          , const DeleteCallbackT&                  delete_callback)
+    {
+      auto deleter = [delete_callback](Server* server)
+      {
+        delete_callback(server);
+        delete server; // NOLINT(cppcoreguidelines-owning-memory)
+      };
+
+      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger), deleter);
+    }
+
+    std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                            protocol_version
+                                          , std::uint16_t                           port
+                                          , const AsyncServiceCallbackT&            service_callback
+                                          , bool                                    parallel_service_calls_enabled
+                                          , const EventCallbackT&                   event_callback
+                                          , const LoggerT&                          logger)
+    {
+      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger));
+    }
+
+    std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                            protocol_version
+                                          , std::uint16_t                           port
+                                          , const AsyncServiceCallbackT&            service_callback
+                                          , bool                                    parallel_service_calls_enabled
+                                          , const EventCallbackT&                   event_callback
+                                          , const DeleteCallbackT&                  delete_callback)
+    {
+      return Server::create(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, default_logger("Service Server"), delete_callback);
+    }
+
     Server::Server(const std::shared_ptr<asio::io_context>& io_context
                   , std::uint8_t                            protocol_version
                   , std::uint16_t                           port
-                  , const ServiceCallbackT&                 service_callback
+                  , const AsyncServiceCallbackT&            service_callback
                   , bool                                    parallel_service_calls_enabled
                   , const EventCallbackT&                   event_callback
                   , const LoggerT&                          logger)
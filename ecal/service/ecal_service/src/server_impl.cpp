@@ -40,7 +40,7 @@ namespace eCAL
     std::shared_ptr<ServerImpl> ServerImpl::create(const std::shared_ptr<asio::io_context>& io_context
                                                   , std::uint8_t                            protocol_version
                                                   , std::uint16_t                           port
-                                                  , const ServerServiceCallbackT&           service_callback // TODO: The service callback may block a long time. This may cause the entire network stack to wait for long running service callbacks. Maybe it is a good idea to have some kind of "future" object, that the user can hand to some differen io_context or to a custom thread. That thread will then work on the object and call some function / let it go out of scope, which will then trigger sending the response to the client.
+                                                  , const ServerAsyncServiceCallbackT&      service_callback
                                                   , bool                                    parallel_service_calls_enabled
                                                   , const ServerEventCallbackT&             event_callback
                                                   , const LoggerT&                          logger)
@@ -57,7 +57,7 @@ namespace eCAL
     }
 
     ServerImpl::ServerImpl(const std::shared_ptr<asio::io_context>& io_context
-                          , const ServerServiceCallbackT&           service_callback
+                          , const ServerAsyncServiceCallbackT&      service_callback
                           , bool                                    parallel_service_calls_enabled
                           , const ServerEventCallbackT&             event_callback
                           , const LoggerT&                          logger)
@@ -238,7 +238,7 @@ namespace eCAL
       }
       else
       {
-        new_session = eCAL::service::ServerSessionV1::create(io_context_, service_callback_, service_callback_strand, event_callback_, shutdown_callback, logger_);
+        new_session = eCAL::service::ServerSessionV1::create(io_context_, service_callback_, service_callback_strand, event_callback_, shutdown_callback, logger_, protocol_version);
       }
 
       // Accept new session.
@@ -56,14 +56,14 @@ namespace eCAL
       static std::shared_ptr<ServerImpl> create(const std::shared_ptr<asio::io_context>& io_context
                                               , std::uint8_t                             protocol_version
                                               , std::uint16_t                            port
-                                              , const ServerServiceCallbackT&            service_callback
+                                              , const ServerAsyncServiceCallbackT&       service_callback
                                               , bool                                     parallel_service_calls_enabled
                                               , const ServerEventCallbackT&              event_callback
                                               , const LoggerT&                           logger = default_logger("Service Server"));
 
     protected:
       ServerImpl(const std::shared_ptr<asio::io_context>& io_context
-                , const ServerServiceCallbackT&           service_callback
+                , const ServerAsyncServiceCallbackT&      service_callback
                 , bool                                    parallel_service_calls_enabled
                 , const ServerEventCallbackT&             event_callback
                 , const LoggerT&                          logger);
@@ -103,7 +103,7 @@ namespace eCAL
 
       const bool                                      parallel_service_calls_enabled_;
       const std::shared_ptr<asio::io_context::strand> service_callback_common_strand_;
-      const ServerServiceCallbackT                    service_callback_;
+      const ServerAsyncServiceCallbackT               service_callback_;
       const ServerEventCallbackT                      event_callback_;
 
       mutable std::mutex                              session_list_mutex_;
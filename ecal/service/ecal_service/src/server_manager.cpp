@@ -23,6 +23,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 
 namespace eCAL
 {
@@ -56,6 +57,23 @@ namespace eCAL
                                                         , const Server::ServiceCallbackT& service_callback
                                                         , bool                            parallel_service_calls_enabled
                                                         , const Server::EventCallbackT&   event_callback)
+    {
+      const Server::AsyncServiceCallbackT async_service_callback
+              = [service_callback](const std::shared_ptr<const std::string>& request, const ServerResponseCallbackT& response_callback)
+                {
+                  const auto response = std::make_shared<std::string>();
+                  service_callback(request, response);
+                  response_callback(response);
+                };
+
+      return create_server(protocol_version, port, async_service_callback, parallel_service_calls_enabled, event_callback);
+    }
+
+    std::shared_ptr<Server> ServerManager::create_server(std::uint8_t                         protocol_version
+                                                        , std::uint16_t                        port
+                                                        , const Server::AsyncServiceCallbackT& service_callback
+                                                        , bool                                 parallel_service_calls_enabled
+                                                        , const Server::EventCallbackT&        event_callback)
     {
       const std::lock_guard<std::mutex> lock(server_manager_mutex_);
       if (stopped_)
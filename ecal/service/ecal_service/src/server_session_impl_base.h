@@ -67,7 +67,7 @@ namespace eCAL
 
     protected:
       ServerSessionBase(const std::shared_ptr<asio::io_context>&         io_context
-                      , const ServerServiceCallbackT&                    service_callback
+                      , const ServerAsyncServiceCallbackT&               service_callback
                       , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                       , const ServerEventCallbackT&                      event_callback
                       , const ShutdownCallbackT&                         shutdown_callback)
@@ -97,7 +97,7 @@ namespace eCAL
       asio::ip::tcp::socket                           socket_;
       mutable std::mutex                              socket_mutex_;
 
-      const ServerServiceCallbackT                    service_callback_;
+      const ServerAsyncServiceCallbackT               service_callback_;
       const std::shared_ptr<asio::io_context::strand> service_callback_strand_;
       const ServerEventCallbackT                      event_callback_;
       const ShutdownCallbackT                         shutdown_callback_;
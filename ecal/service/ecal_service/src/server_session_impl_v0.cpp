@@ -40,7 +40,7 @@ namespace eCAL
   {
 
     std::shared_ptr<ServerSessionV0> ServerSessionV0::create(const std::shared_ptr<asio::io_context>&          io_context
-                                                            , const ServerServiceCallbackT&                    service_callback
+                                                            , const ServerAsyncServiceCallbackT&               service_callback
                                                             , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                                                             , const ServerEventCallbackT&                      event_callback
                                                             , const ShutdownCallbackT&                         shutdown_callback
@@ -51,7 +51,7 @@ namespace eCAL
     }
 
     ServerSessionV0::ServerSessionV0(const std::shared_ptr<asio::io_context>&          io_context
-                                    , const ServerServiceCallbackT&                    service_callback
+                                    , const ServerAsyncServiceCallbackT&               service_callback
                                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                                     , const ServerEventCallbackT&                      event_callback
                                     , const ShutdownCallbackT&                         shutdown_callback
@@ -197,26 +197,10 @@ namespace eCAL
           ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Socket currently doesn't hold any more data.");
           ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "handle_read final request size: " + std::to_string(request->size()) + ". Executing callback...");
 
-          auto response = std::make_shared<std::string>();
-          service_callback_(request, response);
-
-          ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Server callback executed. Reponse size: " + std::to_string(response->size()) + ".");
-   
-          const auto header      = std::make_shared<eCAL::service::TcpHeaderV0>();
-          header->package_size_n = htonl(static_cast<uint32_t>(response->size()));
-
-          const std::vector<asio::const_buffer> buffer_list { asio::buffer(reinterpret_cast<const char*>(header.get()), sizeof(eCAL::service::TcpHeaderV0))
-                                                            , asio::buffer(*response)};
-
-          {
-            const std::lock_guard<std::mutex> socket_lock(socket_mutex_);
-            asio::async_write(socket_
-                            , buffer_list
-                            , [me = shared_from_this(), header, response](asio::error_code ec, std::size_t bytes_written)
-                              {
-                                me->handle_write(ec, bytes_written);
-                              });
-          }
+          service_callback_(request, [me = shared_from_this()](const std::shared_ptr<std::string>& response)
+                                     {
+                                       me->send_service_response(response);
+                                     });
         }
       }
       else
@@ -229,6 +213,27 @@ namespace eCAL
       }
     }
 
+    void ServerSessionV0::send_service_response(const std::shared_ptr<std::string>& response)
+    {
+      ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Server callback executed. Reponse size: " + std::to_string(response->size()) + ".");
+
+      const auto header      = std::make_shared<eCAL::service::TcpHeaderV0>();
+      header->package_size_n = htonl(static_cast<uint32_t>(response->size()));
+
+      const std::vector<asio::const_buffer> buffer_list { asio::buffer(reinterpret_cast<const char*>(header.get()), sizeof(eCAL::service::TcpHeaderV0))
+                                                        , asio::buffer(*response)};
+
+      {
+        const std::lock_guard<std::mutex> socket_lock(socket_mutex_);
+        asio::async_write(socket_
+                        , buffer_list
+                        , [me = shared_from_this(), header, response](asio::error_code ec, std::size_t bytes_written)
+                          {
+                            me->handle_write(ec, bytes_written);
+                          });
+      }
+    }
+
     void ServerSessionV0::handle_write(const asio::error_code& ec, std::size_t /*bytes_transferred*/)
     {
       if (!ec)
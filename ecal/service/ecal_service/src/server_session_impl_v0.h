@@ -44,7 +44,7 @@ namespace eCAL
 
     public:
       static std::shared_ptr<ServerSessionV0> create(const std::shared_ptr<asio::io_context>&          io_context
-                                                    , const ServerServiceCallbackT&                    service_callback
+                                                    , const ServerAsyncServiceCallbackT&               service_callback
                                                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                                                     , const ServerEventCallbackT&                      event_callback
                                                     , const ShutdownCallbackT&                         shutdown_callback
@@ -52,7 +52,7 @@ namespace eCAL
 
     protected:
       ServerSessionV0(const std::shared_ptr<asio::io_context>&         io_context
-                    , const ServerServiceCallbackT&                    service_callback
+                    , const ServerAsyncServiceCallbackT&               service_callback
                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                     , const ServerEventCallbackT&                      event_callback
                     , const ShutdownCallbackT&                         shutdown_callback
@@ -86,6 +86,7 @@ namespace eCAL
 
     private:
       void handle_read(const asio::error_code& ec, size_t bytes_transferred, const std::shared_ptr<std::string>& request);
+      void send_service_response(const std::shared_ptr<std::string>& response);
 
       void handle_write(const asio::error_code& ec, std::size_t /*bytes_transferred*/);
 
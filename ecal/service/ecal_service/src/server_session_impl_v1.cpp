@@ -42,25 +42,30 @@ namespace eCAL
     constexpr std::uint8_t ServerSessionV1::MAX_SUPPORTED_PROTOCOL_VERSION;
 
     std::shared_ptr<ServerSessionV1> ServerSessionV1::create(const std::shared_ptr<asio::io_context>&          io_context
-                                                            , const ServerServiceCallbackT&                    service_callback
+                                                            , const ServerAsyncServiceCallbackT&               service_callback
                                                             , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                                                             , const ServerEventCallbackT&                      event_callback
                                                             , const ShutdownCallbackT&                         shutdown_callback
-                                                            , const LoggerT&                                   logger)
+                                                            , const LoggerT&                                   logger
+                                                            , std::uint8_t                                     max_protocol_version)
     {
-      std::shared_ptr<ServerSessionV1> instance = std::shared_ptr<ServerSessionV1>(new ServerSessionV1(io_context, service_callback, service_callback_strand, event_callback, shutdown_callback, logger));
+      std::shared_ptr<ServerSessionV1> instance = std::shared_ptr<ServerSessionV1>(new ServerSessionV1(io_context, service_callback, service_callback_strand, event_callback, shutdown_callback, logger, max_protocol_version));
       return instance;
     }
 
     ServerSessionV1::ServerSessionV1(const std::shared_ptr<asio::io_context>&          io_context
-                                    , const ServerServiceCallbackT&                    service_callback
+                                    , const ServerAsyncServiceCallbackT&               service_callback
                                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                                     , const ServerEventCallbackT&                      event_callback
                                     , const ShutdownCallbackT&                         shutdown_callback
-                                    , const LoggerT&                                   logger)
+                                    , const LoggerT&                                   logger
+                                    , std::uint8_t                                     max_protocol_version)
       : ServerSessionBase(io_context, service_callback, service_callback_strand, event_callback, shutdown_callback)
+      , max_protocol_version_     (std::max(MIN_SUPPORTED_PROTOCOL_VERSION, std::min(max_protocol_version, MAX_SUPPORTED_PROTOCOL_VERSION)))
       , state_                    (State::NOT_CONNECTED)
       , accepted_protocol_version_(0)
+      , request_in_progress_      (false)
+      , receive_paused_           (false)
       , logger_                   (logger)
     {
       ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Server Session Created");
@@ -165,7 +170,7 @@ namespace eCAL
                                   const ProtocolHandshakeRequestMessage* handshake_request = reinterpret_cast<const ProtocolHandshakeRequestMessage*>(payload_buffer->data());
 
                                   // Compute the maximum supported protocol version by this server and the remote client
-                                  const std::uint8_t both_supported_max_protocol_version = std::min(handshake_request->max_supported_protocol_version, MAX_SUPPORTED_PROTOCOL_VERSION);
+                                  const std::uint8_t both_supported_max_protocol_version = std::min(handshake_request->max_supported_protocol_version, me->max_protocol_version_);
                                   const std::uint8_t both_supported_min_protocol_version = std::max(handshake_request->min_supported_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION);
 
                                   if (both_supported_max_protocol_version >= both_supported_min_protocol_version)
@@ -181,7 +186,7 @@ namespace eCAL
                                   {
                                     const std::string message = std::string("Error while accepting connection from client. No common protocol version is found. ")
                                                               + "Client supports [min: " + std::to_string(handshake_request->min_supported_protocol_version) + ", max: " + std::to_string(handshake_request->max_supported_protocol_version) + "]. "
-                                                              + "Server supports [min: " + std::to_string(MIN_SUPPORTED_PROTOCOL_VERSION) + ", max: " + std::to_string(MAX_SUPPORTED_PROTOCOL_VERSION) + "].";
+                                                              + "Server supports [min: " + std::to_string(MIN_SUPPORTED_PROTOCOL_VERSION) + ", max: " + std::to_string(me->max_protocol_version_) + "].";
                                     me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
                                     //const auto message = get_log_string("ERROR", "Error connecting to server. Server reported an un-supported protocol version: " + std::to_string(handshake_response->accepted_protocol_version));
@@ -258,7 +263,7 @@ namespace eCAL
                                 me->event_callback_(eCAL::service::ServerEventType::Disconnected, message);
                                 me->shutdown_callback_(me);
                               }
-                            , service_callback_strand_->wrap([me = shared_from_this()](const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)
+                            , [me = shared_from_this()](const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)
                               {
                                 TcpHeaderV1* header = reinterpret_cast<TcpHeaderV1*>(header_buffer->data());
                                 if (header->message_type != eCAL::service::MessageType::ServiceRequest)
@@ -283,14 +288,44 @@ namespace eCAL
                                   
                                   ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Received service request of " + std::to_string(payload_buffer->size()) + " bytes");
 
-                                  // Call the service callback
-                                  const std::shared_ptr<std::string> response_buffer = std::make_shared<std::string>();
-                                  me->service_callback_(payload_buffer, response_buffer);
-
-                                  // Send the response to the client
-                                  me->send_service_response(response_buffer);
+                                  if (me->accepted_protocol_version_ >= 2)
+                                  {
+                                    bool start_execution(false);
+                                    bool receive_next   (false);
+                                    {
+                                      const std::lock_guard<std::mutex> request_queue_lock(me->request_queue_mutex_);
+
+                                      // Too many queued requests: Only the id is kept, so the rejection is sent in order
+                                      const bool reject = (me->request_queue_.size() >= MAX_QUEUED_REQUESTS);
+                                      me->request_queue_.emplace_back(header->request_id, (reject ? nullptr : payload_buffer));
+                                      start_execution = !me->request_in_progress_;
+                                      me->request_in_progress_ = true;
+
+                                      // Stop receiving if the client does not stop sending, TCP flow control will throttle it
+                                      me->receive_paused_ = (me->request_queue_.size() >= 2 * MAX_QUEUED_REQUESTS);
+                                      receive_next        = !me->receive_paused_;
+                                    }
+
+                                    // Receive the next request while the service callback is running
+                                    if (receive_next)
+                                      me->receive_service_request();
+
+                                    if (start_execution)
+                                      me->execute_next_queued_request();
+                                  }
+                                  else
+                                  {
+                                    me->service_callback_strand_->dispatch([me, payload_buffer]()
+                                              {
+                                                // Call the service callback, it sends the response to the client
+                                                me->service_callback_(payload_buffer, [me](const std::shared_ptr<std::string>& response_buffer)
+                                                                                      {
+                                                                                        me->send_service_response(response_buffer);
+                                                                                      });
+                                              });
+                                  }
                                 }
-                              }));
+                              });
 
     }
 
@@ -326,5 +361,76 @@ namespace eCAL
                               });
     }
 
+    void ServerSessionV1::execute_next_queued_request()
+    {
+      service_callback_strand_->dispatch([me = shared_from_this()]()
+                {
+                  std::pair<std::uint64_t, std::shared_ptr<std::string>> request;
+                  bool resume_receiving(false);
+                  {
+                    const std::lock_guard<std::mutex> request_queue_lock(me->request_queue_mutex_);
+                    request = std::move(me->request_queue_.front());
+                    me->request_queue_.pop_front();
+
+                    resume_receiving    = me->receive_paused_;
+                    me->receive_paused_ = false;
+                  }
+
+                  if (resume_receiving)
+                    me->receive_service_request();
+
+                  const std::uint64_t request_id = request.first;
+                  if (!request.second)
+                  {
+                    me->logger_(LogLevel::Warning, "[" + get_connection_info_string(me->socket_) + "] " + "Rejected service request, as more than " + std::to_string(MAX_QUEUED_REQUESTS) + " requests were queued.");
+                    me->send_pipelined_service_response(std::make_shared<std::string>("Too many queued requests"), request_id, MessageType::ServiceRequestRejected);
+                    return;
+                  }
+
+                  // Call the service callback, it sends the response to the client
+                  me->service_callback_(request.second, [me, request_id](const std::shared_ptr<std::string>& response_buffer)
+                                                        {
+                                                          me->send_pipelined_service_response(response_buffer, request_id, MessageType::ServiceResponse);
+                                                        });
+                });
+    }
+
+    void ServerSessionV1::send_pipelined_service_response(const std::shared_ptr<std::string>& response_buffer, std::uint64_t request_id, MessageType message_type)
+    {
+      // Create header_buffer
+      const std::shared_ptr<TcpHeaderV1>  header_buffer  = std::make_shared<TcpHeaderV1>();
+      header_buffer->package_size_n = htonl(static_cast<std::uint32_t>(response_buffer->size()));
+      header_buffer->version        = accepted_protocol_version_;
+      header_buffer->message_type   = message_type;
+      header_buffer->header_size_n  = htons(sizeof(TcpHeaderV1));
+      header_buffer->request_id     = request_id;
+
+      ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Sending service response...");
+
+      eCAL::service::ProtocolV1::async_send_payload(socket_, socket_mutex_, header_buffer, response_buffer
+                            , [me = shared_from_this()](asio::error_code ec)
+                              {
+                                // The receive loop is still running. Closing the socket lets
+                                // it fail and report the disconnect to the event callback.
+                                me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + "Failed sending service response: " + ec.message());
+                                me->stop();
+                              }
+                            , [me = shared_from_this()]()
+                              {
+                                ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully sent service response.");
+
+                                // Execute the next request, if there is one
+                                {
+                                  const std::lock_guard<std::mutex> request_queue_lock(me->request_queue_mutex_);
+                                  if (me->request_queue_.empty())
+                                  {
+                                    me->request_in_progress_ = false;
+                                    return;
+                                  }
+                                }
+                                me->execute_next_queued_request();
+                              });
+    }
+
   } // namespace service
 } // namespace eCAL
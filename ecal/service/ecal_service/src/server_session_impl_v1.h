@@ -20,14 +20,18 @@
 #pragma once
 
 #include "server_session_impl_base.h"
+#include "protocol_layout.h"
 #include <atomic>
 #include <cstdint>
 #include <ecal/service/logger.h>
 #include <ecal/service/server_session_types.h>
 
 #include <ecal/service/state.h>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 namespace eCAL
 {
@@ -44,19 +48,21 @@ namespace eCAL
 
     public:
       static std::shared_ptr<ServerSessionV1> create(const std::shared_ptr<asio::io_context>&          io_context
-                                                    , const ServerServiceCallbackT&                    service_callback
+                                                    , const ServerAsyncServiceCallbackT&               service_callback
                                                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                                                     , const ServerEventCallbackT&                      event_callback
                                                     , const ShutdownCallbackT&                         shutdown_callback
-                                                    , const LoggerT&                                   logger);
+                                                    , const LoggerT&                                   logger
+                                                    , std::uint8_t                                     max_protocol_version = MAX_SUPPORTED_PROTOCOL_VERSION);
 
     protected:
       ServerSessionV1(const std::shared_ptr<asio::io_context>&         io_context
-                    , const ServerServiceCallbackT&                    service_callback
+                    , const ServerAsyncServiceCallbackT&               service_callback
                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
                     , const ServerEventCallbackT&                      event_callback
                     , const ShutdownCallbackT&                         shutdown_callback
-                    , const LoggerT&                                   logger);
+                    , const LoggerT&                                   logger
+                    , std::uint8_t                                     max_protocol_version);
 
     public:
       // Copy
@@ -86,16 +92,34 @@ namespace eCAL
       void receive_service_request();
       void send_service_response(const std::shared_ptr<std::string>& response_buffer);
 
+      // Protocol V2 (pipelining): The requests are received while the service
+      // callback is running and queued. Like with protocol V1, the next request
+      // is executed after the response of the previous one has been sent, so a
+      // session does not occupy the service callback strand for longer. The
+      // requests of a session are executed in order on purpose, the service
+      // callback strand does not allow parallel calls of one session anyways.
+      // Requests exceeding MAX_QUEUED_REQUESTS are rejected.
+      void execute_next_queued_request();
+      void send_pipelined_service_response(const std::shared_ptr<std::string>& response_buffer, std::uint64_t request_id, MessageType message_type);
+
     /////////////////////////////////////
     // Member variables
     /////////////////////////////////////
     private:
       static constexpr std::uint8_t MIN_SUPPORTED_PROTOCOL_VERSION = 1;
-      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 1;
+      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 2;
+
+      static constexpr std::size_t  MAX_QUEUED_REQUESTS            = 64;  //!< Protocol V2: Further requests are rejected. Receiving pauses, when as many rejected requests are queued.
 
+      const std::uint8_t      max_protocol_version_;            //!< The maximum protocol version accepted in the handshake (<= MAX_SUPPORTED_PROTOCOL_VERSION)
       std::atomic<State>      state_;
       std::uint8_t            accepted_protocol_version_;
 
+      std::mutex                                                           request_queue_mutex_;
+      std::deque<std::pair<std::uint64_t, std::shared_ptr<std::string>>>  request_queue_;         //!< Protocol V2: Received requests (request id, payload). Protected by request_queue_mutex_.
+      bool                                                                 request_in_progress_;   //!< Protocol V2: A request is being executed or its response is being sent. Protected by request_queue_mutex_.
+      bool                                                                 receive_paused_;        //!< Protocol V2: Too many rejected requests are queued, no request is received. Protected by request_queue_mutex_.
+
       const LoggerT logger_;
     };
   }
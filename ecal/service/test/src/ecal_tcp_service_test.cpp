@@ -27,6 +27,7 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 
@@ -61,7 +62,7 @@ eCAL::service::LoggerT critical_logger(const std::string& node_name)
 }
 
 constexpr std::uint8_t min_protocol_version = 0;
-constexpr std::uint8_t max_protocol_version = 1;
+constexpr std::uint8_t max_protocol_version = 2;
 
 
 
@@ -423,6 +424,217 @@ TEST(Communication, SlowCommunication) // NOLINT
 }
 #endif
 
+#if 1
+TEST(Communication, PipelinedCommunication) // NOLINT
+{
+  // Protocol V1 waits for each response before sending the next request.
+  // Protocol V2 sends all requests at once, so the client queue is empty while
+  // the server is still busy with the first request.
+  for (std::uint8_t protocol_version = 1; protocol_version <= max_protocol_version; protocol_version++)
+  {
+    constexpr int num_calls   = 10;
+    constexpr int num_threads = 4;
+
+    const auto io_context = std::make_shared<asio::io_context>();
+    const asio::io_context::work dummy_work(*io_context);
+
+    std::atomic<bool> server_blocked                      (true);
+    std::atomic<int>  num_server_service_callback_called  (0);
+    std::atomic<int>  num_client_response_callback_called (0);
+
+    const eCAL::service::Server::ServiceCallbackT server_service_callback
+            = [&num_server_service_callback_called, &server_blocked]
+              (const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+              {
+                while (server_blocked)
+                  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                num_server_service_callback_called++;
+                *response = "Response on \"" + *request + "\"";
+              };
+
+    const eCAL::service::Server::EventCallbackT server_event_callback
+            = []
+              (eCAL::service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+              {};
+
+    const eCAL::service::ClientSession::EventCallbackT client_event_callback
+            = []
+              (eCAL::service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+              {};
+
+    auto server = eCAL::service::Server::create(io_context, protocol_version, 0, server_service_callback, true, server_event_callback, critical_logger("Server"));
+    auto client = eCAL::service::ClientSession::create(io_context, protocol_version, "127.0.0.1", server->get_port(), client_event_callback, critical_logger("Client"));
+
+    // The blocked service callback occupies one thread
+    std::vector<std::thread> io_threads;
+    for (int i = 0; i < num_threads; i++)
+    {
+      io_threads.emplace_back([&io_context]()
+                              {
+                                io_context->run();
+                              });
+    }
+
+    // Wait a short time for the client to connect
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(client->get_state(), eCAL::service::State::CONNECTED);
+    EXPECT_EQ(client->get_accepted_protocol_version(), protocol_version);
+
+    for (int i = 0; i < num_calls; i++)
+    {
+      const std::string request = "Request " + std::to_string(i);
+      client->async_call_service(std::make_shared<std::string>(request)
+                                , [&num_client_response_callback_called, request]
+                                  (const eCAL::service::Error& error, const std::shared_ptr<std::string>& response) -> void
+                                  {
+                                    EXPECT_FALSE(bool(error));
+                                    if (response)
+                                    {
+                                      EXPECT_EQ(*response, "Response on \"" + request + "\"");
+                                    }
+                                    num_client_response_callback_called++;
+                                  });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    {
+      EXPECT_EQ(num_server_service_callback_called , 0);
+      EXPECT_EQ(num_client_response_callback_called, 0);
+
+      if (protocol_version >= 2)
+        EXPECT_EQ(client->get_queue_size(), 0);
+      else
+        EXPECT_EQ(client->get_queue_size(), num_calls - 1);
+    }
+
+    server_blocked = false;
+
+    for (int i = 0; (i < 100) && (num_client_response_callback_called < num_calls); i++)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    {
+      EXPECT_EQ(num_server_service_callback_called , num_calls);
+      EXPECT_EQ(num_client_response_callback_called, num_calls);
+      EXPECT_EQ(client->get_queue_size(), 0);
+    }
+
+    // delete all objects
+    client = nullptr;
+    server = nullptr;
+
+    // join the io_threads
+    io_context->stop();
+    for (auto& io_thread : io_threads)
+      io_thread.join();
+  }
+}
+#endif
+
+#if 1
+TEST(Communication, PipelinedRequestsRejected) // NOLINT
+{
+  // Protocol V2 servers queue at most 64 requests of a session and reject further ones
+  constexpr std::uint8_t protocol_version  = 2;
+  constexpr int          max_queued_calls  = 64;
+  constexpr int          num_rejected      = 10;
+  constexpr int          num_threads       = 4;
+
+  const auto io_context = std::make_shared<asio::io_context>();
+  const asio::io_context::work dummy_work(*io_context);
+
+  std::atomic<bool> server_blocked                      (true);
+  std::atomic<int>  num_server_service_callback_called  (0);
+  std::atomic<int>  num_client_response_ok              (0);
+  std::atomic<int>  num_client_response_rejected        (0);
+
+  const eCAL::service::Server::ServiceCallbackT server_service_callback
+          = [&num_server_service_callback_called, &server_blocked]
+            (const std::shared_ptr<const std::string>& /*request*/, const std::shared_ptr<std::string>& response) -> void
+            {
+              while (server_blocked)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+              num_server_service_callback_called++;
+              *response = "Response";
+            };
+
+  const eCAL::service::Server::EventCallbackT server_event_callback
+          = []
+            (eCAL::service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+            {};
+
+  const eCAL::service::ClientSession::EventCallbackT client_event_callback
+          = []
+            (eCAL::service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+            {};
+
+  auto server = eCAL::service::Server::create(io_context, protocol_version, 0, server_service_callback, true, server_event_callback, critical_logger("Server"));
+  auto client = eCAL::service::ClientSession::create(io_context, protocol_version, "127.0.0.1", server->get_port(), client_event_callback, critical_logger("Client"));
+
+  std::vector<std::thread> io_threads;
+  for (int i = 0; i < num_threads; i++)
+  {
+    io_threads.emplace_back([&io_context]()
+                            {
+                              io_context->run();
+                            });
+  }
+
+  // Wait a short time for the client to connect
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(client->get_accepted_protocol_version(), protocol_version);
+
+  const eCAL::service::ClientSession::ResponseCallbackT client_response_callback
+          = [&num_client_response_ok, &num_client_response_rejected]
+            (const eCAL::service::Error& error, const std::shared_ptr<std::string>& response) -> void
+            {
+              if (error)
+              {
+                EXPECT_EQ(error, eCAL::service::Error::ErrorCode::REQUEST_REJECTED);
+                EXPECT_EQ(response, nullptr);
+                num_client_response_rejected++;
+              }
+              else
+              {
+                EXPECT_EQ(*response, "Response");
+                num_client_response_ok++;
+              }
+            };
+
+  // The first request blocks the server, it is not queued anymore
+  client->async_call_service(std::make_shared<std::string>("Request"), client_response_callback);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  for (int i = 0; i < max_queued_calls + num_rejected; i++)
+    client->async_call_service(std::make_shared<std::string>("Request"), client_response_callback);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  server_blocked = false;
+
+  for (int i = 0; (i < 100) && (num_client_response_ok + num_client_response_rejected < max_queued_calls + num_rejected + 1); i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  {
+    EXPECT_EQ(num_server_service_callback_called, max_queued_calls + 1);
+    EXPECT_EQ(num_client_response_ok            , max_queued_calls + 1);
+    EXPECT_EQ(num_client_response_rejected      , num_rejected);
+    EXPECT_EQ(client->get_state(), eCAL::service::State::CONNECTED);
+  }
+
+  // delete all objects
+  client = nullptr;
+  server = nullptr;
+
+  // join the io_threads
+  io_context->stop();
+  for (auto& io_thread : io_threads)
+    io_thread.join();
+}
+#endif
+
 #if 1
 TEST(CallbacksConnectDisconnect, ClientDisconnectsFirst) // NOLINT
 {
@@ -1609,6 +1821,110 @@ TEST(Callback, SerializedServiceCallbacks) // NOLINT
 }
 #endif
 
+#if 1
+TEST(Callback, AsyncServiceCallbacks) // NOLINT
+{
+  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= max_protocol_version; protocol_version++)
+  {
+    constexpr std::chrono::milliseconds server_callback_wait_time(50);
+    constexpr int num_clients = 5;
+
+    const auto io_context = std::make_shared<asio::io_context>();
+    auto server_manager = eCAL::service::ServerManager::create(io_context);
+    auto client_manager = eCAL::service::ClientManager::create(io_context);
+
+    // Only one io_context thread, the service calls are executed by their own threads
+    std::thread io_thread([&io_context]()
+                          {
+                            io_context->run();
+                          });
+
+    std::mutex               worker_threads_mutex;
+    std::vector<std::thread> worker_threads;
+
+    atomic_signalable<int> num_server_service_callback_called  (0);
+    atomic_signalable<int> num_client_response_callback_called (0);
+    atomic_signalable<int> num_client_event_callback_called    (0);
+
+    const eCAL::service::Server::AsyncServiceCallbackT server_service_callback
+            = [&num_server_service_callback_called, &worker_threads_mutex, &worker_threads, server_callback_wait_time]
+              (const std::shared_ptr<const std::string>& request, const eCAL::service::ServerResponseCallbackT& response_callback) -> void
+              {
+                const std::lock_guard<std::mutex> lock(worker_threads_mutex);
+                worker_threads.emplace_back([&num_server_service_callback_called, request, response_callback, server_callback_wait_time]()
+                                            {
+                                              std::this_thread::sleep_for(server_callback_wait_time);
+                                              num_server_service_callback_called++;
+                                              response_callback(std::make_shared<std::string>("Response on \"" + *request + "\""));
+                                            });
+              };
+
+    const eCAL::service::Server::EventCallbackT server_event_callback
+            = []
+              (eCAL::service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+              {};
+
+    const eCAL::service::ClientSession::EventCallbackT client_event_callback
+            = [&num_client_event_callback_called]
+              (eCAL::service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+              {
+                num_client_event_callback_called++;
+              };
+
+    // Serialized service callbacks, but the callbacks only hand over the requests
+    auto server = server_manager->create_server(protocol_version, 0, server_service_callback, false, server_event_callback);
+    std::vector<std::shared_ptr<eCAL::service::ClientSession>> clients;
+    clients.reserve(num_clients);
+    for (int i = 0; i < num_clients; i++)
+    {
+      clients.push_back(client_manager->create_client(protocol_version, "127.0.0.1", server->get_port(), client_event_callback));
+    }
+
+    num_client_event_callback_called.wait_for([&num_clients](int value) -> bool { return value >= num_clients; }, std::chrono::milliseconds(500));
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& client : clients)
+    {
+      const auto request = std::make_shared<std::string>("Request");
+
+      auto client_response_callback = [&num_client_response_callback_called]
+                                      (const eCAL::service::Error& error, const std::shared_ptr<std::string>& response) -> void
+                                      {
+                                        EXPECT_FALSE(bool(error));
+                                        EXPECT_EQ(*response, "Response on \"Request\"");
+                                        num_client_response_callback_called++;
+                                      };
+
+      client->async_call_service(request, client_response_callback);
+    }
+
+    num_client_response_callback_called.wait_for([num_clients](int v) {return v >= num_clients;}, num_clients * server_callback_wait_time * 2);
+
+    auto end = std::chrono::steady_clock::now();
+    auto duration = end - start;
+
+    EXPECT_EQ(num_server_service_callback_called, num_clients);
+    EXPECT_EQ(num_client_response_callback_called, num_clients);
+
+    // The service calls were executed in parallel
+    EXPECT_LT(duration, num_clients * server_callback_wait_time);
+
+    {
+      const std::lock_guard<std::mutex> lock(worker_threads_mutex);
+      for (auto& thread : worker_threads)
+      {
+        thread.join();
+      }
+    }
+
+    server_manager->stop();
+    client_manager->stop();
+
+    io_thread.join();
+  }
+}
+#endif
+
 #if 1
 // Call different eCAL Service API functions from within the callbacks
 TEST(ecal_service, Callback_ApiCallsFromCallbacks)
@@ -1981,6 +2297,10 @@ TEST(ErrorCallback, ErrorCallbackClientDisconnects) // NOLINT
     const auto io_context = std::make_shared<asio::io_context>();
     const asio::io_context::work dummy_work(*io_context);
 
+    // The client runs on its own io_context, so it receives the responses while the server executes the next request
+    const auto client_io_context = std::make_shared<asio::io_context>();
+    const asio::io_context::work client_dummy_work(*client_io_context);
+
     std::atomic<int> num_server_service_callback_called           (0);
     std::atomic<int> num_client_response_callback_called          (0);
 
@@ -2005,12 +2325,16 @@ TEST(ErrorCallback, ErrorCallbackClientDisconnects) // NOLINT
               {};
 
     auto server    = eCAL::service::Server::create(io_context, protocol_version, 0, server_service_callback, true, server_event_callback);
-    auto client_v1 = eCAL::service::ClientSession::create(io_context, protocol_version,"127.0.0.1", server->get_port(), client_event_callback);
+    auto client_v1 = eCAL::service::ClientSession::create(client_io_context, protocol_version,"127.0.0.1", server->get_port(), client_event_callback);
 
     std::thread io_thread([&io_context]()
                           {
                             io_context->run();
                           });
+    std::thread client_io_thread([&client_io_context]()
+                          {
+                            client_io_context->run();
+                          });
 
     // Wait a short time for the client to connect
     std::this_thread::sleep_for(std::chrono::milliseconds(50));
@@ -2049,6 +2373,12 @@ TEST(ErrorCallback, ErrorCallbackClientDisconnects) // NOLINT
     // The first service call should be executed by now.
     std::this_thread::sleep_for(std::chrono::milliseconds(150));
 
+    // Wait for the first response (the server is still executing the second request)
+    for (int i = 0; (i < 40) && (num_client_response_callback_called < 1); i++)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
     {
       EXPECT_EQ(num_server_service_callback_called           , 1);
       EXPECT_EQ(num_client_response_callback_called          , 1);
@@ -2060,14 +2390,17 @@ TEST(ErrorCallback, ErrorCallbackClientDisconnects) // NOLINT
     std::this_thread::sleep_for(std::chrono::milliseconds(200));
 
     // Both service calls should have failed by now. The second should have reached the server, but the client is already gone.
+    // With protocol V2 all requests have been sent before the client went away, so the server executes the third one, too.
     {
-      EXPECT_EQ(num_server_service_callback_called           , 2);
+      EXPECT_EQ(num_server_service_callback_called           , (protocol_version < 2 ? 2 : 3));
       EXPECT_EQ(num_client_response_callback_called          , 3);
     }
 
-    // join the io_thread
+    // join the io_threads
     io_context->stop();
+    client_io_context->stop();
     io_thread.join();
+    client_io_thread.join();
   }
 }
 #endif
@@ -0,0 +1,113 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const int thread_num(8);
+  const int log_num(20000);
+
+  struct SLatency
+  {
+    long long avg_time = 0;
+    long long p50_time = 0;
+    long long p99_time = 0;
+    long long max_time = 0;
+  };
+
+  // measure the caller side latency of eCAL::Logging::Log with thread_num concurrently logging threads
+  SLatency MeasureLatency(const std::string& name_, bool async_, bool block_)
+  {
+    // initialize eCAL API (no console output, log to file and udp)
+    const std::vector<std::string> args =
+    {
+      "--ecal-set-config-key", "monitoring/filter_log_con:none",
+      "--ecal-set-config-key", "monitoring/filter_log_file:all",
+      "--ecal-set-config-key", "monitoring/filter_log_udp:all",
+      "--ecal-set-config-key", std::string("monitoring/log_async:")    + (async_ ? "1" : "0"),
+      "--ecal-set-config-key", std::string("monitoring/log_overflow:") + (block_ ? "1" : "0"),
+    };
+    eCAL::Initialize(args, "logging latency", eCAL::Init::Logging);
+
+    // log from all threads
+    std::vector<std::vector<long long>> latency_arrays(thread_num);
+    std::vector<std::thread>            threads;
+    for (int t = 0; t < thread_num; ++t)
+    {
+      threads.emplace_back([t, &latency_arrays]()
+      {
+        std::vector<long long>& latency_array = latency_arrays[t];
+        latency_array.reserve(log_num);
+
+        const std::string msg = "logging latency thread " + std::to_string(t) + " message";
+        for (int i = 0; i < log_num; ++i)
+        {
+          const auto start_time = std::chrono::steady_clock::now();
+          eCAL::Logging::Log(log_level_info, msg);
+          latency_array.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time).count());
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // finalize eCAL API (writes the buffered log messages)
+    eCAL::Finalize();
+
+    // merge and sort the latencies
+    std::vector<long long> latency_array;
+    for (const auto& thread_latency_array : latency_arrays)
+    {
+      latency_array.insert(latency_array.end(), thread_latency_array.begin(), thread_latency_array.end());
+    }
+    std::sort(latency_array.begin(), latency_array.end());
+
+    SLatency latency;
+    latency.avg_time = std::accumulate(latency_array.begin(), latency_array.end(), 0LL) / static_cast<long long>(latency_array.size());
+    latency.p50_time = latency_array[latency_array.size() / 2];
+    latency.p99_time = latency_array[latency_array.size() * 99 / 100];
+    latency.max_time = latency_array.back();
+
+    std::cout << std::left << std::setw(16) << name_ << std::setw(12) << latency.avg_time << std::setw(12) << latency.p50_time << std::setw(12) << latency.p99_time << latency.max_time << std::endl;
+    return latency;
+  }
+}
+
+// main entry
+int main()
+{
+  std::cout << thread_num << " threads, " << log_num << " log messages per thread" << std::endl << std::endl;
+  std::cout << std::left << std::setw(16) << "Logging" << std::setw(12) << "avg [ns]" << std::setw(12) << "p50 [ns]" << std::setw(12) << "p99 [ns]" << "max [ns]" << std::endl;
+
+  // synchronous logging, asynchronous logging with dropping / blocking overflow policy
+  MeasureLatency("sync",        false, false);
+  MeasureLatency("async drop",  true,  false);
+  MeasureLatency("async block", true,  true);
+
+  return(0);
+}
@@ -22,72 +22,110 @@
 #include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <iomanip>
 #include <numeric>
+#include <string>
 #include <thread>
 #include <vector>
 
-// main entry
-int main(int argc, char** argv)
+namespace
 {
-  // initialize eCAL API
-  eCAL::Initialize(argc, argv, "latency client");
-
-  // create latency client
-  eCAL::CServiceClient latency_client("latency");
+  struct SLatency
+  {
+    long long avg_time   = 0;
+    long long min_time   = 0;
+    long long max_time   = 0;
+    int       throughput = 0;
+  };
 
-  // waiting for service
-  while (eCAL::Ok() && !latency_client.IsConnected())
+  // measure the service call latency, the service transport is selected by the shm_transport config key
+  bool MeasureLatency(bool shm_transport_, SLatency& latency_)
   {
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    std::cout << "Waiting for the service .." << std::endl;
-  }
-  std::cout << std::endl << "Start measurement" << std::endl << std::endl;
+    // initialize eCAL API
+    eCAL::Initialize({ "--ecal-set-config-key", std::string("service/shm_transport:") + (shm_transport_ ? "1" : "0") }, "latency client");
 
-  // prepare latency array
-  const int calls(1000);
-  const int subcalls(100);
-  std::vector<long long> latency_array;
-  latency_array.reserve(calls);
+    // create latency client
+    eCAL::CServiceClient latency_client("latency");
 
-  // run it
-  int run(calls);
-  while (eCAL::Ok() && run--)
-  {
-    // take start time
-    long long start_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-    
-    // call service method "hello" subcalls times (for better time accuracy)
-    for (auto i = 0; i < subcalls; ++i)
+    // waiting for service
+    while (eCAL::Ok() && !latency_client.IsConnected())
     {
-      latency_client.Call("hello", "");
+      std::this_thread::sleep_for(std::chrono::milliseconds(500));
+      std::cout << "Waiting for the service .." << std::endl;
+    }
+    std::cout << std::endl << "Start measurement (" << (shm_transport_ ? "shm" : "tcp") << ")" << std::endl << std::endl;
+
+    // prepare latency array
+    const int calls(1000);
+    const int subcalls(100);
+    std::vector<long long> latency_array;
+    latency_array.reserve(calls);
+
+    // run it
+    int run(calls);
+    while (eCAL::Ok() && run--)
+    {
+      // take start time
+      long long start_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+      // call service method "hello" subcalls times (for better time accuracy)
+      for (auto i = 0; i < subcalls; ++i)
+      {
+        latency_client.Call("hello", "");
+      }
+
+      // take return time and store it into the latency array
+      long long return_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+      latency_array.emplace_back((return_time - start_time)/subcalls);
     }
-    
-    // take return time and store it into the latency array
-    long long return_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-    latency_array.emplace_back((return_time - start_time)/subcalls);
+
+    // finalize eCAL API
+    eCAL::Finalize();
+
+    if (latency_array.empty()) return false;
+
+    // calculate sum and average time
+    long long sum_time = std::accumulate(latency_array.begin(), latency_array.end(), 0LL);
+    long long avg_time = sum_time / latency_array.size();
+
+    // calculate min and max time
+    auto      min_it = std::min_element(latency_array.begin(), latency_array.end());
+    auto      max_it = std::max_element(latency_array.begin(), latency_array.end());
+    size_t    min_pos = min_it - latency_array.begin();
+    size_t    max_pos = max_it - latency_array.begin();
+    long long min_time = *min_it;
+    long long max_time = *max_it;
+
+    latency_.avg_time   = avg_time;
+    latency_.min_time   = min_time;
+    latency_.max_time   = max_time;
+    latency_.throughput = (sum_time > 0) ? static_cast<int>((latency_array.size() * subcalls) / (sum_time / 1000.0 / 1000.0)) : 0;
+
+    // log result
+    std::cout << "Service calls                : " << latency_array.size()*subcalls   << std::endl;
+    std::cout << "Service call average latency : " << avg_time << " us"               << std::endl;
+    std::cout << "Service call min latency     : " << min_time << " us @ " << min_pos << std::endl;
+    std::cout << "Service call max latency     : " << max_time << " us @ " << max_pos << std::endl;
+    std::cout << "Service throughput           : " << latency_.throughput << " calls/s" << std::endl;
+
+    return true;
   }
+}
+
+// main entry
+int main()
+{
+  // measure with shared memory transport (latency server on the same host) and tcp transport
+  SLatency shm_latency;
+  SLatency tcp_latency;
+  if (!MeasureLatency(true,  shm_latency)) return(1);
+  if (!MeasureLatency(false, tcp_latency)) return(1);
 
-  // calculate sum and average time
-  long long sum_time = std::accumulate(latency_array.begin(), latency_array.end(), 0LL);
-  long long avg_time = sum_time / latency_array.size();
-
-  // calculate min and max time
-  auto      min_it = std::min_element(latency_array.begin(), latency_array.end());
-  auto      max_it = std::max_element(latency_array.begin(), latency_array.end());
-  size_t    min_pos = min_it - latency_array.begin();
-  size_t    max_pos = max_it - latency_array.begin();
-  long long min_time = *min_it;
-  long long max_time = *max_it;
-
-  // log result
-  std::cout << "Service calls                : " << calls*subcalls                  << std::endl;
-  std::cout << "Service call average latency : " << avg_time << " us"               << std::endl;
-  std::cout << "Service call min latency     : " << min_time << " us @ " << min_pos << std::endl;
-  std::cout << "Service call max latency     : " << max_time << " us @ " << max_pos << std::endl;
-  std::cout << "Service throughput           : " << static_cast<int>((calls * subcalls) / (sum_time / 1000.0 / 1000.0)) << " calls/s" << std::endl;
-
-  // finalize eCAL API
-  eCAL::Finalize();
+  // compare
+  std::cout << std::endl;
+  std::cout << std::left << std::setw(12) << "Transport" << std::setw(12) << "avg [us]" << std::setw(12) << "min [us]" << std::setw(12) << "max [us]" << "throughput [calls/s]" << std::endl;
+  std::cout << std::left << std::setw(12) << "shm" << std::setw(12) << shm_latency.avg_time << std::setw(12) << shm_latency.min_time << std::setw(12) << shm_latency.max_time << shm_latency.throughput << std::endl;
+  std::cout << std::left << std::setw(12) << "tcp" << std::setw(12) << tcp_latency.avg_time << std::setw(12) << tcp_latency.min_time << std::setw(12) << tcp_latency.max_time << tcp_latency.throughput << std::endl;
 
   return(0);
 }
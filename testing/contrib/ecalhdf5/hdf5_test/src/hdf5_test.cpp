@@ -20,6 +20,8 @@
 #include <ecalhdf5/eh5_meas.h>
 
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <thread>
 #include <set>
 #include <algorithm>
@@ -27,6 +29,7 @@
 #include <gtest/gtest.h>
 
 #include <ecalhdf5/../../src/escape.h> // This header file is usually not available as public include!
+#include <ecalhdf5/../../src/eh5_meas_file_writer_v5.h> // This header file is usually not available as public include!
 
 using namespace eCAL::experimental::measurement::base;
 
@@ -241,6 +244,65 @@ TEST(HDF5, WriteReadIntegrity)
   }
 }
 
+TEST(HDF5, WriteReadBatch)
+{
+  std::string base_name = "batch_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // consecutive entries of the same channel and channel changes within one batch
+  std::vector<TestingMeasEntry> meas_entries{ m1, topic_1, topic_2, m1, m2, m3 };
+  meas_entries[3].snd_timestamp = 1004LL;
+  meas_entries[3].rcv_timestamp = 2004LL;
+  meas_entries[3].id            = 4LL;
+  meas_entries[3].clock         = 14LL;
+
+  // Write HDF5 file
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+
+    if (hdf5_writer.Open(meas_root_dir, eCAL::eh5::eAccessType::CREATE))
+    {
+      hdf5_writer.SetFileBaseName(base_name);
+      hdf5_writer.SetMaxSizePerFile(max_size_per_file);
+    }
+    else
+    {
+      FAIL() << "Failed to open HDF5 Writer";
+    }
+
+    std::vector<eCAL::eh5::WriterEntry> batch;
+    for (const auto& entry : meas_entries)
+    {
+      eCAL::eh5::WriterEntry writer_entry;
+      writer_entry.Data         = entry.data.data();
+      writer_entry.Size         = entry.data.size();
+      writer_entry.SndTimestamp = entry.snd_timestamp;
+      writer_entry.RcvTimestamp = entry.rcv_timestamp;
+      writer_entry.ChannelName  = entry.channel_name;
+      writer_entry.ID           = entry.id;
+      writer_entry.Clock        = entry.clock;
+      batch.push_back(writer_entry);
+    }
+
+    EXPECT_TRUE(hdf5_writer.AddEntriesToFile(batch));
+    EXPECT_TRUE(hdf5_writer.AddEntriesToFile({}));
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // Read HDF5 file
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, meas_entries);
+    for (const auto& entry : meas_entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
+
 TEST(HDF5, ReadWrite)
 {
   std::string file_name = "meas_readwrite";
@@ -401,4 +463,349 @@ TEST(HDF5, EscapeFilenamesForOneFilePerChannel)
     ValidateDataInMeasurement(hdf5_reader, escape_ascii);
     ValidateDataInMeasurement(hdf5_reader, escape_ascii_2);
   }
-}
\ No newline at end of file
+}
+
+namespace
+{
+  // entries of different sizes on several channels (empty, small and every large_interval entry larger than the write batch)
+  std::vector<TestingMeasEntry> CreateChunkedEntries(size_t entries_per_channel, long long large_interval)
+  {
+    const std::vector<std::string> channel_names{ "chunked_a", "chunked_b", "chunked / c" };
+    const std::vector<size_t>      data_sizes{ 0, 1, 100, 4000 };
+
+    std::vector<TestingMeasEntry> entries;
+    long long counter = 0;
+    for (size_t i = 0; i < entries_per_channel; ++i)
+    {
+      for (const auto& channel_name : channel_names)
+      {
+        TestingMeasEntry entry;
+        entry.channel_name  = channel_name;
+        const size_t data_size = (counter % large_interval == large_interval - 1) ? 300 * 1024 : data_sizes[counter % data_sizes.size()];
+        entry.data          = std::string(data_size, static_cast<char>('a' + counter % 26));
+        if (!entry.data.empty()) entry.data.front() = static_cast<char>(counter % 128);
+        entry.snd_timestamp = 1000 + counter;
+        entry.rcv_timestamp = 2000 + counter;
+        entry.id            = counter;
+        entry.clock         = counter;
+        entries.push_back(entry);
+        counter++;
+      }
+    }
+    return entries;
+  }
+
+  void WriteChunkedMeasurement(const std::string& meas_dir, const std::string& base_name, size_t max_file_size, const std::vector<TestingMeasEntry>& entries, const std::set<std::string>& compressed_channels = {})
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+    ASSERT_TRUE(hdf5_writer.Open(meas_dir, eCAL::eh5::eAccessType::CREATE));
+    hdf5_writer.SetFileBaseName(base_name);
+    hdf5_writer.SetMaxSizePerFile(max_file_size);
+
+    for (const auto& channel_name : compressed_channels)
+    {
+      EXPECT_TRUE(hdf5_writer.SetChannelCompression(channel_name, eCAL::eh5::eCompression::DEFLATE));
+    }
+
+    for (const auto& entry : entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+}
+
+TEST(HDF5, ChunkedChannelLayout)
+{
+  std::string base_name     = "chunked_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  auto entries = CreateChunkedEntries(1200, 100);
+  WriteChunkedMeasurement(meas_root_dir, base_name, max_size_per_file, entries);
+
+  // Read HDF5 file
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir + "/" + base_name + ".hdf5"));
+    EXPECT_EQ(hdf5_reader.GetFileVersion(), "6.0");
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+
+  // Read entries with HDF5 dir API
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
+
+TEST(HDF5, ReadFileVersion5)
+{
+  std::string base_name     = "v5_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // measurements are written as file version 6.0, files of eCAL versions before still have to be readable
+  auto entries = CreateChunkedEntries(100, 50);
+
+  // file version 5.0 does not escape channel names, so they must not contain a '/'
+  entries.erase(std::remove_if(entries.begin(), entries.end(), [](const TestingMeasEntry& entry) { return entry.channel_name.find('/') != std::string::npos; }), entries.end());
+  {
+    // the v5 writer expects an existing directory
+    eCAL::eh5::HDF5Meas hdf5_dir(meas_root_dir, eCAL::eh5::eAccessType::CREATE);
+  }
+  {
+    eCAL::eh5::HDF5MeasFileWriterV5 hdf5_writer;
+    hdf5_writer.SetMaxSizePerFile(max_size_per_file);
+    hdf5_writer.SetOneFilePerChannelEnabled(false);
+    hdf5_writer.SetFileBaseName(base_name);
+    ASSERT_TRUE(hdf5_writer.Open(meas_root_dir, eCAL::eh5::eAccessType::CREATE));
+
+    for (const auto& entry : entries)
+    {
+      hdf5_writer.SetChannelType(entry.channel_name, "type");
+      EXPECT_TRUE(hdf5_writer.AddEntryToFile(entry.data.data(), entry.data.size(), entry.snd_timestamp, entry.rcv_timestamp, entry.channel_name, entry.id, entry.clock));
+    }
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  eCAL::eh5::HDF5Meas hdf5_reader;
+  EXPECT_TRUE(hdf5_reader.Open(meas_root_dir + "/" + base_name + ".hdf5"));
+  EXPECT_EQ(hdf5_reader.GetFileVersion(), "5.0");
+
+  ValidateChannelsInMeasurement(hdf5_reader, entries);
+  for (const auto& entry : entries)
+  {
+    EXPECT_EQ(hdf5_reader.GetChannelType(entry.channel_name), "type");
+    ValidateDataInMeasurement(hdf5_reader, entry);
+  }
+}
+
+TEST(HDF5, ChunkedChannelLayoutFileSplit)
+{
+  std::string base_name     = "chunked_split_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // ~18 MB of entries, split into files of 4 MB
+  auto entries = CreateChunkedEntries(100, 5);
+  WriteChunkedMeasurement(meas_root_dir, base_name, 4, entries);
+
+  // the second file exists
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir + "/" + base_name + "_1.hdf5"));
+  }
+
+  // all entries are found with the HDF5 dir API
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
+
+namespace
+{
+  // entries that do not compress
+  std::vector<TestingMeasEntry> CreateRandomEntries(const std::string& channel_name, size_t count, size_t data_size)
+  {
+    std::vector<TestingMeasEntry> entries;
+    unsigned int random = 1;
+    for (size_t i = 0; i < count; ++i)
+    {
+      TestingMeasEntry entry;
+      entry.channel_name = channel_name;
+      entry.data.resize(data_size + i % 100);
+      for (auto& c : entry.data)
+      {
+        random = random * 1103515245u + 12345u;
+        c = static_cast<char>(random >> 24);
+      }
+      entry.snd_timestamp = 100000 + static_cast<long long>(i);
+      entry.rcv_timestamp = 200000 + static_cast<long long>(i);
+      entry.id            = 100000 + static_cast<long long>(i);
+      entry.clock         = 100000 + static_cast<long long>(i);
+      entries.push_back(entry);
+    }
+    return entries;
+  }
+
+  // compression is not available if eCALHDF5 is built without zlib
+  bool IsCompressionAvailable()
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+    return hdf5_writer.Open(output_dir, eCAL::eh5::eAccessType::CREATE)
+      && hdf5_writer.SetChannelCompression("topic", eCAL::eh5::eCompression::DEFLATE);
+  }
+}
+
+TEST(HDF5, ChunkedChannelCompression)
+{
+  if (!IsCompressionAvailable()) GTEST_SKIP() << "HDF5 has been built without deflate (zlib) filter";
+
+  std::string base_name             = "compressed_meas";
+  std::string uncompressed_root_dir = output_dir + "/" + base_name + "_uncompressed";
+  std::string compressed_root_dir   = output_dir + "/" + base_name;
+
+  auto entries        = CreateChunkedEntries(1200, 100);
+  auto random_entries = CreateRandomEntries("random", 200, 2000);
+  entries.insert(entries.end(), random_entries.begin(), random_entries.end());
+
+  WriteChunkedMeasurement(uncompressed_root_dir, base_name, max_size_per_file, entries);
+  WriteChunkedMeasurement(compressed_root_dir, base_name, max_size_per_file, entries, { "chunked_a", "chunked / c", "random" });
+
+  // the compressed file is smaller
+  {
+    std::ifstream uncompressed_file(uncompressed_root_dir + "/" + base_name + ".hdf5", std::ios::binary | std::ios::ate);
+    std::ifstream compressed_file(compressed_root_dir + "/" + base_name + ".hdf5", std::ios::binary | std::ios::ate);
+    EXPECT_LT(static_cast<long long>(compressed_file.tellg()) * 2, static_cast<long long>(uncompressed_file.tellg()));
+  }
+
+  // the entries are decompressed transparently
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(compressed_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
+
+TEST(HDF5, ChunkedChannelCompressionFileSplit)
+{
+  if (!IsCompressionAvailable()) GTEST_SKIP() << "HDF5 has been built without deflate (zlib) filter";
+
+  std::string base_name     = "compressed_split_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // ~10 MB of entries that do not compress, split into files of 4 MB
+  auto entries        = CreateChunkedEntries(100, 1000);
+  auto random_entries = CreateRandomEntries("random", 2000, 5000);
+  entries.insert(entries.end(), random_entries.begin(), random_entries.end());
+  WriteChunkedMeasurement(meas_root_dir, base_name, 4, entries, { "chunked_a", "chunked_b", "random" });
+
+  // the second file exists
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir + "/" + base_name + "_1.hdf5"));
+  }
+
+  // all entries are found with the HDF5 dir API
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
+
+TEST(HDF5, MeasDirIndex)
+{
+  std::string base_name     = "dir_index_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+  std::string index_path    = meas_root_dir + "/.ecalhdf5_index";
+  std::string added_path    = meas_root_dir + "/" + base_name + "_added.hdf5";
+
+  // ~18 MB of entries, split into files of 4 MB
+  auto entries = CreateChunkedEntries(100, 5);
+  std::remove(added_path.c_str());
+  WriteChunkedMeasurement(meas_root_dir, base_name, 4, entries);
+  std::remove(index_path.c_str());
+
+  // the index file is written when opening the directory
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+    EXPECT_TRUE(std::ifstream(index_path).good());
+  }
+
+  // the index file is used when opening the directory again
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+    EXPECT_EQ(hdf5_reader.GetFileVersion(), "6.0");
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+
+    // "chunked_a" has every third entry, starting at rcv timestamp 2000
+    EXPECT_EQ(hdf5_reader.GetMinTimestamp("chunked_a"), 2000LL);
+    EXPECT_EQ(hdf5_reader.GetMaxTimestamp("chunked_a"), 2297LL);
+
+    eCAL::eh5::EntryInfoSet range;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange("chunked_a", 2030LL, 2060LL, range));
+    ASSERT_EQ(range.size(), 11u);
+    EXPECT_EQ(range.begin()->RcvTimestamp, 2030LL);
+    EXPECT_EQ(range.rbegin()->RcvTimestamp, 2060LL);
+
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange("chunked_a", 0LL, 2010LL, range));
+    EXPECT_EQ(range.size(), 4u);
+
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange("chunked_a", 1000LL, 3000LL, range));
+    EXPECT_EQ(range.size(), 100u);
+
+    EXPECT_FALSE(hdf5_reader.GetEntriesInfoRange("unknown", 1000LL, 3000LL, range));
+    EXPECT_TRUE(range.empty());
+  }
+
+  // the index file is rebuilt, if the files have changed
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+    ASSERT_TRUE(hdf5_writer.Open(meas_root_dir, eCAL::eh5::eAccessType::CREATE));
+    hdf5_writer.SetFileBaseName(base_name + "_added");
+    EXPECT_TRUE(WriteToHDF(hdf5_writer, topic_1));
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+  entries.push_back(topic_1);
+
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    ValidateDataInMeasurement(hdf5_reader, topic_1);
+    ValidateDataInMeasurement(hdf5_reader, entries.front());
+  }
+
+  // a corrupt index file is rebuilt
+  {
+    std::ofstream index_file(index_path, std::ios::binary | std::ios::trunc);
+    index_file << "corrupt";
+  }
+
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    ValidateChannelsInMeasurement(hdf5_reader, entries);
+    for (const auto& entry : entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
@@ -0,0 +1,185 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "readwrite/ecal_callback_executor.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(CallbackExecutor, SerialPerStrand)
+{
+  const int strand_num = 8;
+  const int task_num   = 2000;
+
+  auto executor = std::make_shared<eCAL::CCallbackExecutor>(4);
+
+  std::vector<std::shared_ptr<eCAL::CCallbackStrand>> strands;
+  std::vector<long long>                              last_id(strand_num, -1);
+  std::vector<std::atomic<int>>                       running(strand_num);
+  std::atomic<int>                                    overlaps(0);
+  std::atomic<int>                                    wrong_order(0);
+  std::atomic<int>                                    executed(0);
+
+  for (int s = 0; s < strand_num; ++s)
+  {
+    auto handler = [&, s](const char* buf_, size_t len_, long long id_, long long /*clock_*/, long long /*time_*/)
+    {
+      if (running[s]++ != 0)                              overlaps++;
+      if (id_ != last_id[s] + 1)                          wrong_order++;
+      if (std::string(buf_, len_) != std::to_string(id_)) wrong_order++;
+      last_id[s] = id_;
+      executed++;
+      running[s]--;
+    };
+    strands.push_back(executor->CreateStrand(16, eCAL::QOS::block_overflow_qos, handler));
+  }
+
+  // one producer per strand, every second payload is handed over instead of copied
+  std::vector<std::thread> producers;
+  for (int s = 0; s < strand_num; ++s)
+  {
+    producers.emplace_back([&, s]()
+      {
+        for (int i = 0; i < task_num; ++i)
+        {
+          const std::string payload = std::to_string(i);
+          if (i % 2 == 0)
+          {
+            strands[s]->Post(payload.data(), payload.size(), i, 0, 0, nullptr);
+          }
+          else
+          {
+            auto buffer = std::make_shared<const std::vector<char>>(payload.begin(), payload.end());
+            strands[s]->Post(buffer->data(), buffer->size(), i, 0, 0, buffer);
+          }
+        }
+      });
+  }
+  for (auto& producer : producers) producer.join();
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while ((executed < strand_num * task_num) && (std::chrono::steady_clock::now() < timeout))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  EXPECT_EQ(strand_num * task_num, executed);
+  EXPECT_EQ(0, overlaps);
+  EXPECT_EQ(0, wrong_order);
+
+  for (auto& strand : strands)
+  {
+    const auto statistics = strand->GetStatistics();
+    EXPECT_EQ(0, statistics.drops);
+    EXPECT_GE(16u, statistics.queue_depth_max);
+    strand->Stop();
+  }
+}
+
+TEST(CallbackExecutor, DropOldest)
+{
+  auto executor = std::make_shared<eCAL::CCallbackExecutor>(1);
+
+  // a slow callback, the queue runs full
+  std::vector<long long> ids;
+  auto handler = [&ids](const char* /*buf_*/, size_t /*len_*/, long long id_, long long /*clock_*/, long long /*time_*/)
+  {
+    ids.push_back(id_);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  };
+  auto strand = executor->CreateStrand(4, eCAL::QOS::drop_oldest_overflow_qos, handler);
+
+  for (int i = 0; i < 20; ++i) strand->Post("x", 1, i, 0, 0, nullptr);
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  strand->Stop();
+
+  // the first sample may be executed before the queue overflows, the newest four survive
+  ASSERT_LE(4u, ids.size());
+  EXPECT_EQ(std::vector<long long>({ 16, 17, 18, 19 }), std::vector<long long>(ids.end() - 4, ids.end()));
+  EXPECT_EQ(static_cast<long long>(20 - ids.size()), strand->GetStatistics().drops);
+}
+
+TEST(CallbackExecutor, BufferHandoff)
+{
+  auto executor = std::make_shared<eCAL::CCallbackExecutor>(1);
+
+  std::atomic<bool> release(false);
+  std::atomic<int>  executed(0);
+  auto handler = [&](const char* /*buf_*/, size_t /*len_*/, long long /*id_*/, long long /*clock_*/, long long /*time_*/)
+  {
+    while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    executed++;
+  };
+  auto strand = executor->CreateStrand(4, eCAL::QOS::drop_oldest_overflow_qos, handler);
+
+  // the strand keeps the buffer until the callback was executed
+  auto buffer = std::make_shared<const std::vector<char>>(100, 'x');
+  strand->Post(buffer->data(), buffer->size(), 0, 0, 0, buffer);
+  EXPECT_LT(1, buffer.use_count());
+
+  release = true;
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (((executed == 0) || (buffer.use_count() > 1)) && (std::chrono::steady_clock::now() < timeout))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(1, executed);
+  EXPECT_EQ(1, buffer.use_count());
+
+  strand->Stop();
+}
+
+TEST(CallbackExecutor, DestroyedInCallback)
+{
+  // a subscriber owning its executor (thread per subscriber) is destroyed in its own callback
+  struct SSubscriber
+  {
+    std::shared_ptr<eCAL::CCallbackExecutor> executor;
+    std::shared_ptr<eCAL::CCallbackStrand>   strand;
+    ~SSubscriber() { strand->Stop(); }
+  };
+
+  // not created with std::make_shared, so the memory is released with the executor (and not with the last weak reference)
+  auto subscriber = std::make_shared<SSubscriber>();
+  subscriber->executor = std::shared_ptr<eCAL::CCallbackExecutor>(new eCAL::CCallbackExecutor(1));
+  const std::weak_ptr<eCAL::CCallbackExecutor> executor_alive(subscriber->executor);
+
+  auto handler = [&subscriber](const char* /*buf_*/, size_t /*len_*/, long long /*id_*/, long long /*clock_*/, long long /*time_*/)
+  {
+    subscriber.reset();
+  };
+  subscriber->strand = subscriber->executor->CreateStrand(4, eCAL::QOS::drop_oldest_overflow_qos, handler);
+  subscriber->strand->Post("x", 1, 0, 0, 0, nullptr);
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!executor_alive.expired() && (std::chrono::steady_clock::now() < timeout))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_TRUE(executor_alive.expired());
+
+  // give the detached worker time to finish, it must not touch the executor anymore
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+}
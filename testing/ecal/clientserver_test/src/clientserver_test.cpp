@@ -21,8 +21,12 @@
 #include <ecal/msg/protobuf/client.h>
 #include <ecal/msg/protobuf/server.h>
 
+#include <chrono>
 #include <cmath>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -47,6 +51,9 @@
 
 #define NestedRPCCallTest                         1
 
+#define ClientServerTransportTest                 1
+#define ClientServerExecutionPolicyTest           1
+
 namespace
 {
   typedef std::vector<std::shared_ptr<eCAL::CServiceServer>> ServiceVecT;
@@ -1045,3 +1052,140 @@ TEST(ClientServer, NestedRPCCall)
 }
 
 #endif /* NestedRPCCallTest */
+
+#if ClientServerTransportTest
+
+TEST(ClientServer, ClientServerTransport)
+{
+  // shared memory transport (default for services on the same host) and tcp transport,
+  // the payload exceeds the shared memory buffer and is transferred in chunks
+  for (const bool shm_transport : { true, false })
+  {
+    // initialize eCAL API (the server offers no tcp protocol with shared memory transport, the calls succeed via shared memory only)
+    if (shm_transport)
+    {
+      eCAL::Initialize({ "--ecal-set-config-key", "service/shm_transport:1"
+                       , "--ecal-set-config-key", "service/protocol_v0:0"
+                       , "--ecal-set-config-key", "service/protocol_v1:0" }, "clientserver transport test");
+    }
+    else
+    {
+      eCAL::Initialize({ "--ecal-set-config-key", "service/shm_transport:0" }, "clientserver transport test");
+    }
+
+    // create service server
+    eCAL::CServiceServer server("service");
+
+    // method callback function
+    std::atomic<int> methods_executed(0);
+    auto method_callback = [&](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+    {
+      response_ = request_ + request_;
+      methods_executed++;
+      return 42;
+    };
+    server.AddMethodCallback("foo::method", "foo::req_type", "foo::resp_type", method_callback);
+
+    // create service client
+    eCAL::CServiceClient client("service");
+
+    // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+    eCAL::Process::SleepMS(2000);
+    EXPECT_TRUE(client.IsConnected());
+
+    // small and large requests
+    const std::vector<size_t> request_sizes = { 0, 1, 1024, 1024 * 1024 };
+    int methods_called(0);
+    for (const auto request_size : request_sizes)
+    {
+      std::string request(request_size, ' ');
+      for (size_t i = 0; i < request.size(); ++i) request[i] = static_cast<char>('a' + i % 26);
+
+      eCAL::ServiceResponseVecT service_response_vec;
+      EXPECT_TRUE(client.Call("foo::method", request, -1, &service_response_vec));
+      methods_called++;
+
+      ASSERT_EQ(1, service_response_vec.size());
+      EXPECT_EQ(call_state_executed, service_response_vec[0].call_state);
+      EXPECT_EQ(42, service_response_vec[0].ret_state);
+      EXPECT_EQ(request + request, service_response_vec[0].response);
+    }
+
+    EXPECT_EQ(methods_called, methods_executed);
+
+    // finalize eCAL API
+    eCAL::Finalize();
+  }
+}
+
+#endif /* ClientServerTransportTest */
+
+#if ClientServerExecutionPolicyTest
+
+TEST(ClientServer, ClientServerExecutionPolicy)
+{
+  // initialize eCAL API (tcp transport, the io context threads must not be blocked by slow methods)
+  eCAL::Initialize({ "--ecal-set-config-key", "service/shm_transport:0" }, "clientserver execution policy test");
+
+  for (const auto mode : { eCAL::server_execution_method_thread, eCAL::server_execution_worker_pool })
+  {
+    // create service server
+    eCAL::CServiceServer server("service");
+
+    eCAL::SServerExecutionPolicy policy;
+    policy.mode           = mode;
+    policy.worker_threads = 2;
+    policy.queue_size     = 8;
+    EXPECT_TRUE(server.SetExecutionPolicy(policy));
+    EXPECT_EQ(mode, server.GetExecutionPolicy().mode);
+
+    // a slow and a fast method
+    auto slow_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+    {
+      eCAL::Process::SleepMS(500);
+      response_ = request_;
+      return 0;
+    };
+    auto fast_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+    {
+      response_ = request_;
+      return 0;
+    };
+    server.AddMethodCallback("slow", "", "", slow_callback);
+    server.AddMethodCallback("fast", "", "", fast_callback);
+
+    // create service clients (one session each)
+    eCAL::CServiceClient slow_client("service");
+    eCAL::CServiceClient fast_client("service");
+
+    // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+    eCAL::Process::SleepMS(2000);
+    EXPECT_TRUE(slow_client.IsConnected());
+    EXPECT_TRUE(fast_client.IsConnected());
+
+    // the slow call must not delay the fast call of the other client
+    std::thread slow_thread([&slow_client]()
+                            {
+                              eCAL::ServiceResponseVecT service_response_vec;
+                              EXPECT_TRUE(slow_client.Call("slow", "slow request", -1, &service_response_vec));
+                            });
+    eCAL::Process::SleepMS(100);
+
+    const auto start = std::chrono::steady_clock::now();
+    eCAL::ServiceResponseVecT service_response_vec;
+    EXPECT_TRUE(fast_client.Call("fast", "fast request", -1, &service_response_vec));
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(1, service_response_vec.size());
+    EXPECT_EQ(call_state_executed, service_response_vec[0].call_state);
+    EXPECT_EQ("fast request", service_response_vec[0].response);
+    EXPECT_LT(duration, std::chrono::milliseconds(300));
+
+    slow_thread.join();
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+#endif /* ClientServerExecutionPolicyTest */
@@ -19,11 +19,18 @@
 
 #include <ecal/ecal.h>
 #include "util/ecal_expmap.h"
+#include "util/ecal_hash_expmap.h"
 
 #include <string>
 #include <chrono>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <random>
+#include <stdexcept>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -215,4 +222,167 @@ TEST(ExpMap, ExpMapRemove)
   EXPECT_TRUE(expmap.erase("A"));
   EXPECT_EQ(0, expmap.size());
   EXPECT_FALSE(expmap.erase("B"));
-}
\ No newline at end of file
+}
+
+TEST(HashExpMap, HashExpMapSetGet)
+{
+  eCAL::Util::CHashExpMap<std::string, int> expmap(std::chrono::milliseconds(200));
+
+  expmap["A"] = 1;
+  EXPECT_EQ(1, expmap["A"]);
+  EXPECT_EQ(1, expmap.size());
+
+  // access and reset timer
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  EXPECT_EQ(1, expmap["A"]);
+  expmap.remove_deprecated();
+  EXPECT_EQ(1, expmap.size());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap.remove_deprecated();
+  EXPECT_EQ(1, expmap.size());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  std::list<std::string> erased;
+  expmap.remove_deprecated(&erased);
+  EXPECT_EQ(0, expmap.size());
+  ASSERT_EQ(1, erased.size());
+  EXPECT_EQ(std::string("A"), erased.front());
+
+  expmap["A"] = 1;
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap["B"] = 2;
+  expmap["C"] = 3;
+  expmap.remove_deprecated();
+  EXPECT_EQ(3, expmap.size());
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap["B"] = 4;
+  expmap.remove_deprecated();
+  EXPECT_EQ(2, expmap.size());
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap.remove_deprecated();
+  EXPECT_EQ(1, expmap.size());
+  EXPECT_EQ(4, expmap.at("B"));
+}
+
+TEST(HashExpMap, HashExpMapInsertFindErase)
+{
+  eCAL::Util::CHashExpMap<std::string, int> expmap(std::chrono::milliseconds(200));
+  EXPECT_TRUE(expmap.empty());
+  EXPECT_EQ(expmap.end(), expmap.find("A"));
+
+  auto ret = expmap.insert(std::make_pair("A", 1));
+  EXPECT_TRUE(ret.second);
+  EXPECT_EQ(std::string("A"), (*ret.first).first);
+  EXPECT_EQ(1, (*ret.first).second);
+
+  // no overwrite
+  ret = expmap.insert(std::make_pair("A", 2));
+  EXPECT_FALSE(ret.second);
+  EXPECT_EQ(1, (*ret.first).second);
+
+  const auto& const_ref_expmap = expmap;
+  auto const_it = const_ref_expmap.find("A");
+  static_assert(std::is_same<decltype(const_it), eCAL::Util::CHashExpMap<std::string, int>::const_iterator>::value, "We're not being returned a const_iterator from find.");
+  EXPECT_EQ(1, (*const_it).second);
+  EXPECT_THROW(const_ref_expmap.at("B"), std::out_of_range);
+
+  EXPECT_TRUE(expmap.erase("A"));
+  EXPECT_FALSE(expmap.erase("A"));
+  EXPECT_TRUE(expmap.empty());
+}
+
+TEST(HashExpMap, CompareWithExpMap)
+{
+  // random operations on many keys (table growth, erasure with backward shift, elements moved on erase)
+  eCAL::Util::CExpMap<int, int>     expmap(std::chrono::hours(1));
+  eCAL::Util::CHashExpMap<int, int> hash_expmap(std::chrono::hours(1));
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> key_dist(0, 2000);
+  std::uniform_int_distribution<int> op_dist(0, 2);
+  for (int i = 0; i < 100000; ++i)
+  {
+    const int key = key_dist(gen);
+    switch (op_dist(gen))
+    {
+    case 0:
+      expmap[key] = i;
+      hash_expmap[key] = i;
+      break;
+    case 1:
+      ASSERT_EQ(expmap.erase(key), hash_expmap.erase(key));
+      break;
+    default:
+      ASSERT_EQ(expmap.find(key) == expmap.end(), hash_expmap.find(key) == hash_expmap.end());
+      break;
+    }
+  }
+
+  ASSERT_EQ(expmap.size(), hash_expmap.size());
+  for (const auto& entry : hash_expmap)
+  {
+    EXPECT_EQ(expmap.at(entry.first), entry.second);
+  }
+}
+
+TEST(HashExpMap, ExpireMany)
+{
+  // expire a part of many entries, keep the refreshed ones
+  eCAL::Util::CHashExpMap<std::string, int> expmap(std::chrono::milliseconds(100));
+  for (int i = 0; i < 10000; ++i) expmap[std::to_string(i)] = i;
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  for (int i = 0; i < 10000; i += 2) expmap[std::to_string(i)] = i;
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+  std::list<std::string> erased;
+  expmap.remove_deprecated(&erased);
+  EXPECT_EQ(5000, erased.size());
+  ASSERT_EQ(5000, expmap.size());
+  for (const auto& entry : expmap)
+  {
+    EXPECT_EQ(0, entry.second % 2);
+    EXPECT_EQ(std::to_string(entry.second), entry.first);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  expmap.remove_deprecated();
+  EXPECT_EQ(0, expmap.size());
+}
+
+namespace
+{
+  // insert, refresh and expire throughput of a map with the given number of entries
+  template<class Map>
+  void Benchmark(const std::string& name_, size_t entries_)
+  {
+    std::vector<std::string> keys(entries_);
+    for (size_t i = 0; i < entries_; ++i) keys[i] = "topic_" + std::to_string(i) + "_1234567890";
+
+    Map map(std::chrono::milliseconds(50));
+    auto measure = [&](const std::function<void()>& operation_)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      operation_();
+      return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / entries_;
+    };
+
+    const double insert_ns  = measure([&]() { for (const auto& key : keys) map[key] = true; });
+    const double refresh_ns = measure([&]() { for (const auto& key : keys) map[key] = false; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    const double expire_ns  = measure([&]() { map.remove_deprecated(); });
+    EXPECT_EQ(0, map.size());
+
+    std::cout << "[ BENCHMARK] " << name_ << " " << entries_ << " entries : insert " << insert_ns << " ns, refresh " << refresh_ns << " ns, expire " << expire_ns << " ns (per entry)" << std::endl;
+  }
+}
+
+TEST(HashExpMap, Benchmark)
+{
+  for (const size_t entries : { 10000, 100000 })
+  {
+    Benchmark<eCAL::Util::CExpMap<std::string, bool>>    ("expmap     ", entries);
+    Benchmark<eCAL::Util::CHashExpMap<std::string, bool>>("hash expmap", entries);
+  }
+}
@@ -0,0 +1,146 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_hash_window.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+TEST(HashWindow, InsertDuplicate)
+{
+  eCAL::Util::CHashWindow window(4);
+
+  // new hashes are inserted
+  EXPECT_TRUE(window.Insert(1));
+  EXPECT_TRUE(window.Insert(2));
+  EXPECT_EQ(2, window.size());
+
+  // a known hash is a duplicate
+  EXPECT_FALSE(window.Insert(1));
+  EXPECT_FALSE(window.Insert(2));
+  EXPECT_EQ(2, window.size());
+
+  // the table marker value is a valid hash too
+  EXPECT_FALSE(window.Contains(0));
+  EXPECT_TRUE(window.Insert(0));
+  EXPECT_FALSE(window.Insert(0));
+  EXPECT_EQ(3, window.size());
+}
+
+TEST(HashWindow, EvictOldest)
+{
+  eCAL::Util::CHashWindow window(3);
+
+  EXPECT_TRUE(window.Insert(0));
+  EXPECT_TRUE(window.Insert(10));
+  EXPECT_TRUE(window.Insert(20));
+
+  // the window is full, the oldest hash (0) is evicted
+  EXPECT_TRUE(window.Insert(30));
+  EXPECT_EQ(3, window.size());
+  EXPECT_FALSE(window.Contains(0));
+  EXPECT_TRUE(window.Contains(10));
+  EXPECT_TRUE(window.Contains(20));
+  EXPECT_TRUE(window.Contains(30));
+
+  // a duplicate does not refresh its position
+  EXPECT_FALSE(window.Insert(10));
+  EXPECT_TRUE(window.Insert(40));
+  EXPECT_FALSE(window.Contains(10));
+
+  // reset forgets everything
+  window.Reset(2);
+  EXPECT_EQ(0, window.size());
+  EXPECT_EQ(2, window.window());
+  EXPECT_FALSE(window.Contains(20));
+}
+
+TEST(HashWindow, CompareWithQueue)
+{
+  // the former implementation: linear search in the queue of the last hashes
+  const size_t       window_size(64);
+  std::deque<size_t> queue;
+  auto queue_insert = [&](size_t hash_)
+  {
+    if (std::find(queue.begin(), queue.end(), hash_) != queue.end()) return false;
+    queue.push_back(hash_);
+    while (queue.size() > window_size) queue.pop_front();
+    return true;
+  };
+
+  // small value range -> many duplicates, collisions and evictions
+  eCAL::Util::CHashWindow window(window_size);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<size_t> dist(0, 200);
+  for (int i = 0; i < 100000; ++i)
+  {
+    const size_t hash = dist(gen);
+    ASSERT_EQ(queue_insert(hash), window.Insert(hash));
+  }
+  EXPECT_EQ(queue.size(), window.size());
+}
+
+TEST(HashWindow, Benchmark)
+{
+  // every sample is received on two transport layers
+  const size_t window_size(64);
+  const size_t samples(1000000);
+
+  std::vector<size_t> hashes(samples);
+  for (size_t i = 0; i < samples; ++i) hashes[i] = std::hash<std::string>()(std::to_string(i));
+
+  auto measure = [&](const std::function<bool(size_t)>& insert_)
+  {
+    size_t accepted(0);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < samples; ++i)
+    {
+      if (insert_(hashes[i])) accepted++;
+      if (insert_(hashes[i])) accepted++;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(samples, accepted);
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (2.0 * samples);
+  };
+
+  std::deque<size_t> queue;
+  const double queue_ns = measure([&](size_t hash_)
+  {
+    if (std::find(queue.begin(), queue.end(), hash_) != queue.end()) return false;
+    queue.push_back(hash_);
+    while (queue.size() > window_size) queue.pop_front();
+    return true;
+  });
+
+  eCAL::Util::CHashWindow window(window_size);
+  const double window_ns = measure([&](size_t hash_) { return window.Insert(hash_); });
+
+  std::cout << "[ BENCHMARK] queue       : " << queue_ns  << " ns/sample" << std::endl;
+  std::cout << "[ BENCHMARK] hash window : " << window_ns << " ns/sample" << std::endl;
+}
@@ -0,0 +1,94 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile_ack.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+TEST(MemFile, AckCounter)
+{
+  if (!eCAL::CMemFileAck::Supported()) GTEST_SKIP();
+
+  const std::string memfile_name = "my_acknowledged_memory_file";
+
+  eCAL::CMemFileAck publisher;
+  eCAL::CMemFileAck subscriber_1;
+  eCAL::CMemFileAck subscriber_2;
+
+  // subscribers must not create the counter
+  EXPECT_EQ(false, subscriber_1.Create(memfile_name, false));
+
+  EXPECT_EQ(true, publisher.Create(memfile_name, true));
+  EXPECT_EQ(true, subscriber_1.Create(memfile_name, false));
+  EXPECT_EQ(true, subscriber_2.Create(memfile_name, false));
+
+  // nobody acknowledged -> timeout
+  publisher.Reset(41);
+  EXPECT_EQ(0, publisher.Wait(41, 2, 10));
+
+  // late acknowledges of older samples are ignored
+  publisher.Reset(42);
+  subscriber_1.Acknowledge(41);
+  subscriber_1.Acknowledge(42);
+  EXPECT_EQ(1, publisher.Wait(42, 2, 10));
+
+  // acknowledge from other thread wakes up the waiting publisher
+  publisher.Reset(43);
+  std::thread subscriber_thread([&]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      subscriber_1.Acknowledge(43);
+      subscriber_2.Acknowledge(43);
+    });
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(2, publisher.Wait(43, 2, 5000));
+  EXPECT_GT(std::chrono::milliseconds(2500), std::chrono::steady_clock::now() - start);
+  subscriber_thread.join();
+
+  EXPECT_EQ(true, subscriber_1.Destroy());
+  EXPECT_EQ(true, subscriber_2.Destroy());
+  EXPECT_EQ(true, publisher.Destroy());
+}
+
+TEST(MemFile, AckCounterRemovedByPublisher)
+{
+  if (!eCAL::CMemFileAck::Supported()) GTEST_SKIP();
+
+  const std::string memfile_name = "my_removed_acknowledged_memory_file";
+
+  eCAL::CMemFileAck publisher;
+  eCAL::CMemFileAck subscriber;
+
+  EXPECT_EQ(true, publisher.Create(memfile_name, true));
+  EXPECT_EQ(true, publisher.Destroy());
+
+  // a subscriber that is late must not add the counter of a removed memory file again
+  EXPECT_EQ(false, subscriber.Create(memfile_name, false));
+  EXPECT_EQ(false, subscriber.Create(memfile_name, false));
+
+  // the publisher can create it again
+  EXPECT_EQ(true, publisher.Create(memfile_name, true));
+  EXPECT_EQ(true, subscriber.Create(memfile_name, false));
+  EXPECT_EQ(true, subscriber.Destroy());
+  EXPECT_EQ(true, publisher.Destroy());
+}
@@ -0,0 +1,221 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile.h"
+#include "io/shm/ecal_memfile_ring.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  void WriteSample(eCAL::CMemFileRing& ring_, std::uint64_t value_, std::size_t len_)
+  {
+    void* slot = ring_.BeginWrite(len_);
+    ASSERT_NE(nullptr, slot);
+    // fill the whole sample with the value, so torn reads can be detected
+    auto* data = static_cast<std::uint64_t*>(slot);
+    for (std::size_t i = 0; i < len_ / sizeof(std::uint64_t); ++i) data[i] = value_;
+    ring_.EndWrite(len_);
+  }
+}
+
+TEST(MemFile, RingReadWrite)
+{
+  const std::uint32_t slot_count(4);
+  const std::size_t   slot_size(256);
+
+  // use an unaligned base address
+  std::vector<char> memory(eCAL::CMemFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size) + 1);
+
+  // writer initializes the ring, reader attaches to it
+  eCAL::CMemFileRing writer;
+  eCAL::CMemFileRing reader;
+  EXPECT_EQ(false, reader.SetBaseAddress(memory.data() + 1, memory.size() - 1, false));
+  EXPECT_EQ(true,  writer.SetBaseAddress(memory.data() + 1, memory.size() - 1, true, slot_count, slot_size));
+  EXPECT_EQ(true,  reader.SetBaseAddress(memory.data() + 1, memory.size() - 1, false));
+
+  EXPECT_EQ(slot_count, reader.SlotCount());
+  EXPECT_EQ(slot_size,  reader.SlotSize());
+
+  // oversized samples are rejected
+  EXPECT_EQ(nullptr, writer.BeginWrite(slot_size + 1));
+
+  std::uint64_t     read_seq(reader.WriteSequence());
+  std::uint64_t     lost(0);
+  std::vector<char> buffer;
+
+  // nothing written yet
+  EXPECT_EQ(false, reader.Read(read_seq, buffer, lost));
+
+  // write and read back samples one by one
+  for (std::uint64_t value = 1; value <= 10; ++value)
+  {
+    WriteSample(writer, value, 64);
+    EXPECT_EQ(true, reader.Read(read_seq, buffer, lost));
+    ASSERT_EQ(64, buffer.size());
+    std::uint64_t read_value(0);
+    std::memcpy(&read_value, buffer.data(), sizeof(read_value));
+    EXPECT_EQ(value, read_value);
+  }
+  EXPECT_EQ(false, reader.Read(read_seq, buffer, lost));
+  EXPECT_EQ(0, lost);
+
+  // invalid samples are skipped
+  writer.BeginWrite(64);
+  writer.EndWrite(0);
+  EXPECT_EQ(false, reader.Read(read_seq, buffer, lost));
+  EXPECT_EQ(0, lost);
+}
+
+TEST(MemFile, RingOverrun)
+{
+  const std::uint32_t slot_count(4);
+  const std::size_t   slot_size(64);
+
+  std::vector<char> memory(eCAL::CMemFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size));
+
+  eCAL::CMemFileRing ring;
+  EXPECT_EQ(true, ring.SetBaseAddress(memory.data(), memory.size(), true, slot_count, slot_size));
+
+  std::uint64_t     read_seq(ring.WriteSequence());
+  std::uint64_t     lost(0);
+  std::vector<char> buffer;
+
+  // the writer never blocks, the slow reader loses the oldest samples
+  for (std::uint64_t value = 1; value <= 10; ++value)
+  {
+    WriteSample(ring, value, slot_size);
+  }
+
+  std::vector<std::uint64_t> received;
+  while (ring.Read(read_seq, buffer, lost))
+  {
+    std::uint64_t read_value(0);
+    std::memcpy(&read_value, buffer.data(), sizeof(read_value));
+    received.push_back(read_value);
+  }
+
+  EXPECT_EQ(6, lost);
+  EXPECT_EQ((std::vector<std::uint64_t>{ 7, 8, 9, 10 }), received);
+}
+
+TEST(MemFile, RingConcurrentReaders)
+{
+  const std::uint32_t slot_count(16);
+  const std::size_t   slot_size(1024);
+  const std::uint64_t sample_count(100000);
+
+  std::vector<char> memory(eCAL::CMemFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size));
+
+  eCAL::CMemFileRing writer;
+  EXPECT_EQ(true, writer.SetBaseAddress(memory.data(), memory.size(), true, slot_count, slot_size));
+
+  std::atomic<bool> writer_done(false);
+  std::atomic<int>  torn_samples(0);
+  std::atomic<int>  unordered_samples(0);
+
+  // every reader keeps its own cursor, torn or unordered samples must never be delivered
+  auto read_loop = [&]()
+  {
+    eCAL::CMemFileRing reader;
+    if (!reader.SetBaseAddress(memory.data(), memory.size(), false)) return;
+
+    std::uint64_t     read_seq(0);
+    std::uint64_t     lost(0);
+    std::uint64_t     last_value(0);
+    std::vector<char> buffer;
+    for (;;)
+    {
+      const bool done = writer_done;
+      while (reader.Read(read_seq, buffer, lost))
+      {
+        const auto* data = reinterpret_cast<const std::uint64_t*>(buffer.data());
+        const std::size_t count = buffer.size() / sizeof(std::uint64_t);
+        for (std::size_t i = 1; i < count; ++i)
+        {
+          if (data[i] != data[0])
+          {
+            torn_samples++;
+            break;
+          }
+        }
+        if (data[0] <= last_value) unordered_samples++;
+        last_value = data[0];
+      }
+      if (done) break;
+    }
+  };
+
+  std::thread reader_1(read_loop);
+  std::thread reader_2(read_loop);
+
+  for (std::uint64_t value = 1; value <= sample_count; ++value)
+  {
+    WriteSample(writer, value, slot_size);
+  }
+  writer_done = true;
+
+  reader_1.join();
+  reader_2.join();
+
+  EXPECT_EQ(0, torn_samples);
+  EXPECT_EQ(0, unordered_samples);
+  EXPECT_EQ(sample_count, writer.WriteSequence());
+}
+
+TEST(MemFile, RingNotification)
+{
+  if (!eCAL::CMemFileRing::NotificationSupported()) GTEST_SKIP();
+
+  const std::uint32_t slot_count(4);
+  const std::size_t   slot_size(64);
+
+  std::vector<char> memory(eCAL::CMemFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size));
+
+  eCAL::CMemFileRing writer;
+  eCAL::CMemFileRing reader;
+  EXPECT_EQ(true, writer.SetBaseAddress(memory.data(), memory.size(), true, slot_count, slot_size));
+  EXPECT_EQ(true, reader.SetBaseAddress(memory.data(), memory.size(), false));
+
+  // no notification -> timeout
+  EXPECT_EQ(false, reader.WaitForNotification(reader.NotifySequence(), 10));
+
+  // notification before waiting is not lost
+  std::uint32_t notify_seq = reader.NotifySequence();
+  writer.Notify();
+  EXPECT_EQ(true, reader.WaitForNotification(notify_seq, 1000));
+
+  // notification wakes up a waiting reader
+  notify_seq = reader.NotifySequence();
+  std::atomic<bool> notified(false);
+  std::thread waiter([&]() { notified = reader.WaitForNotification(notify_seq, 5000); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  WriteSample(writer, 1, slot_size);
+  writer.Notify();
+  waiter.join();
+  EXPECT_EQ(true, notified);
+}
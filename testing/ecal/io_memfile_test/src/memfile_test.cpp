@@ -20,6 +20,7 @@
 #include <ecal/ecal.h>
 #include "io/shm/ecal_memfile.h"
 #include "io/shm/ecal_memfile_db.h"
+#include "io/shm/ecal_memfile_futex.h"
 
 #include <atomic>
 #include <chrono>
@@ -297,3 +298,45 @@ TEST(MemFile, MemfileConcurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+TEST(MemFile, MemfileNotification)
+{
+  if (!eCAL::memfile::futex::Supported()) GTEST_SKIP();
+
+  const std::string memfile_name = "my_notified_memory_file";
+
+  eCAL::CMemoryFile writer;
+  eCAL::CMemoryFile reader;
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+  EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+
+  // both sides see the same counter
+  ASSERT_NE(nullptr, reader.NotifyAddress());
+  EXPECT_EQ(writer.NotifySequence(), reader.NotifySequence());
+
+  // every notification changes the counter
+  const uint32_t notify_seq = reader.NotifySequence();
+  writer.Notify();
+  EXPECT_NE(notify_seq, reader.NotifySequence());
+
+#ifdef __linux__
+  // a notification from another thread wakes up the waiting reader
+  const uint32_t wait_seq = reader.NotifySequence();
+  std::thread writer_thread([&]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      writer.Notify();
+    });
+  const auto start = std::chrono::steady_clock::now();
+  while (reader.NotifySequence() == wait_seq && (std::chrono::steady_clock::now() - start < std::chrono::seconds(5)))
+  {
+    eCAL::memfile::futex::Wait(reader.NotifyAddress(), wait_seq, 5000);
+  }
+  EXPECT_NE(wait_seq, reader.NotifySequence());
+  EXPECT_GT(std::chrono::milliseconds(2500), std::chrono::steady_clock::now() - start);
+  writer_thread.join();
+#endif
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
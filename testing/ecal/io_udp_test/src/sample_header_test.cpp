@@ -0,0 +1,80 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "readwrite/ecal_sample_header.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(SampleHeader, CreateParse)
+{
+  eCAL::SWriterAttr attr;
+  attr.len   = 1000;
+  attr.id    = -42;
+  attr.clock = 17;
+  attr.time  = 1234567890123;
+  attr.hash  = 0xFEDCBA98;
+
+  // header followed by the payload, like the tcp writer sends it (6 bytes "ECAL" + size field in front)
+  std::vector<char> header;
+  const size_t header_size = eCAL::SampleHeader::Create("my_topic", "4711", attr, 6, header);
+  ASSERT_EQ(header.size(), header_size);
+  EXPECT_EQ(0, (6 + header_size) % 8);
+  EXPECT_EQ(true, eCAL::SampleHeader::IsSampleHeader(header.data(), header.size()));
+
+  std::vector<char> message(header);
+  message.resize(header.size() + attr.len, 'x');
+
+  eCAL::SampleHeader::SSampleHeader parsed;
+  const char* payload(nullptr);
+  ASSERT_EQ(true, eCAL::SampleHeader::Parse(message.data(), message.size(), parsed, payload));
+  EXPECT_EQ("my_topic",  parsed.topic_name);
+  EXPECT_EQ("4711",      parsed.topic_id);
+  EXPECT_EQ(attr.id,     parsed.id);
+  EXPECT_EQ(attr.clock,  parsed.clock);
+  EXPECT_EQ(attr.time,   parsed.time);
+  EXPECT_EQ(attr.hash,   parsed.hash);
+  EXPECT_EQ(attr.len,    parsed.size);
+  EXPECT_EQ(message.data() + header_size, payload);
+
+  // truncated messages are rejected
+  EXPECT_EQ(false, eCAL::SampleHeader::Parse(message.data(), message.size() - 1, parsed, payload));
+  EXPECT_EQ(false, eCAL::SampleHeader::Parse(message.data(), header_size - 1, parsed, payload));
+}
+
+TEST(SampleHeader, Negotiation)
+{
+  eCAL::SampleHeader::CNegotiation negotiation;
+
+  // no readers -> protobuf
+  EXPECT_EQ(false, negotiation.UseBinaryHeader());
+
+  negotiation.AddConnection("reader_1", eCAL::SampleHeader::version);
+  EXPECT_EQ(true, negotiation.UseBinaryHeader());
+
+  // an old reader joins -> protobuf
+  negotiation.AddConnection("reader_2", 0);
+  EXPECT_EQ(false, negotiation.UseBinaryHeader());
+
+  // and leaves again
+  negotiation.RemConnection("reader_2");
+  EXPECT_EQ(true, negotiation.UseBinaryHeader());
+}
@@ -0,0 +1,125 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/udp/fragmentation/msg_type.h"
+#include "io/udp/fragmentation/rcv_fragments.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  class CTestDefragmentation : public IO::UDP::CMsgDefragmentation
+  {
+  public:
+    int OnMessageCompleted(std::vector<char>&& msg_buffer_) override
+    {
+      completed++;
+      // only read the buffer, so it stays with the defragmentation object
+      last_message.assign(msg_buffer_.begin(), msg_buffer_.end());
+      last_message_address = msg_buffer_.data();
+      return(0);
+    }
+
+    int               completed = 0;
+    std::vector<char> last_message;
+    const char*       last_message_address = nullptr;
+  };
+
+  void ApplyFragments(CTestDefragmentation& defrag_, int32_t id_, const std::vector<char>& message_, size_t fragment_len_, size_t skip_fragment_ = SIZE_MAX)
+  {
+    auto udp_message = std::make_unique<IO::UDP::SUDPMessage>();
+    const size_t fragment_num = (message_.size() + fragment_len_ - 1) / fragment_len_;
+
+    // start package
+    udp_message->header.type = IO::UDP::msg_type_header;
+    udp_message->header.id   = id_;
+    udp_message->header.num  = static_cast<int32_t>(fragment_num);
+    udp_message->header.len  = static_cast<int32_t>(message_.size());
+    defrag_.ApplyMessage(*udp_message);
+
+    // data packages
+    for (size_t i = 0; i < fragment_num; ++i)
+    {
+      if (i == skip_fragment_) continue;
+
+      const size_t offset = i * fragment_len_;
+      const size_t len    = std::min(fragment_len_, message_.size() - offset);
+      udp_message->header.type = IO::UDP::msg_type_content;
+      udp_message->header.num  = static_cast<int32_t>(i);
+      udp_message->header.len  = static_cast<int32_t>(len);
+      std::memcpy(udp_message->payload, message_.data() + offset, len);
+      defrag_.ApplyMessage(*udp_message);
+    }
+  }
+
+  std::vector<char> CreateMessage(size_t len_, char seed_)
+  {
+    std::vector<char> message(len_);
+    for (size_t i = 0; i < len_; ++i) message[i] = static_cast<char>((i + static_cast<size_t>(seed_)) % 251);
+    return message;
+  }
+}
+
+TEST(UDP, DefragmentationReuse)
+{
+  CTestDefragmentation defrag;
+
+  const std::vector<char> message_1 = CreateMessage(200000, 1);
+  ApplyFragments(defrag, 1, message_1, 60000);
+  EXPECT_EQ(true, defrag.HasCompleted());
+  EXPECT_EQ(1, defrag.completed);
+  EXPECT_EQ(message_1, defrag.last_message);
+  const char* first_buffer = defrag.last_message_address;
+
+  // a reset object reassembles the next (smaller) message into the same buffer
+  defrag.Reset();
+  EXPECT_EQ(false, defrag.HasFinished());
+
+  const std::vector<char> message_2 = CreateMessage(150000, 2);
+  ApplyFragments(defrag, 2, message_2, 60000);
+  EXPECT_EQ(true, defrag.HasCompleted());
+  EXPECT_EQ(2, defrag.completed);
+  EXPECT_EQ(message_2, defrag.last_message);
+  EXPECT_EQ(first_buffer, defrag.last_message_address);
+}
+
+TEST(UDP, DefragmentationIncomplete)
+{
+  CTestDefragmentation defrag;
+
+  // a lost fragment aborts the reassembly
+  const std::vector<char> message = CreateMessage(200000, 3);
+  ApplyFragments(defrag, 1, message, 60000, 1);
+  EXPECT_EQ(true,  defrag.HasFinished());
+  EXPECT_EQ(true,  defrag.HasAborted());
+  EXPECT_EQ(false, defrag.HasCompleted());
+  EXPECT_EQ(0, defrag.completed);
+
+  // the next message is received completely after a reset
+  defrag.Reset();
+  ApplyFragments(defrag, 2, message, 60000);
+  EXPECT_EQ(true, defrag.HasCompleted());
+  EXPECT_EQ(message, defrag.last_message);
+}
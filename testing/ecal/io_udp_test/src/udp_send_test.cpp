@@ -0,0 +1,213 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/udp/fragmentation/msg_type.h"
+#include "io/udp/fragmentation/snd_fragments.h"
+#include "io/udp/fragmentation/snd_token_bucket.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  // payload size of one fragment (MSG_PAYLOAD_SIZE)
+  const size_t msg_payload_size = MSG_BUFFER_SIZE - sizeof(IO::UDP::SUDPMessageHead);
+
+  std::vector<char> CreateMessage(size_t len_)
+  {
+    // reserve space for the first message header, like CreateSampleBuffer does
+    std::vector<char> message(sizeof(IO::UDP::SUDPMessageHead) + len_);
+    for (size_t i = 0; i < len_; ++i) message[sizeof(IO::UDP::SUDPMessageHead) + i] = static_cast<char>(i % 251);
+    return message;
+  }
+
+  struct SDatagram
+  {
+    IO::UDP::SUDPMessageHead head;
+    std::vector<char>        data;
+  };
+
+  // split gathered datagrams into header and payload again
+  size_t CollectDatagrams(const IO::UDP::SSendBuffer* buffers_, size_t count_, std::vector<SDatagram>& datagrams_)
+  {
+    size_t sent(0);
+    for (size_t i = 0; i < count_; ++i)
+    {
+      std::vector<char> datagram(static_cast<const char*>(buffers_[i].head), static_cast<const char*>(buffers_[i].head) + buffers_[i].head_len);
+      if (buffers_[i].data_len > 0) datagram.insert(datagram.end(), static_cast<const char*>(buffers_[i].data), static_cast<const char*>(buffers_[i].data) + buffers_[i].data_len);
+
+      SDatagram result;
+      std::memcpy(&result.head, datagram.data(), sizeof(result.head));
+      result.data.assign(datagram.begin() + sizeof(result.head), datagram.end());
+      datagrams_.push_back(result);
+      sent += datagram.size();
+    }
+    return sent;
+  }
+}
+
+TEST(UDP, SendSingleFragmentBatch)
+{
+  const size_t      message_len(1000);
+  std::vector<char> message = CreateMessage(message_len);
+  const std::vector<char> expected(message.begin() + sizeof(IO::UDP::SUDPMessageHead), message.end());
+
+  IO::UDP::CTokenBucket  pacer;
+  std::vector<SDatagram> datagrams;
+  size_t                 transmit_calls(0);
+  const size_t sent = IO::UDP::SendFragmentedMessageBatch(message.data(), message_len, pacer,
+    [&](const IO::UDP::SSendBuffer* buffers_, size_t count_) { transmit_calls++; return CollectDatagrams(buffers_, count_, datagrams); });
+
+  EXPECT_EQ(sizeof(IO::UDP::SUDPMessageHead) + message_len, sent);
+  EXPECT_EQ(1, transmit_calls);
+  ASSERT_EQ(1, datagrams.size());
+  EXPECT_EQ(IO::UDP::msg_type_header_with_content, datagrams[0].head.type);
+  EXPECT_EQ(static_cast<int32_t>(message_len), datagrams[0].head.len);
+  EXPECT_EQ(expected, datagrams[0].data);
+}
+
+TEST(UDP, SendFragmentsBatch)
+{
+  // 4 MB point cloud
+  const size_t      message_len(4 * 1024 * 1024 + 17);
+  std::vector<char> message = CreateMessage(message_len);
+  const std::vector<char> expected(message.begin() + sizeof(IO::UDP::SUDPMessageHead), message.end());
+
+  IO::UDP::CTokenBucket  pacer;
+  std::vector<SDatagram> datagrams;
+  size_t                 transmit_calls(0);
+  const size_t sent = IO::UDP::SendFragmentedMessageBatch(message.data(), message_len, pacer,
+    [&](const IO::UDP::SSendBuffer* buffers_, size_t count_) { transmit_calls++; return CollectDatagrams(buffers_, count_, datagrams); });
+
+  // without bandwidth limitation all fragments are handed over at once
+  EXPECT_EQ(1, transmit_calls);
+
+  const size_t fragment_num = (message_len + msg_payload_size - 1) / msg_payload_size;
+  ASSERT_EQ(fragment_num + 1, datagrams.size());
+  EXPECT_EQ((fragment_num + 1) * sizeof(IO::UDP::SUDPMessageHead) + message_len, sent);
+
+  // start package
+  EXPECT_EQ(IO::UDP::msg_type_header, datagrams[0].head.type);
+  EXPECT_EQ(static_cast<int32_t>(fragment_num), datagrams[0].head.num);
+  EXPECT_EQ(static_cast<int32_t>(message_len), datagrams[0].head.len);
+  EXPECT_TRUE(datagrams[0].data.empty());
+
+  // data packages, every datagram carries its own header
+  std::vector<char> received;
+  for (size_t i = 1; i < datagrams.size(); ++i)
+  {
+    EXPECT_EQ(IO::UDP::msg_type_content, datagrams[i].head.type);
+    EXPECT_EQ(datagrams[0].head.id, datagrams[i].head.id);
+    EXPECT_EQ(static_cast<int32_t>(i - 1), datagrams[i].head.num);
+    EXPECT_EQ(static_cast<int32_t>(datagrams[i].data.size()), datagrams[i].head.len);
+    received.insert(received.end(), datagrams[i].data.begin(), datagrams[i].data.end());
+  }
+  EXPECT_EQ(expected, received);
+
+  // the payload is not touched by the batched send path
+  EXPECT_EQ(expected, std::vector<char>(message.begin() + sizeof(IO::UDP::SUDPMessageHead), message.end()));
+}
+
+TEST(UDP, SendPrefixedFragmentsBatch)
+{
+  // sample name + sample header in front of a payload that is not copied
+  const std::string       prefix(300, 'p');
+  const size_t            payload_len(3 * msg_payload_size + 5);
+  const std::vector<char> message = CreateMessage(payload_len);
+  const std::vector<char> payload(message.begin() + sizeof(IO::UDP::SUDPMessageHead), message.end());
+
+  IO::UDP::CTokenBucket  pacer;
+  std::vector<SDatagram> datagrams;
+  bool                   payload_gathered(true);
+  const size_t sent = IO::UDP::SendFragmentedMessageBatch(prefix.data(), prefix.size(), payload.data(), payload.size(), pacer,
+    [&](const IO::UDP::SSendBuffer* buffers_, size_t count_)
+    {
+      // every data package points directly into the payload buffer
+      for (size_t i = 0; i < count_; ++i)
+      {
+        const char* data = static_cast<const char*>(buffers_[i].data);
+        if ((buffers_[i].data_len > 0) && ((data < payload.data()) || (data + buffers_[i].data_len > payload.data() + payload.size()))) payload_gathered = false;
+      }
+      return CollectDatagrams(buffers_, count_, datagrams);
+    });
+
+  EXPECT_EQ(true, payload_gathered);
+
+  const size_t message_len  = prefix.size() + payload_len;
+  const size_t fragment_num = (message_len + msg_payload_size - 1) / msg_payload_size;
+  ASSERT_EQ(fragment_num + 1, datagrams.size());
+  EXPECT_EQ((fragment_num + 1) * sizeof(IO::UDP::SUDPMessageHead) + message_len, sent);
+  EXPECT_EQ(static_cast<int32_t>(message_len), datagrams[0].head.len);
+
+  // reassembled message is prefix + payload
+  std::vector<char> received;
+  for (size_t i = 1; i < datagrams.size(); ++i)
+  {
+    EXPECT_EQ(static_cast<int32_t>(i - 1), datagrams[i].head.num);
+    EXPECT_EQ(static_cast<int32_t>(datagrams[i].data.size()), datagrams[i].head.len);
+    received.insert(received.end(), datagrams[i].data.begin(), datagrams[i].data.end());
+  }
+  std::vector<char> expected(prefix.begin(), prefix.end());
+  expected.insert(expected.end(), payload.begin(), payload.end());
+  EXPECT_EQ(expected, received);
+}
+
+TEST(UDP, TokenBucket)
+{
+  const long   bandwidth(20 * 1024 * 1024);
+  const size_t message_len(2 * 1024 * 1024);
+
+  IO::UDP::CTokenBucket pacer;
+  pacer.SetBandwidth(bandwidth);
+
+  // unlimited
+  IO::UDP::CTokenBucket unlimited;
+  EXPECT_EQ(static_cast<size_t>(-1), unlimited.Available());
+
+  std::vector<char> message = CreateMessage(message_len);
+  size_t transmit_calls(0);
+  size_t transmitted(0);
+
+  const auto start = std::chrono::steady_clock::now();
+  const size_t sent = IO::UDP::SendFragmentedMessageBatch(message.data(), message_len, pacer,
+    [&](const IO::UDP::SSendBuffer* buffers_, size_t count_)
+    {
+      size_t len(0);
+      for (size_t i = 0; i < count_; ++i) len += buffers_[i].head_len + buffers_[i].data_len;
+      transmit_calls++;
+      transmitted += len;
+      return len;
+    });
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(transmitted, sent);
+  EXPECT_LT(1, transmit_calls);
+
+  // the initial burst is sent without waiting, the rest is paced
+  // (a loaded machine only makes it slower, the upper bound just catches a pacer that never refills)
+  const auto expected_min = std::chrono::milliseconds(static_cast<long long>(1000.0 * (message_len - std::max(64.0 * 1024.0, bandwidth * 0.01)) / bandwidth));
+  EXPECT_GE(elapsed, expected_min - std::chrono::milliseconds(5));
+  EXPECT_LT(elapsed, std::chrono::seconds(30));
+}
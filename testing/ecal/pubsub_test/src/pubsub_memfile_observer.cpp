@@ -0,0 +1,97 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+
+// memory files observed by shared observer threads instead of one thread per memory file
+TEST(PubSub, MemfileObserverThreads)
+{
+  // initialize eCAL API with one shared observer thread
+  eCAL::Initialize({ "--ecal-set-config-key", "subscriber/memfile_observer_threads:1" }, "memfile observer threads test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  const size_t topic_count = 8;
+  std::vector<std::unique_ptr<eCAL::CPublisher>>  pubs;
+  std::vector<std::unique_ptr<eCAL::CSubscriber>> subs;
+  std::vector<std::atomic<size_t>>                received_count(topic_count);
+  std::vector<std::atomic<size_t>>                received_bytes(topic_count);
+
+  for (size_t topic = 0; topic < topic_count; ++topic)
+  {
+    const std::string topic_name = "observed_topic_" + std::to_string(topic);
+
+    // create subscriber
+    subs.emplace_back(std::make_unique<eCAL::CSubscriber>(topic_name));
+    received_count[topic] = 0;
+    received_bytes[topic] = 0;
+    auto lambda = [&received_count, &received_bytes, topic](const char* /*topic_name_*/, const eCAL::SReceiveCallbackData* data_) {
+      received_bytes[topic] += data_->size;
+      ++received_count[topic];
+    };
+    EXPECT_EQ(true, subs.back()->AddReceiveCallback(lambda));
+
+    // create publisher, shm only
+    pubs.emplace_back(std::make_unique<eCAL::CPublisher>(topic_name));
+    pubs.back()->SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+    pubs.back()->SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+  }
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // all topics are handled by one thread, every sample has to be delivered
+  const std::string send_s("observed");
+  const size_t iterations = 20;
+  for (size_t i = 0; i < iterations; ++i)
+  {
+    for (auto& pub : pubs)
+    {
+      EXPECT_EQ(send_s.size(), pub->Send(send_s));
+    }
+
+    // let the data flow
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+
+  // check callback receive
+  for (size_t topic = 0; topic < topic_count; ++topic)
+  {
+    EXPECT_EQ(iterations, received_count[topic]) << "topic " << topic;
+    EXPECT_EQ(send_s.size() * iterations, received_bytes[topic]) << "topic " << topic;
+  }
+
+  // destroy subscribers while the observer thread is running
+  subs.clear();
+  pubs.clear();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -0,0 +1,189 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+#define QUEUE_DEPTH                   4
+#define SEND_SAMPLES                 10
+
+namespace
+{
+  eCAL::QOS::SReaderQOS BoundedQueueQOS(eCAL::QOS::eQOSPolicy_Overflow overflow_)
+  {
+    eCAL::QOS::SReaderQOS qos;
+    qos.history_kind_depth = QUEUE_DEPTH;
+    qos.overflow           = overflow_;
+    return qos;
+  }
+
+  std::vector<std::string> PublishAndPoll(const eCAL::QOS::SReaderQOS& qos_)
+  {
+    // create subscriber with the given receive queue
+    eCAL::CSubscriber sub;
+    EXPECT_EQ(true, sub.SetQOS(qos_));
+    EXPECT_EQ(true, sub.Create("receive_queue"));
+
+    // create publisher
+    eCAL::CPublisher pub("receive_queue");
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+    // send more samples than the queue can hold without polling
+    for (int i = 0; i < SEND_SAMPLES; ++i)
+    {
+      const std::string send_s = std::to_string(i);
+      EXPECT_EQ(send_s.size(), pub.Send(send_s));
+      eCAL::Process::SleepMS(DATA_FLOW_TIME);
+    }
+
+    // poll all queued samples
+    std::vector<std::string> received;
+    std::string              buf;
+    while (sub.ReceiveBuffer(buf, nullptr, DATA_FLOW_TIME))
+    {
+      received.push_back(buf);
+    }
+    return received;
+  }
+}
+
+TEST(PubSub, ReceiveQueueDropOldest)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "receive_queue_drop_oldest"));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // the newest samples survive
+  const std::vector<std::string> received = PublishAndPoll(BoundedQueueQOS(eCAL::QOS::drop_oldest_overflow_qos));
+  EXPECT_EQ(std::vector<std::string>({ "6", "7", "8", "9" }), received);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, ReceiveQueueDropNewest)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "receive_queue_drop_newest"));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // the oldest samples survive
+  const std::vector<std::string> received = PublishAndPoll(BoundedQueueQOS(eCAL::QOS::drop_newest_overflow_qos));
+  EXPECT_EQ(std::vector<std::string>({ "0", "1", "2", "3" }), received);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, ReceiveQueueDefault)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "receive_queue_default"));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // only the latest sample is kept by default
+  const std::vector<std::string> received = PublishAndPoll(eCAL::QOS::SReaderQOS());
+  EXPECT_EQ(std::vector<std::string>({ "9" }), received);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, ReceiveQueueKeepAll)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "receive_queue_keep_all"));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // the queue grows beyond its depth, all samples survive
+  eCAL::QOS::SReaderQOS qos = BoundedQueueQOS(eCAL::QOS::drop_oldest_overflow_qos);
+  qos.history_kind = eCAL::QOS::keep_all_history_qos;
+  const std::vector<std::string> received = PublishAndPoll(qos);
+  EXPECT_EQ(std::vector<std::string>({ "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" }), received);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, ReceiveQueueBlock)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "receive_queue_block"));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber with a blocking receive queue
+  eCAL::CSubscriber sub;
+  EXPECT_EQ(true, sub.SetQOS(BoundedQueueQOS(eCAL::QOS::block_overflow_qos)));
+  EXPECT_EQ(true, sub.Create("receive_queue"));
+
+  // create publisher
+  eCAL::CPublisher pub("receive_queue");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // fill the queue, the last sample blocks the transport thread
+  for (int i = 0; i <= QUEUE_DEPTH; ++i)
+  {
+    const std::string send_s = std::to_string(i);
+    EXPECT_EQ(send_s.size(), pub.Send(send_s));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+
+  // a blocked transport thread must not block adding a receive callback
+  std::atomic<int> callback_count(0);
+  EXPECT_EQ(true, sub.AddReceiveCallback([&callback_count](const char* /*topic_name_*/, const eCAL::SReceiveCallbackData* /*data_*/) { ++callback_count; }));
+
+  // poll the queued samples, taking the first one unblocks the transport thread
+  std::vector<std::string> received;
+  std::string              buf;
+  while (sub.ReceiveBuffer(buf, nullptr, DATA_FLOW_TIME))
+  {
+    received.push_back(buf);
+  }
+  EXPECT_EQ(std::vector<std::string>({ "0", "1", "2", "3", "4" }), received);
+
+  // new samples are delivered to the callback again
+  const std::string send_s("callback");
+  EXPECT_EQ(send_s.size(), pub.Send(send_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(1, callback_count);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
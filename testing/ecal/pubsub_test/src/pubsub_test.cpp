@@ -999,6 +999,47 @@ TEST(PubSub, DestroyInCallback)
   eCAL::Finalize();
 }
 
+TEST(PubSub, RemoveCallbackInCallback)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "remove_callback_in_callback");
+
+  // enable loop back communication in the same thread
+  eCAL::Util::EnableLoopback(true);
+
+  // create publisher and subscriber
+  eCAL::CPublisher  pub("remove");
+  eCAL::CSubscriber sub("remove");
+
+  // the callback removes itself, this must not block
+  std::atomic<int> callback_count(0);
+  auto remove_lambda = [&sub, &callback_count](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* /*data_*/) {
+    callback_count++;
+    sub.RemReceiveCallback();
+  };
+  EXPECT_EQ(true, sub.AddReceiveCallback(remove_lambda));
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the callback is only executed for the first message
+  for (int i = 0; i < 3; ++i)
+  {
+    pub.Send("remove");
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+  EXPECT_EQ(1, callback_count);
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
 TEST(IO, SubscriberReconnection)
 {
   /* Test setup :
@@ -0,0 +1,181 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "registration/ecal_registration_delta.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  eCAL::CRegistrationDeltaCache::SampleT CreateTopicSample(const std::string& topic_id_, long long sequence_, long long version_, eCAL::pb::eCmdType cmd_type_ = eCAL::pb::bct_reg_publisher)
+  {
+    auto sample = std::make_shared<eCAL::pb::Sample>();
+    sample->set_cmd_type(cmd_type_);
+    sample->set_reg_sequence(sequence_);
+    sample->set_reg_version(version_);
+    sample->mutable_topic()->set_hname("host");
+    sample->mutable_topic()->set_pid(42);
+    sample->mutable_topic()->set_tname("topic_" + topic_id_);
+    sample->mutable_topic()->set_tid(topic_id_);
+    return sample;
+  }
+
+  eCAL::pb::Sample CreateHeartbeat(long long sequence_, const std::vector<std::pair<std::string, long long>>& entities_)
+  {
+    eCAL::pb::Sample sample;
+    sample.set_cmd_type(eCAL::pb::bct_reg_heartbeat);
+    sample.set_reg_sequence(sequence_);
+    sample.mutable_heartbeat()->set_hname("host");
+    sample.mutable_heartbeat()->set_pid(42);
+    for (const auto& entity : entities_)
+    {
+      auto* heartbeat_entity = sample.mutable_heartbeat()->add_entities();
+      heartbeat_entity->set_id(entity.first);
+      heartbeat_entity->set_version(entity.second);
+    }
+    return sample;
+  }
+
+  // apply the known entities on every heartbeat
+  const std::chrono::milliseconds always(0);
+}
+
+TEST(RegistrationDelta, SameState)
+{
+  auto sample = CreateTopicSample("1", 1, 1);
+  eCAL::pb::Sample changed(*sample);
+
+  // statistics and delta registration fields are not part of the state
+  changed.set_reg_sequence(17);
+  changed.mutable_topic()->set_rclock(5);
+  changed.mutable_topic()->set_dclock(1000);
+  changed.mutable_topic()->set_dfreq(10000);
+  EXPECT_TRUE(eCAL::Registration::IsSameState(*sample, changed));
+
+  // connections are
+  changed.mutable_topic()->set_connections_loc(1);
+  EXPECT_FALSE(eCAL::Registration::IsSameState(*sample, changed));
+
+  // the attribute order is not
+  eCAL::pb::Sample attributes1(*sample);
+  eCAL::pb::Sample attributes2(*sample);
+  for (int i = 0; i < 10; ++i)
+  {
+    (*attributes1.mutable_topic()->mutable_attr())[std::to_string(i)]     = "value";
+    (*attributes2.mutable_topic()->mutable_attr())[std::to_string(9 - i)] = "value";
+  }
+  EXPECT_TRUE(eCAL::Registration::IsSameState(attributes1, attributes2));
+}
+
+TEST(RegistrationDelta, HeartbeatRefresh)
+{
+  eCAL::CRegistrationDeltaCache cache;
+
+  // samples in sequence
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("1", 1, 1)));
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("2", 2, 1)));
+
+  // heartbeat refreshes both
+  eCAL::CRegistrationDeltaCache::SampleListT refresh;
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(2, { { "1", 1 }, { "2", 1 } }), always, refresh));
+  ASSERT_EQ(2, refresh.size());
+
+  // the second entity is gone
+  refresh.clear();
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(2, { { "1", 1 } }), always, refresh));
+  ASSERT_EQ(1, refresh.size());
+  EXPECT_EQ("1", refresh[0]->topic().tid());
+
+  // and can not be refreshed anymore
+  refresh.clear();
+  EXPECT_FALSE(cache.ApplyHeartbeat(CreateHeartbeat(2, { { "1", 1 }, { "2", 1 } }), always, refresh));
+  EXPECT_EQ(1, refresh.size());
+}
+
+TEST(RegistrationDelta, HeartbeatRefreshInterval)
+{
+  eCAL::CRegistrationDeltaCache cache;
+  eCAL::CRegistrationDeltaCache::SampleListT refresh;
+  const std::chrono::milliseconds refresh_interval(std::chrono::hours(1));
+
+  // an entity applied with its sample is kept, but not applied again within the interval
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("1", 1, 1)));
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(1, { { "1", 1 } }), refresh_interval, refresh));
+  EXPECT_EQ(0, refresh.size());
+
+  // once it is due it is applied again, the interval starts over
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(1, { { "1", 1 } }), always, refresh));
+  EXPECT_EQ(1, refresh.size());
+  refresh.clear();
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(1, { { "1", 1 } }), refresh_interval, refresh));
+  EXPECT_EQ(0, refresh.size());
+
+  // the entity is still known, a heartbeat without it removes it
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(1, {}), refresh_interval, refresh));
+  EXPECT_FALSE(cache.ApplyHeartbeat(CreateHeartbeat(1, { { "1", 1 } }), always, refresh));
+  EXPECT_EQ(0, refresh.size());
+}
+
+TEST(RegistrationDelta, LostSample)
+{
+  eCAL::CRegistrationDeltaCache cache;
+  eCAL::CRegistrationDeltaCache::SampleListT refresh;
+
+  // sequence gap
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("1", 1, 1)));
+  EXPECT_FALSE(cache.ApplySample(CreateTopicSample("3", 3, 1)));
+
+  // the heartbeat lists a newer version
+  EXPECT_FALSE(cache.ApplyHeartbeat(CreateHeartbeat(3, { { "1", 2 }, { "3", 1 } }), always, refresh));
+
+  // lost samples at the end of a refresh
+  EXPECT_FALSE(cache.ApplyHeartbeat(CreateHeartbeat(4, { { "1", 1 }, { "3", 1 } }), always, refresh));
+
+  // full state
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("1", 5, 2)));
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("3", 6, 1)));
+  refresh.clear();
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(6, { { "1", 2 }, { "3", 1 } }), always, refresh));
+  EXPECT_EQ(2, refresh.size());
+}
+
+TEST(RegistrationDelta, LateJoin)
+{
+  eCAL::CRegistrationDeltaCache cache;
+  eCAL::CRegistrationDeltaCache::SampleListT refresh;
+
+  // the first heartbeat of a running process
+  EXPECT_FALSE(cache.ApplyHeartbeat(CreateHeartbeat(10, { { "1", 3 } }), always, refresh));
+  EXPECT_EQ(0, refresh.size());
+
+  // one resync request per interval
+  const std::string process_key = eCAL::Registration::GetProcessKey("host", 42);
+  EXPECT_TRUE (cache.AcquireResync(process_key, std::chrono::milliseconds(1000)));
+  EXPECT_FALSE(cache.AcquireResync(process_key, std::chrono::milliseconds(1000)));
+
+  // an unregistration removes the entity
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("1", 11, 3)));
+  EXPECT_TRUE(cache.ApplySample(CreateTopicSample("1", 12, 3, eCAL::pb::bct_unreg_publisher)));
+  EXPECT_TRUE(cache.ApplyHeartbeat(CreateHeartbeat(12, {}), always, refresh));
+  EXPECT_EQ(0, refresh.size());
+}
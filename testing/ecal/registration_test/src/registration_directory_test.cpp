@@ -0,0 +1,160 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2024 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "registration/ecal_registration_directory.h"
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  eCAL::pb::Sample CreateTopicSample(const std::string& topic_id_, long long dclock_, eCAL::pb::eCmdType cmd_type_ = eCAL::pb::bct_reg_publisher)
+  {
+    eCAL::pb::Sample sample;
+    sample.set_cmd_type(cmd_type_);
+    sample.mutable_topic()->set_hname("host");
+    sample.mutable_topic()->set_pid(42);
+    sample.mutable_topic()->set_tname("topic_" + topic_id_);
+    sample.mutable_topic()->set_tid(topic_id_);
+    sample.mutable_topic()->set_dclock(dclock_);
+    return sample;
+  }
+
+  // report unchanged slots on every read
+  const std::chrono::milliseconds always(0);
+
+  int Read(eCAL::CRegistrationDirectoryReader& reader_, const std::string& buffer_, eCAL::CRegistrationDirectoryReader::SampleListT& samples_, std::chrono::milliseconds refresh_interval_ = always)
+  {
+    return reader_.Read(buffer_.data(), buffer_.size(), refresh_interval_, samples_);
+  }
+}
+
+TEST(RegistrationDirectory, DecodeChangedSlots)
+{
+  eCAL::CRegistrationDirectoryWriter      writer;
+  eCAL::CRegistrationDirectoryReader      reader;
+  eCAL::CRegistrationDirectoryReader::SampleListT samples;
+
+  writer.Set("1", CreateTopicSample("1", 1), 1, false);
+  writer.Set("2", CreateTopicSample("2", 1), 1, false);
+  EXPECT_EQ(2, Read(reader, writer.GetBuffer(), samples));
+  EXPECT_EQ(2, samples.size());
+
+  // unchanged samples, nothing to decode
+  const std::chrono::milliseconds refresh_interval(std::chrono::hours(1));
+  writer.Set("1", CreateTopicSample("1", 1), 1, false);
+  writer.Set("2", CreateTopicSample("2", 1), 1, false);
+  EXPECT_EQ(0, Read(reader, writer.GetBuffer(), samples, refresh_interval));
+  EXPECT_EQ(0, samples.size());
+
+  // but reported again when they are due for refresh
+  EXPECT_EQ(0, Read(reader, writer.GetBuffer(), samples));
+  EXPECT_EQ(2, samples.size());
+
+  // new version of one entity
+  writer.Set("2", CreateTopicSample("2", 3), 2, false);
+  EXPECT_EQ(1, Read(reader, writer.GetBuffer(), samples));
+  ASSERT_EQ(2, samples.size());
+  for (const auto* sample : samples)
+  {
+    if (sample->topic().tid() == "2") EXPECT_EQ(3, sample->topic().dclock());
+    else                              EXPECT_EQ(1, sample->topic().dclock());
+  }
+}
+
+TEST(RegistrationDirectory, RefreshStatistics)
+{
+  eCAL::CRegistrationDirectoryWriter      writer;
+  eCAL::CRegistrationDirectoryReader      reader;
+  eCAL::CRegistrationDirectoryReader::SampleListT samples;
+  const std::chrono::milliseconds refresh_interval(std::chrono::hours(1));
+
+  writer.Set("1", CreateTopicSample("1", 1), 1, false);
+  writer.Set("2", CreateTopicSample("2", 1), 1, false);
+  EXPECT_EQ(2, Read(reader, writer.GetBuffer(), samples, refresh_interval));
+
+  // changed statistics are written without version change
+  writer.Set("1", CreateTopicSample("1", 5), 1, false);
+  writer.Set("2", CreateTopicSample("2", 1), 1, false);
+  EXPECT_EQ(1, Read(reader, writer.GetBuffer(), samples, refresh_interval));
+  ASSERT_EQ(1, samples.size());
+  EXPECT_EQ(5, samples[0]->topic().dclock());
+
+  // the registration clock only with a refresh
+  auto sample = CreateTopicSample("1", 5);
+  sample.mutable_topic()->set_rclock(2);
+  writer.Set("1", sample, 1, false);
+  EXPECT_EQ(0, Read(reader, writer.GetBuffer(), samples, refresh_interval));
+
+  writer.Set("1", sample, 1, true);
+  EXPECT_EQ(1, Read(reader, writer.GetBuffer(), samples, refresh_interval));
+  ASSERT_EQ(1, samples.size());
+  EXPECT_EQ(2, samples[0]->topic().rclock());
+}
+
+TEST(RegistrationDirectory, Unregister)
+{
+  eCAL::CRegistrationDirectoryWriter      writer;
+  eCAL::CRegistrationDirectoryReader      reader;
+  eCAL::CRegistrationDirectoryReader::SampleListT samples;
+
+  writer.Set("1", CreateTopicSample("1", 1), 1, false);
+  writer.Set("2", CreateTopicSample("2", 1), 1, false);
+  EXPECT_EQ(2, Read(reader, writer.GetBuffer(), samples));
+
+  // the unregistration sample is reported until the slot is removed
+  writer.Unregister("1", CreateTopicSample("1", 1, eCAL::pb::bct_unreg_publisher));
+  EXPECT_EQ(1, Read(reader, writer.GetBuffer(), samples));
+  ASSERT_EQ(2, samples.size());
+  bool unregistered(false);
+  for (const auto* sample : samples) unregistered |= (sample->cmd_type() == eCAL::pb::bct_unreg_publisher);
+  EXPECT_TRUE(unregistered);
+
+  writer.RemoveUnregistered();
+  writer.Remove("2");
+  EXPECT_EQ(0, Read(reader, writer.GetBuffer(), samples));
+  EXPECT_EQ(0, samples.size());
+
+  // a new registration with the same key is decoded again
+  writer.Set("1", CreateTopicSample("1", 1), 1, false);
+  EXPECT_EQ(1, Read(reader, writer.GetBuffer(), samples));
+  EXPECT_EQ(1, samples.size());
+}
+
+TEST(RegistrationDirectory, InvalidBuffer)
+{
+  eCAL::CRegistrationDirectoryReader      reader;
+  eCAL::CRegistrationDirectoryReader::SampleListT samples;
+
+  EXPECT_EQ(-1, Read(reader, std::string(), samples));
+  EXPECT_EQ(-1, Read(reader, std::string(64, 'x'), samples));
+
+  // sample list of an older eCAL version
+  eCAL::pb::SampleList sample_list;
+  *sample_list.add_samples() = CreateTopicSample("1", 1);
+  EXPECT_EQ(-1, Read(reader, sample_list.SerializeAsString(), samples));
+
+  // slot table exceeding the buffer
+  eCAL::CRegistrationDirectoryWriter writer;
+  writer.Set("1", CreateTopicSample("1", 1), 1, false);
+  const std::string& buffer = writer.GetBuffer();
+  EXPECT_EQ(-1, Read(reader, buffer.substr(0, sizeof(eCAL::Registration::SDirectoryHeader) + 4), samples));
+}
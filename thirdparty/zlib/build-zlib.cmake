@@ -1,5 +1,17 @@
-add_subdirectory(thirdparty/zlib/zlib)
-add_library(ZLIB::zlibstatic ALIAS zlibstatic)
-add_library(ZLIB::zlib ALIAS zlib)
+set(SKIP_INSTALL_ALL ON CACHE BOOL "My option" FORCE)
+add_subdirectory(thirdparty/zlib/zlib EXCLUDE_FROM_ALL)
 
-list(PREPEND CMAKE_MODULE_PATH ${CMAKE_CURRENT_LIST_DIR}/Modules)
\ No newline at end of file
+if (NOT TARGET ZLIB::zlibstatic)
+  add_library(ZLIB::zlibstatic ALIAS zlibstatic)
+  add_library(ZLIB::zlib ALIAS zlib)
+  get_target_property(is_imported zlibstatic IMPORTED)
+  if (NOT is_imported)
+    # Disable warnings for third-party lib
+    target_compile_options(zlibstatic PRIVATE
+      $<$<C_COMPILER_ID:MSVC>:/W0>
+      $<$<NOT:$<C_COMPILER_ID:MSVC>>:-w>
+    )
+  endif ()
+endif ()
+
+list(PREPEND CMAKE_MODULE_PATH ${CMAKE_CURRENT_LIST_DIR}/Modules)